@@ -26,7 +26,7 @@ AFish::AFish()
     , KillZ(-10.f)
     , Score(0)
 {
-    
+    PrimaryActorTick.bCanEverTick = true;
 }
 
 void AFish::PostSpawnInitialize()
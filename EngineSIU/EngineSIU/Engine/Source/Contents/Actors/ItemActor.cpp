@@ -7,6 +7,7 @@
 
 AItemActor::AItemActor()
 {
+    PrimaryActorTick.bCanEverTick = true;
 }
 
 void AItemActor::PostSpawnInitialize()
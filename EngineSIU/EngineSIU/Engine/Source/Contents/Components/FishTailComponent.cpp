@@ -5,6 +5,7 @@
 
 UFishTailComponent::UFishTailComponent()
 {
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 void UFishTailComponent::TickComponent(float DeltaTime)
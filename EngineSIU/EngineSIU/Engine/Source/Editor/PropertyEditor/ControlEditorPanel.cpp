@@ -185,8 +185,8 @@ void ControlEditorPanel::CreateMenuButton(const ImVec2 ButtonSize, ImFont* IconF
 
     if (ImGui::MenuItem("Load Level"))
     {
-        char const* lFilterPatterns[1] = { "*.scene" };
-        const char* FileName = tinyfd_openFileDialog("Open Scene File", "", 1, lFilterPatterns, "Scene(.scene) file", 0);
+        char const* lFilterPatterns[2] = { "*.scene", "*.scenebin" };
+        const char* FileName = tinyfd_openFileDialog("Open Scene File", "", 2, lFilterPatterns, "Scene(.scene, .scenebin) file", 0);
 
         if (FileName == nullptr)
         {
@@ -204,8 +204,8 @@ void ControlEditorPanel::CreateMenuButton(const ImVec2 ButtonSize, ImFont* IconF
 
     if (ImGui::MenuItem("Save Level"))
     {
-        char const* lFilterPatterns[1] = { "*.scene" };
-        const char* FileName = tinyfd_saveFileDialog("Save Scene File", "", 1, lFilterPatterns, "Scene(.scene) file");
+        char const* lFilterPatterns[2] = { "*.scene", "*.scenebin" };
+        const char* FileName = tinyfd_saveFileDialog("Save Scene File", "", 2, lFilterPatterns, "Scene(.scene, .scenebin) file");
 
         if (FileName == nullptr)
         {
@@ -1,6 +1,10 @@
 #include "SceneManager.h"
+#include <algorithm>
 #include <fstream>
+#include <iterator>
+#include <unordered_map>
 #include "EditorViewportClient.h"
+#include "Components/ComponentPropertyReader.h"
 #include "Engine/FObjLoader.h"
 #include "Engine/StaticMeshActor.h"
 #include "UObject/Casts.h"
@@ -9,7 +13,9 @@
 #include "UObject/ObjectGlobals.h"
 
 #include "JSON/json.hpp"
+#include "Serialization/MemoryArchive.h"
 #include "World/World.h"
+#include "WindowsMappedFile.h"
 
 using namespace NS_SceneManagerData;
 using json = nlohmann::json;
@@ -51,14 +57,27 @@ template <typename KeyType, typename ValueType, typename Allocator>
 [[maybe_unused]]
 static void to_json(json& Json, const TMap<KeyType, ValueType, Allocator>& Map)
 {
-    Json = Map.GetContainerPrivate();
+    std::unordered_map<KeyType, ValueType> StdMap;
+    StdMap.reserve(Map.Num());
+    for (const auto& [Key, Value] : Map)
+    {
+        StdMap.emplace(Key, Value);
+    }
+    Json = StdMap;
 }
 
 template <typename KeyType, typename ValueType, typename Allocator>
 [[maybe_unused]]
 static void from_json(const json& Json, TMap<KeyType, ValueType, Allocator>& Map)
 {
-    Json.get_to(Map.GetContainerPrivate());
+    std::unordered_map<KeyType, ValueType> StdMap;
+    Json.get_to(StdMap);
+
+    Map.Empty(StdMap.size());
+    for (auto& [Key, Value] : StdMap)
+    {
+        Map.Emplace(Key, std::move(Value));
+    }
 }
 #pragma endregion
 
@@ -72,6 +91,16 @@ struct FComponentSaveData
 
     TMap<FString, FString> Properties;
 
+    // 바이너리 형식에서 읽은 경우 Properties 대신 값으로 저장된 Property를 사용 (Json에는 저장하지 않음)
+    bool bTypedProperties = false;
+    TArray<FComponentPropertyValue> PropertyValues;
+
+    // SceneComponent의 Transform, 바이너리 형식에서는 Properties의 문자열 대신 이 값을 저장 (Json에는 저장하지 않음)
+    bool bHasTransform = false;
+    FVector RelativeLocation = FVector::ZeroVector;
+    FRotator RelativeRotation = FRotator::ZeroRotator;
+    FVector RelativeScale3D = FVector::OneVector;
+
     NLOHMANN_DEFINE_TYPE_INTRUSIVE(FComponentSaveData, ComponentID, ComponentClass, Properties)
 };
 
@@ -103,6 +132,214 @@ struct FSceneData
 };
 
 //TODO : 레벨 데이타 구현
+
+/**
+ * 바이너리 Scene 파일(.scenebin)의 구조
+ *
+ * [Header][Actor Records][Component Records][Property Records][String Offsets][String Data]
+ *
+ * - 각 구역의 위치는 Header의 Offset으로 찾고, 구역의 시작은 8 Byte로 정렬됨
+ * - Record는 고정 크기라서 매핑된 메모리에서 복사 없이 바로 읽음
+ * - 모든 문자열은 String Table에 한 번씩만 저장되고, Record는 문자열의 Index를 가짐
+ * - Actor는 자신의 Component 범위를, Component는 자신의 Property 범위를 가짐
+ * - Property는 타입(float, int, bool, vector, String Table Index)과 값을 가지며, 숫자로 바꿀 수 없는 값만 문자열로 저장됨
+ */
+constexpr uint32 SceneFileMagic = 0x53554953; // "SIUS"
+constexpr uint32 SceneFileVersion = 2;
+
+struct FSceneFileHeader
+{
+    uint32 Magic = SceneFileMagic;
+    uint32 FileVersion = SceneFileVersion;
+    int32 SceneVersion = 0;
+    int32 NextUUID = 0;
+
+    int32 NumActors = 0;
+    int32 NumComponents = 0;
+    int32 NumProperties = 0;
+    int32 NumStrings = 0;
+
+    int64 ActorsOffset = 0;
+    int64 ComponentsOffset = 0;
+    int64 PropertiesOffset = 0;
+    int64 StringOffsetsOffset = 0; // uint32[NumStrings + 1], String Data 기준 위치
+    int64 StringDataOffset = 0;
+    int64 FileSize = 0;
+
+    void Serialize(FArchive& Ar)
+    {
+        Ar << Magic << FileVersion << SceneVersion << NextUUID;
+        Ar << NumActors << NumComponents << NumProperties << NumStrings;
+        Ar << ActorsOffset << ComponentsOffset << PropertiesOffset << StringOffsetsOffset << StringDataOffset << FileSize;
+    }
+};
+
+enum ESceneComponentRecordFlags : uint32
+{
+    SCRF_None = 0,
+    SCRF_HasTransform = 1 << 0,
+};
+
+struct FSceneActorRecord
+{
+    int32 ActorID;
+    int32 ActorClass;
+    int32 ActorLabel;
+    int32 RootComponentID;
+    int32 FirstComponent;
+    int32 NumComponents;
+    uint32 bTickInEditor;
+    uint32 Reserved;
+};
+
+struct FSceneComponentRecord
+{
+    int32 ComponentID;
+    int32 ComponentClass;
+    int32 FirstProperty;
+    int32 NumProperties;
+    uint32 Flags;
+    float RelativeLocation[3];
+    float RelativeRotation[3]; // Pitch, Yaw, Roll
+    float RelativeScale3D[3];
+};
+
+struct FScenePropertyRecord
+{
+    int32 Key;
+    uint32 Type;   // EComponentPropertyType
+    float Floats[4];
+    int32 Value;   // Int, Bool 또는 String Table Index
+    uint32 Reserved;
+};
+
+static_assert(sizeof(FSceneActorRecord) % 8 == 0 && sizeof(FSceneComponentRecord) % 8 == 0 && sizeof(FScenePropertyRecord) % 8 == 0);
+
+/** Transform은 바이너리 형식에서 Record에 값으로 저장되므로 Property 문자열로는 저장하지 않음 */
+static bool IsTransformPropertyKey(const FString& Key)
+{
+    return Key == TEXT("RelativeLocation") || Key == TEXT("RelativeRotation") || Key == TEXT("RelativeScale3D");
+}
+
+/**
+ * Component의 Transform을 가져옵니다.
+ * 바이너리에서 읽은 값이 있으면 그대로 쓰고, 없으면(Json) Properties의 문자열을 파싱합니다.
+ * @return Transform 정보가 하나라도 있는지 여부
+ */
+static bool GetComponentTransform(const FComponentSaveData& ComponentData, FVector& OutLocation, FRotator& OutRotation, FVector& OutScale3D)
+{
+    if (ComponentData.bHasTransform)
+    {
+        OutLocation = ComponentData.RelativeLocation;
+        OutRotation = ComponentData.RelativeRotation;
+        OutScale3D = ComponentData.RelativeScale3D;
+        return true;
+    }
+
+    OutLocation = FVector::ZeroVector;
+    OutRotation = FRotator::ZeroRotator;
+    OutScale3D = FVector::OneVector;
+
+    bool bFound = false;
+    if (const FString* LocStr = ComponentData.Properties.Find(TEXT("RelativeLocation")))
+    {
+        bFound |= OutLocation.InitFromString(*LocStr);
+    }
+    if (const FString* RotatStr = ComponentData.Properties.Find(TEXT("RelativeRotation")))
+    {
+        bFound |= OutRotation.InitFromString(*RotatStr);
+    }
+    if (const FString* ScaleStr = ComponentData.Properties.Find(TEXT("RelativeScale3D")))
+    {
+        bFound |= OutScale3D.InitFromString(*ScaleStr);
+    }
+    return bFound;
+}
+
+/** Json이면 문자열 맵을, 바이너리면 값으로 저장된 Property를 읽는 Reader로 Func를 호출합니다. */
+template <typename FuncType>
+static void VisitPropertyReader(const FComponentSaveData& ComponentData, FuncType&& Func)
+{
+    if (ComponentData.bTypedProperties)
+    {
+        Func(FComponentPropertyValueReader(ComponentData.PropertyValues));
+    }
+    else
+    {
+        Func(FComponentPropertyMapReader(ComponentData.Properties));
+    }
+}
+
+/**
+ * Json에서 읽은 데이터와 바이너리에서 읽은 데이터가 같은 Scene인지 비교합니다.
+ * 바이너리 쪽의 Transform은 문자열 대신 값으로 비교하고, 나머지 Property는 값을 다시 문자열로 만들어 비교합니다.
+ */
+static bool IsSameSceneData(const FSceneData& Expected, const FSceneData& Actual)
+{
+    if (Expected.Version != Actual.Version || Expected.NextUUID != Actual.NextUUID || Expected.Actors.Num() != Actual.Actors.Num())
+    {
+        UE_LOG(ELogLevel::Warning, TEXT("Scene round trip mismatch: header or actor count"));
+        return false;
+    }
+
+    for (int32 ActorIndex = 0; ActorIndex < Expected.Actors.Num(); ++ActorIndex)
+    {
+        const FActorSaveData& ExpectedActor = Expected.Actors[ActorIndex];
+        const FActorSaveData& ActualActor = Actual.Actors[ActorIndex];
+        if (ExpectedActor.ActorID != ActualActor.ActorID
+            || ExpectedActor.ActorClass != ActualActor.ActorClass
+            || ExpectedActor.ActorLabel != ActualActor.ActorLabel
+            || ExpectedActor.ActorTickInEditor != ActualActor.ActorTickInEditor
+            || ExpectedActor.RootComponentID != ActualActor.RootComponentID
+            || ExpectedActor.Components.Num() != ActualActor.Components.Num())
+        {
+            UE_LOG(ELogLevel::Warning, TEXT("Scene round trip mismatch: Actor '%s'"), *ExpectedActor.ActorID);
+            return false;
+        }
+
+        for (int32 ComponentIndex = 0; ComponentIndex < ExpectedActor.Components.Num(); ++ComponentIndex)
+        {
+            const FComponentSaveData& ExpectedComponent = ExpectedActor.Components[ComponentIndex];
+            const FComponentSaveData& ActualComponent = ActualActor.Components[ComponentIndex];
+
+            FVector ExpectedLocation, ActualLocation, ExpectedScale, ActualScale;
+            FRotator ExpectedRotation, ActualRotation;
+            const bool bExpectedTransform = GetComponentTransform(ExpectedComponent, ExpectedLocation, ExpectedRotation, ExpectedScale);
+            GetComponentTransform(ActualComponent, ActualLocation, ActualRotation, ActualScale);
+
+            bool bSame = ExpectedComponent.ComponentID == ActualComponent.ComponentID
+                && ExpectedComponent.ComponentClass == ActualComponent.ComponentClass
+                && ExpectedLocation == ActualLocation
+                && ExpectedRotation == ActualRotation
+                && ExpectedScale == ActualScale;
+
+            // Transform이 값으로 옮겨진 경우, 나머지 Property만 남아 있어야 함
+            int32 NumExpectedProperties = 0;
+            VisitPropertyReader(ActualComponent, [&](const FComponentPropertyReader& ActualProperties)
+            {
+                for (const auto& [Key, Value] : ExpectedComponent.Properties)
+                {
+                    if (bExpectedTransform && ActualComponent.bHasTransform && IsTransformPropertyKey(Key))
+                    {
+                        continue;
+                    }
+
+                    FString ActualValue;
+                    bSame &= ActualProperties.Read(*Key, ActualValue) && ActualValue.Equals(Value);
+                    ++NumExpectedProperties;
+                }
+            });
+            bSame &= NumExpectedProperties == (ActualComponent.bTypedProperties ? ActualComponent.PropertyValues.Num() : ActualComponent.Properties.Num());
+
+            if (!bSame)
+            {
+                UE_LOG(ELogLevel::Warning, TEXT("Scene round trip mismatch: Actor '%s' Component '%s'"), *ExpectedActor.ActorID, *ExpectedComponent.ComponentID);
+                return false;
+            }
+        }
+    }
+    return true;
+}
 }
 
 
@@ -154,6 +391,109 @@ bool SceneManager::SaveSceneToJsonFile(const std::filesystem::path& FilePath, co
     return true;
 }
 
+bool SceneManager::LoadSceneFromBinaryFile(const std::filesystem::path& FilePath, UWorld& OutWorld)
+{
+    FMappedFile MappedFile;
+    if (!MappedFile.Open(FilePath))
+    {
+        UE_LOG(ELogLevel::Error, "Failed to open file for reading: %s", FilePath.string().c_str());
+        return false;
+    }
+
+    FSceneData SceneData;
+    if (!BinaryToSceneData(MappedFile.GetData(), MappedFile.GetSize(), SceneData))
+    {
+        UE_LOG(ELogLevel::Error, "Failed to parse scene data from file: %s", FilePath.string().c_str());
+        return false;
+    }
+
+    // 필요한 문자열은 모두 SceneData로 옮겨졌으므로 Actor를 생성하기 전에 매핑을 해제
+    MappedFile.Close();
+
+    return LoadWorldFromData(SceneData, &OutWorld);
+}
+
+bool SceneManager::SaveSceneToBinaryFile(const std::filesystem::path& FilePath, const UWorld& InWorld)
+{
+    TArray<uint8> BinaryData;
+    SceneDataToBinary(WorldToSceneData(InWorld), BinaryData);
+
+    std::ofstream OutFile(FilePath, std::ios::binary);
+    if (!OutFile)
+    {
+        UE_LOG(ELogLevel::Error, "Failed to open file for writing: %s", FilePath.string().c_str());
+        return false;
+    }
+
+    OutFile.write(reinterpret_cast<const char*>(BinaryData.GetData()), BinaryData.Num());
+    return OutFile.good();
+}
+
+bool SceneManager::IsBinarySceneFile(const std::filesystem::path& FilePath)
+{
+    return FilePath.extension() == ".scenebin";
+}
+
+bool SceneManager::ConvertJsonToBinaryFile(const std::filesystem::path& JsonFilePath, const std::filesystem::path& BinaryFilePath)
+{
+    FSceneData JsonSceneData;
+    if (!ReadSceneData(JsonFilePath, JsonSceneData))
+    {
+        return false;
+    }
+
+    TArray<uint8> BinaryData;
+    SceneDataToBinary(JsonSceneData, BinaryData);
+    {
+        std::ofstream OutFile(BinaryFilePath, std::ios::binary);
+        OutFile.write(reinterpret_cast<const char*>(BinaryData.GetData()), BinaryData.Num());
+        if (!OutFile.good())
+        {
+            UE_LOG(ELogLevel::Error, "Failed to open file for writing: %s", BinaryFilePath.string().c_str());
+            return false;
+        }
+    }
+
+    FSceneData BinarySceneData;
+    return ReadSceneData(BinaryFilePath, BinarySceneData) && IsSameSceneData(JsonSceneData, BinarySceneData);
+}
+
+bool SceneManager::ParseSceneFile(const std::filesystem::path& FilePath, int32& OutNumActors)
+{
+    FSceneData SceneData;
+    if (!ReadSceneData(FilePath, SceneData))
+    {
+        return false;
+    }
+    OutNumActors = SceneData.Actors.Num();
+    return true;
+}
+
+bool SceneManager::ReadSceneData(const std::filesystem::path& FilePath, FSceneData& OutSceneData)
+{
+    if (IsBinarySceneFile(FilePath))
+    {
+        FMappedFile MappedFile;
+        if (!MappedFile.Open(FilePath) || !BinaryToSceneData(MappedFile.GetData(), MappedFile.GetSize(), OutSceneData))
+        {
+            UE_LOG(ELogLevel::Error, "Failed to parse scene data from file: %s", FilePath.string().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    std::ifstream JsonFile(FilePath, std::ios::binary);
+    if (!JsonFile.is_open())
+    {
+        UE_LOG(ELogLevel::Error, "Failed to open file for reading: %s", FilePath.string().c_str());
+        return false;
+    }
+
+    FString JsonString;
+    JsonString.GetContainerPrivate().assign(std::istreambuf_iterator<char>(JsonFile), std::istreambuf_iterator<char>());
+    return JsonToSceneData(JsonString, OutSceneData);
+}
+
 bool SceneManager::JsonToSceneData(const FString& InJsonString, FSceneData& OutSceneData)
 {
     try
@@ -184,6 +524,309 @@ bool SceneManager::SceneDataToJson(const FSceneData& InSceneData, FString& OutJs
     return true;
 }
 
+void SceneManager::SceneDataToBinary(const FSceneData& InSceneData, TArray<uint8>& OutData)
+{
+    // 1. String Table과 Record를 만들고
+    TArray<const FString*> Strings;
+    TMap<FString, int32> StringIndices;
+    auto AddString = [&Strings, &StringIndices](const FString& String) -> int32
+    {
+        if (const int32* Found = StringIndices.Find(String))
+        {
+            return *Found;
+        }
+        const int32 Index = Strings.Add(&String);
+        StringIndices.Add(String, Index);
+        return Index;
+    };
+
+    TArray<FSceneActorRecord> ActorRecords;
+    TArray<FSceneComponentRecord> ComponentRecords;
+    TArray<FScenePropertyRecord> PropertyRecords;
+    ActorRecords.Reserve(InSceneData.Actors.Num());
+
+    for (const FActorSaveData& ActorData : InSceneData.Actors)
+    {
+        FSceneActorRecord& ActorRecord = ActorRecords[ActorRecords.Emplace()];
+        ActorRecord.ActorID = AddString(ActorData.ActorID);
+        ActorRecord.ActorClass = AddString(ActorData.ActorClass);
+        ActorRecord.ActorLabel = AddString(ActorData.ActorLabel);
+        ActorRecord.RootComponentID = AddString(ActorData.RootComponentID);
+        ActorRecord.FirstComponent = ComponentRecords.Num();
+        ActorRecord.NumComponents = ActorData.Components.Num();
+        ActorRecord.bTickInEditor = ActorData.ActorTickInEditor == TEXT("true");
+
+        for (const FComponentSaveData& ComponentData : ActorData.Components)
+        {
+            FSceneComponentRecord& ComponentRecord = ComponentRecords[ComponentRecords.Emplace()];
+            ComponentRecord.ComponentID = AddString(ComponentData.ComponentID);
+            ComponentRecord.ComponentClass = AddString(ComponentData.ComponentClass);
+
+            FVector Location, Scale3D;
+            FRotator Rotation;
+            const bool bHasTransform = GetComponentTransform(ComponentData, Location, Rotation, Scale3D);
+            if (bHasTransform)
+            {
+                ComponentRecord.Flags |= SCRF_HasTransform;
+                ComponentRecord.RelativeLocation[0] = Location.X;
+                ComponentRecord.RelativeLocation[1] = Location.Y;
+                ComponentRecord.RelativeLocation[2] = Location.Z;
+                ComponentRecord.RelativeRotation[0] = Rotation.Pitch;
+                ComponentRecord.RelativeRotation[1] = Rotation.Yaw;
+                ComponentRecord.RelativeRotation[2] = Rotation.Roll;
+                ComponentRecord.RelativeScale3D[0] = Scale3D.X;
+                ComponentRecord.RelativeScale3D[1] = Scale3D.Y;
+                ComponentRecord.RelativeScale3D[2] = Scale3D.Z;
+            }
+
+            // 값으로 저장할 수 있는 Property는 타입과 값을, 나머지는 String Table Index를 기록
+            assert(!ComponentData.bTypedProperties);
+            ComponentRecord.FirstProperty = PropertyRecords.Num();
+            for (const auto& [Key, Value] : ComponentData.Properties)
+            {
+                if (bHasTransform && IsTransformPropertyKey(Key))
+                {
+                    continue;
+                }
+
+                FComponentPropertyValue TypedValue;
+                const bool bTyped = TypedValue.TryParse(Value);
+
+                FScenePropertyRecord& PropertyRecord = PropertyRecords[PropertyRecords.Emplace()];
+                PropertyRecord.Key = AddString(Key);
+                PropertyRecord.Type = static_cast<uint32>(TypedValue.Type);
+                std::copy_n(TypedValue.Floats, 4, PropertyRecord.Floats);
+                PropertyRecord.Value = bTyped ? TypedValue.Int : AddString(Value);
+            }
+            ComponentRecord.NumProperties = PropertyRecords.Num() - ComponentRecord.FirstProperty;
+        }
+    }
+
+    TArray<uint32> StringOffsets;
+    StringOffsets.Reserve(Strings.Num() + 1);
+    std::string StringData;
+    for (const FString* String : Strings)
+    {
+        StringOffsets.Add(static_cast<uint32>(StringData.size()));
+        StringData.append(String->GetContainerPrivate().data(), String->GetContainerPrivate().size());
+    }
+    StringOffsets.Add(static_cast<uint32>(StringData.size()));
+
+    // 2. 각 구역의 위치를 정한 뒤
+    auto Align = [](int64 Offset) { return (Offset + 7) & ~static_cast<int64>(7); };
+
+    FSceneFileHeader Header;
+    Header.SceneVersion = InSceneData.Version;
+    Header.NextUUID = InSceneData.NextUUID;
+    Header.NumActors = ActorRecords.Num();
+    Header.NumComponents = ComponentRecords.Num();
+    Header.NumProperties = PropertyRecords.Num();
+    Header.NumStrings = Strings.Num();
+    Header.ActorsOffset = Align(sizeof(FSceneFileHeader));
+    Header.ComponentsOffset = Header.ActorsOffset + ActorRecords.Num() * sizeof(FSceneActorRecord);
+    Header.PropertiesOffset = Header.ComponentsOffset + ComponentRecords.Num() * sizeof(FSceneComponentRecord);
+    Header.StringOffsetsOffset = Header.PropertiesOffset + PropertyRecords.Num() * sizeof(FScenePropertyRecord);
+    Header.StringDataOffset = Align(Header.StringOffsetsOffset + StringOffsets.Num() * sizeof(uint32));
+    Header.FileSize = Header.StringDataOffset + static_cast<int64>(StringData.size());
+
+    // 3. 순서대로 기록
+    OutData.Empty();
+    OutData.Reserve(static_cast<int32>(Header.FileSize));
+    FMemoryWriter Writer(OutData);
+
+    auto WriteBytes = [&Writer](void* Data, int64 Length)
+    {
+        if (Length > 0)
+        {
+            Writer.Serialize(Data, Length);
+        }
+    };
+
+    Header.Serialize(Writer);
+    WriteBytes(ActorRecords.GetData(), ActorRecords.Num() * sizeof(FSceneActorRecord));
+    WriteBytes(ComponentRecords.GetData(), ComponentRecords.Num() * sizeof(FSceneComponentRecord));
+    WriteBytes(PropertyRecords.GetData(), PropertyRecords.Num() * sizeof(FScenePropertyRecord));
+    WriteBytes(StringOffsets.GetData(), StringOffsets.Num() * sizeof(uint32));
+
+    uint64 Padding = 0;
+    WriteBytes(&Padding, Header.StringDataOffset - OutData.Num());
+    WriteBytes(StringData.data(), static_cast<int64>(StringData.size()));
+
+    assert(OutData.Num() == Header.FileSize);
+}
+
+bool SceneManager::BinaryToSceneData(const uint8* Data, int64 Size, FSceneData& OutSceneData)
+{
+    if (Size < static_cast<int64>(sizeof(FSceneFileHeader)))
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Binary scene: file is too small"));
+        return false;
+    }
+
+    FSceneFileHeader Header;
+    FMemoryReaderView Reader(Data, Size);
+    Header.Serialize(Reader);
+
+    if (Header.Magic != SceneFileMagic)
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Binary scene: not a scene file"));
+        return false;
+    }
+    if (Header.FileVersion != SceneFileVersion)
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Binary scene: unsupported version %u (expected %u)"), Header.FileVersion, SceneFileVersion);
+        return false;
+    }
+
+    auto IsValidSection = [Size](int64 Offset, int64 Count, int64 ElementSize)
+    {
+        return Offset >= 0 && Offset % 8 == 0 && Count >= 0 && Offset + Count * ElementSize <= Size;
+    };
+
+    if (Header.FileSize != Size || Header.NumStrings < 0
+        || !IsValidSection(Header.ActorsOffset, Header.NumActors, sizeof(FSceneActorRecord))
+        || !IsValidSection(Header.ComponentsOffset, Header.NumComponents, sizeof(FSceneComponentRecord))
+        || !IsValidSection(Header.PropertiesOffset, Header.NumProperties, sizeof(FScenePropertyRecord))
+        || !IsValidSection(Header.StringOffsetsOffset, static_cast<int64>(Header.NumStrings) + 1, sizeof(uint32))
+        || !IsValidSection(Header.StringDataOffset, 0, 1))
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Binary scene: corrupted offset index"));
+        return false;
+    }
+
+    // Record는 고정 크기이고 정렬되어 있으므로 매핑된 메모리를 그대로 읽음
+    const FSceneActorRecord* ActorRecords = reinterpret_cast<const FSceneActorRecord*>(Data + Header.ActorsOffset);
+    const FSceneComponentRecord* ComponentRecords = reinterpret_cast<const FSceneComponentRecord*>(Data + Header.ComponentsOffset);
+    const FScenePropertyRecord* PropertyRecords = reinterpret_cast<const FScenePropertyRecord*>(Data + Header.PropertiesOffset);
+    const uint32* StringOffsets = reinterpret_cast<const uint32*>(Data + Header.StringOffsetsOffset);
+    const char* StringData = reinterpret_cast<const char*>(Data + Header.StringDataOffset);
+    const int64 StringDataSize = Size - Header.StringDataOffset;
+
+    for (int32 Index = 0; Index < Header.NumStrings; ++Index)
+    {
+        if (StringOffsets[Index] > StringOffsets[Index + 1])
+        {
+            UE_LOG(ELogLevel::Error, TEXT("Binary scene: corrupted string table"));
+            return false;
+        }
+    }
+    if (StringOffsets[Header.NumStrings] > StringDataSize)
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Binary scene: corrupted string table"));
+        return false;
+    }
+
+    bool bValid = true;
+    auto ReadString = [&](int32 Index, FString& OutString)
+    {
+        if (Index < 0 || Index >= Header.NumStrings)
+        {
+            bValid = false;
+            return;
+        }
+        OutString.GetContainerPrivate().assign(StringData + StringOffsets[Index], StringOffsets[Index + 1] - StringOffsets[Index]);
+    };
+
+    // Property Key는 종류가 적으므로 String Table Index마다 FName을 한 번만 만듦
+    TArray<FName> KeyNames;
+    KeyNames.SetNum(Header.NumStrings);
+    auto ReadKeyName = [&](int32 Index, FName& OutName)
+    {
+        if (Index < 0 || Index >= Header.NumStrings)
+        {
+            bValid = false;
+            return;
+        }
+        if (KeyNames[Index] == NAME_None)
+        {
+            FString KeyString;
+            ReadString(Index, KeyString);
+            KeyNames[Index] = FName(KeyString);
+        }
+        OutName = KeyNames[Index];
+    };
+
+    OutSceneData.Version = Header.SceneVersion;
+    OutSceneData.NextUUID = Header.NextUUID;
+    OutSceneData.Actors.Empty();
+    OutSceneData.Actors.Reserve(Header.NumActors);
+
+    for (int32 ActorIndex = 0; ActorIndex < Header.NumActors && bValid; ++ActorIndex)
+    {
+        const FSceneActorRecord& ActorRecord = ActorRecords[ActorIndex];
+        if (ActorRecord.FirstComponent < 0 || ActorRecord.NumComponents < 0
+            || ActorRecord.FirstComponent + static_cast<int64>(ActorRecord.NumComponents) > Header.NumComponents)
+        {
+            bValid = false;
+            break;
+        }
+
+        FActorSaveData& ActorData = OutSceneData.Actors[OutSceneData.Actors.Emplace()];
+        ReadString(ActorRecord.ActorID, ActorData.ActorID);
+        ReadString(ActorRecord.ActorClass, ActorData.ActorClass);
+        ReadString(ActorRecord.ActorLabel, ActorData.ActorLabel);
+        ReadString(ActorRecord.RootComponentID, ActorData.RootComponentID);
+        ActorData.ActorTickInEditor = ActorRecord.bTickInEditor ? TEXT("true") : TEXT("false");
+
+        ActorData.Components.SetNum(ActorRecord.NumComponents);
+        for (int32 Index = 0; Index < ActorRecord.NumComponents && bValid; ++Index)
+        {
+            const FSceneComponentRecord& ComponentRecord = ComponentRecords[ActorRecord.FirstComponent + Index];
+            if (ComponentRecord.FirstProperty < 0 || ComponentRecord.NumProperties < 0
+                || ComponentRecord.FirstProperty + static_cast<int64>(ComponentRecord.NumProperties) > Header.NumProperties)
+            {
+                bValid = false;
+                break;
+            }
+
+            FComponentSaveData& ComponentData = ActorData.Components[Index];
+            ReadString(ComponentRecord.ComponentID, ComponentData.ComponentID);
+            ReadString(ComponentRecord.ComponentClass, ComponentData.ComponentClass);
+
+            if (ComponentRecord.Flags & SCRF_HasTransform)
+            {
+                ComponentData.bHasTransform = true;
+                ComponentData.RelativeLocation = FVector(ComponentRecord.RelativeLocation[0], ComponentRecord.RelativeLocation[1], ComponentRecord.RelativeLocation[2]);
+                ComponentData.RelativeRotation = FRotator(ComponentRecord.RelativeRotation[0], ComponentRecord.RelativeRotation[1], ComponentRecord.RelativeRotation[2]);
+                ComponentData.RelativeScale3D = FVector(ComponentRecord.RelativeScale3D[0], ComponentRecord.RelativeScale3D[1], ComponentRecord.RelativeScale3D[2]);
+            }
+
+            // 문자열 맵을 만들지 않고 값 그대로 옮겨서, 컴포넌트가 FComponentPropertyValueReader로 바로 읽도록 함
+            ComponentData.bTypedProperties = true;
+            ComponentData.PropertyValues.SetNum(ComponentRecord.NumProperties);
+            for (int32 PropertyIndex = 0; PropertyIndex < ComponentRecord.NumProperties && bValid; ++PropertyIndex)
+            {
+                const FScenePropertyRecord& PropertyRecord = PropertyRecords[ComponentRecord.FirstProperty + PropertyIndex];
+                if (PropertyRecord.Type >= static_cast<uint32>(EComponentPropertyType::Max))
+                {
+                    bValid = false;
+                    break;
+                }
+
+                FComponentPropertyValue& Value = ComponentData.PropertyValues[PropertyIndex];
+                ReadKeyName(PropertyRecord.Key, Value.Key);
+                Value.Type = static_cast<EComponentPropertyType>(PropertyRecord.Type);
+                std::copy_n(PropertyRecord.Floats, 4, Value.Floats);
+                if (Value.Type == EComponentPropertyType::String)
+                {
+                    ReadString(PropertyRecord.Value, Value.String);
+                }
+                else
+                {
+                    Value.Int = PropertyRecord.Value;
+                }
+            }
+        }
+    }
+
+    if (!bValid)
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Binary scene: corrupted record"));
+        return false;
+    }
+    return true;
+}
+
 FSceneData SceneManager::WorldToSceneData(const UWorld& InWorld)
 {
     FSceneData sceneData;
@@ -213,6 +856,15 @@ FSceneData SceneManager::WorldToSceneData(const UWorld& InWorld)
             
             //TMap<FString, FString> InProperties;
             Component->GetProperties(componentData.Properties);
+
+            // 바이너리 형식은 문자열 대신 이 값을 저장
+            if (const USceneComponent* SceneComp = Cast<USceneComponent>(Component))
+            {
+                componentData.bHasTransform = true;
+                componentData.RelativeLocation = SceneComp->GetRelativeLocation();
+                componentData.RelativeRotation = SceneComp->GetRelativeRotation();
+                componentData.RelativeScale3D = SceneComp->GetRelativeScale3D();
+            }
             
             // 컴포넌트의 속성들을 JSON으로 변환하여 저장
             // for (const auto& Property : InProperties)
@@ -358,7 +1010,10 @@ bool SceneManager::LoadWorldFromData(const FSceneData& sceneData, UWorld* target
             {
                 // 1.4. 컴포넌트 속성 설정 (공통 로직)
                 //ApplyComponentProperties(TargetComponent, componentData.Properties);
-                TargetComponent->SetProperties( componentData.Properties); // 태그 설정 (ID로 사용)
+                VisitPropertyReader(componentData, [TargetComponent](const FComponentPropertyReader& Properties)
+                {
+                    TargetComponent->SetProperties(Properties);
+                });
 
                 // 1.5. *** 수정: 복합 키를 사용하여 컴포넌트 맵에 추가 ***
                 //FString CompositeKey = actorData.ActorID + TEXT("::") + componentData.ComponentID; // 예: "MyActor1::MeshComponent"
@@ -391,39 +1046,36 @@ bool SceneManager::LoadWorldFromData(const FSceneData& sceneData, UWorld* target
             USceneComponent* CurrentSceneComp = Cast<USceneComponent>(*FoundCompPtr);
             if (CurrentSceneComp == nullptr) continue; // SceneComponent만 부착/트랜스폼 가능
 
-            // 부착 정보 찾기 (Properties 맵 사용)
-            const FString* ParentIDPtr = componentData.Properties.Find(TEXT("AttachParentID"));
-            if (ParentIDPtr && !ParentIDPtr->IsEmpty() && *ParentIDPtr != TEXT("nullptr"))
+            // 부착 정보 찾기
+            FString ParentID;
+            VisitPropertyReader(componentData, [&ParentID](const FComponentPropertyReader& Properties)
+            {
+                Properties.Read(TEXT("AttachParentID"), ParentID);
+            });
+            if (!ParentID.IsEmpty() && ParentID != TEXT("nullptr"))
             {
                 // !!! 부모 검색 범위를 ActorComponentsMap (현재 액터의 컴포넌트)으로 한정 !!!
-                UActorComponent** FoundParentCompPtr = ActorComponentsMap.Find(*ParentIDPtr);
+                UActorComponent** FoundParentCompPtr = ActorComponentsMap.Find(ParentID);
                 if (FoundParentCompPtr && *FoundParentCompPtr)
                 {
                     USceneComponent* ParentSceneComp = Cast<USceneComponent>(*FoundParentCompPtr);
                     if (ParentSceneComp) {
                         // 부착 실행 (SetupAttachment 대신 AttachToComponent 권장 - 규칙 명시 가능)
                         CurrentSceneComp->SetupAttachment(ParentSceneComp);
-                        UE_LOG(ELogLevel::Display, TEXT("Attached Component '%s' to Parent '%s' in Actor '%s'"), *componentData.ComponentID, *(*ParentIDPtr), *actorData.ActorID);
+                        UE_LOG(ELogLevel::Display, TEXT("Attached Component '%s' to Parent '%s' in Actor '%s'"), *componentData.ComponentID, *ParentID, *actorData.ActorID);
                     }
                     else { /* 부모가 SceneComponent 아님 경고 */ }
                 }
                 else {
                     // 부모 컴포넌트를 이 액터 내에서 찾지 못함 (오류 가능성 높음)
-                    UE_LOG(ELogLevel::Warning, TEXT("Could not find Parent component '%s' within Actor '%s' for '%s'."), *(*ParentIDPtr), *actorData.ActorID, *componentData.ComponentID);
+                    UE_LOG(ELogLevel::Warning, TEXT("Could not find Parent component '%s' within Actor '%s' for '%s'."), *ParentID, *actorData.ActorID, *componentData.ComponentID);
                 }
             }
 
-            FVector RelativeLocation = FVector::ZeroVector;
-            const FString* LocStr = componentData.Properties.Find(TEXT("RelativeLocation"));
-            if (LocStr) RelativeLocation.InitFromString(*LocStr); // 또는 직접 파싱
-
+            // Json은 문자열을 파싱하고, 바이너리는 저장된 값을 그대로 사용
+            FVector RelativeLocation, RelativeScale3D;
             FRotator RelativeRotation;
-            const FString* RotatStr = componentData.Properties.Find(TEXT("RelativeRotation")); // 쿼터니언 저장/로드 권장
-            if (RotatStr) RelativeRotation.InitFromString(*RotatStr);
-
-            FVector RelativeScale3D = FVector::OneVector;
-            const FString* ScaleStr = componentData.Properties.Find(TEXT("RelativeScale3D")); // 스케일 키 이름 확인! (GetProperties와 일치해야 함)
-            if (ScaleStr) RelativeScale3D.InitFromString(*ScaleStr);
+            GetComponentTransform(componentData, RelativeLocation, RelativeRotation, RelativeScale3D);
 
             CurrentSceneComp->SetRelativeLocation(RelativeLocation);
             CurrentSceneComp->SetRelativeRotation(RelativeRotation);
@@ -1,6 +1,7 @@
 #pragma once
 #include <filesystem>
 #include <string>
+#include "Container/Array.h"
 
 class FString;
 class UWorld;
@@ -30,6 +31,35 @@ public:
      */
     static bool SaveSceneToJsonFile(const std::filesystem::path& FilePath, const UWorld& InWorld);
 
+    /**
+     * 바이너리(.scenebin) 형식으로 저장된 World파일을 불러옵니다.
+     * 파일을 메모리에 매핑해서 읽고, 문자열은 파일 안의 String Table에서 바로 가져옵니다.
+     * @return 파일이 없거나 형식, 버전이 맞지 않으면 false
+     */
+    static bool LoadSceneFromBinaryFile(const std::filesystem::path& FilePath, UWorld& OutWorld);
+
+    /**
+     * World를 바이너리 형식으로 저장합니다.
+     * @return 성공적으로 저장되었는지 여부
+     */
+    static bool SaveSceneToBinaryFile(const std::filesystem::path& FilePath, const UWorld& InWorld);
+
+    /** 바이너리 형식의 확장자(.scenebin)인지 확인합니다. */
+    static bool IsBinarySceneFile(const std::filesystem::path& FilePath);
+
+    /**
+     * Json 파일을 바이너리(.scenebin) 파일로 변환합니다. World를 거치지 않고 Scene 데이터만 옮깁니다.
+     * @return 저장한 바이너리 파일을 다시 읽은 결과가 Json과 같은지(Round Trip) 여부
+     */
+    static bool ConvertJsonToBinaryFile(const std::filesystem::path& JsonFilePath, const std::filesystem::path& BinaryFilePath);
+
+    /**
+     * Scene 파일을 읽어 데이터로만 변환하고 World에는 올리지 않습니다. 형식은 확장자로 구분합니다.
+     * @param OutNumActors 읽은 Actor 수
+     * @return 파일이 없거나 형식이 맞지 않으면 false
+     */
+    static bool ParseSceneFile(const std::filesystem::path& FilePath, int32& OutNumActors);
+
 private:
     /**
      * JSON 문자열을 역직렬화하여 FSceneData를 생성합니다.
@@ -54,12 +84,22 @@ private:
     static bool LoadWorldFromData(const NS_SceneManagerData::FSceneData& sceneData, UWorld* targetWorld);
 
 private:
-    // TODO: IFileManager::Get().CreateFileReader() & Writer() 만들면 여기에 추가
-    // static void DeserializeFromBinary(const void* Data, int64 Size, NS_SceneManagerData::FSceneData& OutSceneData);
-    // or 중간 구조체 사용 안할경우
-    // static UWorld* DeserializeFromBinary(const void* Data, int64 Size);
-
-    // static TArray<uint8> SerializeToBinary(const NS_SceneManagerData::FSceneData& SceneData);
-    // or 중간 구조체 사용 안할경우
-    // static TArray<uint8> SerializeToBinary(UWorld* World);
+    /** Scene 파일을 확장자에 맞는 형식으로 읽어 FSceneData를 만듭니다. */
+    static bool ReadSceneData(const std::filesystem::path& FilePath, NS_SceneManagerData::FSceneData& OutSceneData);
+
+    /**
+     * FSceneData를 바이너리 형식으로 직렬화합니다.
+     * SceneComponent의 Transform과 숫자, 벡터 Property는 문자열 대신 값으로 저장됩니다.
+     */
+    static void SceneDataToBinary(const NS_SceneManagerData::FSceneData& InSceneData, TArray<uint8>& OutData);
+
+    /**
+     * 바이너리 형식의 메모리를 읽어 FSceneData를 만듭니다.
+     * 모든 Offset과 Index의 범위를 검사하므로 손상된 파일도 안전하게 거부합니다.
+     * Property는 문자열 맵 대신 PropertyValues에 값 그대로 옮겨지고, 컴포넌트는 이를 FComponentPropertyValueReader로 읽습니다.
+     *
+     * @param Data 파일 전체 (매핑된 메모리)
+     * @return 성공 여부
+     */
+    static bool BinaryToSceneData(const uint8* Data, int64 Size, NS_SceneManagerData::FSceneData& OutSceneData);
 };
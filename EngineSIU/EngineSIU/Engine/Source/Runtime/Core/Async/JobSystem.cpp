@@ -0,0 +1,371 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+
+struct FJob
+{
+    std::function<void()> Task;
+
+    /** 끝나지 않은 선행 작업 수 + 1, Submit이 등록을 마칠 때 1을 내리며 0이 되면 대기열에 들어감 */
+    std::atomic<int32> PendingCount = 1;
+
+    std::atomic<bool> bFinished = false;
+
+    /** Dependents와 bFinished 변경을 함께 보호 */
+    std::mutex Mutex;
+    TArray<FJobHandle> Dependents;
+};
+
+namespace
+{
+struct FWorkerQueue
+{
+    std::mutex Mutex;
+    std::deque<FJobHandle> Jobs;
+};
+
+/** 0번은 메인 스레드(그리고 워커가 아닌 모든 스레드), 1번부터 워커 */
+TArray<std::unique_ptr<FWorkerQueue>> Queues;
+TArray<std::thread> Workers;
+
+/** SubmitBackground로 등록된 작업, 워커만 가져감 */
+FWorkerQueue BackgroundQueue;
+
+std::atomic<int32> NumQueuedJobs = 0;
+std::atomic<bool> bStopWorkers = false;
+
+std::mutex SleepMutex;
+std::condition_variable SleepCondition;
+
+thread_local int32 CurrentQueueIndex = 0;
+
+/** 현재 스레드에서 실행 중인 작업의 중첩 깊이 */
+thread_local int32 JobDepth = 0;
+
+struct FJobDepthScope
+{
+    FJobDepthScope() { ++JobDepth; }
+    ~FJobDepthScope() { --JobDepth; }
+};
+
+void ExecuteJob(const FJobHandle& Job);
+
+void EnqueueJob(const FJobHandle& Job)
+{
+    if (Workers.Num() == 0)
+    {
+        ExecuteJob(Job);
+        return;
+    }
+
+    FWorkerQueue& Queue = *Queues[CurrentQueueIndex];
+    {
+        std::lock_guard Lock(Queue.Mutex);
+        Queue.Jobs.push_back(Job);
+    }
+    NumQueuedJobs.fetch_add(1);
+
+    // 잠든 워커가 조건 확인과 wait 사이에서 알림을 놓치지 않도록 한 번 잠갔다 풂
+    {
+        std::lock_guard Lock(SleepMutex);
+    }
+    SleepCondition.notify_one();
+}
+
+void ExecuteJob(const FJobHandle& Job)
+{
+    if (Job->Task)
+    {
+        FJobDepthScope DepthScope;
+        Job->Task();
+        Job->Task = nullptr;
+    }
+
+    TArray<FJobHandle> Dependents;
+    {
+        std::lock_guard Lock(Job->Mutex);
+        Job->bFinished.store(true);
+        Dependents = std::move(Job->Dependents);
+    }
+
+    for (const FJobHandle& Dependent : Dependents)
+    {
+        if (Dependent->PendingCount.fetch_sub(1) == 1)
+        {
+            EnqueueJob(Dependent);
+        }
+    }
+}
+
+/** 백그라운드 대기열의 앞에서 작업 하나를 꺼내 실행합니다. */
+bool TryExecuteBackground()
+{
+    FJobHandle Job;
+    {
+        std::lock_guard Lock(BackgroundQueue.Mutex);
+        if (BackgroundQueue.Jobs.empty())
+        {
+            return false;
+        }
+        Job = std::move(BackgroundQueue.Jobs.front());
+        BackgroundQueue.Jobs.pop_front();
+    }
+
+    NumQueuedJobs.fetch_sub(1);
+    ExecuteJob(Job);
+    return true;
+}
+
+/** 자기 덱의 뒤, 없으면 다른 덱의 앞에서 작업 하나를 꺼내 실행합니다. */
+bool TryExecuteOne()
+{
+    const int32 NumQueues = Queues.Num();
+    if (NumQueues == 0)
+    {
+        return false;
+    }
+
+    FJobHandle Job;
+    {
+        FWorkerQueue& Own = *Queues[CurrentQueueIndex];
+        std::lock_guard Lock(Own.Mutex);
+        if (!Own.Jobs.empty())
+        {
+            Job = std::move(Own.Jobs.back());
+            Own.Jobs.pop_back();
+        }
+    }
+
+    for (int32 Offset = 1; !Job && Offset < NumQueues; ++Offset)
+    {
+        FWorkerQueue& Victim = *Queues[(CurrentQueueIndex + Offset) % NumQueues];
+        std::lock_guard Lock(Victim.Mutex);
+        if (!Victim.Jobs.empty())
+        {
+            Job = std::move(Victim.Jobs.front());
+            Victim.Jobs.pop_front();
+        }
+    }
+
+    if (!Job)
+    {
+        return false;
+    }
+
+    NumQueuedJobs.fetch_sub(1);
+    ExecuteJob(Job);
+    return true;
+}
+
+void WorkerMain(int32 QueueIndex)
+{
+    CurrentQueueIndex = QueueIndex;
+
+    while (!bStopWorkers.load())
+    {
+        if (TryExecuteOne() || TryExecuteBackground())
+        {
+            continue;
+        }
+
+        std::unique_lock Lock(SleepMutex);
+        SleepCondition.wait(Lock, [] { return bStopWorkers.load() || NumQueuedJobs.load() > 0; });
+    }
+}
+}
+
+
+void FJobSystem::Initialize(int32 NumWorkers)
+{
+    Shutdown();
+
+    NumWorkers = std::max(NumWorkers, 0);
+
+    bStopWorkers.store(false);
+    Queues.Empty();
+    for (int32 i = 0; i < NumWorkers + 1; ++i)
+    {
+        Queues.Add(std::make_unique<FWorkerQueue>());
+    }
+
+    for (int32 i = 0; i < NumWorkers; ++i)
+    {
+        Workers.Emplace(WorkerMain, i + 1);
+    }
+}
+
+void FJobSystem::Shutdown()
+{
+    if (Workers.Num() == 0)
+    {
+        return;
+    }
+
+    // 대기열에 남은 작업은 워커와 함께 모두 처리한 뒤 종료
+    while (TryExecuteOne() || TryExecuteBackground())
+    {
+    }
+
+    {
+        std::lock_guard Lock(SleepMutex);
+        bStopWorkers.store(true);
+    }
+    SleepCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.Empty();
+
+    while (TryExecuteOne() || TryExecuteBackground())
+    {
+    }
+    Queues.Empty();
+    NumQueuedJobs.store(0);
+}
+
+int32 FJobSystem::GetNumWorkers()
+{
+    return Workers.Num();
+}
+
+FJobHandle FJobSystem::Submit(std::function<void()> Task, const TArray<FJobHandle>& Prerequisites)
+{
+    FJobHandle Job = std::make_shared<FJob>();
+    Job->Task = std::move(Task);
+
+    for (const FJobHandle& Prerequisite : Prerequisites)
+    {
+        if (!Prerequisite)
+        {
+            continue;
+        }
+
+        std::lock_guard Lock(Prerequisite->Mutex);
+        if (!Prerequisite->bFinished.load())
+        {
+            Job->PendingCount.fetch_add(1);
+            Prerequisite->Dependents.Add(Job);
+        }
+    }
+
+    // 등록 중에 선행 작업이 끝나도 실행되지 않도록 잡아둔 1을 해제
+    if (Job->PendingCount.fetch_sub(1) == 1)
+    {
+        EnqueueJob(Job);
+    }
+
+    return Job;
+}
+
+FJobHandle FJobSystem::SubmitBackground(std::function<void()> Task)
+{
+    FJobHandle Job = std::make_shared<FJob>();
+    Job->Task = std::move(Task);
+    Job->PendingCount.store(0);
+
+    if (Workers.Num() == 0)
+    {
+        ExecuteJob(Job);
+        return Job;
+    }
+
+    {
+        std::lock_guard Lock(BackgroundQueue.Mutex);
+        BackgroundQueue.Jobs.push_back(Job);
+    }
+    NumQueuedJobs.fetch_add(1);
+
+    {
+        std::lock_guard Lock(SleepMutex);
+    }
+    SleepCondition.notify_one();
+
+    return Job;
+}
+
+bool FJobSystem::IsInsideJob()
+{
+    return JobDepth > 0;
+}
+
+bool FJobSystem::IsComplete(const FJobHandle& Handle)
+{
+    return !Handle || Handle->bFinished.load();
+}
+
+void FJobSystem::Wait(const FJobHandle& Handle)
+{
+    while (!IsComplete(Handle))
+    {
+        if (!TryExecuteOne())
+        {
+            // 남은 작업이 다른 스레드에서 실행 중
+            std::this_thread::yield();
+        }
+    }
+}
+
+void FJobSystem::WaitAll(const TArray<FJobHandle>& Handles)
+{
+    for (const FJobHandle& Handle : Handles)
+    {
+        Wait(Handle);
+    }
+}
+
+void FJobSystem::ParallelFor(int32 Num, const std::function<void(int32)>& Body, int32 MinBatchSize)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    MinBatchSize = std::max(MinBatchSize, 1);
+
+    // 스틸링으로 부하가 고르게 퍼지도록 스레드 수보다 조금 잘게 나눔
+    const int32 MaxBatches = (Workers.Num() + 1) * 4;
+    const int32 NumBatches = std::min((Num + MinBatchSize - 1) / MinBatchSize, MaxBatches);
+    if (NumBatches <= 1 || Workers.Num() == 0)
+    {
+        FJobDepthScope DepthScope;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Body(Index);
+        }
+        return;
+    }
+
+    const int32 BatchSize = (Num + NumBatches - 1) / NumBatches;
+
+    TArray<FJobHandle> Batches;
+    int32 Start = 0;
+    for (; Start + BatchSize < Num; Start += BatchSize)
+    {
+        const int32 End = Start + BatchSize;
+        Batches.Add(Submit([&Body, Start, End]
+        {
+            for (int32 Index = Start; Index < End; ++Index)
+            {
+                Body(Index);
+            }
+        }));
+    }
+
+    {
+        FJobDepthScope DepthScope;
+        for (int32 Index = Start; Index < Num; ++Index)
+        {
+            Body(Index);
+        }
+    }
+
+    WaitAll(Batches);
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <functional>
+#include <memory>
+
+#include "HAL/PlatformType.h"
+#include "Container/Array.h"
+
+struct FJob;
+
+/** Submit이 돌려주는 작업 핸들, 선행 작업 지정과 Wait에 사용합니다. */
+using FJobHandle = std::shared_ptr<FJob>;
+
+
+/**
+ * 워커 스레드마다 작업 덱을 두는 워크 스틸링 잡 시스템입니다.
+ * 소유 스레드는 덱의 뒤에서(LIFO) 꺼내고, 일이 없는 스레드는 다른 덱의 앞에서(FIFO) 훔쳐갑니다.
+ * Wait를 호출한 스레드도 대기하는 동안 남은 작업을 실행하므로 작업 안에서 다시 Wait/ParallelFor를 호출해도 됩니다.
+ * 워커가 0개면 모든 작업은 Submit 시점에 호출 스레드에서 바로 실행됩니다.
+ */
+class FJobSystem
+{
+public:
+    /**
+     * 워커 스레드를 생성합니다. 이미 초기화되어 있으면 종료 후 다시 생성합니다.
+     * @param NumWorkers 메인 스레드를 제외한 워커 수
+     */
+    static void Initialize(int32 NumWorkers);
+
+    /** 남은 작업을 모두 실행한 뒤 워커 스레드를 종료합니다. */
+    static void Shutdown();
+
+    static int32 GetNumWorkers();
+
+    /**
+     * 작업을 등록합니다. 선행 작업이 모두 끝난 뒤에 실행 대기열에 들어갑니다.
+     * @param Task 실행할 함수
+     * @param Prerequisites 먼저 끝나야 하는 작업들, nullptr 핸들은 무시
+     * @return 등록된 작업의 핸들
+     */
+    static FJobHandle Submit(std::function<void()> Task, const TArray<FJobHandle>& Prerequisites = {});
+
+    /**
+     * 파일 로드처럼 오래 걸리는 작업을 등록합니다.
+     * 워커 스레드만 실행하며, 일반 작업이 없을 때만 가져가므로 Wait/ParallelFor 중인 스레드가 붙잡히지 않습니다.
+     * @param Task 실행할 함수
+     * @return 등록된 작업의 핸들
+     */
+    static FJobHandle SubmitBackground(std::function<void()> Task);
+
+    /**
+     * 현재 스레드가 작업이나 ParallelFor의 Body를 실행 중인지 여부
+     * 워커 수와 관계없이, 메인 스레드가 Wait 중에 대신 실행하거나 직접 실행하는 구간도 포함합니다.
+     */
+    static bool IsInsideJob();
+
+    /** 작업이 끝났는지 여부 */
+    static bool IsComplete(const FJobHandle& Handle);
+
+    /**
+     * 작업이 끝날 때까지 다른 작업을 실행하며 기다립니다.
+     * @param Handle 기다릴 작업, nullptr이면 바로 반환
+     */
+    static void Wait(const FJobHandle& Handle);
+
+    static void WaitAll(const TArray<FJobHandle>& Handles);
+
+    /**
+     * [0, Num) 구간을 나눠 병렬로 실행하고 모두 끝날 때까지 기다립니다. (배리어)
+     * 마지막 구간은 호출 스레드에서 직접 실행합니다.
+     * @param Num 반복 횟수
+     * @param Body 인덱스마다 호출할 함수
+     * @param MinBatchSize 한 작업이 처리할 최소 인덱스 수
+     */
+    static void ParallelFor(int32 Num, const std::function<void(int32)>& Body, int32 MinBatchSize = 1);
+};
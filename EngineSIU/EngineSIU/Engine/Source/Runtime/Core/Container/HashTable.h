@@ -0,0 +1,252 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "Array.h"
+#include "ContainerAllocator.h"
+
+
+/**
+ * TMap, TSet이 공유하는 Open Addressing 해시 테이블입니다.
+ * Element는 TArray에 빈틈없이 저장되고, 별도의 Bucket 배열(선형 탐사)이 Element의 Index를 가리킵니다.
+ *
+ * - Element 하나당 힙 할당이 없고, 순회는 배열을 그대로 훑습니다.
+ * - 제거 시 마지막 Element를 빈 자리로 옮기므로(swap-remove) 순서와 주소는 보장되지 않습니다.
+ * - Element를 추가/제거하면 기존 Element에 대한 포인터와 참조는 무효화될 수 있습니다.
+ *
+ * @tparam InElementType 저장할 Element 타입
+ * @tparam InKeyType Element에서 꺼낸 Key 타입
+ * @tparam KeyFuncs static const InKeyType& GetKey(const InElementType&)를 제공하는 타입
+ * @tparam Hasher Key의 해시 함수
+ * @tparam Allocator Element와 Bucket 배열에 사용할 Allocator (rebind 해서 사용)
+ */
+template <typename InElementType, typename InKeyType, typename KeyFuncs, typename Hasher, typename Allocator>
+class THashTable
+{
+public:
+    using ElementType = InElementType;
+    using KeyType = InKeyType;
+    using ElementAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<ElementType>;
+    using ElementArrayType = TArray<ElementType, ElementAllocator>;
+
+private:
+    struct FBucket
+    {
+        uint32 Hash = 0;
+        int32 Index = INDEX_NONE;
+    };
+
+    using BucketAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<FBucket>;
+
+    /** Bucket 배열 대비 최대 Element 비율 (3/4) */
+    static constexpr int32 MaxLoadNumerator = 3;
+    static constexpr int32 MaxLoadDenominator = 4;
+    static constexpr int32 MinBucketNum = 8;
+
+    ElementArrayType Elements;
+    TArray<FBucket, BucketAllocator> Buckets;
+
+public:
+    ElementType* GetData() { return Elements.GetData(); }
+    const ElementType* GetData() const { return Elements.GetData(); }
+
+    ElementType& operator[](int32 Index) { return Elements[Index]; }
+    const ElementType& operator[](int32 Index) const { return Elements[Index]; }
+
+    int32 Num() const { return static_cast<int32>(Elements.Num()); }
+    bool IsEmpty() const { return Elements.IsEmpty(); }
+
+    void Empty(int32 ExpectedNum = 0)
+    {
+        Elements.Empty();
+        Buckets.Empty();
+        Reserve(ExpectedNum);
+    }
+
+    void Reserve(int32 Number)
+    {
+        if (Number <= 0)
+        {
+            return;
+        }
+
+        Elements.Reserve(Number);
+
+        const int32 RequiredBucketNum = GetBucketNumForElements(Number);
+        if (RequiredBucketNum > Buckets.Num())
+        {
+            Rehash(RequiredBucketNum);
+        }
+    }
+
+    /** Key와 일치하는 Element의 Index를 반환합니다. 없으면 INDEX_NONE */
+    int32 FindIndex(const KeyType& Key) const
+    {
+        if (Buckets.Num() == 0)
+        {
+            return INDEX_NONE;
+        }
+
+        const uint32 Hash = HashKey(Key);
+        const uint32 Mask = static_cast<uint32>(Buckets.Num() - 1);
+        for (uint32 BucketIndex = Hash & Mask; ; BucketIndex = (BucketIndex + 1) & Mask)
+        {
+            const FBucket& Bucket = Buckets[BucketIndex];
+            if (Bucket.Index == INDEX_NONE)
+            {
+                return INDEX_NONE;
+            }
+            if (Bucket.Hash == Hash && KeyFuncs::GetKey(Elements[Bucket.Index]) == Key)
+            {
+                return Bucket.Index;
+            }
+        }
+    }
+
+    /**
+     * Key와 일치하는 Element를 찾고, 없으면 MakeElement()의 결과를 추가합니다.
+     * @param Key 찾을 Key
+     * @param MakeElement Key가 없을 때만 호출되는 Element 생성 함수
+     * @param bOutAlreadyExisted [optional] 이미 존재했는지 여부
+     * @return Element의 Index
+     */
+    template <typename FactoryType>
+    int32 FindOrAddByKey(const KeyType& Key, FactoryType&& MakeElement, bool* bOutAlreadyExisted = nullptr)
+    {
+        if (Buckets.Num() < GetBucketNumForElements(Num() + 1))
+        {
+            Rehash(std::max(static_cast<int32>(Buckets.Num()) * 2, MinBucketNum));
+        }
+
+        const uint32 Hash = HashKey(Key);
+        const uint32 Mask = static_cast<uint32>(Buckets.Num() - 1);
+        uint32 BucketIndex = Hash & Mask;
+        for (; Buckets[BucketIndex].Index != INDEX_NONE; BucketIndex = (BucketIndex + 1) & Mask)
+        {
+            const FBucket& Bucket = Buckets[BucketIndex];
+            if (Bucket.Hash == Hash && KeyFuncs::GetKey(Elements[Bucket.Index]) == Key)
+            {
+                if (bOutAlreadyExisted)
+                {
+                    *bOutAlreadyExisted = true;
+                }
+                return Bucket.Index;
+            }
+        }
+
+        const int32 NewIndex = static_cast<int32>(Elements.Emplace(MakeElement()));
+        Buckets[BucketIndex] = { Hash, NewIndex };
+
+        if (bOutAlreadyExisted)
+        {
+            *bOutAlreadyExisted = false;
+        }
+        return NewIndex;
+    }
+
+    /**
+     * Key와 일치하는 Element를 제거합니다.
+     * @return 제거된 Element의 개수 (0 또는 1)
+     */
+    int32 RemoveByKey(const KeyType& Key)
+    {
+        if (Buckets.Num() == 0)
+        {
+            return 0;
+        }
+
+        const uint32 Hash = HashKey(Key);
+        const uint32 Mask = static_cast<uint32>(Buckets.Num() - 1);
+        for (uint32 BucketIndex = Hash & Mask; ; BucketIndex = (BucketIndex + 1) & Mask)
+        {
+            const FBucket& Bucket = Buckets[BucketIndex];
+            if (Bucket.Index == INDEX_NONE)
+            {
+                return 0;
+            }
+            if (Bucket.Hash == Hash && KeyFuncs::GetKey(Elements[Bucket.Index]) == Key)
+            {
+                const int32 ElementIndex = Bucket.Index;
+                RemoveBucket(BucketIndex);
+                RemoveElement(ElementIndex);
+                return 1;
+            }
+        }
+    }
+
+private:
+    static uint32 HashKey(const KeyType& Key)
+    {
+        // std::hash가 포인터나 정수를 그대로 반환하는 경우가 있으므로, 하위 비트에 고르게 퍼지도록 섞어줌
+        const uint64 Hash = static_cast<uint64>(Hasher{}(Key));
+        return static_cast<uint32>((Hash * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+    static int32 GetBucketNumForElements(int32 ElementNum)
+    {
+        int32 BucketNum = MinBucketNum;
+        while (ElementNum * MaxLoadDenominator > BucketNum * MaxLoadNumerator)
+        {
+            BucketNum *= 2;
+        }
+        return BucketNum;
+    }
+
+    void Rehash(int32 NewBucketNum)
+    {
+        Buckets.Empty();
+        Buckets.SetNum(NewBucketNum);
+
+        const uint32 Mask = static_cast<uint32>(NewBucketNum - 1);
+        for (int32 ElementIndex = 0; ElementIndex < Num(); ++ElementIndex)
+        {
+            const uint32 Hash = HashKey(KeyFuncs::GetKey(Elements[ElementIndex]));
+            uint32 BucketIndex = Hash & Mask;
+            while (Buckets[BucketIndex].Index != INDEX_NONE)
+            {
+                BucketIndex = (BucketIndex + 1) & Mask;
+            }
+            Buckets[BucketIndex] = { Hash, ElementIndex };
+        }
+    }
+
+    /** 선형 탐사 체인이 끊기지 않도록 뒤의 Bucket들을 당겨옵니다. (Backward shift deletion) */
+    void RemoveBucket(uint32 HoleIndex)
+    {
+        const uint32 Mask = static_cast<uint32>(Buckets.Num() - 1);
+        for (uint32 Next = (HoleIndex + 1) & Mask; Buckets[Next].Index != INDEX_NONE; Next = (Next + 1) & Mask)
+        {
+            const uint32 Home = Buckets[Next].Hash & Mask;
+
+            // Next의 원래 위치가 (HoleIndex, Next] 구간 밖이라면 빈 자리로 옮길 수 있음
+            if (((Next - Home) & Mask) >= ((Next - HoleIndex) & Mask))
+            {
+                Buckets[HoleIndex] = Buckets[Next];
+                HoleIndex = Next;
+            }
+        }
+        Buckets[HoleIndex] = FBucket();
+    }
+
+    /** Element 배열에서 Index의 Element를 제거하고, 마지막 Element를 그 자리로 옮깁니다. */
+    void RemoveElement(int32 Index)
+    {
+        const int32 LastIndex = Num() - 1;
+        if (Index != LastIndex)
+        {
+            // 마지막 Element를 가리키는 Bucket을 찾아 Index를 갱신
+            const uint32 Mask = static_cast<uint32>(Buckets.Num() - 1);
+            uint32 BucketIndex = HashKey(KeyFuncs::GetKey(Elements[LastIndex])) & Mask;
+            while (Buckets[BucketIndex].Index != LastIndex)
+            {
+                BucketIndex = (BucketIndex + 1) & Mask;
+            }
+            Buckets[BucketIndex].Index = Index;
+
+            Elements[Index] = std::move(Elements[LastIndex]);
+        }
+        Elements.RemoveAt(LastIndex);
+    }
+};
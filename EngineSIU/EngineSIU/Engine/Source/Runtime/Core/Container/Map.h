@@ -1,31 +1,48 @@
 ﻿#pragma once
-#include <unordered_map>
+#include <cassert>
 
 #include "ContainerAllocator.h"
+#include "HashTable.h"
 #include "Pair.h"
 #include "Serialization/Archive.h"
 
 
+/**
+ * Key-Value Pair를 THashTable에 빈틈없이 저장하는 Map입니다.
+ *
+ * @note Add, Emplace, FindOrAdd, operator[], Remove, Empty는 Pair 배열을 재할당하거나 마지막 Pair를 옮기므로(swap-remove),
+ *       그 전에 Find로 얻은 포인터나 FindOrAdd/operator[]로 얻은 참조, 반복자를 모두 무효화합니다.
+ *       주소가 유지되어야 하는 Value는 TMap<Key, std::unique_ptr<Value>>처럼 힙에 따로 할당하세요.
+ */
 template <typename KeyType, typename ValueType, typename Allocator = FDefaultAllocator<std::pair<const KeyType, ValueType>>>
 class TMap
 {
 public:
     using PairType = TPair<const KeyType, ValueType>;
-    using MapType = std::unordered_map<KeyType, ValueType, std::hash<KeyType>, std::equal_to<KeyType>, Allocator>;
-    using SizeType = typename MapType::size_type;
+    using SizeType = typename Allocator::size_type;
 
 private:
-    MapType ContainerPrivate;
+    /** 실제로 저장되는 Pair, 외부에는 Key가 const인 PairType으로 노출됩니다. */
+    using ElementType = TPair<KeyType, ValueType>;
+
+    struct FKeyFuncs
+    {
+        static const KeyType& GetKey(const ElementType& Element) { return Element.Key; }
+    };
+
+    using HashTableType = THashTable<ElementType, KeyType, FKeyFuncs, std::hash<KeyType>, Allocator>;
+
+    HashTableType ContainerPrivate;
 
 public:
     class Iterator
     {
     private:
-        typename MapType::iterator InnerIt;
+        ElementType* InnerIt;
     public:
-        Iterator(typename MapType::iterator it) : InnerIt(std::move(it)) {}
+        Iterator(ElementType* It) : InnerIt(It) {}
         PairType& operator*() { return reinterpret_cast<PairType&>(*InnerIt); }
-        PairType* operator->() { return reinterpret_cast<PairType*>(&(*InnerIt)); }
+        PairType* operator->() { return reinterpret_cast<PairType*>(InnerIt); }
         Iterator& operator++() { ++InnerIt; return *this; }
         bool operator!=(const Iterator& other) const { return InnerIt != other.InnerIt; }
     };
@@ -33,24 +50,21 @@ public:
     class ConstIterator
     {
     private:
-        typename MapType::const_iterator InnerIt;
+        const ElementType* InnerIt;
     public:
-        ConstIterator(typename MapType::const_iterator it) : InnerIt(it) {}
+        ConstIterator(const ElementType* It) : InnerIt(It) {}
         const PairType& operator*() const { return reinterpret_cast<const PairType&>(*InnerIt); }
-        const PairType* operator->() const { return reinterpret_cast<const PairType*>(&(*InnerIt)); }
+        const PairType* operator->() const { return reinterpret_cast<const PairType*>(InnerIt); }
         ConstIterator& operator++() { ++InnerIt; return *this; }
         bool operator!=(const ConstIterator& other) const { return InnerIt != other.InnerIt; }
     };
 
 public:
     // TPair를 반환하는 커스텀 반복자
-    Iterator begin() noexcept { return Iterator(ContainerPrivate.begin()); }
-    Iterator end() noexcept { return Iterator(ContainerPrivate.end()); }
-    ConstIterator begin() const noexcept { return ConstIterator(ContainerPrivate.begin()); }
-    ConstIterator end() const noexcept { return ConstIterator(ContainerPrivate.end()); }
-
-    MapType& GetContainerPrivate() { return ContainerPrivate; }
-    const MapType& GetContainerPrivate() const { return ContainerPrivate; }
+    Iterator begin() noexcept { return Iterator(ContainerPrivate.GetData()); }
+    Iterator end() noexcept { return Iterator(ContainerPrivate.GetData() + ContainerPrivate.Num()); }
+    ConstIterator begin() const noexcept { return ConstIterator(ContainerPrivate.GetData()); }
+    ConstIterator end() const noexcept { return ConstIterator(ContainerPrivate.GetData() + ContainerPrivate.Num()); }
 
     // 생성자 및 소멸자
     TMap() = default;
@@ -82,20 +96,29 @@ public:
         return *this;
     }
 
-    // 요소 접근 및 수정
+    // 요소 접근 및 수정, 반환된 참조는 다음 추가/제거 전까지만 유효
     ValueType& operator[](const KeyType& Key)
     {
-        return ContainerPrivate[Key];
+        return FindOrAdd(Key);
     }
 
     const ValueType& operator[](const KeyType& Key) const
     {
-        return ContainerPrivate.at(Key);
+        const ValueType* Value = Find(Key);
+        assert(Value);
+        return *Value;
     }
 
     void Add(const KeyType& Key, const ValueType& Value)
     {
-        ContainerPrivate.insert_or_assign(Key, Value);
+        bool bAlreadyExisted = false;
+        const int32 Index = ContainerPrivate.FindOrAddByKey(
+            Key, [&] { return ElementType(Key, Value); }, &bAlreadyExisted
+        );
+        if (bAlreadyExisted)
+        {
+            ContainerPrivate[Index].Value = Value;
+        }
     }
 
     /**
@@ -107,76 +130,82 @@ public:
     template <typename InitKeyType = KeyType, typename InitValueType = ValueType>
     ValueType& Emplace(InitKeyType&& InKey, InitValueType&& InValue)
     {
-        auto result = ContainerPrivate.emplace(std::forward<InitKeyType>(InKey), std::forward<InitValueType>(InValue));
-        return result.first->second;
+        KeyType Key(std::forward<InitKeyType>(InKey));
+        const int32 Index = ContainerPrivate.FindOrAddByKey(
+            Key, [&] { return ElementType(std::move(Key), ValueType(std::forward<InitValueType>(InValue))); }
+        );
+        return ContainerPrivate[Index].Value;
     }
 
     // Key만 넣고, Value는 기본값으로 삽입
     template <typename InitKeyType = KeyType>
     ValueType& Emplace(InitKeyType&& InKey)
     {
-        auto result = ContainerPrivate.emplace(std::forward<InitKeyType>(InKey), ValueType{});
-        return result.first->second;
+        KeyType Key(std::forward<InitKeyType>(InKey));
+        const int32 Index = ContainerPrivate.FindOrAddByKey(
+            Key, [&] { return ElementType(std::move(Key), ValueType{}); }
+        );
+        return ContainerPrivate[Index].Value;
     }
 
     void Remove(const KeyType& Key)
     {
-        ContainerPrivate.erase(Key);
+        ContainerPrivate.RemoveByKey(Key);
     }
 
     void Empty()
     {
-        ContainerPrivate.clear();
+        ContainerPrivate.Empty();
     }
 
     void Empty(SizeType Number)
     {
-        ContainerPrivate.clear();
-        ContainerPrivate.reserve(Number);
+        ContainerPrivate.Empty(static_cast<int32>(Number));
     }
 
     // 검색 및 조회
     bool Contains(const KeyType& Key) const
     {
-        return ContainerPrivate.contains(Key);
+        return ContainerPrivate.FindIndex(Key) != INDEX_NONE;
     }
 
+    /** @return Key의 Value, 없으면 nullptr. 포인터는 다음 추가/제거 전까지만 유효합니다. */
     const ValueType* Find(const KeyType& Key) const
     {
-        auto it = ContainerPrivate.find(Key);
-        return it != ContainerPrivate.end() ? &(it->second) : nullptr;
+        const int32 Index = ContainerPrivate.FindIndex(Key);
+        return Index != INDEX_NONE ? &ContainerPrivate[Index].Value : nullptr;
     }
 
     ValueType* Find(const KeyType& Key)
     {
-        auto it = ContainerPrivate.find(Key);
-        return it != ContainerPrivate.end() ? &(it->second) : nullptr;
+        const int32 Index = ContainerPrivate.FindIndex(Key);
+        return Index != INDEX_NONE ? &ContainerPrivate[Index].Value : nullptr;
     }
 
+    /** @return Key의 Value, 없으면 기본값으로 추가. 참조는 다음 추가/제거 전까지만 유효합니다. */
     ValueType& FindOrAdd(const KeyType& Key)
     {
-        if (ValueType* Value = Find(Key))
-        {
-            return *Value;
-        }
-        return Emplace(Key);
+        const int32 Index = ContainerPrivate.FindOrAddByKey(
+            Key, [&] { return ElementType(KeyType(Key), ValueType{}); }
+        );
+        return ContainerPrivate[Index].Value;
     }
 
     // 크기 관련
     SizeType Num() const
     {
-        return ContainerPrivate.size();
+        return static_cast<SizeType>(ContainerPrivate.Num());
     }
 
     bool IsEmpty() const
     {
-        return ContainerPrivate.empty();
+        return ContainerPrivate.IsEmpty();
     }
 
     // 용량 관련
     void Reserve(SizeType Number)
     {
-        ContainerPrivate.reserve(Number);
+        ContainerPrivate.Reserve(static_cast<int32>(Number));
     }
 };
 
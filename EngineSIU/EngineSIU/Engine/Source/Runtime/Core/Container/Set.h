@@ -1,35 +1,46 @@
 ﻿#pragma once
-#include <unordered_set>
-
 #include "Array.h"
 #include "ContainerAllocator.h"
+#include "HashTable.h"
 
 
+/**
+ * Element를 THashTable에 빈틈없이 저장하는 Set입니다.
+ *
+ * @note Add, Emplace, Remove, Empty는 Element 배열을 재할당하거나 마지막 Element를 옮기므로(swap-remove),
+ *       그 전에 Find로 얻은 반복자와 Element 포인터를 모두 무효화합니다.
+ *       순회 중에 같은 Set에 추가/제거할 수 있다면 Array()로 복사한 목록을 순회하세요.
+ */
 template <typename T, typename Hasher = std::hash<T>, typename Allocator = FDefaultAllocator<T>>
 class TSet
 {
 private:
-    using SetType = std::unordered_set<T, Hasher, std::equal_to<>, Allocator>;
     using ElementType = T;
 
-    SetType ContainerPrivate;
+    struct FKeyFuncs
+    {
+        static const ElementType& GetKey(const ElementType& Element) { return Element; }
+    };
+
+    using HashTableType = THashTable<ElementType, ElementType, FKeyFuncs, Hasher, Allocator>;
+
+    HashTableType ContainerPrivate;
 
 public:
     using SizeType = typename Allocator::SizeType;
-    using Iterator = typename SetType::iterator;
-    using ConstIterator = typename SetType::const_iterator;
 
-    SetType& GetContainerPrivate() { return ContainerPrivate; }
-    const SetType& GetContainerPrivate() const { return ContainerPrivate; }
+    /** Element는 Hash의 Key이므로, 반복자로는 수정할 수 없습니다. */
+    using Iterator = const ElementType*;
+    using ConstIterator = const ElementType*;
 
     // 기본 생성자
     TSet() = default;
 
     // Iterator 관련 메서드
-    Iterator begin() noexcept { return ContainerPrivate.begin(); }
-    Iterator end() noexcept { return ContainerPrivate.end(); }
-    ConstIterator begin() const noexcept { return ContainerPrivate.begin(); }
-    ConstIterator end() const noexcept { return ContainerPrivate.end(); }
+    Iterator begin() noexcept { return ContainerPrivate.GetData(); }
+    Iterator end() noexcept { return ContainerPrivate.GetData() + ContainerPrivate.Num(); }
+    ConstIterator begin() const noexcept { return ContainerPrivate.GetData(); }
+    ConstIterator end() const noexcept { return ContainerPrivate.GetData() + ContainerPrivate.Num(); }
 
     // Add
     int32 Add(const T& Item) { return Emplace(Item); }
@@ -42,28 +53,36 @@ public:
      * @return 새로 추가된 Element의 Index, 이미 존재하는 경우 기존 Element의 Index를 반환
      */
     template<typename ArgsType = T>
-    int32 Emplace(ArgsType&& Args) 
-    { 
-        auto iter = ContainerPrivate.emplace(std::forward<ArgsType>(Args));
-        return std::distance(ContainerPrivate.begin(), iter.first);
+    int32 Emplace(ArgsType&& Args)
+    {
+        ElementType Item(std::forward<ArgsType>(Args));
+        return ContainerPrivate.FindOrAddByKey(Item, [&] { return std::move(Item); });
     }
 
     // Num (개수)
-    SizeType Num() const { return static_cast<SizeType>(ContainerPrivate.size()); }
+    SizeType Num() const { return static_cast<SizeType>(ContainerPrivate.Num()); }
 
-    // Find
-    Iterator Find(const T& Item) { return ContainerPrivate.find(Item); }
-    ConstIterator Find(const T& Item) const { return ContainerPrivate.find(Item); }
+    // Find, 반환된 반복자는 다음 추가/제거 전까지만 유효
+    Iterator Find(const T& Item)
+    {
+        const int32 Index = ContainerPrivate.FindIndex(Item);
+        return Index != INDEX_NONE ? begin() + Index : end();
+    }
+    ConstIterator Find(const T& Item) const
+    {
+        const int32 Index = ContainerPrivate.FindIndex(Item);
+        return Index != INDEX_NONE ? begin() + Index : end();
+    }
 
     // Contains
-    bool Contains(const T& Item) const { return ContainerPrivate.contains(Item); }
+    bool Contains(const T& Item) const { return ContainerPrivate.FindIndex(Item) != INDEX_NONE; }
 
     // Array (TArray로 반환)
     TArray<T, Allocator> Array() const
     {
         TArray<T, Allocator> Result;
         Result.Reserve(Num());
-        for (const auto& Item : ContainerPrivate)
+        for (const auto& Item : *this)
         {
             Result.Add(Item);
         }
@@ -71,18 +90,14 @@ public:
     }
 
     // Remove
-    SizeType Remove(const T& Item) { return static_cast<SizeType>(ContainerPrivate.erase(Item)); }
+    SizeType Remove(const T& Item) { return static_cast<SizeType>(ContainerPrivate.RemoveByKey(Item)); }
 
     // Empty
-    void Empty() { ContainerPrivate.clear(); }
-    void Empty(SizeType Number)
-    {
-        ContainerPrivate.clear();
-        ContainerPrivate.reserve(Number);
-    }
+    void Empty() { ContainerPrivate.Empty(); }
+    void Empty(SizeType Number) { ContainerPrivate.Empty(static_cast<int32>(Number)); }
 
     // IsEmpty
-    bool IsEmpty() const { return ContainerPrivate.empty(); }
+    bool IsEmpty() const { return ContainerPrivate.IsEmpty(); }
 };
 
 template <typename ElementType, typename Hasher, class Allocator>
@@ -18,6 +18,9 @@ enum EAllocationType : uint8
 struct FPlatformMemory
 {
 private:
+    /** Pool에서 꺼낸 객체도 EAT_Object 통계에 포함시키기 위함 */
+    friend class FUObjectAllocator;
+
     static std::atomic<uint64> ObjectAllocationBytes;
     static std::atomic<uint64> ObjectAllocationCount;
     static std::atomic<uint64> ContainerAllocationBytes;
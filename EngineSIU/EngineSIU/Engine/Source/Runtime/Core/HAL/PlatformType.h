@@ -28,6 +28,12 @@
 #endif
 
 
+// bench 콘솔 명령(ConsoleBenchmarks.cpp)을 빌드에 포함할지 여부, 프로젝트 설정의 WithBenchmarks 속성으로 정해짐 (기본값: Debug만 1)
+#ifndef WITH_BENCHMARKS
+    #define WITH_BENCHMARKS 0
+#endif
+
+
 #define USE_WIDECHAR 0
 
 #if USE_WIDECHAR 
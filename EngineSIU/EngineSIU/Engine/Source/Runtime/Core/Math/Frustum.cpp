@@ -0,0 +1,161 @@
+#include "Frustum.h"
+
+#include "Matrix.h"
+#include "MathSSE.h"
+
+
+FFrustum::FFrustum(const FMatrix& ViewProjection, bool bIncludeNearFar)
+{
+    const auto& M = ViewProjection.M;
+
+    // Clip = v * M 이므로 각 열이 클립 좌표의 한 성분이 됨 (Gribb/Hartmann)
+    auto Column = [&M](int32 Col)
+    {
+        return FPlane(M[0][Col], M[1][Col], M[2][Col], M[3][Col]);
+    };
+    auto Combine = [](const FPlane& A, const FPlane& B, float Sign)
+    {
+        return FPlane(A.X + B.X * Sign, A.Y + B.Y * Sign, A.Z + B.Z * Sign, A.W + B.W * Sign);
+    };
+
+    const FPlane Col0 = Column(0);
+    const FPlane Col1 = Column(1);
+    const FPlane Col2 = Column(2);
+    const FPlane Col3 = Column(3);
+
+    Planes[Left] = Combine(Col3, Col0, 1.0f);   // -w <= x
+    Planes[Right] = Combine(Col3, Col0, -1.0f); //  x <= w
+    Planes[Bottom] = Combine(Col3, Col1, 1.0f); // -w <= y
+    Planes[Top] = Combine(Col3, Col1, -1.0f);   //  y <= w
+    Planes[Near] = Col2;                        //  0 <= z
+    Planes[Far] = Combine(Col3, Col2, -1.0f);   //  z <= w
+
+    NumPlanes = bIncludeNearFar ? MaxPlanes : Near;
+
+    for (int32 Index = 0; Index < NumPlanes; ++Index)
+    {
+        Planes[Index].Normalize();
+    }
+}
+
+bool FFrustum::IntersectBox(const FVector& Center, const FVector& Extent) const
+{
+    for (int32 Index = 0; Index < NumPlanes; ++Index)
+    {
+        const FPlane& Plane = Planes[Index];
+        const float Distance = Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z + Plane.W;
+        const float Radius = FMath::Abs(Plane.X) * Extent.X + FMath::Abs(Plane.Y) * Extent.Y + FMath::Abs(Plane.Z) * Extent.Z;
+        if (Distance + Radius < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FCullingBounds::Add(const FVector& Center, const FVector& Extent)
+{
+    CenterX.Add(Center.X);
+    CenterY.Add(Center.Y);
+    CenterZ.Add(Center.Z);
+    ExtentX.Add(Extent.X);
+    ExtentY.Add(Extent.Y);
+    ExtentZ.Add(Extent.Z);
+}
+
+void FCullingBounds::Reserve(int32 Number)
+{
+    CenterX.Reserve(Number);
+    CenterY.Reserve(Number);
+    CenterZ.Reserve(Number);
+    ExtentX.Reserve(Number);
+    ExtentY.Reserve(Number);
+    ExtentZ.Reserve(Number);
+}
+
+void FCullingBounds::Empty()
+{
+    CenterX.Empty();
+    CenterY.Empty();
+    CenterZ.Empty();
+    ExtentX.Empty();
+    ExtentY.Empty();
+    ExtentZ.Empty();
+}
+
+void FrustumCulling::CullBoxes_Scalar(const FFrustum& Frustum, const FCullingBounds& Bounds, uint8* OutVisible)
+{
+    const int32 NumBounds = Bounds.Num();
+    for (int32 Index = 0; Index < NumBounds; ++Index)
+    {
+        const FVector Center(Bounds.CenterX[Index], Bounds.CenterY[Index], Bounds.CenterZ[Index]);
+        const FVector Extent(Bounds.ExtentX[Index], Bounds.ExtentY[Index], Bounds.ExtentZ[Index]);
+        OutVisible[Index] = Frustum.IntersectBox(Center, Extent) ? 1 : 0;
+    }
+}
+
+void FrustumCulling::CullBoxes_SSE(const FFrustum& Frustum, const FCullingBounds& Bounds, uint8* OutVisible)
+{
+    using namespace SSE;
+
+    // 평면 계수를 미리 브로드캐스트
+    VectorRegister4Float PlaneX[FFrustum::MaxPlanes], PlaneY[FFrustum::MaxPlanes], PlaneZ[FFrustum::MaxPlanes], PlaneW[FFrustum::MaxPlanes];
+    VectorRegister4Float AbsX[FFrustum::MaxPlanes], AbsY[FFrustum::MaxPlanes], AbsZ[FFrustum::MaxPlanes];
+    for (int32 PlaneIndex = 0; PlaneIndex < Frustum.NumPlanes; ++PlaneIndex)
+    {
+        const FPlane& Plane = Frustum.Planes[PlaneIndex];
+        PlaneX[PlaneIndex] = VectorSetFloat1(Plane.X);
+        PlaneY[PlaneIndex] = VectorSetFloat1(Plane.Y);
+        PlaneZ[PlaneIndex] = VectorSetFloat1(Plane.Z);
+        PlaneW[PlaneIndex] = VectorSetFloat1(Plane.W);
+        AbsX[PlaneIndex] = VectorSetFloat1(FMath::Abs(Plane.X));
+        AbsY[PlaneIndex] = VectorSetFloat1(FMath::Abs(Plane.Y));
+        AbsZ[PlaneIndex] = VectorSetFloat1(FMath::Abs(Plane.Z));
+    }
+
+    const VectorRegister4Float Zero = VectorSetFloat1(0.0f);
+
+    const int32 NumBounds = Bounds.Num();
+    const int32 NumSimd = NumBounds & ~3;
+
+    int32 Index = 0;
+    for (; Index < NumSimd; Index += 4)
+    {
+        const VectorRegister4Float CX = VectorLoad(Bounds.CenterX.GetData() + Index);
+        const VectorRegister4Float CY = VectorLoad(Bounds.CenterY.GetData() + Index);
+        const VectorRegister4Float CZ = VectorLoad(Bounds.CenterZ.GetData() + Index);
+        const VectorRegister4Float EX = VectorLoad(Bounds.ExtentX.GetData() + Index);
+        const VectorRegister4Float EY = VectorLoad(Bounds.ExtentY.GetData() + Index);
+        const VectorRegister4Float EZ = VectorLoad(Bounds.ExtentZ.GetData() + Index);
+
+        // 모든 평면의 안쪽(Distance + Radius >= 0)에 걸쳐 있어야 보임
+        VectorRegister4Float Inside = VectorCompareGE(Zero, Zero);
+        for (int32 PlaneIndex = 0; PlaneIndex < Frustum.NumPlanes; ++PlaneIndex)
+        {
+            VectorRegister4Float Distance = VectorMultiply(PlaneX[PlaneIndex], CX);
+            Distance = VectorMultiplyAdd(PlaneY[PlaneIndex], CY, Distance);
+            Distance = VectorMultiplyAdd(PlaneZ[PlaneIndex], CZ, Distance);
+            Distance = VectorAdd(Distance, PlaneW[PlaneIndex]);
+
+            VectorRegister4Float Radius = VectorMultiply(AbsX[PlaneIndex], EX);
+            Radius = VectorMultiplyAdd(AbsY[PlaneIndex], EY, Radius);
+            Radius = VectorMultiplyAdd(AbsZ[PlaneIndex], EZ, Radius);
+
+            Inside = VectorBitwiseAnd(Inside, VectorCompareGE(VectorAdd(Distance, Radius), Zero));
+        }
+
+        const int32 Mask = VectorMaskBits(Inside);
+        OutVisible[Index + 0] = static_cast<uint8>(Mask & 1);
+        OutVisible[Index + 1] = static_cast<uint8>((Mask >> 1) & 1);
+        OutVisible[Index + 2] = static_cast<uint8>((Mask >> 2) & 1);
+        OutVisible[Index + 3] = static_cast<uint8>((Mask >> 3) & 1);
+    }
+
+    // 4개로 나누어 떨어지지 않는 나머지
+    for (; Index < NumBounds; ++Index)
+    {
+        const FVector Center(Bounds.CenterX[Index], Bounds.CenterY[Index], Bounds.CenterZ[Index]);
+        const FVector Extent(Bounds.ExtentX[Index], Bounds.ExtentY[Index], Bounds.ExtentZ[Index]);
+        OutVisible[Index] = Frustum.IntersectBox(Center, Extent) ? 1 : 0;
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include "Plane.h"
+#include "Container/Array.h"
+
+struct FMatrix;
+
+
+/**
+ * View-Projection 행렬로부터 만든 절두체입니다.
+ * 모든 평면의 법선은 절두체 안쪽을 향합니다.
+ */
+struct FFrustum
+{
+    enum EPlane : uint8
+    {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        MaxPlanes,
+    };
+
+    FPlane Planes[MaxPlanes];
+
+    /** 유효한 평면 개수, Near/Far를 제외하면 4 */
+    int32 NumPlanes = 0;
+
+    FFrustum() = default;
+
+    /**
+     * 행 벡터(v * M) 규약의 View-Projection 행렬에서 평면을 추출합니다.
+     * @param ViewProjection 월드 -> 클립 공간 변환 행렬
+     * @param bIncludeNearFar false면 좌/우/상/하 평면만 사용 (Depth Clamp를 쓰는 그림자 패스용)
+     */
+    explicit FFrustum(const FMatrix& ViewProjection, bool bIncludeNearFar = true);
+
+    /** 중심과 반 크기로 표현된 AABB가 절두체와 겹치는지 검사합니다. */
+    bool IntersectBox(const FVector& Center, const FVector& Extent) const;
+};
+
+
+/**
+ * 컬링 커널에 넣기 위한 SoA(Structure of Arrays) 형태의 AABB 목록입니다.
+ * 4개씩 묶어서 SIMD 레지스터에 바로 로드할 수 있습니다.
+ */
+struct FCullingBounds
+{
+    TArray<float> CenterX;
+    TArray<float> CenterY;
+    TArray<float> CenterZ;
+    TArray<float> ExtentX;
+    TArray<float> ExtentY;
+    TArray<float> ExtentZ;
+
+    void Add(const FVector& Center, const FVector& Extent);
+    void Reserve(int32 Number);
+    void Empty();
+
+    int32 Num() const { return CenterX.Num(); }
+};
+
+
+namespace FrustumCulling
+{
+/**
+ * 스칼라 기준 구현입니다. SIMD 커널 검증용으로도 사용합니다.
+ * @param Frustum 검사할 절두체
+ * @param Bounds 검사할 AABB 목록
+ * @param OutVisible Bounds.Num() 크기의 결과 배열, 보이면 1 아니면 0
+ */
+void CullBoxes_Scalar(const FFrustum& Frustum, const FCullingBounds& Bounds, uint8* OutVisible);
+
+/** SSE로 AABB 4개를 한 번에 검사합니다. 결과는 CullBoxes_Scalar와 같습니다. */
+void CullBoxes_SSE(const FFrustum& Frustum, const FCullingBounds& Bounds, uint8* OutVisible);
+
+inline void CullBoxes(const FFrustum& Frustum, const FCullingBounds& Bounds, uint8* OutVisible)
+{
+    CullBoxes_SSE(Frustum, Bounds, OutVisible);
+}
+}
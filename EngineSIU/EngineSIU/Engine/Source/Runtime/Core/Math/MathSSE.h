@@ -54,6 +54,41 @@ FORCEINLINE VectorRegister4Float VectorMultiplyAdd(
     return VectorAdd(VectorMultiply(Vec1, Vec2), Vec3);
 }
 
+/** 정렬되지 않은 주소에서 float 4개를 로드합니다. */
+FORCEINLINE VectorRegister4Float VectorLoad(const float* Ptr)
+{
+    return _mm_loadu_ps(Ptr);
+}
+
+/** 정렬되지 않은 주소에 float 4개를 저장합니다. */
+FORCEINLINE void VectorStore(const VectorRegister4Float& Vec, float* Ptr)
+{
+    _mm_storeu_ps(Ptr, Vec);
+}
+
+/** 모든 성분을 같은 값으로 채웁니다. */
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float F)
+{
+    return _mm_set1_ps(F);
+}
+
+/** 성분별로 Vec1 >= Vec2 이면 모든 비트가 1, 아니면 0 */
+FORCEINLINE VectorRegister4Float VectorCompareGE(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_cmpge_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorBitwiseAnd(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_and_ps(Vec1, Vec2);
+}
+
+/** 각 성분의 부호 비트를 모아 4비트 정수로 반환합니다. (VectorCompare 결과와 함께 사용) */
+FORCEINLINE int32 VectorMaskBits(const VectorRegister4Float& Vec)
+{
+    return _mm_movemask_ps(Vec);
+}
+
 inline void VectorMatrixMultiply(FMatrix* Result, const FMatrix* Matrix1, const FMatrix* Matrix2)
 {
     // 레지스터에 값 로드
@@ -118,3 +118,48 @@ public:
 private:
     const TArray<uint8>& Data;
 };
+
+/**
+ * 복사하지 않고 외부 메모리(매핑된 파일 등)를 그대로 읽는 Reader
+ * 메모리는 Reader보다 오래 유지되어야 합니다.
+ */
+class FMemoryReaderView : public FMemoryArchive
+{
+public:
+    FMemoryReaderView(const void* InData, int64 InSize)
+        : Data(static_cast<const uint8*>(InData))
+        , Size(InSize)
+    {
+        bIsSaving = false;
+        bIsLoading = true;
+    }
+
+    virtual void LoadData(void* OutData, uint64 Length) override
+    {
+        if (Offset + static_cast<int64>(Length) > Size)
+        {
+            throw std::runtime_error("Attempted to read beyond the end of the buffer.");
+        }
+
+        FPlatformMemory::Memcpy(OutData, Data + Offset, Length);
+        Offset += Length;
+    }
+
+    virtual void Seek(int64 InPos) override
+    {
+        if (InPos > Size)
+        {
+            throw std::runtime_error("Attempted to seek beyond the end of the buffer.");
+        }
+        Offset = InPos;
+    }
+
+    /** 현재 위치의 메모리, 값을 복사하지 않고 직접 읽을 때 사용 */
+    const uint8* GetCurrentData() const { return Data + Offset; }
+
+    int64 GetSize() const { return Size; }
+
+private:
+    const uint8* Data;
+    int64 Size;
+};
@@ -1,4 +1,553 @@
 #include "ProfilerStatsManager.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <Windows.h>
+
+#include "UserInterface/Console.h"
+#include "WindowsPlatformTime.h"
+
 // Initialize static members
 TMap<FName, double> FProfilerStatsManager::CPUStatsMS;
+
+namespace
+{
+    /**
+     * 한 스레드가 쓰는 링 버퍼
+     * 소유 스레드만 Events에 쓰고 NumWritten을 올리며, 스레드가 끝나면 다음에 생기는 스레드가 다시 사용합니다.
+     */
+    struct FThreadEventBuffer
+    {
+        uint32 ThreadId = 0;
+        std::atomic<bool> bInUse = false;
+        std::atomic<uint64> NumWritten = 0;
+        FProfilerScope Events[FProfilerStatsManager::EventsPerThread];
+    };
+
+    /** 스레드가 끝날 때 버퍼를 반납 */
+    struct FThreadBufferOwner
+    {
+        FThreadEventBuffer* Buffer = nullptr;
+
+        ~FThreadBufferOwner()
+        {
+            if (Buffer)
+            {
+                Buffer->bInUse.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    constexpr uint64 EventIndexMask = FProfilerStatsManager::EventsPerThread - 1;
+
+    // 버퍼 목록은 스레드가 처음 기록할 때와 읽을 때만 잠금, 기록 자체는 잠그지 않음
+    std::mutex RegistryMutex;
+    TArray<std::unique_ptr<FThreadEventBuffer>> ThreadBuffers;
+
+    thread_local FThreadBufferOwner ThreadBuffer;
+    thread_local uint32 ScopeDepth = 0;
+
+    // 메인 스레드에서만 접근, FrameNumber번째 프레임의 시작 시각은 FrameStartCycles[FrameNumber % 크기]
+    uint64 FrameStartCycles[FProfilerStatsManager::HistoryFrames + 1] = {};
+    uint64 NumFrameStarts = 0;
+    uint32 MainThreadId = 0;
+
+    FThreadEventBuffer* ClaimThreadBuffer()
+    {
+        std::lock_guard Lock(RegistryMutex);
+        for (const std::unique_ptr<FThreadEventBuffer>& Buffer : ThreadBuffers)
+        {
+            if (!Buffer->bInUse.load(std::memory_order_acquire))
+            {
+                Buffer->bInUse.store(true, std::memory_order_relaxed);
+                Buffer->ThreadId = GetCurrentThreadId();
+                Buffer->NumWritten.store(0, std::memory_order_release);
+                return Buffer.get();
+            }
+        }
+
+        std::unique_ptr<FThreadEventBuffer> Buffer = std::make_unique<FThreadEventBuffer>();
+        Buffer->bInUse.store(true, std::memory_order_relaxed);
+        Buffer->ThreadId = GetCurrentThreadId();
+        FThreadEventBuffer* Result = Buffer.get();
+        ThreadBuffers.Add(std::move(Buffer));
+        return Result;
+    }
+
+    /**
+     * [FromCycles, ToCycles)에 끝난 구간을 모든 스레드 버퍼에서 복사합니다.
+     * 복사하는 동안 소유 스레드가 덮어썼을 수 있는 칸은 복사 후 NumWritten을 다시 읽어 버립니다.
+     * @param OutTruncatedCycles FromCycles 이후에 끝났지만 링 버퍼에서 밀려난 구간이 있으면, 남은 구간 중 가장 먼저 끝난 시각 (없으면 0)
+     */
+    void CollectEvents(uint64 FromCycles, uint64 ToCycles, TArray<FProfilerThreadScopes>& OutThreads, uint64& OutTruncatedCycles)
+    {
+        OutThreads.Empty();
+        OutTruncatedCycles = 0;
+
+        std::lock_guard Lock(RegistryMutex);
+        for (const std::unique_ptr<FThreadEventBuffer>& Buffer : ThreadBuffers)
+        {
+            const uint64 Written = Buffer->NumWritten.load(std::memory_order_acquire);
+
+            // 소유 스레드가 다음에 쓸 칸(Written)은 가장 오래된 칸을 덮어쓰므로 제외
+            const uint64 Oldest = Written >= FProfilerStatsManager::EventsPerThread ? Written - FProfilerStatsManager::EventsPerThread + 1 : 0;
+
+            // 최신 구간부터 거꾸로 복사, 한 스레드의 구간은 끝난 순서대로 쌓이므로 FromCycles 이전에서 멈춤
+            TArray<FProfilerScope> Copies;
+            bool bReachedFrom = false;
+            for (uint64 Index = Written; Index > Oldest; --Index)
+            {
+                const FProfilerScope Event = Buffer->Events[(Index - 1) & EventIndexMask];
+                if (Event.EndCycles < FromCycles)
+                {
+                    bReachedFrom = true;
+                    break;
+                }
+                Copies.Add(Event);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64 WrittenAfter = Buffer->NumWritten.load(std::memory_order_relaxed);
+            if (WrittenAfter < Written)
+            {
+                // 복사하는 사이 스레드가 끝나고 버퍼가 다른 스레드에 넘어감
+                continue;
+            }
+            const uint64 ValidFrom = WrittenAfter >= FProfilerStatsManager::EventsPerThread ? WrittenAfter - FProfilerStatsManager::EventsPerThread + 1 : 0;
+
+            // 버퍼가 한 바퀴 돌아 FromCycles까지 거슬러 가지 못했거나, 복사하는 사이 덮어쓴 칸이 있으면 그 앞의 구간은 잃어버림
+            bool bTruncated = !bReachedFrom && Oldest > 0;
+            uint64 OldestRetainedCycles = ToCycles;
+
+            FProfilerThreadScopes& Thread = OutThreads[OutThreads.Emplace()];
+            Thread.ThreadId = Buffer->ThreadId;
+            for (int32 CopyIndex = Copies.Num() - 1; CopyIndex >= 0; --CopyIndex)
+            {
+                const uint64 Index = Written - 1 - CopyIndex;
+                if (Index < ValidFrom)
+                {
+                    bTruncated = true;
+                    continue;
+                }
+
+                const FProfilerScope& Event = Copies[CopyIndex];
+                OldestRetainedCycles = std::min(OldestRetainedCycles, Event.EndCycles);
+                if (Event.EndCycles >= FromCycles && Event.EndCycles < ToCycles)
+                {
+                    Thread.Scopes.Add(Event);
+                }
+            }
+
+            if (bTruncated)
+            {
+                OutTruncatedCycles = std::max(OutTruncatedCycles, OldestRetainedCycles);
+            }
+        }
+    }
+
+    int32 GetNumCompletedFrames()
+    {
+        return NumFrameStarts > 0 ? static_cast<int32>(std::min<uint64>(NumFrameStarts - 1, FProfilerStatsManager::HistoryFrames)) : 0;
+    }
+
+    /** 최근 NumFrames개의 완료된 프레임 경계, NumFrames + 1개 (마지막은 진행 중인 프레임의 시작) */
+    TArray<uint64> GetFrameBounds(int32 NumFrames)
+    {
+        TArray<uint64> Bounds;
+        Bounds.SetNum(NumFrames + 1);
+        const uint64 FirstFrame = NumFrameStarts - 1 - NumFrames;
+        for (int32 Index = 0; Index <= NumFrames; ++Index)
+        {
+            Bounds[Index] = FrameStartCycles[(FirstFrame + Index) % (FProfilerStatsManager::HistoryFrames + 1)];
+        }
+        return Bounds;
+    }
+
+    /**
+     * 최근 MaxFrames개의 완료된 프레임 경계와 그 안에 끝난 구간을 모읍니다.
+     * 어느 스레드든 링 버퍼에서 구간이 밀려난 프레임은 합계가 모자라게 나오므로, 그런 앞쪽 프레임은 빼고 경고를 남깁니다.
+     * @return 모든 구간이 남아 있는 프레임 수, OutBounds는 그보다 하나 많음
+     */
+    int32 CollectRetainedFrames(int32 MaxFrames, TArray<uint64>& OutBounds, TArray<FProfilerThreadScopes>& OutThreads)
+    {
+        int32 NumFrames = std::min(MaxFrames, GetNumCompletedFrames());
+        if (NumFrames <= 0)
+        {
+            OutBounds.Empty();
+            OutThreads.Empty();
+            return 0;
+        }
+
+        OutBounds = GetFrameBounds(NumFrames);
+        uint64 TruncatedCycles = 0;
+        CollectEvents(OutBounds[0], OutBounds[NumFrames], OutThreads, TruncatedCycles);
+        if (TruncatedCycles == 0)
+        {
+            return NumFrames;
+        }
+
+        // 밀려난 구간은 TruncatedCycles 이전에 끝났으므로 그 뒤에 시작한 프레임만 온전함
+        int32 NumDropped = 0;
+        while (NumDropped < NumFrames && OutBounds[NumDropped] <= TruncatedCycles)
+        {
+            ++NumDropped;
+        }
+
+        UE_LOG(ELogLevel::Warning,
+            "profiler: dropped the oldest %d of %d frames, a thread recorded more than %u scopes since then",
+            NumDropped, NumFrames, FProfilerStatsManager::EventsPerThread - 1
+        );
+
+        NumFrames -= NumDropped;
+        TArray<uint64> RetainedBounds;
+        for (int32 Index = NumDropped; Index < OutBounds.Num(); ++Index)
+        {
+            RetainedBounds.Add(OutBounds[Index]);
+        }
+        OutBounds = std::move(RetainedBounds);
+        if (NumFrames <= 0)
+        {
+            OutThreads.Empty();
+            return 0;
+        }
+
+        for (FProfilerThreadScopes& Thread : OutThreads)
+        {
+            Thread.Scopes.RemoveAll([FirstCycles = OutBounds[0]](const FProfilerScope& Event)
+            {
+                return Event.EndCycles < FirstCycles;
+            });
+        }
+        return NumFrames;
+    }
+
+    /** 구간이 끝난 시각으로 프레임 번호(0부터)를 찾음 */
+    int32 FindFrameIndex(const TArray<uint64>& Bounds, uint64 EndCycles)
+    {
+        const auto It = std::upper_bound(Bounds.begin(), Bounds.end(), EndCycles);
+        return static_cast<int32>(It - Bounds.begin()) - 1;
+    }
+
+    /** 정렬된 값에서 Nearest-rank 방식의 백분위 */
+    double Percentile(const TArray<double>& SortedValues, double Fraction)
+    {
+        const int32 Rank = std::clamp(static_cast<int32>(std::ceil(Fraction * SortedValues.Num())), 1, SortedValues.Num());
+        return SortedValues[Rank - 1];
+    }
+
+    /** JSON 문자열에 넣을 수 있도록 따옴표와 역슬래시는 이스케이프하고, 제어 문자는 공백으로 바꿈 */
+    std::string EscapeJson(const std::string& Text)
+    {
+        std::string Result;
+        Result.reserve(Text.size());
+        for (const char Char : Text)
+        {
+            if (Char == '"' || Char == '\\')
+            {
+                Result += '\\';
+                Result += Char;
+            }
+            else if (static_cast<unsigned char>(Char) < 0x20)
+            {
+                Result += ' ';
+            }
+            else
+            {
+                Result += Char;
+            }
+        }
+        return Result;
+    }
+}
+
+void FProfilerStatsManager::BeginFrame()
+{
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+    if (NumFrameStarts == 0)
+    {
+        MainThreadId = GetCurrentThreadId();
+    }
+    else
+    {
+        // 방금 끝난 프레임의 Stat을 모든 스레드에서 합산
+        CPUStatsMS.Empty();
+
+        TArray<FProfilerThreadScopes> Threads;
+        uint64 TruncatedCycles = 0;
+        CollectEvents(FrameStartCycles[(NumFrameStarts - 1) % (HistoryFrames + 1)], NowCycles, Threads, TruncatedCycles);
+        for (const FProfilerThreadScopes& Thread : Threads)
+        {
+            for (const FProfilerScope& Event : Thread.Scopes)
+            {
+                CPUStatsMS.FindOrAdd(Event.Name) += FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles);
+            }
+        }
+    }
+
+    FrameStartCycles[NumFrameStarts % (HistoryFrames + 1)] = NowCycles;
+    ++NumFrameStarts;
+}
+
+void FProfilerStatsManager::BeginScope()
+{
+    ++ScopeDepth;
+}
+
+void FProfilerStatsManager::EndScope(const TStatId& StatId, uint64 StartCycles, uint64 EndCycles)
+{
+    FThreadEventBuffer* Buffer = ThreadBuffer.Buffer;
+    if (!Buffer)
+    {
+        Buffer = ThreadBuffer.Buffer = ClaimThreadBuffer();
+    }
+
+    ScopeDepth = ScopeDepth > 0 ? ScopeDepth - 1 : 0;
+
+    const uint64 Index = Buffer->NumWritten.load(std::memory_order_relaxed);
+    FProfilerScope& Event = Buffer->Events[Index & EventIndexMask];
+    Event.Name = StatId.GetName();
+    Event.Depth = ScopeDepth;
+    Event.StartCycles = StartCycles;
+    Event.EndCycles = EndCycles;
+    Buffer->NumWritten.store(Index + 1, std::memory_order_release);
+}
+
+int32 FProfilerStatsManager::GetRecordedScopes(int32 MaxFrames, TArray<FProfilerThreadScopes>& OutThreads)
+{
+    TArray<uint64> Bounds;
+    return CollectRetainedFrames(MaxFrames, Bounds, OutThreads);
+}
+
+FProfilerStatSummary FProfilerStatsManager::SummarizeValues(const FName& StatName, TArray<double> Values)
+{
+    FProfilerStatSummary Summary;
+    Summary.StatName = StatName;
+    Summary.NumFrames = Values.Num();
+    if (Values.Num() == 0)
+    {
+        return Summary;
+    }
+
+    Values.Sort();
+
+    double Total = 0.0;
+    for (const double Value : Values)
+    {
+        Total += Value;
+    }
+
+    Summary.MinMs = Values[0];
+    Summary.MaxMs = Values[Values.Num() - 1];
+    Summary.AvgMs = Total / Values.Num();
+    Summary.P50Ms = Percentile(Values, 0.50);
+    Summary.P95Ms = Percentile(Values, 0.95);
+    Summary.P99Ms = Percentile(Values, 0.99);
+    return Summary;
+}
+
+double FProfilerStatsManager::GetCpuStatMs(const FName& StatName)
+{
+    const double* FoundMs = CPUStatsMS.Find(StatName);
+    return FoundMs ? *FoundMs : -1.0; // Return -1 if not found
+}
+
+TArray<FProfilerStatSummary> FProfilerStatsManager::GetStatSummaries(int32 MaxFrames)
+{
+    TArray<FProfilerStatSummary> Summaries;
+    TArray<uint64> Bounds;
+    TArray<FProfilerThreadScopes> Threads;
+    const int32 NumFrames = CollectRetainedFrames(MaxFrames, Bounds, Threads);
+    if (NumFrames <= 0)
+    {
+        return Summaries;
+    }
+
+    // Stat마다 프레임별 합계, 기록되지 않은 프레임은 음수
+    TMap<FName, TArray<double>> FrameTimes;
+    for (const FProfilerThreadScopes& Thread : Threads)
+    {
+        for (const FProfilerScope& Event : Thread.Scopes)
+        {
+            TArray<double>& Times = FrameTimes.FindOrAdd(Event.Name);
+            if (Times.Num() == 0)
+            {
+                Times.Init(-1.0, NumFrames);
+            }
+
+            double& FrameMs = Times[FindFrameIndex(Bounds, Event.EndCycles)];
+            FrameMs = std::max(FrameMs, 0.0) + FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles);
+        }
+    }
+
+    TArray<double> Values;
+    for (const auto& [StatName, Times] : FrameTimes)
+    {
+        Values.Empty();
+        for (const double FrameMs : Times)
+        {
+            if (FrameMs >= 0.0)
+            {
+                Values.Add(FrameMs);
+            }
+        }
+        Summaries.Add(SummarizeValues(StatName, std::move(Values)));
+    }
+
+    Summaries.Sort([](const FProfilerStatSummary& A, const FProfilerStatSummary& B)
+    {
+        return A.AvgMs > B.AvgMs;
+    });
+    return Summaries;
+}
+
+void FProfilerStatsManager::LogStatSummaries(int32 MaxFrames)
+{
+    TArray<uint64> Bounds;
+    TArray<FProfilerThreadScopes> Threads;
+    const int32 NumFrames = CollectRetainedFrames(MaxFrames, Bounds, Threads);
+    if (NumFrames <= 0)
+    {
+        UE_LOG(ELogLevel::Warning, "profile summary: no completed frames recorded yet");
+        return;
+    }
+
+    // 프레임 시간 자체의 분포와 가장 느린 프레임의 위치
+    TArray<double> FrameTimes;
+    int32 WorstFrame = 0;
+    for (int32 Index = 0; Index < NumFrames; ++Index)
+    {
+        FrameTimes.Add(FPlatformTime::ToMilliseconds(Bounds[Index + 1] - Bounds[Index]));
+        if (FrameTimes[Index] > FrameTimes[WorstFrame])
+        {
+            WorstFrame = Index;
+        }
+    }
+    const double WorstFrameMs = FrameTimes[WorstFrame];
+
+    const FProfilerStatSummary FrameSummary = SummarizeValues(FName("Frame"), FrameTimes);
+    UE_LOG(ELogLevel::Display,
+        "profile summary: %d frames, frame min %.2f avg %.2f p50 %.2f p95 %.2f p99 %.2f max %.2f ms (worst frame %d frames ago, %.2f ms)",
+        NumFrames, FrameSummary.MinMs, FrameSummary.AvgMs, FrameSummary.P50Ms, FrameSummary.P95Ms, FrameSummary.P99Ms, FrameSummary.MaxMs,
+        NumFrames - WorstFrame, WorstFrameMs
+    );
+
+    for (const FProfilerStatSummary& Summary : GetStatSummaries(NumFrames))
+    {
+        UE_LOG(ELogLevel::Display,
+            "  %-32s %4d frames, min %.3f avg %.3f p50 %.3f p95 %.3f p99 %.3f max %.3f ms",
+            Summary.StatName.ToString().ToAnsiString().c_str(), Summary.NumFrames,
+            Summary.MinMs, Summary.AvgMs, Summary.P50Ms, Summary.P95Ms, Summary.P99Ms, Summary.MaxMs
+        );
+    }
+}
+
+bool FProfilerStatsManager::WriteChromeTrace(const FString& FilePath, int32 MaxFrames)
+{
+    TArray<uint64> Bounds;
+    TArray<FProfilerThreadScopes> Threads;
+    const int32 NumFrames = CollectRetainedFrames(MaxFrames, Bounds, Threads);
+    if (NumFrames <= 0)
+    {
+        UE_LOG(ELogLevel::Warning, "profile dump: no completed frames recorded yet");
+        return false;
+    }
+
+    const std::filesystem::path Path(FilePath.ToWideString());
+    if (Path.has_parent_path())
+    {
+        std::error_code ErrorCode;
+        std::filesystem::create_directories(Path.parent_path(), ErrorCode);
+    }
+
+    std::ofstream File(Path, std::ios::trunc);
+    if (!File.is_open())
+    {
+        UE_LOG(ELogLevel::Error, "profile dump: cannot open %s", FilePath.ToAnsiString().c_str());
+        return false;
+    }
+
+    // ts와 dur은 마이크로초, 첫 프레임의 시작을 0으로 둠
+    const uint64 BaseCycles = Bounds[0];
+    const auto ToMicroseconds = [BaseCycles](uint64 Cycles)
+    {
+        return FPlatformTime::ToMilliseconds(Cycles - BaseCycles) * 1000.0;
+    };
+    const uint32 ProcessId = GetCurrentProcessId();
+
+    char Line[512];
+    int32 NumEvents = 0;
+    File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    std::snprintf(Line, sizeof(Line),
+        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":0,\"args\":{\"name\":\"EngineSIU\"}}", ProcessId
+    );
+    File << Line;
+
+    for (const FProfilerThreadScopes& Thread : Threads)
+    {
+        const char* ThreadName = Thread.ThreadId == MainThreadId ? "Main Thread" : "Worker Thread";
+        std::snprintf(Line, sizeof(Line),
+            ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"%s %u\"}}",
+            ProcessId, Thread.ThreadId, ThreadName, Thread.ThreadId
+        );
+        File << Line;
+        std::snprintf(Line, sizeof(Line),
+            ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"sort_index\":%d}}",
+            ProcessId, Thread.ThreadId, Thread.ThreadId == MainThreadId ? 0 : 1
+        );
+        File << Line;
+    }
+
+    // 프레임을 메인 스레드의 최상위 구간으로 넣어 그 아래에 프레임 안의 구간이 중첩되어 보이도록 함
+    const uint64 FirstFrameNumber = NumFrameStarts - 1 - NumFrames;
+    for (int32 Index = 0; Index < NumFrames; ++Index)
+    {
+        std::snprintf(Line, sizeof(Line),
+            ",\n{\"name\":\"Frame %llu\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+            static_cast<unsigned long long>(FirstFrameNumber + Index), ProcessId, MainThreadId,
+            ToMicroseconds(Bounds[Index]), ToMicroseconds(Bounds[Index + 1]) - ToMicroseconds(Bounds[Index])
+        );
+        File << Line;
+    }
+
+    // 같은 이름을 매번 문자열로 바꾸지 않도록 캐시
+    TMap<FName, std::string> EscapedNames;
+    for (const FProfilerThreadScopes& Thread : Threads)
+    {
+        for (const FProfilerScope& Event : Thread.Scopes)
+        {
+            std::string& Name = EscapedNames.FindOrAdd(Event.Name);
+            if (Name.empty())
+            {
+                Name = EscapeJson(Event.Name.ToString().ToAnsiString());
+            }
+
+            const double StartUs = ToMicroseconds(Event.StartCycles);
+            std::snprintf(Line, sizeof(Line),
+                ",\n{\"name\":\"%s\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%u}}",
+                Name.c_str(), ProcessId, Thread.ThreadId, StartUs, ToMicroseconds(Event.EndCycles) - StartUs, Event.Depth
+            );
+            File << Line;
+            ++NumEvents;
+        }
+    }
+
+    File << "\n]}\n";
+    File.close();
+    if (File.fail())
+    {
+        UE_LOG(ELogLevel::Error, "profile dump: failed to write %s", FilePath.ToAnsiString().c_str());
+        return false;
+    }
+
+    UE_LOG(ELogLevel::Display, "profile dump: %d frames, %d scopes on %d threads written to %s",
+        NumFrames, NumEvents, Threads.Num(), FilePath.ToAnsiString().c_str()
+    );
+    return true;
+}
@@ -2,32 +2,100 @@
 
 #include "Core/HAL/PlatformType.h"
 #include "UObject/NameTypes.h" // For FName
+#include "Container/Array.h"
 #include "Container/Map.h"     // For TMap
+#include "Container/String.h"
 #include "Stats.h"             // For TStatId
 
+/** 최근 프레임 기록에서 한 Stat의 프레임당 시간 통계 (ms) */
+struct FProfilerStatSummary
+{
+    FName StatName;
+
+    /** Stat이 한 번 이상 기록된 프레임 수, 통계는 이 프레임들로만 계산 */
+    int32 NumFrames = 0;
+
+    double MinMs = 0.0;
+    double AvgMs = 0.0;
+    double MaxMs = 0.0;
+    double P50Ms = 0.0;
+    double P95Ms = 0.0;
+    double P99Ms = 0.0;
+};
+
+/** 끝난 CPU 구간 하나, 32 Byte */
+struct FProfilerScope
+{
+    FName Name;
+
+    /** 같은 스레드에서 열려 있던 바깥 구간 수 */
+    uint32 Depth = 0;
+
+    uint64 StartCycles = 0;
+    uint64 EndCycles = 0;
+};
+
+/** 한 스레드가 기록한 구간, 끝난 순서대로 정렬됨 */
+struct FProfilerThreadScopes
+{
+    uint32 ThreadId = 0;
+    TArray<FProfilerScope> Scopes;
+};
+
+/**
+ * FScopeCycleCounter가 측정한 CPU 구간을 스레드마다 고정 크기 링 버퍼에 기록합니다.
+ * 구간은 스레드 ID와 중첩 깊이를 함께 남기므로, 지난 프레임의 스파이크가 어느 구간에서 생겼는지 나중에 찾을 수 있습니다.
+ * 기록하는 쪽은 자기 스레드 버퍼에만 쓰므로 잠금 없이 동작하고, 읽는 쪽은 덮어써졌을 수 있는 구간을 버립니다.
+ *
+ * @note BeginFrame과 통계/덤프 함수는 메인 스레드에서만 호출해야 합니다.
+ */
 class FProfilerStatsManager
 {
 public:
-    // Call at the beginning of each frame to clear previous results
-    static void BeginFrame()
-    {
-        CPUStatsMS.Empty();
-    }
-
-    // Called by FScopeCycleCounter to record CPU time
-    static void AddCpuStat(const TStatId& StatId, const double TimeMs)
-    {
-        CPUStatsMS.FindOrAdd(StatId.GetName()) = TimeMs;
-    }
-
-    // Retrieve CPU time for a given StatId
-    static double GetCpuStatMs(const FName& StatName)
-    {
-        const double* FoundMs = CPUStatsMS.Find(StatName);
-        return FoundMs ? *FoundMs : -1.0; // Return -1 if not found
-    }
+    /** 프레임 경계를 보관하는 프레임 수, 통계와 덤프는 최대 이만큼의 프레임을 다룸 */
+    static constexpr int32 HistoryFrames = 300;
+
+    /** 스레드마다 보관하는 구간 수 (2의 거듭제곱), 넘치면 오래된 구간부터 덮어쓰고 구간을 잃은 프레임은 통계와 덤프에서 뺌 */
+    static constexpr uint32 EventsPerThread = 1 << 16;
+
+    // Call at the beginning of each frame to close the previous frame and update its stats
+    static void BeginFrame();
+
+    // Called by FScopeCycleCounter when a scope is entered
+    static void BeginScope();
+
+    // Called by FScopeCycleCounter to record the finished scope on the calling thread
+    static void EndScope(const TStatId& StatId, uint64 StartCycles, uint64 EndCycles);
+
+    // Retrieve CPU time of the last completed frame for a given StatId (summed over all threads)
+    static double GetCpuStatMs(const FName& StatName);
+
+    /**
+     * 최근 MaxFrames개의 완료된 프레임에 끝난 구간을 스레드별로 복사합니다.
+     * @return 구간이 모두 남아 있는 프레임 수, 링 버퍼에서 구간이 밀려난 앞쪽 프레임은 빠짐
+     */
+    static int32 GetRecordedScopes(int32 MaxFrames, TArray<FProfilerThreadScopes>& OutThreads);
+
+    /** 프레임별 값(ms)의 최소/평균/최대와 Nearest-rank 백분위 */
+    static FProfilerStatSummary SummarizeValues(const FName& StatName, TArray<double> Values);
+
+    /**
+     * 최근 MaxFrames개의 완료된 프레임에서 Stat마다 프레임당 시간의 최소/평균/최대/백분위를 계산합니다.
+     * @return 평균 시간이 큰 순서로 정렬된 통계
+     */
+    static TArray<FProfilerStatSummary> GetStatSummaries(int32 MaxFrames = HistoryFrames);
+
+    /** 프레임 시간과 Stat별 통계를 로그로 출력합니다. */
+    static void LogStatSummaries(int32 MaxFrames = HistoryFrames);
+
+    /**
+     * 최근 MaxFrames개의 완료된 프레임을 chrome://tracing (Trace Event Format) JSON 파일로 저장합니다.
+     * 프레임은 메인 스레드의 "Frame N" 구간으로, 각 구간은 기록한 스레드의 트랙에 중첩되어 표시됩니다.
+     * @return 저장에 성공했는지 여부
+     */
+    static bool WriteChromeTrace(const FString& FilePath, int32 MaxFrames = HistoryFrames);
 
 private:
-    // Map from Stat Name to elapsed time in milliseconds for the current frame
+    // Map from Stat Name to elapsed time in milliseconds for the last completed frame
     static TMap<FName, double> CPUStatsMS;
 };
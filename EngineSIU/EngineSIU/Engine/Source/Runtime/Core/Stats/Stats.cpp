@@ -7,6 +7,7 @@ FScopeCycleCounter::FScopeCycleCounter(TStatId StatId)
     : StartCycles(FPlatformTime::Cycles64())
     , UsedStatId(StatId)
 {
+    FProfilerStatsManager::BeginScope();
 }
 
 FScopeCycleCounter::~FScopeCycleCounter()
@@ -20,7 +21,7 @@ uint64 FScopeCycleCounter::Finish()
     const uint64 CycleDiff = EndCycles - StartCycles;
 
     // FThreadStats::AddMessage(UsedStatId, EStatOperation::Add, CycleDiff);
-    FProfilerStatsManager::AddCpuStat(UsedStatId, FPlatformTime::ToMilliseconds(CycleDiff));
+    FProfilerStatsManager::EndScope(UsedStatId, StartCycles, EndCycles);
 
     return CycleDiff;
 }
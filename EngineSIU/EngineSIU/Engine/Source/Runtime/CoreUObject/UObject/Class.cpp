@@ -17,7 +17,10 @@ UClass::UClass(
     , ClassSize(InClassSize)
     , ClassAlignment(InAlignment)
     , SuperClass(InSuperClass)
+    , ObjectPool(FUObjectAllocator::Get().FindPool(InClassSize))
 {
+    // Pool의 블록은 BlockGranularity 단위로만 정렬됨
+    assert(InAlignment <= FUObjectAllocator::BlockGranularity);
     NamePrivate = InClassName;
 }
 
@@ -67,6 +70,37 @@ void UClass::SerializeBin(FArchive& Ar, void* Data)
     }
 }
 
+void UClass::CopyProperties(UObject* Dest, const UObject* Src) const
+{
+    for (const UClass* Class = this; Class; Class = Class->SuperClass)
+    {
+        for (const FProperty& Prop : Class->Properties)
+        {
+            if (Prop.CopyValue)
+            {
+                Prop.CopyValue(
+                    reinterpret_cast<uint8*>(Dest) + Prop.Offset,
+                    reinterpret_cast<const uint8*>(Src) + Prop.Offset
+                );
+            }
+        }
+    }
+}
+
+void UClass::RemapReferences(UObject* Object, const FObjectDuplicator& Duplicator) const
+{
+    for (const UClass* Class = this; Class; Class = Class->SuperClass)
+    {
+        for (const FProperty& Prop : Class->Properties)
+        {
+            if (Prop.RemapReferences)
+            {
+                Prop.RemapReferences(reinterpret_cast<uint8*>(Object) + Prop.Offset, Duplicator);
+            }
+        }
+    }
+}
+
 UObject* UClass::CreateDefaultObject()
 {
     if (!ClassDefaultObject)
@@ -43,6 +43,9 @@ public:
     uint32 GetClassSize() const { return ClassSize; }
     uint32 GetClassAlignment() const { return ClassAlignment; }
 
+    /** 이 Class 크기의 Pool에서 생성자를 호출하기 전의 메모리를 할당합니다. */
+    void* AllocateObjectMemory() const { return FUObjectAllocator::Get().Allocate(ObjectPool, ClassSize); }
+
     /** SomeBase의 자식 클래스인지 확인합니다. */
     bool IsChildOf(const UClass* SomeBase) const;
 
@@ -74,6 +77,18 @@ public:
     /** 바이너리 직렬화 함수 */
     void SerializeBin(FArchive& Ar, void* Data);
 
+    /**
+     * 이 Class와 부모 Class에 등록된 Property를 Src에서 Dest로 복사합니다.
+     * @param Dest Src와 같은 Class의 객체
+     */
+    void CopyProperties(UObject* Dest, const UObject* Src) const;
+
+    /**
+     * 객체 포인터 Property 중 Duplicator에서 복제된 원본을 가리키는 값을 복제본으로 바꿉니다.
+     * @param Object 이 Class의 객체
+     */
+    void RemapReferences(UObject* Object, const FObjectDuplicator& Duplicator) const;
+
 protected:
     virtual UObject* CreateDefaultObject();
 
@@ -88,6 +103,9 @@ private:
     UClass* SuperClass = nullptr;
     UObject* ClassDefaultObject = nullptr;
 
+    /** ClassSize에 맞는 Pool, 생성할 때마다 크기로 찾지 않도록 캐시 */
+    FUObjectAllocator::FPool* ObjectPool = nullptr;
+
     TArray<FProperty> Properties;
 };
 
@@ -2,10 +2,14 @@
 
 #include <assert.h>
 #include <atomic>
+#include <cctype>
+#include <cstddef>
 #include <cwchar>
+#include <cwctype>
 #include <mutex>
-#include "Core/Container/Map.h"
+#include "Core/Container/Array.h"
 #include "Core/Container/String.h"
+#include "Core/HAL/PlatformMemory.h"
 
 
 enum ENameCase : uint8
@@ -36,10 +40,14 @@ struct FNameStringView
 };
 
 
-/** FName의 Hash값을 담는 클래스, FNameEntry에서 사용 */
+/**
+ * Arena에 저장된 FNameEntry의 위치
+ * 상위 비트는 블록 번호, 하위 FNameBlockOffsetBits 비트는 블록 안의 오프셋(Stride 단위)입니다.
+ * 0은 NAME_None으로 예약되어 있습니다.
+ */
 struct FNameEntryId
 {
-	uint32 Value = 0;  // 비교 문자열이 있는 해시
+	uint32 Value = 0;
 
 	bool IsNone() const { return !Value; }
 
@@ -67,9 +75,13 @@ struct FNameEntryHeader
 };
 
 
+/**
+ * Arena에 저장되는 Name 하나
+ * 실제로는 Header 뒤에 문자열 길이 + null 종료 문자만큼만 할당되며, NAME_SIZE 배열은 접근용 선언입니다.
+ */
 struct FNameEntry
 {
-	FNameEntryId ComparisonId; // 비교 문자열이 있는 해시
+	FNameEntryId ComparisonId; // 대소문자를 무시한 비교용 Entry, 처음 등록된 표기라면 자기 자신
 	FNameEntryHeader Header;   // Name의 정보
 
 	union
@@ -78,70 +90,93 @@ struct FNameEntry
 		WIDECHAR WideName[NAME_SIZE];
 	};
 
-	void StoreName(const ANSICHAR* InName, uint32 Len)
+	FNameStringView MakeView() const
 	{
-		memcpy(AnsiName, InName, sizeof(ANSICHAR) * Len);
-		AnsiName[Len] = '\0';
+		return Header.IsWide ? FNameStringView{WideName, Header.Len} : FNameStringView{AnsiName, Header.Len};
 	}
 
-	void StoreName(const WIDECHAR* InName, uint32 Len)
+	/** 문자열 길이에 맞춰 Arena에 할당할 크기 */
+	static uint32 GetSize(uint32 Len, bool bIsWide)
 	{
-		memcpy(WideName, InName, sizeof(WIDECHAR) * Len);
-		WideName[Len] = '\0';
+		const uint32 CharSize = bIsWide ? sizeof(WIDECHAR) : sizeof(ANSICHAR);
+		return static_cast<uint32>(offsetof(FNameEntry, AnsiName)) + (Len + 1) * CharSize;
 	}
 };
 
 namespace
 {
-template <typename CharType>
-uint32 HashString(const CharType* Str)
+constexpr uint32 FNameBlockOffsetBits = 16;
+constexpr uint32 FNameMaxBlocks = 1 << 13;
+
+/** 한 테이블을 나누는 Shard 수, 서로 다른 Shard에 대한 등록은 동시에 진행됨 */
+constexpr uint32 FNamePoolShardBits = 4;
+constexpr uint32 FNamePoolShards = 1 << FNamePoolShardBits;
+
+template <ENameCase Sensitivity, typename CharType>
+uint32 NormalizeChar(CharType Char)
+{
+	if constexpr (Sensitivity == CaseSensitive)
+	{
+		return static_cast<uint32>(Char);
+	}
+	else if constexpr (std::is_same_v<CharType, WIDECHAR>)
+	{
+		return static_cast<uint32>(towlower(Char));
+	}
+	else
+	{
+		return static_cast<uint32>(tolower(static_cast<unsigned char>(Char)));
+	}
+}
+
+template <ENameCase Sensitivity, typename CharType>
+uint64 HashString(const CharType* Str, uint32 Len)
 {
-	// djb2 문자열 해싱 알고리즘
-	uint32 Hash = 5381;
-	while (*Str)
+	// FNV-1a 64bit, 하위 비트는 Shard 선택에, 상위 32비트는 슬롯 위치와 비교값에 사용
+	uint64 Hash = 0xcbf29ce484222325ull;
+	for (uint32 i = 0; i < Len; ++i)
 	{
-		Hash = ((Hash << 5) + Hash) + *Str;
-		++Str;
+		Hash ^= NormalizeChar<Sensitivity>(Str[i]);
+		Hash *= 0x100000001b3ull;
 	}
 	return Hash;
 }
 
-template <typename CharType>
-uint32 HashStringLower(const CharType* Str, uint32 InLen)
+template <ENameCase Sensitivity>
+uint64 HashName(FNameStringView InName)
+{
+	return InName.IsAnsi() ? HashString<Sensitivity>(InName.Ansi, InName.Len) : HashString<Sensitivity>(InName.Wide, InName.Len);
+}
+
+template <ENameCase Sensitivity, typename CharType>
+bool EqualsString(const CharType* A, const CharType* B, uint32 Len)
 {
-	CharType LowerStr[NAME_SIZE];
-	if constexpr (std::is_same_v<CharType, wchar_t>)
+	if constexpr (Sensitivity == CaseSensitive)
 	{
-		for (uint32 i = 0; i < InLen; i++)
-		{
-			LowerStr[i] = towlower(Str[i]);
-		}
-		LowerStr[InLen] = '\0';
+		return memcmp(A, B, Len * sizeof(CharType)) == 0;
 	}
 	else
 	{
-		for (uint32 i = 0; i < InLen; ++i)
+		for (uint32 i = 0; i < Len; ++i)
 		{
-			LowerStr[i] = static_cast<CharType>(tolower(Str[i]));
+			if (NormalizeChar<Sensitivity>(A[i]) != NormalizeChar<Sensitivity>(B[i]))
+			{
+				return false;
+			}
 		}
-		LowerStr[InLen] = '\0';
+		return true;
 	}
-	return HashString(LowerStr);
 }
 
+/** ASCII만 담긴 WIDECHAR 문자열은 ANSICHAR로 저장되므로, 너비가 다르면 다른 문자열 */
 template <ENameCase Sensitivity>
-uint32 HashName(FNameStringView InName);
-
-template <>
-uint32 HashName<IgnoreCase>(FNameStringView InName)
+bool EqualsName(FNameStringView A, FNameStringView B)
 {
-	return InName.IsAnsi() ? HashStringLower(InName.Ansi, InName.Len) : HashStringLower(InName.Wide, InName.Len);
-}
-
-template <>
-uint32 HashName<CaseSensitive>(FNameStringView InName)
-{
-	return InName.IsAnsi() ? HashString(InName.Ansi) : HashString(InName.Wide);
+	if (A.Len != B.Len || A.bIsWide != B.bIsWide)
+	{
+		return false;
+	}
+	return A.IsAnsi() ? EqualsString<Sensitivity>(A.Ansi, B.Ansi, A.Len) : EqualsString<Sensitivity>(A.Wide, B.Wide, A.Len);
 }
 }
 
@@ -154,141 +189,277 @@ struct FNameValue
 	{}
 
 	FNameStringView Name;
-	uint32 Hash;
-	FNameEntryId ComparisonId = {};
+	uint64 Hash;
+
+	uint32 GetShardIndex() const { return static_cast<uint32>(Hash & (FNamePoolShards - 1)); }
+	uint32 GetProbeHash() const { return static_cast<uint32>(Hash >> 32); }
 };
 
 using FNameComparisonValue = FNameValue<IgnoreCase>;
 using FNameDisplayValue = FNameValue<CaseSensitive>;
 
-/** Open Addressing을 이용한 커스텀 Hash Set 이었는데, Hash 충돌 문제로 사용 못함 */
-#pragma region Deprecated Pool Shard
-#if 0  // NOLINT(readability-avoid-unconditional-preprocessor-if)
-template <ENameCase Sensitivity>
-class FNamePoolShard
+
+/**
+ * FNameEntry를 이어 붙여 저장하는 추가 전용 Arena
+ * 할당은 잠금 안에서 하지만, Resolve는 잠금 없이 블록 배열을 바로 읽습니다.
+ * (Id를 받은 스레드는 그 Entry가 기록된 이후임이 보장되므로 블록 포인터도 이미 보임)
+ */
+class FNameEntryAllocator
 {
-	template <typename T>
-	using Vec = std::vector<T, FDefaultAllocator<T>>;
+public:
+	static constexpr uint32 Stride = alignof(FNameEntry);
+	static constexpr uint32 BlockSizeBytes = Stride << FNameBlockOffsetBits;
 
-	// 요소 상태를 나타내는 enum
-	enum class ESlotState : uint8
+	FNameEntryAllocator()
 	{
-		Empty,    // 비어있는 슬롯
-		Occupied, // 사용 중인 슬롯
-		Deleted   // 삭제된 슬롯
-	};
+		Blocks[0] = static_cast<uint8*>(FPlatformMemory::Malloc<EAT_Container>(BlockSizeBytes));
+		NumBlocks = 1;
+
+		// 0번 Id는 NAME_None
+		CurrentByteCursor = Stride;
+	}
 
-	// 슬롯 구조체
-	struct FSlot
+	// Name은 프로그램 종료까지 유지되므로 블록은 해제하지 않음
+
+	const FNameEntry& Resolve(FNameEntryId Id) const
+	{
+		const uint32 Block = Id.Value >> FNameBlockOffsetBits;
+		const uint32 Offset = (Id.Value & ((1 << FNameBlockOffsetBits) - 1)) * Stride;
+		return *reinterpret_cast<const FNameEntry*>(Blocks[Block] + Offset);
+	}
+
+	/**
+	 * 문자열을 Arena에 복사합니다.
+	 * @param ComparisonId 비교용 Entry, None이면 새 Entry 자신을 가리킴
+	 */
+	FNameEntryId Create(FNameStringView Name, FNameEntryId ComparisonId)
 	{
-		FNameEntry Value;   // 저장된 값
-		ESlotState State;    // 슬롯의 상태
+		const uint32 Bytes = Align(FNameEntry::GetSize(Name.Len, Name.bIsWide));
 
-		FSlot()
-			: Value()
-			, State(ESlotState::Empty)
+		FNameEntryId Id;
+		FNameEntry* Entry;
 		{
+			std::lock_guard Lock(Mutex);
+
+			if (CurrentByteCursor + Bytes > BlockSizeBytes)
+			{
+				assert(NumBlocks < FNameMaxBlocks);
+				Blocks[NumBlocks] = static_cast<uint8*>(FPlatformMemory::Malloc<EAT_Container>(BlockSizeBytes));
+				++NumBlocks;
+				CurrentByteCursor = 0;
+			}
+
+			const uint32 Block = NumBlocks - 1;
+			Id.Value = (Block << FNameBlockOffsetBits) | (CurrentByteCursor / Stride);
+			Entry = reinterpret_cast<FNameEntry*>(Blocks[Block] + CurrentByteCursor);
+			CurrentByteCursor += Bytes;
 		}
 
-		bool Used() const
+		// 할당받은 영역은 다른 스레드와 겹치지 않으므로 잠금 밖에서 기록
+		Entry->ComparisonId = ComparisonId ? ComparisonId : Id;
+		Entry->Header = {
+			.IsWide = Name.bIsWide,
+			.Len = static_cast<uint16>(Name.Len)
+		};
+		if (Name.bIsWide)
 		{
-			return State == ESlotState::Occupied;
+			memcpy(Entry->WideName, Name.Wide, sizeof(WIDECHAR) * Name.Len);
+			Entry->WideName[Name.Len] = '\0';
 		}
-
-		void SetValue(const FNameEntry& InValue)
+		else
 		{
-			Value = InValue;
-			State = ESlotState::Occupied;
+			memcpy(Entry->AnsiName, Name.Ansi, sizeof(ANSICHAR) * Name.Len);
+			Entry->AnsiName[Name.Len] = '\0';
 		}
-	};
 
-private:
-	mutable Vec<FSlot> Slots;
-	std::atomic<uint32> ElementCount; // 총 요소 개수
-	float MaxLoadFactorValue;        // 최대 부하 계수
+		NumEntries.fetch_add(1, std::memory_order_relaxed);
+		return Id;
+	}
 
-	mutable std::mutex Mutex;
+	uint32 GetNumEntries() const { return NumEntries.load(std::memory_order_relaxed); }
 
-	// 해시 테이블 리사이징 및 리해싱
-	void Rehash(uint32 NewCapacity)
+	uint64 GetAllocatedBytes() const
 	{
-		Vec<FSlot> OldSlots = std::move(Slots);
-		Slots.clear();
-		Slots.resize(NewCapacity);
+		std::lock_guard Lock(Mutex);
+		return static_cast<uint64>(NumBlocks) * BlockSizeBytes;
+	}
 
-		ElementCount = 0;
-		for (const auto& Slot : OldSlots)
-		{
-			if (Slot.State == ESlotState::Occupied)
-			{
-				Slots[Slot.Value.ComparisonId.Value & Slots.size()] = Slot;
-			}
-		}
+private:
+	static uint32 Align(uint32 Bytes)
+	{
+		return (Bytes + Stride - 1) & ~(Stride - 1);
 	}
 
+	/** .natvis에서 FName을 표시할 때 직접 읽음 */
+	uint8* Blocks[FNameMaxBlocks] = {};
+	uint32 NumBlocks = 0;
+	uint32 CurrentByteCursor = 0;
+
+	std::atomic<uint32> NumEntries = 0;
+
+	mutable std::mutex Mutex;
+};
+
+
+/**
+ * 문자열 Hash로 Entry Id를 찾는 Open Addressing 테이블의 한 조각
+ * 읽기는 잠금 없이 슬롯을 탐색하고 문자열까지 비교하므로 Hash가 충돌해도 다른 Name이 같은 Id를 받지 않습니다.
+ * 쓰기는 Shard마다 잠그며, 테이블이 커지면 새 슬롯 배열을 만들어 교체합니다.
+ */
+template <ENameCase Sensitivity>
+class FNamePoolShard
+{
+	/** 상위 32비트는 Probe Hash, 하위 32비트는 Entry Id, 0이면 빈 슬롯 */
+	struct FSlotTable
+	{
+		uint32 Capacity = 0;
+		std::atomic<uint64>* Slots = nullptr;
+	};
+
 public:
-	FNamePoolShard(int32 InitCapacity = 1024, float InMaxLoadFactor = 0.75f)
-		: Slots(InitCapacity)
-		, ElementCount(0)
-		, MaxLoadFactorValue(InMaxLoadFactor)
+	FNamePoolShard()
 	{
+		Table.store(AllocateTable(InitialCapacity));
 	}
 
-	FSlot& Probe(uint32 InHash) const
+	FNamePoolShard(const FNamePoolShard&) = delete;
+	FNamePoolShard& operator=(const FNamePoolShard&) = delete;
+
+	FNameEntryId Find(const FNameEntryAllocator& Entries, const FNameValue<Sensitivity>& Value) const
 	{
-		return Slots[InHash & Slots.size()-1];
+		const FSlotTable* Current = Table.load(std::memory_order_acquire);
+		uint32 SlotIndex;
+		return Probe(Entries, *Current, Value, SlotIndex);
 	}
 
-	FNameEntryId Find(const FNameValue<Sensitivity>& Value) const
+	/**
+	 * 같은 문자열이 있으면 그 Id를, 없으면 CreateEntry가 만든 Id를 등록하고 반환합니다.
+	 * @param CreateEntry Shard가 잠긴 상태에서 한 번만 호출됨
+	 */
+	template <typename CreateFuncType>
+	FNameEntryId FindOrInsert(const FNameEntryAllocator& Entries, const FNameValue<Sensitivity>& Value, CreateFuncType&& CreateEntry)
 	{
-		FNameEntryId Result;
+		if (const FNameEntryId Existing = Find(Entries, Value))
 		{
-			std::lock_guard _(Mutex);
+			return Existing;
+		}
 
-			const FSlot& Slot = Probe(Value.Hash);
-			Result = Slot.Value.ComparisonId;
+		std::lock_guard Lock(Mutex);
+
+		// 잠그기 전에 다른 스레드가 등록했을 수 있으므로 다시 탐색
+		FSlotTable* Current = Table.load(std::memory_order_relaxed);
+		uint32 SlotIndex;
+		if (const FNameEntryId Existing = Probe(Entries, *Current, Value, SlotIndex))
+		{
+			return Existing;
 		}
-		return Result;
+
+		// 부하율 75%를 넘기 전에 확장
+		if ((NumUsed + 1) * 4 > Current->Capacity * 3)
+		{
+			Current = Grow(*Current);
+			Probe(Entries, *Current, Value, SlotIndex);
+		}
+
+		const FNameEntryId NewId = CreateEntry();
+		Current->Slots[SlotIndex].store(MakeSlot(Value.GetProbeHash(), NewId), std::memory_order_release);
+		++NumUsed;
+		return NewId;
 	}
 
-	FNameEntryId Insert(const FNameValue<Sensitivity>& Value)
+	uint64 GetAllocatedBytes() const
 	{
-		// 부하 계수 확인 및 필요시 리해싱
-		if (ElementCount >= Slots.size() * MaxLoadFactorValue)
+		std::lock_guard Lock(Mutex);
+		uint64 Bytes = static_cast<uint64>(Table.load(std::memory_order_relaxed)->Capacity) * sizeof(std::atomic<uint64>);
+		for (const FSlotTable* Retired : RetiredTables)
 		{
-			Rehash(Slots.size() * 2);
+			Bytes += static_cast<uint64>(Retired->Capacity) * sizeof(std::atomic<uint64>);
 		}
+		return Bytes;
+	}
 
-		std::lock_guard _(Mutex);
-		FSlot& Slot = Probe(Value.Hash);
+private:
+	static constexpr uint32 InitialCapacity = 256;
 
-		if (Slot.Used())
+	static uint64 MakeSlot(uint32 ProbeHash, FNameEntryId Id)
+	{
+		return (static_cast<uint64>(ProbeHash) << 32) | Id.Value;
+	}
+
+	static FSlotTable* AllocateTable(uint32 Capacity)
+	{
+		FSlotTable* NewTable = new FSlotTable;
+		NewTable->Capacity = Capacity;
+		NewTable->Slots = new std::atomic<uint64>[Capacity];
+		for (uint32 i = 0; i < Capacity; ++i)
 		{
-			return Slot.Value.ComparisonId;
+			NewTable->Slots[i].store(0, std::memory_order_relaxed);
 		}
+		return NewTable;
+	}
 
-		// 요소 삽입
-		FNameEntry Entry;
-		Entry.ComparisonId = Value.ComparisonId;
-		Entry.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
+	/**
+	 * 같은 문자열의 Id를 찾습니다.
+	 * @param OutSlotIndex 찾지 못했다면 처음 만난 빈 슬롯
+	 */
+	static FNameEntryId Probe(const FNameEntryAllocator& Entries, const FSlotTable& InTable, const FNameValue<Sensitivity>& Value, uint32& OutSlotIndex)
+	{
+		const uint32 Mask = InTable.Capacity - 1;
+		const uint32 ProbeHash = Value.GetProbeHash();
+		for (uint32 Index = ProbeHash & Mask; ; Index = (Index + 1) & Mask)
 		{
-			Entry.StoreName(Value.Name.Wide, Value.Name.Len);
+			const uint64 Slot = InTable.Slots[Index].load(std::memory_order_acquire);
+			if (Slot == 0)
+			{
+				OutSlotIndex = Index;
+				return {};
+			}
+
+			const FNameEntryId Id = {static_cast<uint32>(Slot)};
+			if (static_cast<uint32>(Slot >> 32) == ProbeHash && EqualsName<Sensitivity>(Entries.Resolve(Id).MakeView(), Value.Name))
+			{
+				OutSlotIndex = Index;
+				return Id;
+			}
 		}
-		else
+	}
+
+	/** 잠긴 상태에서 호출, 기존 배열은 읽는 중인 스레드가 있을 수 있어 해제하지 않고 보관 */
+	FSlotTable* Grow(const FSlotTable& OldTable)
+	{
+		FSlotTable* NewTable = AllocateTable(OldTable.Capacity * 2);
+		const uint32 Mask = NewTable->Capacity - 1;
+
+		for (uint32 i = 0; i < OldTable.Capacity; ++i)
 		{
-			Entry.StoreName(Value.Name.Ansi, Value.Name.Len);
+			const uint64 Slot = OldTable.Slots[i].load(std::memory_order_relaxed);
+			if (Slot == 0)
+			{
+				continue;
+			}
+
+			// 슬롯 위치는 슬롯에 저장된 Probe Hash만으로 다시 계산됨
+			uint32 Index = static_cast<uint32>(Slot >> 32) & Mask;
+			while (NewTable->Slots[Index].load(std::memory_order_relaxed) != 0)
+			{
+				Index = (Index + 1) & Mask;
+			}
+			NewTable->Slots[Index].store(Slot, std::memory_order_relaxed);
 		}
-		Slot.SetValue(Entry);
-		ElementCount.fetch_add(1, std::memory_order_relaxed);
-		return {Value.Hash};
+
+		RetiredTables.Add(Table.load(std::memory_order_relaxed));
+		Table.store(NewTable, std::memory_order_release);
+		return NewTable;
 	}
+
+	std::atomic<FSlotTable*> Table = nullptr;
+	TArray<FSlotTable*> RetiredTables;
+
+	uint32 NumUsed = 0;
+
+	mutable std::mutex Mutex;
 };
-#endif
-#pragma endregion Deprecated Pool Shard
+
 
 struct FNamePool
 {
@@ -300,64 +471,62 @@ public:
     }
 
 private:
-	// FNamePoolShard<CaseSensitive> DisplayPool;
-	// FNamePoolShard<IgnoreCase> ComparisonPool;
+	FNameEntryAllocator Entries;
 
-	TMap<uint32, FNameEntry> DisplayPool;
-	TMap<uint32, FNameEntry> ComparisonPool;
+	/** 표기 그대로의 문자열 -> Entry */
+	FNamePoolShard<CaseSensitive> DisplayShards[FNamePoolShards];
 
-private:
-	template <ENameCase Sensitivity>
-	FNameEntry MakeEntry(const FNameValue<Sensitivity>& Value) const
-	{
-		FNameEntry Result;
-		Result.ComparisonId = Value.ComparisonId;
-		Result.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
-		{
-			Result.StoreName(Value.Name.Wide, Value.Name.Len);
-		}
-		else
-		{
-			Result.StoreName(Value.Name.Ansi, Value.Name.Len);
-		}
-		return Result;
-	}
+	/** 대소문자를 무시한 문자열 -> 처음 등록된 표기의 Entry */
+	FNamePoolShard<IgnoreCase> ComparisonShards[FNamePoolShards];
 
 public:
-	/** Hash로 원본 문자열을 가져옵니다. */
-	FNameEntry Resolve(uint32 Hash) const
+	/** Id로 Entry를 가져옵니다. 잠금 없이 Arena를 바로 읽습니다. */
+	const FNameEntry& Resolve(FNameEntryId Id) const
 	{
-		return *DisplayPool.Find(Hash);
+		return Entries.Resolve(Id);
 	}
 
 	/**
-	 * 문자열을 찾거나, 없으면 Hash화 해서 저장합니다.
+	 * 문자열을 찾거나, 없으면 Arena에 저장합니다.
 	 *
-	 * @return DisplayName의 Hash
+	 * @return DisplayName의 Entry Id
 	 */
 	FNameEntryId FindOrStoreString(const FNameStringView& Name)
 	{
-		// DisplayPool에 같은 문자열이 있다면, 문자열의 Hash 반환
-		FNameDisplayValue DisplayValue{Name};
-		if (DisplayPool.Find(DisplayValue.Hash))
+		const FNameDisplayValue DisplayValue{Name};
+		return DisplayShards[DisplayValue.GetShardIndex()].FindOrInsert(Entries, DisplayValue, [this, &Name]
 		{
-			return {DisplayValue.Hash};
-		}
+			bool bCreatedComparison = false;
+			const FNameComparisonValue ComparisonValue{Name};
+			const FNameEntryId ComparisonId = ComparisonShards[ComparisonValue.GetShardIndex()].FindOrInsert(Entries, ComparisonValue, [this, &Name, &bCreatedComparison]
+			{
+				bCreatedComparison = true;
+				return Entries.Create(Name, {});
+			});
+
+			// 처음 등록된 표기라면 비교용 Entry를 그대로 Display Entry로 사용
+			if (bCreatedComparison)
+			{
+				return ComparisonId;
+			}
+			return Entries.Create(Name, ComparisonId);
+		});
+	}
 
-		const FNameComparisonValue ComparisonValue{Name};
-		if (!ComparisonPool.Find(ComparisonValue.Hash))
+	uint32 GetNumEntries() const
+	{
+		return Entries.GetNumEntries();
+	}
+
+	uint64 GetAllocatedBytes() const
+	{
+		uint64 Bytes = Entries.GetAllocatedBytes();
+		for (uint32 i = 0; i < FNamePoolShards; ++i)
 		{
-			const FNameEntry Entry = MakeEntry(ComparisonValue);
-			ComparisonPool.Add(ComparisonValue.Hash, Entry);
+			Bytes += DisplayShards[i].GetAllocatedBytes();
+			Bytes += ComparisonShards[i].GetAllocatedBytes();
 		}
-
-		DisplayValue.ComparisonId = {ComparisonValue.Hash};
-		DisplayPool.Add(DisplayValue.Hash, MakeEntry(DisplayValue));
-		return {DisplayValue.Hash};
+		return Bytes;
 	}
 };
 
@@ -381,8 +550,7 @@ struct FNameHelper
 		}
 	}
 
-	template <typename CharType>
-	static FName MakeFName(const CharType* Char, uint32 Len)
+	static FName MakeFName(const ANSICHAR* Char, uint32 Len)
 	{
 		// 문자열의 길이가 NAME_SIZE를 초과하면 None 반환
 		if (Len >= NAME_SIZE)
@@ -391,21 +559,94 @@ struct FNameHelper
 			return {};
 		}
 
-		const FNameEntryId DisplayId = FNamePool::Get().FindOrStoreString({Char, Len});
+		return MakeFName(FNameStringView{Char, Len});
+	}
+
+	static FName MakeFName(const WIDECHAR* Char, uint32 Len)
+	{
+		// 문자열의 길이가 NAME_SIZE를 초과하면 None 반환
+		if (Len >= NAME_SIZE)
+		{
+		    assert(Len >= NAME_SIZE);
+			return {};
+		}
+
+		// ASCII만 있다면 ANSICHAR로 저장해서 같은 문자열이 너비에 따라 다른 Name이 되지 않도록 함
+		bool bIsAscii = true;
+		for (uint32 i = 0; i < Len && bIsAscii; ++i)
+		{
+			bIsAscii = Char[i] < 0x80;
+		}
+
+		if (bIsAscii)
+		{
+			ANSICHAR AnsiName[NAME_SIZE];
+			for (uint32 i = 0; i < Len; ++i)
+			{
+				AnsiName[i] = static_cast<ANSICHAR>(Char[i]);
+			}
+			return MakeFName(FNameStringView{AnsiName, Len});
+		}
+
+		return MakeFName(FNameStringView{Char, Len});
+	}
+
+	static FName MakeFName(const FNameStringView& Name)
+	{
+		// "Cube_5"는 "Cube" Entry + Number로 저장해서 FName(FName("Cube"), 6)과 같은 Name이 되도록 함
+		FNameStringView BaseName = Name;
+		const uint32 Number = Name.IsAnsi()
+			? ParseNumber(Name.Ansi, BaseName.Len)
+			: ParseNumber(Name.Wide, BaseName.Len);
+
+		FNamePool& Pool = FNamePool::Get();
+		const FNameEntryId DisplayId = Pool.FindOrStoreString(BaseName);
 
 		FName Result;
 		Result.DisplayIndex = DisplayId.Value;
-		Result.ComparisonIndex = ResolveComparisonId(DisplayId).Value;
+		Result.ComparisonIndex = Pool.Resolve(DisplayId).ComparisonId.Value;
+		Result.Number = Number;
 		return Result;
 	}
 
-	static FNameEntryId ResolveComparisonId(FNameEntryId DisplayId)
+	/**
+	 * 이름 끝의 "_숫자"를 잘라냅니다.
+	 * "Cube_05"처럼 0으로 시작하면 잘라낸 뒤 같은 문자열로 되돌릴 수 없으므로 그대로 둡니다.
+	 * @param InOutLen 이름의 길이, 숫자를 잘라냈다면 "_" 앞까지의 길이로 바뀜
+	 * @return 내부 Number, 잘라내지 않았다면 NAME_NO_NUMBER_INTERNAL
+	 */
+	template <typename CharType>
+	static uint32 ParseNumber(const CharType* Name, uint32& InOutLen)
 	{
-		if (DisplayId.IsNone())
+		uint32 NumDigits = 0;
+		while (NumDigits < InOutLen && Name[InOutLen - NumDigits - 1] >= '0' && Name[InOutLen - NumDigits - 1] <= '9')
 		{
-			return {};
+			++NumDigits;
+		}
+
+		// 숫자 앞에 "_"와 최소 한 글자가 있어야 하고, int32 범위를 넘을 만큼 길면 문자열로 둠
+		const uint32 FirstDigit = InOutLen - NumDigits;
+		if (NumDigits == 0 || NumDigits > 10 || FirstDigit < 2 || Name[FirstDigit - 1] != '_')
+		{
+			return NAME_NO_NUMBER_INTERNAL;
+		}
+		if (NumDigits > 1 && Name[FirstDigit] == '0')
+		{
+			return NAME_NO_NUMBER_INTERNAL;
+		}
+
+		uint64 Value = 0;
+		for (uint32 i = FirstDigit; i < InOutLen; ++i)
+		{
+			Value = Value * 10 + (Name[i] - '0');
 		}
-		return FNamePool::Get().Resolve(DisplayId.Value).ComparisonId;
+		if (Value >= INT32_MAX)
+		{
+			return NAME_NO_NUMBER_INTERNAL;
+		}
+
+		InOutLen = FirstDigit - 1;
+		return NAME_EXTERNAL_TO_INTERNAL(static_cast<uint32>(Value));
 	}
 };
 
@@ -436,34 +677,42 @@ FString FName::ToString() const
 		return {TEXT("None")};
 	}
 
-	// TODO: WIDECHAR에 대응 해야함
-	FNameEntry Entry = FNamePool::Get().Resolve(DisplayIndex);
-    if (Entry.Header.IsWide)
+	const FNameEntry& Entry = FNamePool::Get().Resolve({DisplayIndex});
+    FString Result = Entry.Header.IsWide ? FString{Entry.WideName} : FString{Entry.AnsiName};
+    if (Number != NAME_NO_NUMBER_INTERNAL)
     {
-        return {Entry.WideName};
-    }
-    else
-    {
-        return {Entry.AnsiName};
+        Result += TEXT("_");
+        Result += FString::FromInt(NAME_INTERNAL_TO_EXTERNAL(Number));
     }
+    return Result;
 }
 
 bool FName::operator==(const FName& Other) const
 {
-	return ComparisonIndex == Other.ComparisonIndex;
+	return ComparisonIndex == Other.ComparisonIndex && Number == Other.Number;
 }
 
 bool FName::operator==(ENameNone) const
 {
-    return ComparisonIndex == NAME_None;
+    return ComparisonIndex == NAME_None && Number == NAME_NO_NUMBER_INTERNAL;
 }
 
 bool FName::operator!=(ENameNone) const
 {
-    return ComparisonIndex != NAME_None;
+    return !(*this == NAME_None);
 }
 
 bool FName::operator!=(const FName& Other) const
 {
-    return ComparisonIndex != Other.ComparisonIndex;
+    return !(*this == Other);
+}
+
+uint32 FName::GetNumNameEntries()
+{
+	return FNamePool::Get().GetNumEntries();
+}
+
+uint64 FName::GetNameTableMemorySize()
+{
+	return FNamePool::Get().GetAllocatedBytes();
 }
@@ -8,28 +8,52 @@ enum ENameNone : uint8 { NAME_None = 0 };
 /** Maximum size of name, including the null terminator. */
 enum : uint16 { NAME_SIZE = 256 };
 
+/** Number가 없는 Name의 내부 값, 내부 값은 표시되는 숫자 + 1 입니다. */
+#define NAME_NO_NUMBER_INTERNAL 0
+
+/** "Cube_5"의 5처럼 표시되는 숫자와 FName 내부 Number 사이의 변환 */
+#define NAME_INTERNAL_TO_EXTERNAL(x) ((x) - 1)
+#define NAME_EXTERNAL_TO_INTERNAL(x) ((x) + 1)
+
 class FName
 {
     friend struct FNameHelper;
 
-    uint32 DisplayIndex;    // 원본 문자열의 Hash
-    uint32 ComparisonIndex; // 비교시 사용되는 Hash
+    uint32 DisplayIndex;    // 원본 문자열 Entry의 Id (Name Pool Arena의 블록/오프셋)
+    uint32 ComparisonIndex; // 대소문자를 무시한 비교용 Entry의 Id
+    uint32 Number;          // "_숫자" 접미사의 내부 값, NAME_NO_NUMBER_INTERNAL이면 접미사 없음
 
 public:
-    FName() : DisplayIndex(NAME_None), ComparisonIndex(NAME_None) {}
-    FName(ENameNone) : DisplayIndex(NAME_None), ComparisonIndex(NAME_None) {}
+    FName() : DisplayIndex(NAME_None), ComparisonIndex(NAME_None), Number(NAME_NO_NUMBER_INTERNAL) {}
+    FName(ENameNone) : DisplayIndex(NAME_None), ComparisonIndex(NAME_None), Number(NAME_NO_NUMBER_INTERNAL) {}
     FName(const WIDECHAR* Name);
     FName(const ANSICHAR* Name);
     FName(const FString& Name);
 
+    /**
+     * 기존 Name에 숫자 접미사만 붙입니다. 문자열을 만들거나 Name Pool을 검색하지 않습니다.
+     * @param Other 접미사를 뺀 Name (Class 이름 등)
+     * @param InNumber 내부 Number, 표시되는 숫자는 NAME_INTERNAL_TO_EXTERNAL(InNumber)
+     */
+    FName(const FName& Other, uint32 InNumber)
+        : DisplayIndex(Other.DisplayIndex), ComparisonIndex(Other.ComparisonIndex), Number(InNumber) {}
+
+    /** 문자열은 이 함수를 호출할 때 만들어집니다. Number가 있으면 "Base_숫자" 형태 */
     FString ToString() const;
     uint32 GetDisplayIndex() const { return DisplayIndex; }
     uint32 GetComparisonIndex() const { return ComparisonIndex; }
+    uint32 GetNumber() const { return Number; }
 
     bool operator==(const FName& Other) const;
     bool operator==(ENameNone) const;
     bool operator!=(const FName& Other) const;
     bool operator!=(ENameNone) const;
+
+    /** Name Pool에 저장된 고유 문자열 수 */
+    static uint32 GetNumNameEntries();
+
+    /** Name Pool의 문자열 Arena와 검색 테이블이 차지하는 메모리 (Byte) */
+    static uint64 GetNameTableMemorySize();
 };
 
 template<>
@@ -37,7 +61,6 @@ struct std::hash<FName>
 {
     size_t operator()(const FName& Key) const noexcept
     {
-        // TODO: 나중에 FName에 Number 추가하면 살짝 수정
-        return hash<uint32>()(Key.GetComparisonIndex());
+        return hash<uint64>()(static_cast<uint64>(Key.GetNumber()) << 32 | Key.GetComparisonIndex());
     }
 };
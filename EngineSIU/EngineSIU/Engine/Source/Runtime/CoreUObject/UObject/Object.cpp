@@ -1,6 +1,7 @@
 #include "Object.h"
 
 #include "ObjectFactory.h"
+#include "ObjectDuplicator.h"
 #include "Class.h"
 #include "Engine/Engine.h"
 
@@ -14,7 +15,7 @@ UClass* UObject::StaticClass()
         nullptr,
         []() -> UObject*
         {
-            void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(UObject));
+            void* RawMemory = UObject::StaticClass()->AllocateObjectMemory();
             ::new (RawMemory) UObject;
             return static_cast<UObject*>(RawMemory);
         }
@@ -24,15 +25,34 @@ UClass* UObject::StaticClass()
 
 UObject::UObject()
     : UUID(0)
-    // TODO: Object를 생성할 때 직접 설정하기
-    , InternalIndex(-1)
-    , NamePrivate("None")
+    // GUObjectArray.AddObject에서 설정됨
+    , InternalIndex(INDEX_NONE)
+    , HashIndex(INDEX_NONE)
 {
 }
 
 UObject* UObject::Duplicate(UObject* InOuter)
 {
-    return FObjectFactory::ConstructObject(GetClass(), InOuter);
+    FObjectDuplicator* Duplicator = FObjectDuplicator::GetActive();
+    if (!Duplicator)
+    {
+        return FObjectFactory::ConstructObject(GetClass(), InOuter);
+    }
+
+    UObject* NewObject = Duplicator->FindDuplicate(this);
+    if (NewObject)
+    {
+        NewObject->OuterPrivate = InOuter;
+    }
+    else
+    {
+        NewObject = FObjectFactory::ConstructObject(GetClass(), InOuter);
+        Duplicator->AddDuplicate(this, NewObject);
+    }
+
+    // 객체 포인터는 원본을 가리키는 채로 복사되고, 모든 복제가 끝난 뒤 FixupReferences에서 바뀜
+    GetClass()->CopyProperties(NewObject, this);
+    return NewObject;
 }
 
 void UObject::Serialize(FArchive& Ar)
@@ -1,6 +1,7 @@
 #pragma once
 #include "EngineLoop.h"
 #include "NameTypes.h"
+#include "UObjectAllocator.h"
 #include "Misc/CoreMiscDefines.h"
 
 extern FEngineLoop GEngineLoop;
@@ -28,9 +29,13 @@ private:
     friend class FObjectFactory;
     friend class FSceneMgr;
     friend class UClass;
+    friend class FUObjectArray;
+    friend void AddToClassMap(UObject* Object);
+    friend void RemoveFromClassMap(UObject* Object);
 
     uint32 UUID;
-    uint32 InternalIndex; // Index of GUObjectArray
+    int32 InternalIndex;  // Index of GUObjectArray, 제거 표시되면 INDEX_NONE
+    int32 HashIndex;      // Index of FUObjectHashTables의 Class별 Object 목록
 
     FName NamePrivate;
     UClass* ClassPrivate = nullptr;
@@ -44,8 +49,16 @@ public:
     UObject();
     virtual ~UObject() = default;
 
+    /**
+     * 같은 Class의 객체를 만들어 값을 복사합니다.
+     * FObjectDuplicator가 활성화되어 있으면 미리 할당된 복제본을 사용하고, 등록된 Property를 복사한 뒤 대응에 등록합니다.
+     * @param InOuter 복제본의 Outer
+     */
     virtual UObject* Duplicate(UObject* InOuter);
 
+    /** FObjectDuplicator::FixupReferences에서 모든 참조가 복제본으로 바뀐 뒤 호출됩니다. */
+    virtual void PostDuplicate() {}
+
     UObject* GetOuter() const { return OuterPrivate; }
     virtual UWorld* GetWorld() const;
     virtual void Serialize(FArchive& Ar);
@@ -55,7 +68,7 @@ public:
 
 
     uint32 GetUUID() const { return UUID; }
-    uint32 GetInternalIndex() const { return InternalIndex; }
+    int32 GetInternalIndex() const { return InternalIndex; }
 
     UClass* GetClass() const { return ClassPrivate; }
 
@@ -73,22 +86,13 @@ public:
 public:
     void* operator new(size_t size)
     {
-        UE_LOG(ELogLevel::Display, "UObject Created : %d", size);
-
-        void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(size);
-        UE_LOG(
-            ELogLevel::Display,
-            "TotalAllocationBytes : %d, TotalAllocationCount : %d",
-            FPlatformMemory::GetAllocationBytes<EAT_Object>(),
-            FPlatformMemory::GetAllocationCount<EAT_Object>()
-        );
-        return RawMemory;
+        return FUObjectAllocator::Get().Allocate(size);
     }
 
+    /** virtual 소멸자를 통해 호출되므로 size는 실제 객체 타입의 크기 */
     void operator delete(void* ptr, size_t size)
     {
-        UE_LOG(ELogLevel::Display, "UObject Deleted : %d", size);
-        FPlatformMemory::Free<EAT_Object>(ptr, size);
+        FUObjectAllocator::Get().Free(ptr, size);
     }
 
     FVector4 EncodeUUID() const {
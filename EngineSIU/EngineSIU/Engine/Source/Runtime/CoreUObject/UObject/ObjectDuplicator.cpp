@@ -0,0 +1,79 @@
+#include "ObjectDuplicator.h"
+
+#include <cassert>
+#include "Class.h"
+#include "Object.h"
+
+
+namespace
+{
+/** 복제는 메인 스레드에서만 일어나므로 스택 하나로 충분함 */
+FObjectDuplicator* GActiveDuplicator = nullptr;
+}
+
+
+FObjectDuplicator::FObjectDuplicator()
+    : Previous(GActiveDuplicator)
+{
+    GActiveDuplicator = this;
+}
+
+FObjectDuplicator::~FObjectDuplicator()
+{
+    assert(GActiveDuplicator == this);
+    GActiveDuplicator = Previous;
+}
+
+FObjectDuplicator* FObjectDuplicator::GetActive()
+{
+    return GActiveDuplicator;
+}
+
+void FObjectDuplicator::Reserve(int32 NumObjects)
+{
+    DuplicateMap.Reserve(NumObjects);
+    Duplicates.Reserve(NumObjects);
+}
+
+void FObjectDuplicator::AddDuplicate(const UObject* Original, UObject* Duplicate)
+{
+    assert(Original && Duplicate);
+    assert(Original->GetClass() == Duplicate->GetClass());
+
+    if (!DuplicateMap.Contains(Original))
+    {
+        Duplicates.Add(Duplicate);
+    }
+    DuplicateMap.Add(Original, Duplicate);
+}
+
+UObject* FObjectDuplicator::FindDuplicate(const UObject* Original) const
+{
+    UObject* const* Found = DuplicateMap.Find(Original);
+    return Found ? *Found : nullptr;
+}
+
+void* FObjectDuplicator::RemapAddress(const void* Address) const
+{
+    if (!Address)
+    {
+        return nullptr;
+    }
+
+    UObject* const* Found = DuplicateMap.Find(Address);
+    return Found ? *Found : const_cast<void*>(Address);
+}
+
+void FObjectDuplicator::FixupReferences()
+{
+    for (UObject* Duplicate : Duplicates)
+    {
+        Duplicate->GetClass()->RemapReferences(Duplicate, *this);
+    }
+
+    // 모든 참조가 바뀐 뒤에 호출해야 서로를 가리키는 관계(부모/자식 등)를 검사할 수 있음
+    for (UObject* Duplicate : Duplicates)
+    {
+        Duplicate->PostDuplicate();
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "HAL/PlatformType.h"
+
+class UObject;
+
+
+/**
+ * 여러 객체를 한 번에 복제할 때 원본과 복제본의 대응을 관리합니다.
+ * 생성되어 있는 동안 활성화되며, 그 사이의 UObject::Duplicate는
+ *  1. 미리 할당된 복제본이 있으면 새로 생성하지 않고 그 객체를 사용하고
+ *  2. UClass에 등록된 Property를 복사한 뒤
+ *  3. 복제본을 대응에 등록합니다.
+ * 모든 복제가 끝나면 FixupReferences를 한 번 호출해서 원본을 가리키는 객체 포인터 Property를 복제본으로 바꿉니다.
+ *
+ * Example Code
+ * ```
+ * FObjectDuplicator Duplicator;
+ * Actor->PreallocateDuplicate(World, Duplicator);
+ * AActor* NewActor = static_cast<AActor*>(Actor->Duplicate(World));
+ * Duplicator.FixupReferences();
+ * ```
+ */
+class FObjectDuplicator
+{
+public:
+    FObjectDuplicator();
+    ~FObjectDuplicator();
+
+    FObjectDuplicator(const FObjectDuplicator&) = delete;
+    FObjectDuplicator& operator=(const FObjectDuplicator&) = delete;
+
+    /** @return 현재 진행 중인 묶음 복제, 없으면 nullptr */
+    static FObjectDuplicator* GetActive();
+
+    /**
+     * @param NumObjects 복제할 객체 수, 대응 테이블을 미리 할당
+     */
+    void Reserve(int32 NumObjects);
+
+    /**
+     * Original의 복제본으로 Duplicate를 등록합니다.
+     * @param Duplicate Original과 같은 Class여야 함
+     */
+    void AddDuplicate(const UObject* Original, UObject* Duplicate);
+
+    /** @return 등록된 복제본, 없으면 nullptr */
+    UObject* FindDuplicate(const UObject* Original) const;
+
+    /**
+     * 객체 포인터 Property의 값을 바꿀 때 사용합니다.
+     * 타입을 모르는 포인터도 받을 수 있도록 주소로 비교합니다.
+     * @return Address가 복제된 원본이면 복제본의 주소, 아니면 Address 그대로
+     */
+    void* RemapAddress(const void* Address) const;
+
+    /**
+     * 등록된 모든 복제본의 객체 포인터 Property를 복제본으로 바꾸고 PostDuplicate를 호출합니다.
+     * 복제가 모두 끝난 뒤 한 번만 호출합니다.
+     */
+    void FixupReferences();
+
+    int32 GetNumDuplicates() const { return Duplicates.Num(); }
+
+private:
+    /** 원본 주소 -> 복제본 */
+    TMap<const void*, UObject*> DuplicateMap;
+
+    /** 등록 순서대로의 복제본, FixupReferences에서 순회 */
+    TArray<UObject*> Duplicates;
+
+    /** 중첩된 경우 소멸될 때 되돌릴 이전 Duplicator */
+    FObjectDuplicator* Previous = nullptr;
+};
@@ -1 +1,4 @@
 #include "ObjectFactory.h"
+
+// 객체 생성 로그는 기본적으로 출력하지 않음 (콘솔에서 log LogObject verbose)
+DEFINE_LOG_CATEGORY(LogObject, Display)
@@ -6,27 +6,28 @@
 #include "UObjectArray.h"
 #include "UserInterface/Console.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogObject)
+
 class FObjectFactory
 {
 public:
+    /**
+     * 객체를 생성하고 GUObjectArray에 등록합니다.
+     * @param InName NAME_None이면 "Class이름_UUID" 이름을 붙임 (문자열은 GetName을 호출할 때 만들어짐)
+     */
     static UObject* ConstructObject(UClass* InClass, UObject* InOuter, FName InName = NAME_None)
     {
         const uint32 Id = UEngineStatics::GenUUID();
-        FString Name = InClass->GetName() + "_" + std::to_string(Id);
-        if (InName != NAME_None)
-        {
-            Name = InName.ToString();
-        }
 
         UObject* Obj = InClass->ClassCTOR();
         Obj->ClassPrivate = InClass;
-        Obj->NamePrivate = Name;
+        Obj->NamePrivate = InName != NAME_None ? InName : FName(InClass->GetFName(), NAME_EXTERNAL_TO_INTERNAL(Id));
         Obj->UUID = Id;
         Obj->OuterPrivate = InOuter;
 
         GUObjectArray.AddObject(Obj);
 
-        UE_LOG(ELogLevel::Display, "Created New Object : %s", *Name);
+        UE_LOG_CATEGORY(LogObject, ELogLevel::Verbose, "Created New Object : %s", *Obj->GetName());
         return Obj;
     }
 
@@ -38,7 +38,7 @@ public: \
             static_cast<uint32>(alignof(TClass)), \
             TSuperClass::StaticClass(), \
             []() -> UObject* { \
-                void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(TClass)); \
+                void* RawMemory = TClass::StaticClass()->AllocateObjectMemory(); \
                 ::new (RawMemory) TClass; \
                 return static_cast<UObject*>(RawMemory); \
             } \
@@ -83,7 +83,10 @@ public: \
         { \
             constexpr int64 Offset = offsetof(ThisClass, VarName); \
             ThisClass::StaticClass()->RegisterProperty( \
-                { #VarName, sizeof(Type), Offset } \
+                { \
+                    #VarName, sizeof(Type), Offset, \
+                    &TPropertyOps<Type>::CopyValue, TPropertyOps<Type>::RemapReferences \
+                } \
             ); \
         } \
     } VarName##_PropRegistrar_{};
@@ -1,8 +1,20 @@
 ﻿#include "ObjectUtils.h"
+#include "Object.h"
 #include "UObjectArray.h"
 
 
 bool IsValid(const UObject* Test)
 {
-    return Test && GUObjectArray.GetObjectItemArrayUnsafe().Contains(const_cast<UObject*>(Test));
+    return Test && GUObjectArray.IndexToObject(Test->GetInternalIndex()) == Test;
+}
+
+void GetObjectSlot(const UObject* Object, int32& OutIndex, int32& OutSerialNumber)
+{
+    OutIndex = Object ? Object->GetInternalIndex() : INDEX_NONE;
+    OutSerialNumber = GUObjectArray.GetSerialNumber(OutIndex);
+}
+
+bool IsValidObjectSlot(int32 Index, int32 SerialNumber)
+{
+    return GUObjectArray.IsValidIndex(Index, SerialNumber);
 }
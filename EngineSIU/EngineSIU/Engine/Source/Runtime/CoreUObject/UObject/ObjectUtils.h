@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "HAL/PlatformType.h"
 
 class UObject;
 
@@ -7,5 +8,18 @@ class UObject;
  *
  * @param Test 유효성을 검사할 UObject 포인터입니다.
  * @return 포인터가 유효하면 true를 반환하고, 그렇지 않으면 false를 반환합니다.
+ *
+ * @note 제거 대기 중인 Object는 유효하지 않습니다. 이미 삭제되었을 수 있는 Object는 TWeakObjectPtr로 확인해야 합니다.
  */
 bool IsValid(const UObject* Test);
+
+/**
+ * Object가 GUObjectArray에서 차지하고 있는 칸을 가져옵니다.
+ * 칸이 재사용되어도 SerialNumber가 달라지므로 삭제된 Object를 가리키는지 IsValidObjectSlot으로 판별할 수 있습니다.
+ *
+ * @param OutIndex 등록되지 않은 Object이거나 nullptr이면 INDEX_NONE
+ */
+void GetObjectSlot(const UObject* Object, int32& OutIndex, int32& OutSerialNumber);
+
+/** GetObjectSlot으로 얻은 칸의 Object가 아직 살아있는지 확인합니다. Object의 메모리는 읽지 않습니다. */
+bool IsValidObjectSlot(int32 Index, int32 SerialNumber);
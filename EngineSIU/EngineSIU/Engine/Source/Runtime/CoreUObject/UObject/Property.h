@@ -1,13 +1,28 @@
 ﻿#pragma once
 #include "Object.h"
+#include "ObjectDuplicator.h"
 
 
 struct FProperty
 {
-    FProperty(const char* InName, int32 InSize, int32 InOffset)
+    /** Dest와 Src는 Property 값의 주소 */
+    using CopyFunctionType = void(*)(void* Dest, const void* Src);
+
+    /** Value는 Property 값의 주소 */
+    using RemapFunctionType = void(*)(void* Value, const FObjectDuplicator& Duplicator);
+
+    FProperty(
+        const char* InName,
+        int32 InSize,
+        int32 InOffset,
+        CopyFunctionType InCopyValue = nullptr,
+        RemapFunctionType InRemapReferences = nullptr
+    )
         : Name(InName)
         , Size(InSize)
         , Offset(InOffset)
+        , CopyValue(InCopyValue)
+        , RemapReferences(InRemapReferences)
     {}
 
     virtual ~FProperty() = default;
@@ -15,6 +30,60 @@ struct FProperty
     const char* Name;
     int64 Size;
     int64 Offset;
+
+    /** 타입의 대입 연산자로 값을 복사합니다. (FString, TArray 등도 안전하게 복사) */
+    CopyFunctionType CopyValue;
+
+    /** 객체 포인터나 객체 포인터 배열인 Property만 설정되며, 원본을 가리키면 복제본으로 바꿉니다. */
+    RemapFunctionType RemapReferences;
+};
+
+
+/**
+ * UPROPERTY가 Property 타입별로 복사/참조 변경 함수를 만들 때 사용합니다.
+ * 포인터는 가리키는 타입이 불완전해도 되도록 주소만 비교합니다.
+ */
+template <typename T>
+struct TPropertyOps
+{
+    static void CopyValue(void* Dest, const void* Src)
+    {
+        *static_cast<T*>(Dest) = *static_cast<const T*>(Src);
+    }
+
+    static constexpr FProperty::RemapFunctionType RemapReferences = nullptr;
+};
+
+template <typename T>
+struct TPropertyOps<T*>
+{
+    static void CopyValue(void* Dest, const void* Src)
+    {
+        *static_cast<T**>(Dest) = *static_cast<T* const*>(Src);
+    }
+
+    static void RemapReferences(void* Value, const FObjectDuplicator& Duplicator)
+    {
+        T*& Pointer = *static_cast<T**>(Value);
+        Pointer = static_cast<T*>(Duplicator.RemapAddress(Pointer));
+    }
+};
+
+template <typename T, typename Allocator>
+struct TPropertyOps<TArray<T*, Allocator>>
+{
+    static void CopyValue(void* Dest, const void* Src)
+    {
+        *static_cast<TArray<T*, Allocator>*>(Dest) = *static_cast<const TArray<T*, Allocator>*>(Src);
+    }
+
+    static void RemapReferences(void* Value, const FObjectDuplicator& Duplicator)
+    {
+        for (T*& Pointer : *static_cast<TArray<T*, Allocator>*>(Value))
+        {
+            Pointer = static_cast<T*>(Duplicator.RemapAddress(Pointer));
+        }
+    }
 };
 
 
@@ -0,0 +1,89 @@
+#include "UObjectAllocator.h"
+
+#include <cassert>
+#include "HAL/PlatformMemory.h"
+
+
+FUObjectAllocator& FUObjectAllocator::Get()
+{
+    static FUObjectAllocator Instance;
+    return Instance;
+}
+
+FUObjectAllocator::FUObjectAllocator()
+{
+    for (uint32 Index = 0; Index < std::size(Pools); ++Index)
+    {
+        Pools[Index].BlockSize = (Index + 1) * BlockGranularity;
+    }
+}
+
+FUObjectAllocator::FPool* FUObjectAllocator::FindPool(size_t Size)
+{
+    if (Size == 0 || Size > MaxPooledSize)
+    {
+        return nullptr;
+    }
+    return &Pools[(Size - 1) / BlockGranularity];
+}
+
+void* FUObjectAllocator::Allocate(FPool* Pool, size_t Size)
+{
+    if (!Pool)
+    {
+        return FPlatformMemory::Malloc<EAT_Object>(Size);
+    }
+    assert(Size <= Pool->BlockSize);
+
+    void* Block;
+    {
+        std::lock_guard Lock(Pool->Mutex);
+        Block = AllocateBlock(Pool);
+    }
+
+    FPlatformMemory::IncrementStats<EAT_Object>(Size);
+    return Block;
+}
+
+void FUObjectAllocator::Free(void* Ptr, size_t Size)
+{
+    if (!Ptr)
+    {
+        return;
+    }
+
+    FPool* Pool = FindPool(Size);
+    if (!Pool)
+    {
+        FPlatformMemory::Free<EAT_Object>(Ptr, Size);
+        return;
+    }
+
+    FPlatformMemory::DecrementStats<EAT_Object>(Size);
+
+    std::lock_guard Lock(Pool->Mutex);
+    *static_cast<void**>(Ptr) = Pool->FreeList;
+    Pool->FreeList = Ptr;
+}
+
+void* FUObjectAllocator::AllocateBlock(FPool* Pool)
+{
+    if (void* Block = Pool->FreeList)
+    {
+        Pool->FreeList = *static_cast<void**>(Block);
+        return Block;
+    }
+
+    if (Pool->ChunkOffset + Pool->BlockSize > ChunkSize)
+    {
+        // Chunk 끝에 남는 BlockSize 미만의 자투리는 버림
+        Pool->Chunk = static_cast<uint8*>(_aligned_malloc(ChunkSize, BlockGranularity));
+        assert(Pool->Chunk);
+        Pool->ChunkOffset = 0;
+        ReservedBytes.fetch_add(ChunkSize, std::memory_order_relaxed);
+    }
+
+    void* Block = Pool->Chunk + Pool->ChunkOffset;
+    Pool->ChunkOffset += Pool->BlockSize;
+    return Block;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+
+#include "HAL/PlatformType.h"
+
+
+/**
+ * UObject 메모리를 크기별 Pool에서 할당합니다.
+ * 16 Byte 단위 크기마다 Pool이 하나씩 있고, 각 Pool은 64KB Chunk를 잘라 쓰며 해제된 블록은 Free List로 재사용합니다.
+ * UClass는 자기 크기의 Pool을 캐시해 두므로 생성할 때 크기 계산 없이 바로 Pool에서 꺼냅니다.
+ * MaxPooledSize보다 큰 객체는 FPlatformMemory::Malloc으로 할당합니다.
+ *
+ * @note Chunk는 프로그램이 끝날 때까지 OS에 반환하지 않습니다.
+ */
+class FUObjectAllocator
+{
+public:
+    static constexpr uint32 BlockGranularity = 16;
+    static constexpr uint32 MaxPooledSize = 4096;
+    static constexpr uint32 ChunkSize = 64 * 1024;
+
+    /** 같은 크기 구간의 객체들이 공유하는 Pool */
+    struct FPool
+    {
+        std::mutex Mutex;
+
+        /** 이 Pool의 블록 크기, BlockGranularity의 배수 */
+        uint32 BlockSize = 0;
+
+        /** 해제된 블록들, 블록의 앞 8 Byte에 다음 블록의 주소를 저장 */
+        void* FreeList = nullptr;
+
+        /** 아직 한 번도 쓰지 않은 영역을 잘라 쓰는 현재 Chunk */
+        uint8* Chunk = nullptr;
+        uint32 ChunkOffset = ChunkSize;
+    };
+
+public:
+    static FUObjectAllocator& Get();
+
+    FUObjectAllocator(const FUObjectAllocator&) = delete;
+    FUObjectAllocator& operator=(const FUObjectAllocator&) = delete;
+
+    /**
+     * Size 크기의 객체가 사용할 Pool을 찾습니다.
+     * @return MaxPooledSize보다 크면 nullptr
+     */
+    FPool* FindPool(size_t Size);
+
+    /**
+     * 객체 메모리를 할당합니다. EAT_Object 통계에 Size만큼 더해집니다.
+     * @param Pool FindPool(Size)의 결과, nullptr이면 FPlatformMemory::Malloc 사용
+     * @param Size 객체의 크기
+     */
+    void* Allocate(FPool* Pool, size_t Size);
+    void* Allocate(size_t Size) { return Allocate(FindPool(Size), Size); }
+
+    /**
+     * Allocate로 할당한 메모리를 Pool에 돌려줍니다.
+     * @param Size Allocate에 넘긴 크기 (sized delete가 넘겨주는 실제 객체의 크기)
+     */
+    void Free(void* Ptr, size_t Size);
+
+    /** Pool들이 OS에서 받아 둔 Chunk의 전체 크기 (Byte) */
+    uint64 GetReservedBytes() const { return ReservedBytes.load(std::memory_order_relaxed); }
+
+private:
+    FUObjectAllocator();
+    ~FUObjectAllocator() = default;
+
+    /** Pool의 Mutex를 잡은 상태에서 호출 */
+    void* AllocateBlock(FPool* Pool);
+
+private:
+    FPool Pools[MaxPooledSize / BlockGranularity];
+
+    std::atomic<uint64> ReservedBytes = 0;
+};
@@ -1,31 +1,61 @@
 ﻿#include "UObjectArray.h"
+#include <cassert>
 #include "Object.h"
 #include "UObjectHash.h"
 
 
 void FUObjectArray::AddObject(UObject* Object)
 {
-    ObjObjects.Add(Object);
+    assert(Object->InternalIndex == INDEX_NONE);
+
+    int32 Index;
+    if (ObjAvailableList.Num() > 0)
+    {
+        Index = ObjAvailableList.Pop();
+    }
+    else
+    {
+        Index = ObjObjects.Emplace();
+    }
+
+    ObjObjects[Index].Object = Object;
+    Object->InternalIndex = Index;
     AddToClassMap(Object);
 }
 
 void FUObjectArray::MarkRemoveObject(UObject* Object)
 {
-    ObjObjects.Remove(Object);
+    const int32 Index = Object->InternalIndex;
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+    assert(ObjObjects[Index].Object == Object);
+
+    // 칸을 비우고 SerialNumber를 올려서 이 칸을 가리키던 Weak 참조가 모두 무효가 되도록 함
+    FUObjectItem& Item = ObjObjects[Index];
+    Item.Object = nullptr;
+    ++Item.SerialNumber;
+    ObjAvailableList.Add(Index);
+    Object->InternalIndex = INDEX_NONE;
+
     RemoveFromClassMap(Object);  // UObjectHashTable에서 Object를 제외
-    PendingDestroyObjects.AddUnique(Object);
+    PendingDestroyObjects.Add(Object);
 }
 
 void FUObjectArray::ProcessPendingDestroyObjects()
 {
-    for (UObject* Object : PendingDestroyObjects)
+    // 소멸자에서 다른 Object를 제거 표시할 수 있으므로 대기열이 빌 때까지 묶음 단위로 처리
+    TArray<UObject*> DestroyBatch;
+    while (!PendingDestroyObjects.IsEmpty())
     {
-        if (Object)
+        std::swap(DestroyBatch, PendingDestroyObjects);
+        for (UObject* Object : DestroyBatch)
         {
             delete Object;
         }
+        DestroyBatch.Empty();
     }
-    PendingDestroyObjects.Empty();
 }
 
 FUObjectArray GUObjectArray;
@@ -1,31 +1,79 @@
 ﻿#pragma once
 #include "Container/Array.h"
-#include "Container/Set.h"
+#include "HAL/PlatformType.h"
 
 class UClass;
 class UObject;
 
 
+/** GUObjectArray의 한 칸 */
+struct FUObjectItem
+{
+    /** 이 칸을 쓰고 있는 Object, 비어 있으면 nullptr */
+    UObject* Object = nullptr;
+
+    /** 칸이 비워질 때마다 증가, Index와 함께 저장해 두면 칸이 재사용되었는지 알 수 있음 */
+    int32 SerialNumber = 0;
+};
+
+/**
+ * 모든 UObject를 고정된 칸(Index)에 저장합니다.
+ * Object는 생성될 때 빈 칸을 받아 제거될 때까지 같은 Index를 가지고, 제거되면 칸의 SerialNumber가 증가한 뒤 다른 Object에 재사용됩니다.
+ * 등록, 제거 표시 모두 O(1)이며, 실제 메모리 해제는 프레임이 끝날 때 ProcessPendingDestroyObjects에서 한 번에 처리합니다.
+ */
 class FUObjectArray
 {
 public:
     void AddObject(UObject* Object);
+
+    /**
+     * Object를 배열에서 빼고 제거 대기열에 넣습니다.
+     * 이미 제거 대기 중이거나 등록되지 않은 Object는 무시합니다.
+     */
     void MarkRemoveObject(UObject* Object);
 
+    /** 제거 대기열의 Object를 모두 삭제합니다, 소멸자에서 제거 표시된 Object도 함께 삭제됩니다. */
     void ProcessPendingDestroyObjects();
 
-    TSet<UObject*>& GetObjectItemArrayUnsafe()
+    /** @return Index 칸의 Object, 비어 있으면 nullptr */
+    UObject* IndexToObject(int32 Index) const
     {
-        return ObjObjects;
+        return Index >= 0 && Index < ObjObjects.Num() ? ObjObjects[Index].Object : nullptr;
+    }
+
+    /** @return Index 칸의 현재 SerialNumber */
+    int32 GetSerialNumber(int32 Index) const
+    {
+        return Index >= 0 && Index < ObjObjects.Num() ? ObjObjects[Index].SerialNumber : 0;
+    }
+
+    /**
+     * Index 칸이 SerialNumber일 때 등록된 Object가 아직 살아있는지 확인합니다.
+     * 삭제된 Object의 메모리를 읽지 않으므로 이미 해제된 Object에 대해서도 안전합니다.
+     */
+    bool IsValidIndex(int32 Index, int32 SerialNumber) const
+    {
+        return Index >= 0 && Index < ObjObjects.Num() && ObjObjects[Index].Object && ObjObjects[Index].SerialNumber == SerialNumber;
     }
 
-    const TSet<UObject*>& GetObjectItemArrayUnsafe() const
+    /** 살아있는 Object 수 */
+    int32 GetObjectArrayNumMinusAvailable() const { return ObjObjects.Num() - ObjAvailableList.Num(); }
+
+    /** 제거 대기 중인 Object 수 */
+    int32 GetNumPendingDestroy() const { return PendingDestroyObjects.Num(); }
+
+    /** 모든 칸, 빈 칸(Object == nullptr)이 섞여 있음 */
+    const TArray<FUObjectItem>& GetObjectItemArrayUnsafe() const
     {
         return ObjObjects;
     }
 
 private:
-    TSet<UObject*> ObjObjects;
+    TArray<FUObjectItem> ObjObjects;
+
+    /** 비어 있는 칸의 Index, 나중에 빈 칸부터 재사용 */
+    TArray<int32> ObjAvailableList;
+
     TArray<UObject*> PendingDestroyObjects;
 };
 
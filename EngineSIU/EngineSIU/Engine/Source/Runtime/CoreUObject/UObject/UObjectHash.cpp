@@ -1,12 +1,32 @@
 #include "UObjectHash.h"
 #include <cassert>
+#include <memory>
+#include <mutex>
 #include "Object.h"
 #include "Class.h"
 #include "Container/Map.h"
 #include "Container/Set.h"
 
+/**
+ * 하나의 Class에 속한 Object 목록
+ * Object는 밀집 배열에 저장되며, 제거 시 마지막 원소와 교체(swap-remove)합니다.
+ */
+struct FClassObjectList
+{
+    TArray<UObject*> Objects;
+
+    /**
+     * 자신과 모든 파생 클래스의 Object 목록, DerivedListsVersion이 다르면 새 배열로 다시 만듭니다.
+     * 순회 중인 TObjectIterator는 이전 배열을 계속 들고 있으므로 제자리에서 고치지 않습니다.
+     */
+    std::shared_ptr<const TArray<TArray<UObject*>*>> DerivedLists;
+    uint32 DerivedListsVersion = 0;
+};
+
 /**
  * 모든 UObject의 정보를 담고 있는 HashTable
+ * 렌더 패스가 워커 스레드에서 TObjectRange를 만들기 때문에, 두 Map과 DerivedLists는 Mutex를 잡고 접근합니다.
+ * @note Class별 Objects 배열 자체는 잠그지 않으므로, 워커가 순회하는 동안 Object를 생성/제거해서는 안 됩니다.
  */
 struct FUObjectHashTables
 {
@@ -26,8 +46,26 @@ public:
         return Singleton;
     }
 
+    /** Mutex를 잡은 상태에서 호출해야 합니다. */
+    FClassObjectList& FindOrAddObjectList(const UClass* Class)
+    {
+        std::unique_ptr<FClassObjectList>& List = ClassToObjectListMap.FindOrAdd(const_cast<UClass*>(Class));
+        if (!List)
+        {
+            List = std::make_unique<FClassObjectList>();
+        }
+        return *List;
+    }
+
     TMap<UClass*, TSet<UClass*>> ClassToChildListMap;
-    TMap<UClass*, TSet<UObject*>> ClassToObjectListMap;
+
+    /** FClassObjectList의 주소는 TObjectIterator가 참조하므로 힙에 할당해 고정합니다. */
+    TMap<UClass*, std::unique_ptr<FClassObjectList>> ClassToObjectListMap;
+
+    /** ClassToChildListMap이 변경될 때마다 증가합니다. */
+    uint32 ClassTreeVersion = 1;
+
+    std::mutex Mutex;
 };
 
 /** Helper function that returns all the children of the specified class recursively */
@@ -63,30 +101,74 @@ static void RecursivelyPopulateDerivedClasses(FUObjectHashTables& ThreadHash, co
     }
 }
 
+/** Mutex를 잡은 상태에서 InClass의 상속 구조를 ClassToChildListMap에 추가합니다. */
+static void AddClassToChildListMapLocked(FUObjectHashTables& HashTable, UClass* InClass)
+{
+    UClass* CurrentClass = InClass;
+
+    for (UClass* SuperClass = CurrentClass->GetSuperClass(); SuperClass;)
+    {
+        TSet<UClass*>& ChildSet = HashTable.ClassToChildListMap.FindOrAdd(SuperClass);
+        if (!ChildSet.Contains(CurrentClass))
+        {
+            ChildSet.Add(CurrentClass);
+            ++HashTable.ClassTreeVersion;
+        }
+
+        CurrentClass = SuperClass;
+        SuperClass = SuperClass->GetSuperClass();
+    }
+}
+
 void AddToClassMap(UObject* Object)
 {
     assert(Object->GetClass());
     FUObjectHashTables& HashTable = FUObjectHashTables::Get();
+    std::lock_guard Lock(HashTable.Mutex);
 
     UClass* Class = Object->GetClass();
-    HashTable.ClassToObjectListMap.FindOrAdd(Class).Add(Object);
 
     // Ensure child class mappings are updated
-    AddClassToChildListMap(Class);
+    AddClassToChildListMapLocked(HashTable, Class);
+
+    if (Object->HashIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    TArray<UObject*>& Objects = HashTable.FindOrAddObjectList(Class).Objects;
+    Object->HashIndex = Objects.Add(Object);
 }
 
 void RemoveFromClassMap(UObject* Object)
 {
     assert(Object->GetClass());
     FUObjectHashTables& HashTable = FUObjectHashTables::Get();
+    std::lock_guard Lock(HashTable.Mutex);
+
+    const int32 Index = Object->HashIndex;
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
 
-    TSet<UObject*>& ObjectSet = HashTable.ClassToObjectListMap.FindOrAdd(Object->GetClass());
-    int32 NumRemoved = ObjectSet.Remove(Object);
+    const std::unique_ptr<FClassObjectList>* List = HashTable.ClassToObjectListMap.Find(Object->GetClass());
+    if (!List || !*List)
+    {
+        return;
+    }
 
-    if (NumRemoved == 0)
+    TArray<UObject*>& Objects = (*List)->Objects;
+    assert(Objects[Index] == Object);
+
+    // 마지막 Object를 빈 자리로 옮겨 배열을 밀집 상태로 유지
+    UObject* LastObject = Objects.Pop();
+    if (LastObject != Object)
     {
-        HashTable.ClassToObjectListMap.Remove(Object->GetClass());
+        Objects[Index] = LastObject;
+        LastObject->HashIndex = Index;
     }
+    Object->HashIndex = INDEX_NONE;
 }
 
 void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results)
@@ -94,18 +176,50 @@ void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results)
     Results.Add(ClassToLookFor);
 
     FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
+    std::lock_guard Lock(ThreadHash.Mutex);
     RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, Results);
 }
 
 uint32 GetNumOfObjectsByClass(UClass* ClassToLookFor)
 {
-    if (const TSet<UObject*>* ObjectSet = FUObjectHashTables::Get().ClassToObjectListMap.Find(ClassToLookFor))
+    FUObjectHashTables& HashTable = FUObjectHashTables::Get();
+    std::lock_guard Lock(HashTable.Mutex);
+
+    if (const std::unique_ptr<FClassObjectList>* List = HashTable.ClassToObjectListMap.Find(ClassToLookFor))
     {
-        return ObjectSet->Num();
+        return (*List)->Objects.Num();
     }
     return 0;
 }
 
+FObjectListsRef GetObjectListsOfClass(const UClass* ClassToLookFor)
+{
+    FUObjectHashTables& HashTable = FUObjectHashTables::Get();
+    std::lock_guard Lock(HashTable.Mutex);
+
+    FClassObjectList& List = HashTable.FindOrAddObjectList(ClassToLookFor);
+    if (!List.DerivedLists || List.DerivedListsVersion != HashTable.ClassTreeVersion)
+    {
+        TArray<const UClass*> Classes;
+        Classes.Add(ClassToLookFor);
+        RecursivelyPopulateDerivedClasses(HashTable, ClassToLookFor, Classes);
+
+        // 첫 번째 목록은 항상 ClassToLookFor 자신의 목록
+        auto DerivedLists = std::make_shared<TArray<TArray<UObject*>*>>();
+        DerivedLists->Reserve(Classes.Num());
+        for (const UClass* Class : Classes)
+        {
+            DerivedLists->Add(&HashTable.FindOrAddObjectList(Class).Objects);
+        }
+
+        // 이전 배열은 그것을 들고 있는 Iterator가 끝날 때 해제됨
+        List.DerivedLists = std::move(DerivedLists);
+        List.DerivedListsVersion = HashTable.ClassTreeVersion;
+    }
+
+    return List.DerivedLists;
+}
+
 void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses)
 {
     // Most classes searched for have around 10 subclasses, some have hundreds
@@ -113,6 +227,7 @@ void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results,
     ClassesToSearch.Add(ClassToLookFor);
 
     FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
+    std::lock_guard Lock(ThreadHash.Mutex);
 
     if (bIncludeDerivedClasses)
     {
@@ -122,9 +237,11 @@ void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results,
 
     for (const UClass* SearchClass : ClassesToSearch)
     {
-        if (TSet<UObject*>* List = ThreadHash.ClassToObjectListMap.Find(const_cast<UClass*>(SearchClass)))
+        if (const std::unique_ptr<FClassObjectList>* List = ThreadHash.ClassToObjectListMap.Find(const_cast<UClass*>(SearchClass)))
         {
-            for (const auto& Object : *List)
+            const TArray<UObject*>& Objects = (*List)->Objects;
+            Results.Reserve(Results.Num() + Objects.Num());
+            for (UObject* Object : Objects)
             {
                 Results.Add(Object);
             }
@@ -135,13 +252,6 @@ void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results,
 void AddClassToChildListMap(UClass* InClass)
 {
     FUObjectHashTables& HashTable = FUObjectHashTables::Get();
-    UClass* CurrentClass = InClass;
-
-    for (UClass* SuperClass = CurrentClass->GetSuperClass(); SuperClass;)
-    {
-        HashTable.ClassToChildListMap.FindOrAdd(SuperClass).Add(CurrentClass);
-
-        CurrentClass = SuperClass;
-        SuperClass = SuperClass->GetSuperClass();
-    }
+    std::lock_guard Lock(HashTable.Mutex);
+    AddClassToChildListMapLocked(HashTable, InClass);
 }
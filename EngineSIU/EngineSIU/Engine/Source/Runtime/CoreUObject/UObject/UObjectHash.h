@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include "Container/Array.h"
 
 class UObject;
@@ -31,5 +32,16 @@ void RemoveFromClassMap(UObject* Object);
  */
 void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results);
 
+/** GetObjectListsOfClass의 결과, 상속 구조가 바뀌어도 들고 있는 동안에는 해제되지 않습니다. */
+using FObjectListsRef = std::shared_ptr<const TArray<TArray<UObject*>*>>;
+
+/**
+ * ClassToLookFor와 그 파생 클래스들의 Object 목록을 복사 없이 반환합니다.
+ * 첫 번째 원소는 항상 ClassToLookFor 자신의 목록입니다.
+ * 어느 스레드에서든 호출할 수 있습니다.
+ * @note 각 Object 목록은 Object가 생성/제거될 때 바로 갱신되지만, 이후에 추가된 파생 클래스의 목록은 다시 호출해야 포함됩니다.
+ */
+FObjectListsRef GetObjectListsOfClass(const UClass* ClassToLookFor);
+
 /** ClassToLookFor와 일치하는 오브젝트의 개수를 반환합니다. */
 uint32 GetNumOfObjectsByClass(UClass* ClassToLookFor);
@@ -2,14 +2,18 @@
 #include "Object.h"
 #include "UObjectHash.h"
 #include "Container/Array.h"
+#include "Math/MathUtility.h"
 
 #undef GetObject // Windows.h 이름 겹침
 
 
 /**
  * 특정 타입의 UObject 인스턴스를 순회하기 위한 반복자 클래스입니다.
+ * FUObjectHashTables의 Class별 Object 목록을 복사하지 않고 직접 순회합니다.
  * 
  * @tparam T 순회할 UObject 타입 또는 그 파생 클래스
+ * @note 각 목록을 뒤에서부터 순회하므로, 순회 중에 새 Object를 생성하거나 현재 Object를 제거하는 것은 안전합니다.
+ *       제거는 마지막 Object를 빈 자리로 옮기므로, 아직 방문하지 않은 다른 Object를 제거하면 이미 방문한 Object를 다시 방문할 수 있습니다.
  */
 template <typename T>
     requires std::derived_from<T, UObject>
@@ -23,15 +27,24 @@ public:
 
     /** Begin 생성자 */
     explicit TObjectIterator(bool bIncludeDerivedClasses = true)
-        : Index(-1)
+        : ObjectLists(GetObjectListsOfClass(T::StaticClass()))
+        , bIncludeDerived(bIncludeDerivedClasses)
+        , ListIndex(0)
+        , Index(0)
     {
-        GetObjectsOfClass(T::StaticClass(), ObjectArray, bIncludeDerivedClasses);
+        if (ListIndex < GetNumLists())
+        {
+            Index = (*ObjectLists)[ListIndex]->Num();
+        }
         Advance();
     }
 
     /** End 생성자 */
     TObjectIterator(EEndTagType, const TObjectIterator& Begin)
-        : Index(Begin.ObjectArray.Num())
+        : ObjectLists(nullptr)
+        , bIncludeDerived(Begin.bIncludeDerived)
+        , ListIndex(0)
+        , Index(0)
     {
     }
 
@@ -50,30 +63,66 @@ public:
         return (T*)GetObject();
     }
 
-    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return Index == Rhs.Index; }
-    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return Index != Rhs.Index; }
+    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const
+    {
+        const bool bIsEnd = IsEnd();
+        if (bIsEnd || Rhs.IsEnd())
+        {
+            return bIsEnd == Rhs.IsEnd();
+        }
+        return ListIndex == Rhs.ListIndex && Index == Rhs.Index;
+    }
+    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return !(*this == Rhs); }
 
 protected:
     UObject* GetObject() const 
     { 
-        return ObjectArray[Index];
+        return (*(*ObjectLists)[ListIndex])[Index];
+    }
+
+    int32 GetNumLists() const
+    {
+        if (!ObjectLists)
+        {
+            return 0;
+        }
+        return bIncludeDerived ? ObjectLists->Num() : FMath::Min(ObjectLists->Num(), 1);
+    }
+
+    bool IsEnd() const
+    {
+        return ListIndex >= GetNumLists();
     }
 
     bool Advance()
     {
-        while(++Index < ObjectArray.Num())
+        while (ListIndex < GetNumLists())
         {
-            if (GetObject())
+            const TArray<UObject*>& Objects = *(*ObjectLists)[ListIndex];
+
+            // 순회 중에 Object가 제거되어 목록이 줄어든 경우
+            Index = FMath::Min(Index, Objects.Num());
+            while (--Index >= 0)
+            {
+                if (Objects[Index])
+                {
+                    return true;
+                }
+            }
+
+            if (++ListIndex < GetNumLists())
             {
-                return true;
+                Index = (*ObjectLists)[ListIndex]->Num();
             }
         }
         return false;
     }
 
 protected:
-    /** Results from the GetObjectsOfClass query */
-    TArray<UObject*> ObjectArray;
+    /** GetObjectListsOfClass의 결과, 첫 번째 목록은 T 자신의 목록 */
+    FObjectListsRef ObjectLists;
+    bool bIncludeDerived;
+    int32 ListIndex;
     int32 Index;
 };
 
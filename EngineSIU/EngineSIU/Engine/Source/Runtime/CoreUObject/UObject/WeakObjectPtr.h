@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include <concepts>
 
+#include "CoreMiscDefines.h"
 #include "ObjectUtils.h"
 #include "HAL/PlatformType.h"
 
@@ -8,6 +9,8 @@
  * Object가 유효할때만 값을 반환하는 포인터, Object가 유효하지 않다면 nullptr
  * @tparam T UObject를 상속받은 Class
  *
+ * Object의 GUObjectArray 칸과 SerialNumber를 저장해 두므로, Object가 삭제되고 칸이 재사용되어도 안전하게 무효를 판별합니다.
+ *
  * @note TWeakObjectPtr의 소멸자가 호출이 되어도 Object는 따로 삭제를 하지 않습니다.
  */
 template <typename T>
@@ -33,17 +36,20 @@ public:
     TWeakObjectPtr(ElementType* InPtr)
         : ObjectPtr(InPtr)
     {
+        GetObjectSlot(InPtr, ObjectIndex, ObjectSerialNumber);
     }
 
     TWeakObjectPtr& operator=(nullptr_t)
     {
         ObjectPtr = nullptr;
+        ObjectIndex = INDEX_NONE;
         return *this;
     }
 
     TWeakObjectPtr& operator=(ElementType* InPtr)
     {
         ObjectPtr = InPtr;
+        GetObjectSlot(InPtr, ObjectIndex, ObjectSerialNumber);
         return *this;
     }
 
@@ -52,7 +58,8 @@ public:
     {
         if (ObjectPtr)
         {
-            if (::IsValid(ObjectPtr))
+            // 삭제된 Object의 메모리를 읽지 않도록 칸의 SerialNumber로 확인
+            if (IsValidObjectSlot(ObjectIndex, ObjectSerialNumber))
             {
                 return ObjectPtr;
             }
@@ -71,4 +78,8 @@ public:
 
 private:
     mutable ElementType* ObjectPtr = nullptr;
+
+    /** 가리키는 Object의 GUObjectArray 칸 */
+    int32 ObjectIndex = INDEX_NONE;
+    int32 ObjectSerialNumber = 0;
 };
@@ -1,6 +1,7 @@
 #include "Player.h"
 
 #include "UnrealClient.h"
+#include "CollisionManager.h"
 #include "World/World.h"
 #include "BaseGizmos/GizmoArrowComponent.h"
 #include "BaseGizmos/GizmoCircleComponent.h"
@@ -79,7 +80,11 @@ void AEditorPlayer::ProcessGizmoIntersection(UStaticMeshComponent* Component, co
     float Distance = 0.0f;
     int currentIntersectCount = 0;
     if (!Component) return;
-    if (RayIntersectsObject(PickPosition, Component, Distance, currentIntersectCount))
+
+    FVector RayOrigin;
+    FVector RayDirection;
+    ComputeWorldPickRay(PickPosition, RayOrigin, RayDirection);
+    if (RayIntersectsObject(RayOrigin, RayDirection, Component, Distance, currentIntersectCount))
     {
         if (Distance < minDistance)
         {
@@ -134,26 +139,28 @@ void AEditorPlayer::PickActor(const FVector& pickPosition)
 {
     if (!(ShowFlags::GetInstance().CurrentFlags & EEngineShowFlags::SF_Primitives)) return;
 
+    FVector RayOrigin;
+    FVector RayDirection;
+    ComputeWorldPickRay(pickPosition, RayOrigin, RayDirection);
+
+    // 월드 AABB가 반직선에 닿는 Primitive만 정밀 검사
+    TArray<UPrimitiveComponent*> Candidates;
+    UWorld* World = GEngine->ActiveWorld;
+    if (FCollisionManager* CollisionManager = World ? World->GetCollisionManager() : nullptr)
+    {
+        CollisionManager->LineTrace(RayOrigin, RayDirection, FLT_MAX, Candidates);
+    }
+
     USceneComponent* Possible = nullptr;
     int maxIntersect = 0;
     float minDistance = FLT_MAX;
-    for (const auto iter : TObjectRange<UPrimitiveComponent>())
+    for (UPrimitiveComponent* pObj : Candidates)
     {
-        UPrimitiveComponent* pObj;
-        if (iter->IsA<UPrimitiveComponent>() || iter->IsA<ULightComponentBase>())
-        {
-            pObj = static_cast<UPrimitiveComponent*>(iter);
-        }
-        else
-        {
-            continue;
-        }
-
         if (pObj && !pObj->IsA<UGizmoBaseComponent>())
         {
             float Distance = 0.0f;
             int currentIntersectCount = 0;
-            if (RayIntersectsObject(pickPosition, pObj, Distance, currentIntersectCount))
+            if (RayIntersectsObject(RayOrigin, RayDirection, pObj, Distance, currentIntersectCount))
             {
                 if (Distance < minDistance)
                 {
@@ -213,60 +220,44 @@ void AEditorPlayer::ScreenToViewSpace(int32 ScreenX, int32 ScreenY, std::shared_
     }
 }
 
-int AEditorPlayer::RayIntersectsObject(const FVector& PickPosition, USceneComponent* Component, float& HitDistance, int& IntersectCount)
+void AEditorPlayer::ComputeWorldPickRay(const FVector& PickPosition, FVector& OutRayOrigin, FVector& OutRayDirection)
 {
-    FMatrix WorldMatrix = Component->GetWorldMatrix();
-    FMatrix ViewMatrix = GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetViewMatrix();
-    
-    bool bIsOrtho = GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->IsOrthographic();
-    
+    std::shared_ptr<FEditorViewportClient> ActiveViewport = GEngineLoop.GetLevelEditor()->GetActiveViewportClient();
+    FMatrix InverseView = FMatrix::Inverse(ActiveViewport->GetViewMatrix());
 
-    if (bIsOrtho)
+    if (ActiveViewport->IsOrthographic())
     {
-        // 오쏘 모드: ScreenToViewSpace()에서 계산된 pickPosition이 클립/뷰 좌표라고 가정
-        FMatrix inverseView = FMatrix::Inverse(ViewMatrix);
-        // pickPosition을 월드 좌표로 변환
-        FVector worldPickPos = inverseView.TransformPosition(PickPosition);  
-        // 오쏘에서는 픽킹 원점은 unproject된 픽셀의 위치
-        FVector rayOrigin = worldPickPos;
-        // 레이 방향은 카메라의 정면 방향 (평행)
-        FVector orthoRayDir = GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->OrthogonalCamera.GetForwardVector().GetSafeNormal();
-
-        // 객체의 로컬 좌표계로 변환
-        FMatrix LocalMatrix = FMatrix::Inverse(WorldMatrix);
-        FVector LocalRayOrigin = LocalMatrix.TransformPosition(rayOrigin);
-        FVector LocalRayDir = (LocalMatrix.TransformPosition(rayOrigin + orthoRayDir) - LocalRayOrigin).GetSafeNormal();
-        
-        IntersectCount = Component->CheckRayIntersection(LocalRayOrigin, LocalRayDir, HitDistance);
-        return IntersectCount;
+        // 오쏘 모드: 픽킹 원점은 unproject된 픽셀의 위치, 방향은 카메라의 정면 방향 (평행)
+        OutRayOrigin = InverseView.TransformPosition(PickPosition);
+        OutRayDirection = ActiveViewport->OrthogonalCamera.GetForwardVector().GetSafeNormal();
     }
     else
     {
-        FMatrix inverseMatrix = FMatrix::Inverse(WorldMatrix * ViewMatrix);
-        FVector cameraOrigin = { 0,0,0 };
-        FVector pickRayOrigin = inverseMatrix.TransformPosition(cameraOrigin);
-        // 퍼스펙티브 모드의 기존 로직 사용
-        FVector transformedPick = inverseMatrix.TransformPosition(PickPosition);
-        FVector rayDirection = (transformedPick - pickRayOrigin).GetSafeNormal();
-        
-        IntersectCount = Component->CheckRayIntersection(pickRayOrigin, rayDirection, HitDistance);
-
-        if (IntersectCount > 0)
-        {
-            FVector LocalHitPoint = pickRayOrigin + rayDirection * HitDistance;
+        // 퍼스펙티브 모드: 카메라 위치에서 near plane 위의 픽셀 방향
+        OutRayOrigin = InverseView.TransformPosition(FVector::ZeroVector);
+        OutRayDirection = (InverseView.TransformPosition(PickPosition) - OutRayOrigin).GetSafeNormal();
+    }
+}
 
-            FVector WorldHitPoint = WorldMatrix.TransformPosition(LocalHitPoint);
+int AEditorPlayer::RayIntersectsObject(const FVector& RayOrigin, const FVector& RayDirection, USceneComponent* Component, float& HitDistance, int& IntersectCount)
+{
+    FMatrix WorldMatrix = Component->GetWorldMatrix();
 
-            FVector WorldRayOrigin;
-            FMatrix InverseView = FMatrix::Inverse(ViewMatrix);
-            WorldRayOrigin = InverseView.TransformPosition(cameraOrigin);
+    // 객체의 로컬 좌표계로 변환
+    FMatrix LocalMatrix = FMatrix::Inverse(WorldMatrix);
+    FVector LocalRayOrigin = LocalMatrix.TransformPosition(RayOrigin);
+    FVector LocalRayDir = (LocalMatrix.TransformPosition(RayOrigin + RayDirection) - LocalRayOrigin).GetSafeNormal();
 
-            float WorldDistance = FVector::Distance(WorldRayOrigin, WorldHitPoint);
+    IntersectCount = Component->CheckRayIntersection(LocalRayOrigin, LocalRayDir, HitDistance);
 
-            HitDistance = WorldDistance;
-        }
-        return IntersectCount;
+    if (IntersectCount > 0)
+    {
+        // 스케일이 다른 컴포넌트끼리 비교할 수 있도록 월드 거리로 변환
+        FVector LocalHitPoint = LocalRayOrigin + LocalRayDir * HitDistance;
+        FVector WorldHitPoint = WorldMatrix.TransformPosition(LocalHitPoint);
+        HitDistance = FVector::Distance(RayOrigin, WorldHitPoint);
     }
+    return IntersectCount;
 }
 
 void AEditorPlayer::PickedObjControl()
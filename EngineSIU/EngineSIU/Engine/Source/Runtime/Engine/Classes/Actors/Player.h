@@ -27,7 +27,11 @@ class AEditorPlayer : public AActor
     void AddCoordiMode();
 
 private:
-    static int RayIntersectsObject(const FVector& PickPosition, USceneComponent* Component, float& HitDistance, int& IntersectCount);
+    /** ScreenToViewSpace로 구한 뷰 공간 위치를 월드 공간의 픽킹 반직선으로 바꿉니다. */
+    static void ComputeWorldPickRay(const FVector& PickPosition, FVector& OutRayOrigin, FVector& OutRayDirection);
+
+    /** 월드 공간 반직선을 컴포넌트의 로컬 공간에서 검사하고, HitDistance는 RayOrigin으로부터의 월드 거리로 반환합니다. */
+    static int RayIntersectsObject(const FVector& RayOrigin, const FVector& RayDirection, USceneComponent* Component, float& HitDistance, int& IntersectCount);
     void ScreenToViewSpace(int32 ScreenX, int32 ScreenY, std::shared_ptr<FEditorViewportClient> ActiveViewport, FVector& RayOrigin);
     void PickedObjControl();
     void ControlRotation(USceneComponent* Component, UGizmoBaseComponent* Gizmo, float DeltaX, float DeltaY);
@@ -4,6 +4,13 @@
 #include "UObject/Casts.h"
 #include "World/World.h"
 
+UCameraComponent::UCameraComponent()
+{
+    // 스프링 암(TG_PostPhysics)이 위치를 정한 뒤에 따라감
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.SetTickGroup(TG_PostUpdateWork);
+}
+
 UObject* UCameraComponent::Duplicate(UObject* InOuter)
 {
     ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
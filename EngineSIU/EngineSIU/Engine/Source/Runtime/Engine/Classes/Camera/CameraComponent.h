@@ -7,7 +7,7 @@ class UCameraComponent : public USceneComponent
 public:
     DECLARE_CLASS(UCameraComponent, USceneComponent)
 
-    UCameraComponent() = default;
+    UCameraComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
     virtual void InitializeComponent() override;
@@ -1,8 +1,16 @@
 #include "ActorComponent.h"
+#include "Components/ComponentPropertyReader.h"
 
 #include "GameFramework/Actor.h"
+#include "Engine/TickTaskManager.h"
+#include "World/World.h"
 
 
+UActorComponent::UActorComponent()
+{
+    PrimaryComponentTick.Target = this;
+}
+
 UObject* UActorComponent::Duplicate(UObject* InOuter)
 {
     ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
@@ -11,6 +19,10 @@ UObject* UActorComponent::Duplicate(UObject* InOuter)
     NewComponent->bIsActive = bIsActive;
     NewComponent->bAutoActive = bAutoActive;
 
+    NewComponent->PrimaryComponentTick.bCanEverTick = PrimaryComponentTick.bCanEverTick;
+    NewComponent->PrimaryComponentTick.SetTickGroup(PrimaryComponentTick.GetTickGroup());
+    NewComponent->PrimaryComponentTick.SetTickInterval(PrimaryComponentTick.GetTickInterval());
+
     return NewComponent;
 }
 
@@ -33,36 +45,16 @@ void UActorComponent::GetProperties(TMap<FString, FString>& OutProperties) const
     
 }
 
-void UActorComponent::SetProperties(const TMap<FString, FString>& Properties)
+void UActorComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
-    // Super::ApplyProperties(Properties); // 만약 UObject 레벨에 있다면
-
-    const FString* TempStr = nullptr;
-
-    // --- 설정 값 복원 ---
-
-    TempStr = Properties.Find(TEXT("bAutoActive")); // bAutoActive 변수가 있다고 가정
-    if (TempStr)
-    {
-        // 이 플래그는 보통 BeginPlay나 InitializeComponent 등에서
-        // SetActive를 호출할지 여부를 결정하는 데 사용될 수 있습니다.
-        // 여기서는 플래그 값 자체만 복원합니다.
-        this->bAutoActive = TempStr->ToBool();
-    }
-
-
-    // --- 초기 상태 값 복원 (Setter 함수 사용 권장) ---
+    // 이 플래그는 보통 BeginPlay나 InitializeComponent 등에서 SetActive를 호출할지 여부를 결정하는 데 사용됩니다.
+    // 여기서는 플래그 값 자체만 복원합니다.
+    InProperties.Read(TEXT("bAutoActive"), bAutoActive);
 
-    // bIsActive: 컴포넌트의 활성화 상태 설정
-    TempStr = Properties.Find(TEXT("bIsActive"));
-    if (TempStr)
+    // bIsActive: 컴포넌트의 활성화 상태 설정 (SetActive가 없으므로 Tick 활성화만 함께 맞춤)
+    if (InProperties.Read(TEXT("bIsActive"), bIsActive))
     {
-        // bool bShouldBeActive = TempStr->ToBool();
-        // SetActive(bShouldBeActive); // SetActive 함수 호출 (구현 필요)
-
-        // 임시로 직접 설정 (만약 SetActive 함수가 없다면)
-        this->bIsActive = TempStr->ToBool();
-        // 주의: 이 경우 SetActive에 포함될 수 있는 부가 로직이 누락될 수 있습니다.
+        PrimaryComponentTick.SetTickFunctionEnable(bIsActive);
     }
 }
 
@@ -110,6 +102,9 @@ void UActorComponent::DestroyComponent(bool bPromoteChildren)
 
     bIsBeingDestroyed = true;
 
+    RegisterComponentTickFunctions(false);
+    RegisterComponentWithWorld(false);
+
     // Owner에서 Component 제거하기
     if (AActor* MyOwner = GetOwner())
     {
@@ -138,12 +133,60 @@ void UActorComponent::DestroyComponent(bool bPromoteChildren)
 
 void UActorComponent::Activate()
 {
-    // TODO: Tick 다시 재생
     bIsActive = true;
+    PrimaryComponentTick.SetTickFunctionEnable(true);
 }
 
 void UActorComponent::Deactivate()
 {
-    // TODO: Tick 멈추기
     bIsActive = false;
+    PrimaryComponentTick.SetTickFunctionEnable(false);
+}
+
+void UActorComponent::RegisterComponentTickFunctions(bool bRegister)
+{
+    if (!bRegister)
+    {
+        PrimaryComponentTick.UnRegisterTickFunction();
+        return;
+    }
+
+    if (bIsBeingDestroyed)
+    {
+        return;
+    }
+
+    const AActor* MyOwner = GetOwner();
+    UWorld* World = MyOwner ? MyOwner->GetWorld() : nullptr;
+    if (World && World->GetTickTaskManager())
+    {
+        PrimaryComponentTick.SetTickFunctionEnable(bIsActive);
+        PrimaryComponentTick.RegisterTickFunction(World->GetTickTaskManager());
+    }
+}
+
+void UActorComponent::RegisterComponentWithWorld(bool bRegister)
+{
+    if (bRegister == bRegisteredWithWorld || (bRegister && bIsBeingDestroyed))
+    {
+        return;
+    }
+
+    const AActor* MyOwner = GetOwner();
+    UWorld* World = MyOwner ? MyOwner->GetWorld() : nullptr;
+    if (bRegister && !World)
+    {
+        return;
+    }
+
+    bRegisteredWithWorld = bRegister;
+
+    if (bRegister)
+    {
+        OnRegister(World);
+    }
+    else
+    {
+        OnUnregister(World);
+    }
 }
@@ -1,9 +1,12 @@
 #pragma once
 #include "Engine/EngineTypes.h"
+#include "Engine/TickFunction.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
 
 class AActor;
+class FComponentPropertyReader;
+class UWorld;
 
 class UActorComponent : public UObject
 {
@@ -13,7 +16,7 @@ private:
     friend class AActor;
 
 public:
-    UActorComponent() = default;
+    UActorComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
@@ -23,8 +26,11 @@ public:
 */
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const;
 
-    /** 저장된 Properties 맵에서 컴포넌트의 상태를 복원합니다. */
-    virtual void SetProperties(const TMap<FString, FString>& Properties);
+    /**
+     * 저장된 Property로 컴포넌트의 상태를 복원합니다.
+     * Json은 GetProperties가 만든 문자열을, 바이너리 Scene은 값으로 저장된 Property를 같은 Reader로 읽습니다.
+     */
+    virtual void SetProperties(const FComponentPropertyReader& InProperties);
 
 
     /** AActor가 World에 Spawn되어 BeginPlay이전에 호출됩니다. */
@@ -67,6 +73,28 @@ public:
     void Activate();
     void Deactivate();
 
+    /**
+     * PrimaryComponentTick을 소유 Actor가 속한 World의 FTickTaskManager에 등록하거나 해제합니다.
+     * @param bRegister false면 해제
+     */
+    void RegisterComponentTickFunctions(bool bRegister);
+
+    /**
+     * 소유 Actor가 속한 World의 시스템(Scene의 공간 인덱스 등)에 컴포넌트를 등록하거나 해제합니다.
+     * @param bRegister false면 해제
+     */
+    void RegisterComponentWithWorld(bool bRegister);
+
+    /** RegisterComponentWithWorld(true)로 World에 등록되어 있는지 여부를 반환합니다. */
+    bool IsRegisteredWithWorld() const { return bRegisteredWithWorld; }
+
+protected:
+    /** World에 등록될 때 호출됩니다. 하위 클래스는 여기서 World의 시스템에 자신을 추가합니다. */
+    virtual void OnRegister(UWorld* World) {}
+
+    /** World에서 해제될 때 호출됩니다. World가 이미 정리된 경우 World의 시스템은 nullptr일 수 있습니다. */
+    virtual void OnUnregister(UWorld* World) {}
+
 private:
     AActor* OwnerPrivate;
 
@@ -82,7 +110,16 @@ private:
     /** Component가 현재 활성화 중인지 여부 */
     uint8 bIsActive : 1 = true;
 
+    /** RegisterComponentWithWorld(true)가 호출되었는지 여부 */
+    uint8 bRegisteredWithWorld : 1 = false;
+
 public:
     /** Component가 초기화 되었을 때, 자동으로 활성화할지 여부 */
     uint8 bAutoActive : 1 = true;
+
+    /**
+     * TickComponent를 호출하는 Tick 함수, 생성자에서 bCanEverTick을 켠 컴포넌트만 등록됩니다.
+     * SetRunOnAnyThread(true)는 소유 Actor 밖의 상태(다른 Actor, World, 전역 객체)를 건드리지 않는 컴포넌트만 켜야 합니다.
+     */
+    FActorComponentTickFunction PrimaryComponentTick;
 };
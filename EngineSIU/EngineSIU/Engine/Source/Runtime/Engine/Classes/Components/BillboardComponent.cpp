@@ -1,4 +1,5 @@
 #include "BillboardComponent.h"
+#include "Components/ComponentPropertyReader.h"
 #include <DirectXMath.h>
 #include "Define.h"
 #include "World/World.h"
@@ -42,25 +43,14 @@ void UBillboardComponent::GetProperties(TMap<FString, FString>& OutProperties) c
     OutProperties.Add(TEXT("BufferKey"), TexturePath);
 }
 
-void UBillboardComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UBillboardComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("FinalIndexU"));
-    if (TempStr)
+    InProperties.Read(TEXT("FinalIndexU"), finalIndexU);
+    InProperties.Read(TEXT("FinalIndexV"), finalIndexV);
+    if (InProperties.Read(TEXT("BufferKey"), TexturePath))
     {
-        finalIndexU = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("FinalIndexV"));
-    if (TempStr)
-    {
-        finalIndexV = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("BufferKey"));
-    if (TempStr)
-    {
-        TexturePath = *TempStr;
-        Texture = FEngineLoop::ResourceManager.GetTexture(TempStr->ToWideString());
+        Texture = FEngineLoop::ResourceManager.GetTexture(TexturePath.ToWideString());
     }
 }
 
@@ -14,11 +14,14 @@ public:
     virtual ~UBillboardComponent();
     virtual UObject* Duplicate(UObject* InOuter) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SetProperties(const FComponentPropertyReader& InProperties) override;
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
     virtual int CheckRayIntersection(const FVector& InRayOrigin, const FVector& InRayDirection, float& OutHitDistance) const override;
 
+    /** 반직선 대신 마우스 위치로 화면 공간에서 픽킹하므로 AABB로 후보를 거를 수 없음 */
+    virtual bool IsRayTraceBoundedByAABB() const override { return false; }
+
     virtual void SetTexture(const FWString& InFilePath);
     void SetUUIDParent(USceneComponent* InUUIDParent);
     FMatrix CreateBillboardMatrix() const;
@@ -1,4 +1,5 @@
 #include "BoxComponent.h"
+#include "Components/ComponentPropertyReader.h"
 
 #include "UObject/Casts.h"
 
@@ -16,19 +17,30 @@ UObject* UBoxComponent::Duplicate(UObject* InOuter)
     return NewComponent;
 }
 
+FBoundingBox UBoxComponent::GetWorldAABB() const
+{
+    // 충돌 검사 함수마다 스케일 적용 여부가 달라 더 큰 쪽을 기준으로 보수적으로 계산
+    const FVector Scale = FVector::GetAbs(GetWorldScale3D());
+    const FVector Extent = BoxExtent * FVector(FMath::Max(Scale.X, 1.f), FMath::Max(Scale.Y, 1.f), FMath::Max(Scale.Z, 1.f));
+
+    // OBB의 각 축을 월드 축에 투영한 길이의 합
+    const FVector HalfSize =
+        FVector::GetAbs(GetForwardVector()) * Extent.X +
+        FVector::GetAbs(GetRightVector()) * Extent.Y +
+        FVector::GetAbs(GetUpVector()) * Extent.Z;
+
+    const FVector Center = GetWorldLocation();
+    return FBoundingBox(Center - HalfSize, Center + HalfSize);
+}
+
 void UBoxComponent::GetProperties(TMap<FString, FString>& OutProperties) const
 {
     Super::GetProperties(OutProperties);
     OutProperties.Add(TEXT("BoxExtent"), BoxExtent.ToString());
 }
 
-void UBoxComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UBoxComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("BoxExtent"));
-    if (TempStr)
-    {
-        BoxExtent.InitFromString(*TempStr);
-    }
+    InProperties.Read(TEXT("BoxExtent"), BoxExtent);
 }
@@ -9,12 +9,17 @@ public:
     UBoxComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual FBoundingBox GetWorldAABB() const override;
 
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SetProperties(const FComponentPropertyReader& InProperties) override;
 
     FVector GetBoxExtent() const { return BoxExtent; }
-    void SetBoxExtent(FVector InExtent) { BoxExtent = InExtent; }
+    void SetBoxExtent(FVector InExtent)
+    {
+        BoxExtent = InExtent;
+        MarkBoundsDirty();
+    }
 
 private:
     FVector BoxExtent = FVector::OneVector;
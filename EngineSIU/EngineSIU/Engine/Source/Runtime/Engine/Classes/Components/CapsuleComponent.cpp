@@ -1,4 +1,5 @@
 #include "CapsuleComponent.h"
+#include "Components/ComponentPropertyReader.h"
 
 #include "UObject/Casts.h"
 
@@ -17,20 +18,20 @@ UObject* UCapsuleComponent::Duplicate(UObject* InOuter)
     return NewComponent;
 }
 
-void UCapsuleComponent::SetProperties(const TMap<FString, FString>& InProperties)
+FBoundingBox UCapsuleComponent::GetWorldAABB() const
+{
+    FVector Start, End;
+    GetEndPoints(Start, End);
+
+    const FVector HalfSize(CapsuleRadius);
+    return FBoundingBox(Start.ComponentMin(End) - HalfSize, Start.ComponentMax(End) + HalfSize);
+}
+
+void UCapsuleComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("CapsuleHalfHeight"));
-    if (TempStr)
-    {
-        CapsuleHalfHeight = FCString::Atof(**TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("CapsuleRadius"));
-    if (TempStr)
-    {
-        CapsuleRadius = FCString::Atof(**TempStr);
-    }
+    InProperties.Read(TEXT("CapsuleHalfHeight"), CapsuleHalfHeight);
+    InProperties.Read(TEXT("CapsuleRadius"), CapsuleRadius);
 }
 
 void UCapsuleComponent::GetProperties(TMap<FString, FString>& OutProperties) const
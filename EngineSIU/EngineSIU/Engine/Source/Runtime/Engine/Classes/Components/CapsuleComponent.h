@@ -10,8 +10,9 @@ public:
     UCapsuleComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual FBoundingBox GetWorldAABB() const override;
 
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SetProperties(const FComponentPropertyReader& InProperties) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
 
     float GetHalfHeight() const { return CapsuleHalfHeight; }
@@ -19,6 +20,7 @@ public:
     {
         InHeight = FMath::Clamp(InHeight, CapsuleRadius, 10000.f);
         CapsuleHalfHeight = InHeight;
+        MarkBoundsDirty();
     }
 
     float GetRadius() const { return CapsuleRadius; }
@@ -26,6 +28,7 @@ public:
     {
         InRadius = FMath::Clamp(InRadius, 0.f, CapsuleHalfHeight);
         CapsuleRadius = InRadius;
+        MarkBoundsDirty();
     }
 
     void GetEndPoints(FVector& OutStart, FVector& OutEnd) const;
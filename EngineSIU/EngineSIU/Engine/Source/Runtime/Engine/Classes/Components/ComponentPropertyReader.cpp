@@ -0,0 +1,219 @@
+#include "ComponentPropertyReader.h"
+
+#include "Container/CString.h"
+
+
+bool FComponentPropertyValue::TryParse(const FString& InString)
+{
+    Type = EComponentPropertyType::String;
+
+    if (InString.Equals(TEXT("true")) || InString.Equals(TEXT("false")))
+    {
+        Type = EComponentPropertyType::Bool;
+        Int = InString.Equals(TEXT("true")) ? 1 : 0;
+        return true;
+    }
+
+    // 숫자는 다시 만든 문자열이 같을 때만 숫자로 저장 (Json에서 손으로 쓴 값 등은 문자열로 남김)
+    const int32 IntValue = FCString::Atoi(*InString);
+    if (FString::Printf(TEXT("%d"), IntValue).Equals(InString))
+    {
+        Type = EComponentPropertyType::Int;
+        Int = IntValue;
+        return true;
+    }
+
+    const float FloatValue = FCString::Atof(*InString);
+    if (FString::Printf(TEXT("%f"), FloatValue).Equals(InString))
+    {
+        Type = EComponentPropertyType::Float;
+        Floats[0] = FString::ToFloat(InString);
+        return true;
+    }
+
+    FVector Vector;
+    if (Vector.InitFromString(InString) && Vector.ToString().Equals(InString))
+    {
+        Type = EComponentPropertyType::Vector;
+        Floats[0] = Vector.X;
+        Floats[1] = Vector.Y;
+        Floats[2] = Vector.Z;
+        return true;
+    }
+
+    FVector2D Vector2D;
+    if (Vector2D.InitFromString(InString) && Vector2D.ToString().Equals(InString))
+    {
+        Type = EComponentPropertyType::Vector2D;
+        Floats[0] = Vector2D.X;
+        Floats[1] = Vector2D.Y;
+        return true;
+    }
+
+    FRotator Rotator;
+    if (Rotator.InitFromString(InString) && Rotator.ToString().Equals(InString))
+    {
+        Type = EComponentPropertyType::Rotator;
+        Floats[0] = Rotator.Pitch;
+        Floats[1] = Rotator.Yaw;
+        Floats[2] = Rotator.Roll;
+        return true;
+    }
+
+    FLinearColor Color;
+    if (Color.InitFromString(InString) && Color.ToString().Equals(InString))
+    {
+        Type = EComponentPropertyType::LinearColor;
+        Floats[0] = Color.R;
+        Floats[1] = Color.G;
+        Floats[2] = Color.B;
+        Floats[3] = Color.A;
+        return true;
+    }
+
+    return false;
+}
+
+FString FComponentPropertyValue::ToString() const
+{
+    switch (Type)
+    {
+    case EComponentPropertyType::Float:
+        return FString::Printf(TEXT("%f"), Floats[0]);
+    case EComponentPropertyType::Int:
+        return FString::Printf(TEXT("%d"), Int);
+    case EComponentPropertyType::Bool:
+        return Int != 0 ? TEXT("true") : TEXT("false");
+    case EComponentPropertyType::Vector2D:
+        return FVector2D(Floats[0], Floats[1]).ToString();
+    case EComponentPropertyType::Vector:
+        return FVector(Floats[0], Floats[1], Floats[2]).ToString();
+    case EComponentPropertyType::Rotator:
+        return FRotator(Floats[0], Floats[1], Floats[2]).ToString();
+    case EComponentPropertyType::LinearColor:
+        return FLinearColor(Floats[0], Floats[1], Floats[2], Floats[3]).ToString();
+    default:
+        return String;
+    }
+}
+
+
+template <typename ValueType, typename FromValueType, typename FromStringType>
+bool FComponentPropertyReader::ReadProperty(
+    const TCHAR* Key, EComponentPropertyType Type, ValueType& OutValue, FromValueType FromValue, FromStringType FromString
+) const
+{
+    if (const FComponentPropertyValue* Value = FindValue(Key); Value && Value->Type == Type)
+    {
+        FromValue(*Value, OutValue);
+        return true;
+    }
+
+    // Json이거나 다른 타입으로 저장된 경우, 예전처럼 문자열을 파싱
+    FString Scratch;
+    const FString* String = FindString(Key, Scratch);
+    if (!String)
+    {
+        return false;
+    }
+    FromString(*String, OutValue);
+    return true;
+}
+
+bool FComponentPropertyReader::Read(const TCHAR* Key, FString& OutValue) const
+{
+    FString Scratch;
+    const FString* String = FindString(Key, Scratch);
+    if (!String)
+    {
+        return false;
+    }
+    OutValue = *String;
+    return true;
+}
+
+bool FComponentPropertyReader::Read(const TCHAR* Key, float& OutValue) const
+{
+    return ReadProperty(Key, EComponentPropertyType::Float, OutValue,
+        [](const FComponentPropertyValue& Value, float& Out) { Out = Value.Floats[0]; },
+        [](const FString& String, float& Out) { Out = FString::ToFloat(String); }
+    );
+}
+
+bool FComponentPropertyReader::Read(const TCHAR* Key, int32& OutValue) const
+{
+    return ReadProperty(Key, EComponentPropertyType::Int, OutValue,
+        [](const FComponentPropertyValue& Value, int32& Out) { Out = Value.Int; },
+        [](const FString& String, int32& Out) { Out = FString::ToInt(String); }
+    );
+}
+
+bool FComponentPropertyReader::Read(const TCHAR* Key, bool& OutValue) const
+{
+    return ReadProperty(Key, EComponentPropertyType::Bool, OutValue,
+        [](const FComponentPropertyValue& Value, bool& Out) { Out = Value.Int != 0; },
+        [](const FString& String, bool& Out) { Out = String.ToBool(); }
+    );
+}
+
+bool FComponentPropertyReader::Read(const TCHAR* Key, FVector2D& OutValue) const
+{
+    return ReadProperty(Key, EComponentPropertyType::Vector2D, OutValue,
+        [](const FComponentPropertyValue& Value, FVector2D& Out) { Out = FVector2D(Value.Floats[0], Value.Floats[1]); },
+        [](const FString& String, FVector2D& Out) { Out.InitFromString(String); }
+    );
+}
+
+bool FComponentPropertyReader::Read(const TCHAR* Key, FVector& OutValue) const
+{
+    return ReadProperty(Key, EComponentPropertyType::Vector, OutValue,
+        [](const FComponentPropertyValue& Value, FVector& Out) { Out = FVector(Value.Floats[0], Value.Floats[1], Value.Floats[2]); },
+        [](const FString& String, FVector& Out) { Out.InitFromString(String); }
+    );
+}
+
+bool FComponentPropertyReader::Read(const TCHAR* Key, FRotator& OutValue) const
+{
+    return ReadProperty(Key, EComponentPropertyType::Rotator, OutValue,
+        [](const FComponentPropertyValue& Value, FRotator& Out) { Out = FRotator(Value.Floats[0], Value.Floats[1], Value.Floats[2]); },
+        [](const FString& String, FRotator& Out) { Out.InitFromString(String); }
+    );
+}
+
+bool FComponentPropertyReader::Read(const TCHAR* Key, FLinearColor& OutValue) const
+{
+    return ReadProperty(Key, EComponentPropertyType::LinearColor, OutValue,
+        [](const FComponentPropertyValue& Value, FLinearColor& Out) { Out = FLinearColor(Value.Floats[0], Value.Floats[1], Value.Floats[2], Value.Floats[3]); },
+        [](const FString& String, FLinearColor& Out) { Out.InitFromString(String); }
+    );
+}
+
+
+const FComponentPropertyValue* FComponentPropertyValueReader::FindValue(const TCHAR* Key) const
+{
+    const FName KeyName(Key);
+    for (const FComponentPropertyValue& Value : Values)
+    {
+        if (Value.Key == KeyName)
+        {
+            return &Value;
+        }
+    }
+    return nullptr;
+}
+
+const FString* FComponentPropertyValueReader::FindString(const TCHAR* Key, FString& Scratch) const
+{
+    const FComponentPropertyValue* Value = FindValue(Key);
+    if (!Value)
+    {
+        return nullptr;
+    }
+    if (Value->Type == EComponentPropertyType::String)
+    {
+        return &Value->String;
+    }
+
+    Scratch = Value->ToString();
+    return &Scratch;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "Math/Color.h"
+#include "Math/Rotator.h"
+#include "Math/Vector.h"
+#include "UObject/NameTypes.h"
+
+
+/** 문자열 대신 값으로 저장된 Property의 타입, 바이너리 Scene 파일에 그대로 기록되므로 순서를 바꾸면 안 됨 */
+enum class EComponentPropertyType : uint8
+{
+    String,
+    Float,
+    Int,
+    Bool,
+    Vector2D,
+    Vector,
+    Rotator,
+    LinearColor,
+
+    Max,
+};
+
+
+/**
+ * 타입이 정해진 Property 값 하나.
+ * 문자열을 다시 만들었을 때 원래 문자열과 똑같은 경우에만 숫자 타입을 쓰므로, ToString()은 항상 원래 문자열을 돌려줍니다.
+ */
+struct FComponentPropertyValue
+{
+    FName Key;
+    EComponentPropertyType Type = EComponentPropertyType::String;
+
+    /** Float은 [0], Vector2D, Vector, Rotator(Pitch, Yaw, Roll), LinearColor는 앞에서부터 사용 */
+    float Floats[4] = {};
+
+    /** Int, Bool(0 또는 1) */
+    int32 Int = 0;
+
+    /** Type이 String일 때만 사용 */
+    FString String;
+
+    /**
+     * 문자열을 숫자 타입으로 바꿀 수 있으면 Type과 값을 채웁니다.
+     * @return 숫자 타입으로 바꿨는지 여부, false면 Type은 String이고 String 멤버는 건드리지 않음
+     */
+    bool TryParse(const FString& InString);
+
+    FString ToString() const;
+};
+
+
+/**
+ * 저장된 Property로 컴포넌트의 상태를 복원할 때 사용합니다.
+ * Json은 문자열 맵을 파싱하고, 바이너리 Scene은 파일에 저장된 값을 문자열을 거치지 않고 그대로 넘깁니다.
+ * Read는 Key가 없으면 false를 반환하고 OutValue를 바꾸지 않습니다.
+ */
+class FComponentPropertyReader
+{
+public:
+    virtual ~FComponentPropertyReader() = default;
+
+    bool Read(const TCHAR* Key, FString& OutValue) const;
+    bool Read(const TCHAR* Key, float& OutValue) const;
+    bool Read(const TCHAR* Key, int32& OutValue) const;
+    bool Read(const TCHAR* Key, bool& OutValue) const;
+    bool Read(const TCHAR* Key, FVector2D& OutValue) const;
+    bool Read(const TCHAR* Key, FVector& OutValue) const;
+    bool Read(const TCHAR* Key, FRotator& OutValue) const;
+    bool Read(const TCHAR* Key, FLinearColor& OutValue) const;
+
+protected:
+    /** 값으로 저장된 Property를 찾습니다. 문자열만 가진 Reader는 nullptr */
+    virtual const FComponentPropertyValue* FindValue(const TCHAR* Key) const = 0;
+
+    /** Property를 문자열로 찾습니다. 저장된 문자열이 없으면 Scratch에 만들어서 가리킴 */
+    virtual const FString* FindString(const TCHAR* Key, FString& Scratch) const = 0;
+
+private:
+    template <typename ValueType, typename FromValueType, typename FromStringType>
+    bool ReadProperty(const TCHAR* Key, EComponentPropertyType Type, ValueType& OutValue, FromValueType FromValue, FromStringType FromString) const;
+};
+
+
+/** Json에서 읽은 문자열 맵을 파싱하는 Reader */
+class FComponentPropertyMapReader : public FComponentPropertyReader
+{
+public:
+    explicit FComponentPropertyMapReader(const TMap<FString, FString>& InProperties)
+        : Properties(InProperties)
+    {
+    }
+
+protected:
+    virtual const FComponentPropertyValue* FindValue(const TCHAR* Key) const override { return nullptr; }
+    virtual const FString* FindString(const TCHAR* Key, FString& Scratch) const override { return Properties.Find(Key); }
+
+private:
+    const TMap<FString, FString>& Properties;
+};
+
+
+/** 바이너리 Scene에서 읽은 값을 그대로 넘기는 Reader, 요청한 타입과 저장된 타입이 다를 때만 문자열을 거칩니다. */
+class FComponentPropertyValueReader : public FComponentPropertyReader
+{
+public:
+    explicit FComponentPropertyValueReader(const TArray<FComponentPropertyValue>& InValues)
+        : Values(InValues)
+    {
+    }
+
+protected:
+    virtual const FComponentPropertyValue* FindValue(const TCHAR* Key) const override;
+    virtual const FString* FindString(const TCHAR* Key, FString& Scratch) const override;
+
+private:
+    const TArray<FComponentPropertyValue>& Values;
+};
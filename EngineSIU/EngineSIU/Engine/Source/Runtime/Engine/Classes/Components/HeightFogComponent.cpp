@@ -1,4 +1,5 @@
 #include "HeightFogComponent.h"
+#include "Components/ComponentPropertyReader.h"
 #include <UObject/Casts.h>
 
 UHeightFogComponent::UHeightFogComponent(float Density, float HeightFalloff, float StartDist, float EndDist, float DistanceWeight)
@@ -64,40 +65,13 @@ void UHeightFogComponent::GetProperties(TMap<FString, FString>& OutProperties) c
     OutProperties.Add(TEXT("FogInscatteringColor"), FString::Printf(TEXT("%s"), *FogInscatteringColor.ToString()));
 }
 
-void UHeightFogComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UHeightFogComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("FogDensity"));
-    if (TempStr)
-    {
-        FogDensity = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("FogHeightFalloff"));
-    if (TempStr)
-    {
-        FogHeightFalloff = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("StartDistance"));
-    if (TempStr)
-    {
-        StartDistance = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("FogCutoffDistance"));
-    if (TempStr)
-    {
-        FogDistanceWeight = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("FogMaxOpacity"));
-    if (TempStr)
-    {
-        EndDistance = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("FogInscatteringColor"));
-    if (TempStr)
-    {
-        // FVector4 Color;
-        // Color.InitFromString(*TempStr);
-        FogInscatteringColor = FLinearColor(*TempStr);
-    }
+    InProperties.Read(TEXT("FogDensity"), FogDensity);
+    InProperties.Read(TEXT("FogHeightFalloff"), FogHeightFalloff);
+    InProperties.Read(TEXT("StartDistance"), StartDistance);
+    InProperties.Read(TEXT("FogCutoffDistance"), FogDistanceWeight);
+    InProperties.Read(TEXT("FogMaxOpacity"), EndDistance);
+    InProperties.Read(TEXT("FogInscatteringColor"), FogInscatteringColor);
 }
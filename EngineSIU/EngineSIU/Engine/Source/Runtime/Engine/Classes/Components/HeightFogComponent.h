@@ -32,6 +32,6 @@ public:
 
     virtual UObject* Duplicate(UObject* InOuter) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SetProperties(const FComponentPropertyReader& InProperties) override;
     
 };
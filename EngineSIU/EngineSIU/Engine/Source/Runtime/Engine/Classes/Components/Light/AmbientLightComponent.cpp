@@ -1,4 +1,5 @@
 ﻿#include "AmbientLightComponent.h"
+#include "Components/ComponentPropertyReader.h"
 
 #include "UObject/Casts.h"
 
@@ -26,15 +27,10 @@ void UAmbientLightComponent::GetProperties(TMap<FString, FString>& OutProperties
     OutProperties.Add(TEXT("AmbientColor"), AmbientLightInfo.AmbientColor.ToString());
 }
 
-void UAmbientLightComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UAmbientLightComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("AmbientColor"));
-    if (TempStr)
-    {
-        AmbientLightInfo.AmbientColor.InitFromString(*TempStr);
-    }
+    InProperties.Read(TEXT("AmbientColor"), AmbientLightInfo.AmbientColor);
 }
 
 const FAmbientLightInfo& UAmbientLightComponent::GetAmbientLightInfo() const
@@ -12,7 +12,7 @@ public:
     virtual UObject* Duplicate(UObject* InOuter) override;
     
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SetProperties(const FComponentPropertyReader& InProperties) override;
 
     const FAmbientLightInfo& GetAmbientLightInfo() const;
     void SetAmbientLightInfo(const FAmbientLightInfo& InAmbient);
@@ -1,4 +1,5 @@
 #include "DirectionalLightComponent.h"
+#include "Components/ComponentPropertyReader.h"
 #include "Components/SceneComponent.h"
 #include "Math/JungleMath.h"
 #include "Math/Rotator.h"
@@ -37,25 +38,12 @@ void UDirectionalLightComponent::GetProperties(TMap<FString, FString>& OutProper
     OutProperties.Add(TEXT("Direction"), *DirectionalLightInfo.Direction.ToString());
 }
 
-void UDirectionalLightComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UDirectionalLightComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("LightColor"));
-    if (TempStr)
-    {
-        DirectionalLightInfo.LightColor.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Intensity"));
-    if (TempStr)
-    {
-        DirectionalLightInfo.Intensity = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Direction"));
-    if (TempStr)
-    {
-        DirectionalLightInfo.Direction.InitFromString(*TempStr);
-    }
+    InProperties.Read(TEXT("LightColor"), DirectionalLightInfo.LightColor);
+    InProperties.Read(TEXT("Intensity"), DirectionalLightInfo.Intensity);
+    InProperties.Read(TEXT("Direction"), DirectionalLightInfo.Direction);
 }
 
 
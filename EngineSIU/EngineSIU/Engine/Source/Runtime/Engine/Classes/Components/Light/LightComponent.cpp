@@ -1,4 +1,5 @@
 #include "LightComponent.h"
+#include "Components/ComponentPropertyReader.h"
 #include "UObject/Casts.h"
 
 ULightComponentBase::ULightComponentBase()
@@ -33,20 +34,11 @@ void ULightComponentBase::GetProperties(TMap<FString, FString>& OutProperties) c
     OutProperties.Add(TEXT("AABB_Max"), AABB.MaxLocation.ToString());
 }
 
-void ULightComponentBase::SetProperties(const TMap<FString, FString>& InProperties)
+void ULightComponentBase::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("AABB_Min"));
-    if (TempStr)
-    {
-        AABB.MinLocation.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("AABB_Max"));
-    if (TempStr)
-    {
-        AABB.MaxLocation.InitFromString(*TempStr);
-    }
+    InProperties.Read(TEXT("AABB_Min"), AABB.MinLocation);
+    InProperties.Read(TEXT("AABB_Max"), AABB.MaxLocation);
 }
 
 void ULightComponentBase::TickComponent(float DeltaTime)
@@ -1,4 +1,5 @@
 #include "PointLightComponent.h"
+#include "Components/ComponentPropertyReader.h"
 
 #include "Math/JungleMath.h"
 #include "UObject/Casts.h"
@@ -246,41 +247,15 @@ void UPointLightComponent::GetProperties(TMap<FString, FString>& OutProperties)
     OutProperties.Add(TEXT("Position"), FString::Printf(TEXT("%s"), *PointLightInfo.Position.ToString()));
 }
 
-void UPointLightComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UPointLightComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("Radius"));
-    if (TempStr)
-    {
-        PointLightInfo.Radius = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("LightColor"));
-    if (TempStr)
-    {
-        PointLightInfo.LightColor.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Intensity"));
-    if (TempStr)
-    {
-        PointLightInfo.Intensity = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Type"));
-    if (TempStr)
-    {
-        PointLightInfo.Type = FString::ToInt(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Attenuation"));
-    if (TempStr)
-    {
-        PointLightInfo.Attenuation = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Position"));
-    if (TempStr)
-    {
-        PointLightInfo.Position.InitFromString(*TempStr);
-    }
-    
+    InProperties.Read(TEXT("Radius"), PointLightInfo.Radius);
+    InProperties.Read(TEXT("LightColor"), PointLightInfo.LightColor);
+    InProperties.Read(TEXT("Intensity"), PointLightInfo.Intensity);
+    InProperties.Read(TEXT("Type"), PointLightInfo.Type);
+    InProperties.Read(TEXT("Attenuation"), PointLightInfo.Attenuation);
+    InProperties.Read(TEXT("Position"), PointLightInfo.Position);
 }
 
 FPointLightInfo& UPointLightComponent::GetPointLightInfo()
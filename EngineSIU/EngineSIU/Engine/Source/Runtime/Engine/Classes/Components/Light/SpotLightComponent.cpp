@@ -1,4 +1,5 @@
 #include "SpotLightComponent.h"
+#include "Components/ComponentPropertyReader.h"
 
 #include "Math/JungleMath.h"
 #include "Math/Rotator.h"
@@ -50,55 +51,18 @@ void USpotLightComponent::GetProperties(TMap<FString, FString>& OutProperties) c
     
 }
 
-void USpotLightComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void USpotLightComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("Position"));
-    if (TempStr)
-    {
-        SpotLightInfo.Position.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Radius"));
-    if (TempStr)
-    {
-        SpotLightInfo.Radius = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Direction"));
-    if (TempStr)
-    {
-        SpotLightInfo.Direction.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("LightColor"));
-    if (TempStr)
-    {
-        SpotLightInfo.LightColor.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Intensity"));
-    if (TempStr)
-    {
-        SpotLightInfo.Intensity = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Type"));
-    if (TempStr)
-    {
-        SpotLightInfo.Type = FString::ToInt(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("InnerRad"));
-    if (TempStr)
-    {
-        SpotLightInfo.InnerRad = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("OuterRad"));
-    if (TempStr)
-    {
-        SpotLightInfo.OuterRad = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Attenuation"));
-    if (TempStr)
-    {
-        SpotLightInfo.Attenuation = FString::ToFloat(*TempStr);
-    }
+    InProperties.Read(TEXT("Position"), SpotLightInfo.Position);
+    InProperties.Read(TEXT("Radius"), SpotLightInfo.Radius);
+    InProperties.Read(TEXT("Direction"), SpotLightInfo.Direction);
+    InProperties.Read(TEXT("LightColor"), SpotLightInfo.LightColor);
+    InProperties.Read(TEXT("Intensity"), SpotLightInfo.Intensity);
+    InProperties.Read(TEXT("Type"), SpotLightInfo.Type);
+    InProperties.Read(TEXT("InnerRad"), SpotLightInfo.InnerRad);
+    InProperties.Read(TEXT("OuterRad"), SpotLightInfo.OuterRad);
+    InProperties.Read(TEXT("Attenuation"), SpotLightInfo.Attenuation);
 }
 
 FVector USpotLightComponent::GetDirection()
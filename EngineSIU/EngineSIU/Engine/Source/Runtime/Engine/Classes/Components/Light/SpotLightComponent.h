@@ -11,7 +11,7 @@ public:
     virtual UObject* Duplicate(UObject* InOuter) override;
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SetProperties(const FComponentPropertyReader& InProperties) override;
     FVector GetDirection();
 
     FSpotLightInfo& GetSpotLightInfo();
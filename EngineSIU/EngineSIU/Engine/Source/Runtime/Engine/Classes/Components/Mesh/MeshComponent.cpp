@@ -18,7 +18,7 @@ void UMeshComponent::GetProperties(TMap<FString, FString>& OutProperties) const
     Super::GetProperties(OutProperties);
 }
 
-void UMeshComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UMeshComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
 }
@@ -11,7 +11,7 @@ public:
     virtual UObject* Duplicate(UObject* InOuter) override;
 
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SetProperties(const FComponentPropertyReader& InProperties) override;
     
 #pragma region Material
     virtual uint32 GetNumMaterials() const { return 0; }
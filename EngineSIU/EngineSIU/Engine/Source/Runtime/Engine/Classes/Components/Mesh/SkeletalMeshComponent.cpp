@@ -1,6 +1,8 @@
 #include "SkeletalMeshComponent.h"
+#include "Components/ComponentPropertyReader.h"
 #include "Engine/Asset/SkeletalMeshAsset.h"
 #include "Engine/FbxLoader.h"
+#include "Engine/SkeletalMeshSkinning.h"
 #include "Engine/SkeletalMeshActor.h"
 
 USkeletalMeshComponent::USkeletalMeshComponent()
@@ -31,23 +33,23 @@ void USkeletalMeshComponent::GetProperties(TMap<FString, FString>& OutProperties
     }
 }
 
-void USkeletalMeshComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void USkeletalMeshComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
 
-    const FString* MeshPath = InProperties.Find(TEXT("SkeletalMeshPath"));
-    if (MeshPath)
+    FString MeshPath;
+    if (InProperties.Read(TEXT("SkeletalMeshPath"), MeshPath))
     {
-        if (*MeshPath != TEXT("None"))
+        if (MeshPath != TEXT("None"))
         {
-            if (USkeletalMesh* LoadedMesh = FFBXManager::CreateSkeletalMesh(*MeshPath))
+            if (USkeletalMesh* LoadedMesh = FFBXManager::CreateSkeletalMesh(MeshPath))
             {
                 SetSkeletalMesh(LoadedMesh);
-                UE_LOG(ELogLevel::Display, TEXT("Set SkeletalMesh '%s' for %s"), **MeshPath, *GetName());
+                UE_LOG(ELogLevel::Display, TEXT("Set SkeletalMesh '%s' for %s"), *MeshPath, *GetName());
             }
             else
             {
-                UE_LOG(ELogLevel::Warning, TEXT("Could not load SkeletalMesh '%s' for %s"), **MeshPath, *GetName());
+                UE_LOG(ELogLevel::Warning, TEXT("Could not load SkeletalMesh '%s' for %s"), *MeshPath, *GetName());
                 SetSkeletalMesh(nullptr);
             }
         }
@@ -63,15 +65,28 @@ int USkeletalMeshComponent::CheckRayIntersection(const FVector& InRayOrigin, con
     if (!SkeletalMesh) return 0;
     if (!AABB.Intersect(InRayOrigin, InRayDirection, OutHitDistance)) return 0;
 
-    const auto* RenderData = SkeletalMesh->GetRenderData();
+    auto* RenderData = SkeletalMesh->GetRenderData();
     const auto& Vertices = RenderData->Vertices;
     const auto& Indices = RenderData->Indices;
 
+    // 위상은 바뀌지 않으므로 스키닝된 포즈는 Refit으로 따라감
+    if (RenderData->BVH.GetNumTriangles() != Indices.Num() / 3)
+    {
+        RenderData->BVH.Build(Vertices, Indices);
+        RenderData->bBVHDirty = false;
+    }
+    else if (RenderData->bBVHDirty)
+    {
+        RenderData->BVH.Refit(Vertices, Indices);
+        RenderData->bBVHDirty = false;
+    }
+
     OutHitDistance = FLT_MAX;
     int HitCount = 0;
 
-    for (int i = 0; i + 2 < Indices.Num(); i += 3)
+    RenderData->BVH.RayCast(InRayOrigin, InRayDirection, [&](int32 Triangle)
     {
+        const int32 i = Triangle * 3;
         const FVector v0(Vertices[Indices[i + 0]].X, Vertices[Indices[i + 0]].Y, Vertices[Indices[i + 0]].Z);
         const FVector v1(Vertices[Indices[i + 1]].X, Vertices[Indices[i + 1]].Y, Vertices[Indices[i + 1]].Z);
         const FVector v2(Vertices[Indices[i + 2]].X, Vertices[Indices[i + 2]].Y, Vertices[Indices[i + 2]].Z);
@@ -82,7 +97,7 @@ int USkeletalMeshComponent::CheckRayIntersection(const FVector& InRayOrigin, con
             OutHitDistance = FMath::Min(OutHitDistance, HitDistance);
             ++HitCount;
         }
-    }
+    });
     return HitCount;
 }
 
@@ -111,15 +126,9 @@ void USkeletalMeshComponent::RotateBone(FString BoneName, FRotator Rotation)
     }
 
     /*Rotation = Cast<ASkeletalMeshActor>(GetOwner())->BoneGizmoSceneComponents[BoneIndex]->GetRelativeRotation();*/
-    FFBXLoader::RotateBones(RenderData->SkeletonBones, BoneIndex, FbxVector4(Rotation.Roll, Rotation.Pitch, Rotation.Yaw));
-
-    FFBXLoader::RecalculateGlobalPoses(RenderData->SkeletonBones);
+    FSkeletalMeshSkinning::SetBoneRotation(RenderData->SkeletonBones, BoneIndex, Rotation);
 
-    // 스킨 다시 계산
-    FFBXLoader::ReskinVerticesCPU(
-        FFBXLoader::Mesh, // 필요시 원본 FbxMesh 포인터 보존 필요
-        RenderData->SkeletonBones,
-        RenderData->Vertices
-    );
+    // 스키닝은 렌더러가 그리기 직전에 메시당 한 번 수행
+    RenderData->bPoseDirty = true;
 }
 
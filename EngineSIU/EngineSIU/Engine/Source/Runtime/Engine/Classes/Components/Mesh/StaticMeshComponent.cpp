@@ -1,5 +1,6 @@
 #include <algorithm>
 #include "StaticMeshComponent.h"
+#include "Components/ComponentPropertyReader.h"
 #include "Engine/FObjLoader.h"
 #include "Launch/EngineLoop.h"
 #include "UObject/Casts.h"
@@ -41,29 +42,26 @@ void UStaticMeshComponent::GetProperties(TMap<FString, FString>& OutProperties)
     }
 }
 
-void UStaticMeshComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UStaticMeshComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
 
-    
     // --- StaticMesh 설정 ---
-    TempStr = InProperties.Find(TEXT("StaticMeshPath"));
-    if (TempStr) // 키가 존재하는지 확인
+    FString MeshPath;
+    if (InProperties.Read(TEXT("StaticMeshPath"), MeshPath)) // 키가 존재하는지 확인
     {
-        if (*TempStr != TEXT("None")) // 값이 "None"이 아닌지 확인
+        if (MeshPath != TEXT("None")) // 값이 "None"이 아닌지 확인
         {
             // 경로 문자열로 UStaticMesh 에셋 로드 시도
-           
-            if (UStaticMesh* MeshToSet = FObjManager::CreateStaticMesh(*TempStr))
+            if (UStaticMesh* MeshToSet = FObjManager::CreateStaticMesh(MeshPath))
             {
                 SetStaticMesh(MeshToSet); // 성공 시 메시 설정
-                UE_LOG(ELogLevel::Display, TEXT("Set StaticMesh '%s' for %s"), **TempStr, *GetName());
+                UE_LOG(ELogLevel::Display, TEXT("Set StaticMesh '%s' for %s"), *MeshPath, *GetName());
             }
             else
             {
                 // 로드 실패 시 경고 로그
-                UE_LOG(ELogLevel::Warning, TEXT("Could not load StaticMesh '%s' for %s"), **TempStr, *GetName());
+                UE_LOG(ELogLevel::Warning, TEXT("Could not load StaticMesh '%s' for %s"), *MeshPath, *GetName());
                 SetStaticMesh(nullptr); // 안전하게 nullptr로 설정
             }
         }
@@ -168,7 +166,23 @@ int UStaticMeshComponent::CheckRayIntersection(const FVector& InRayOrigin, const
     const bool bHasIndices = (IndexNum > 0);
     
     int32 TriangleNum = bHasIndices ? (IndexNum / 3) : (VertexNum / 3);
-    for (int32 i = 0; i < TriangleNum; i++)
+
+    // 로드할 때 만들어 두지만, 다른 경로로 데이터가 바뀌었으면 여기서 다시 만듦
+    FMeshBVH& BVH = RenderData->BVH;
+    if (BVH.GetNumTriangles() != TriangleNum)
+    {
+        if (bHasIndices)
+        {
+            BVH.Build(Vertices, Indices);
+        }
+        else
+        {
+            BVH.Build(&Vertices[0].X, sizeof(FStaticMeshVertex), VertexNum, nullptr, 0);
+        }
+    }
+
+    // 반직선이 지나는 리프의 삼각형만 검사, 전체를 검사한 것과 같은 교차 수와 거리를 얻음
+    BVH.RayCast(InRayOrigin, InRayDirection, [&](int32 i)
     {
         int32 Idx0 = i * 3;
         int32 Idx1 = i * 3 + 1;
@@ -192,7 +206,6 @@ int UStaticMeshComponent::CheckRayIntersection(const FVector& InRayOrigin, const
             OutHitDistance = FMath::Min(HitDistance, OutHitDistance);
             IntersectionNum++;
         }
-
-    }
+    });
     return IntersectionNum;
 }
@@ -15,7 +15,7 @@ public:
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SetProperties(const FComponentPropertyReader& InProperties) override;
 
     void SetselectedSubMeshIndex(const int& value) { selectedSubMeshIndex = value; }
     int GetselectedSubMeshIndex() const { return selectedSubMeshIndex; };
@@ -42,6 +42,7 @@ public:
             OverrideMaterials.SetNum(value->GetMaterials().Num());
             AABB = FBoundingBox(StaticMesh->GetRenderData()->BoundingBoxMin, StaticMesh->GetRenderData()->BoundingBoxMax);
         }
+        MarkBoundsDirty();
     }
 
 protected:
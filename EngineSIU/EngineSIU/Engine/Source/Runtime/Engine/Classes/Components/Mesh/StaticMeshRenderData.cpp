@@ -35,12 +35,16 @@ void UStaticMesh::GetUsedMaterials(TArray<UMaterial*>& OutMaterial) const
 
 FWString UStaticMesh::GetOjbectName() const
 {
-    return RenderData->ObjectName;
+    return ObjectName;
 }
 
 void UStaticMesh::SetData(FStaticMeshRenderData* InRenderData)
 {
+    ClearMaterials();
+
     RenderData = InRenderData;
+    ObjectName = RenderData->ObjectName;
+    bIsPlaceholder = false;
 
     for (int materialIndex = 0; materialIndex < RenderData->Materials.Num(); materialIndex++)
     {
@@ -53,3 +57,21 @@ void UStaticMesh::SetData(FStaticMeshRenderData* InRenderData)
         materials.Add(newMaterialSlot);
     }
 }
+
+void UStaticMesh::SetPlaceholderData(FStaticMeshRenderData* InPlaceholderData, const FWString& InObjectName)
+{
+    ClearMaterials();
+
+    RenderData = InPlaceholderData;
+    ObjectName = InObjectName;
+    bIsPlaceholder = true;
+}
+
+void UStaticMesh::ClearMaterials()
+{
+    for (FStaticMaterial* MaterialSlot : materials)
+    {
+        delete MaterialSlot;
+    }
+    materials.Empty();
+}
@@ -25,7 +25,19 @@ public:
 
     void SetData(FStaticMeshRenderData* InRenderData);
 
+    /**
+     * 비동기 로드가 끝나기 전까지 공유 Placeholder 데이터를 사용합니다.
+     * @param InObjectName 로드할 에셋 경로, Scene 저장 시 Placeholder 대신 이 경로가 기록됨
+     */
+    void SetPlaceholderData(FStaticMeshRenderData* InPlaceholderData, const FWString& InObjectName);
+
+    bool IsPlaceholder() const { return bIsPlaceholder; }
+
 private:
+    void ClearMaterials();
+
     FStaticMeshRenderData* RenderData = nullptr;
+    FWString ObjectName;
+    bool bIsPlaceholder = false;
     TArray<FStaticMaterial*> materials;
 };
@@ -1,4 +1,5 @@
 #include "ParticleSubUVComponent.h"
+#include "Components/ComponentPropertyReader.h"
 #include "EngineLoop.h"
 #include "UObject/Casts.h"
 #include "D3D11RHI/DXDBufferManager.h"
@@ -8,6 +9,10 @@ UParticleSubUVComponent::UParticleSubUVComponent()
 {
     SetType(StaticClass()->GetName());
     bIsLoop = true;
+    PrimaryComponentTick.bCanEverTick = true;
+
+    // 자기 프레임 인덱스와 UV만 바꾸므로 워커 스레드에서 Tick해도 됨 (Deactivate도 자기 Tick 함수만 끔)
+    PrimaryComponentTick.SetRunOnAnyThread(true);
 }
 
 // Duplicate: 버퍼 포인터는 복사하지 않고 애니메이션 상태만 복제
@@ -44,56 +49,18 @@ void UParticleSubUVComponent::GetProperties(TMap<FString, FString>& OutPropertie
     
 }
 
-void UParticleSubUVComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UParticleSubUVComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("bIsLoop"));
-    if (TempStr)
-    {
-        bIsLoop = (*TempStr == TEXT("true"));
-    }
-    TempStr = InProperties.Find(TEXT("CellsPerRow"));
-    if (TempStr)
-    {
-        CellsPerRow = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("CellsPerColumn"));
-    if (TempStr)
-    {
-        CellsPerColumn = FString::ToFloat(**TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("IndexU"));
-    if (TempStr)
-    {
-        indexU = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("IndexV"));
-    if (TempStr)
-    {
-        indexV = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("ElapsedTime"));
-    if (TempStr)
-    {
-        elapsedTime = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("FrameDuration"));
-    if (TempStr)
-    {
-        FrameDuration = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("UVScale"));
-    
-    if (TempStr)
-    {
-        UVScale.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("UVOffset"));
-    if (TempStr)
-    {
-        UVOffset.InitFromString(*TempStr);
-    }
+    InProperties.Read(TEXT("bIsLoop"), bIsLoop);
+    InProperties.Read(TEXT("CellsPerRow"), CellsPerRow);
+    InProperties.Read(TEXT("CellsPerColumn"), CellsPerColumn);
+    InProperties.Read(TEXT("IndexU"), indexU);
+    InProperties.Read(TEXT("IndexV"), indexV);
+    InProperties.Read(TEXT("ElapsedTime"), elapsedTime);
+    InProperties.Read(TEXT("FrameDuration"), FrameDuration);
+    InProperties.Read(TEXT("UVScale"), UVScale);
+    InProperties.Read(TEXT("UVOffset"), UVOffset);
 }
 
 // InitializeComponent: 초기화 시 버텍스 버퍼 생성
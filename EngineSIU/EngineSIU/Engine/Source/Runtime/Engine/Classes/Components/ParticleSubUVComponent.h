@@ -14,7 +14,7 @@ public:
     virtual UObject* Duplicate(UObject* InOuter) override;
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SetProperties(const FComponentPropertyReader& InProperties) override;
     
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
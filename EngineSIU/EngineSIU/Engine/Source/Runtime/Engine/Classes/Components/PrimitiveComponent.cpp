@@ -1,8 +1,10 @@
 #include "PrimitiveComponent.h"
+#include "Components/ComponentPropertyReader.h"
 
 #include "UObject/Casts.h"
 #include "Engine/OverlapInfo.h"
 #include "Engine/OverlapResult.h"
+#include "CollisionManager.h"
 #include "GameFramework/Actor.h"
 #include "World/World.h"
 
@@ -183,6 +185,72 @@ void UPrimitiveComponent::TickComponent(float DeltaTime)
     Super::TickComponent(DeltaTime);
 }
 
+FBoundingBox UPrimitiveComponent::GetWorldAABB() const
+{
+    const FMatrix WorldMatrix = GetWorldMatrix();
+
+    FVector Min(FLT_MAX);
+    FVector Max(-FLT_MAX);
+    for (int32 Corner = 0; Corner < 8; ++Corner)
+    {
+        const FVector LocalCorner(
+            (Corner & 1) ? AABB.MaxLocation.X : AABB.MinLocation.X,
+            (Corner & 2) ? AABB.MaxLocation.Y : AABB.MinLocation.Y,
+            (Corner & 4) ? AABB.MaxLocation.Z : AABB.MinLocation.Z
+        );
+        const FVector WorldCorner = WorldMatrix.TransformPosition(LocalCorner);
+        Min = Min.ComponentMin(WorldCorner);
+        Max = Max.ComponentMax(WorldCorner);
+    }
+
+    return FBoundingBox(Min, Max);
+}
+
+void UPrimitiveComponent::MarkBoundsDirty()
+{
+    if (!IsRegisteredWithWorld() || SceneDirtyIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (FCollisionManager* CollisionManager = World->GetCollisionManager())
+        {
+            CollisionManager->MarkPrimitiveDirty(this);
+        }
+    }
+}
+
+void UPrimitiveComponent::OnRegister(UWorld* World)
+{
+    Super::OnRegister(World);
+
+    if (FCollisionManager* CollisionManager = World->GetCollisionManager())
+    {
+        CollisionManager->RegisterPrimitive(this);
+    }
+}
+
+void UPrimitiveComponent::OnUnregister(UWorld* World)
+{
+    if (FCollisionManager* CollisionManager = World ? World->GetCollisionManager() : nullptr)
+    {
+        CollisionManager->UnregisterPrimitive(this);
+    }
+    SceneProxyId = INDEX_NONE;
+    SceneDirtyIndex = INDEX_NONE;
+
+    Super::OnUnregister(World);
+}
+
+void UPrimitiveComponent::OnComponentToWorldDirty()
+{
+    Super::OnComponentToWorldDirty();
+
+    MarkBoundsDirty();
+}
+
 bool UPrimitiveComponent::IntersectRayTriangle(const FVector& RayOrigin, const FVector& RayDirection, const FVector& v0, const FVector& v1, const FVector& v2, float& OutHitDistance) const
 {
     const FVector Edge1 = v1 - v0;
@@ -230,27 +298,16 @@ void UPrimitiveComponent::GetProperties(TMap<FString, FString>& OutProperties) c
     OutProperties.Add(TEXT("AABB_max"), AABB.MaxLocation.ToString());
 }
 
-void UPrimitiveComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UPrimitiveComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
 
-    const FString* TempStr = nullptr;
-
     // --- PrimitiveComponent 고유 속성 복원 ---
+    InProperties.Read(TEXT("m_Type"), m_Type);
+    InProperties.Read(TEXT("AABB_min"), AABB.MinLocation);
+    InProperties.Read(TEXT("AABB_max"), AABB.MaxLocation);
 
-    TempStr = InProperties.Find(TEXT("m_Type"));
-    if (TempStr)
-    {
-        this->m_Type = *TempStr; // m_Type이 FString이라고 가정
-        // 만약 m_Type이 enum이라면 문자열로부터 enum 값을 파싱하는 로직 필요
-    }
-
-    const FString* AABBminStr = InProperties.Find(TEXT("AABB_min"));
-    if (AABBminStr) AABB.MinLocation.InitFromString(*AABBminStr); 
-
-    
-    const FString* AABBmaxStr = InProperties.Find(TEXT("AABB_max"));
-    if (AABBmaxStr) AABB.MaxLocation.InitFromString(*AABBmaxStr); 
+    MarkBoundsDirty();
 }
 
 void UPrimitiveComponent::BeginComponentOverlap(const FOverlapInfo& OtherOverlap, bool bDoNotifies)
@@ -24,10 +24,22 @@ public:
     ) const;
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SetProperties(const FComponentPropertyReader& InProperties) override;
     
     FBoundingBox AABB;
 
+    /** Scene의 공간 인덱스에 사용할 월드 공간 AABB, 기본은 로컬 AABB의 8개 꼭짓점을 감쌉니다. */
+    virtual FBoundingBox GetWorldAABB() const;
+
+    /**
+     * 반직선 교차가 AABB 안에서만 일어나는지 여부
+     * false면 공간 인덱스 대신 항상 LineTrace 결과에 포함됩니다. (화면 공간에서 픽킹하는 Billboard 등)
+     */
+    virtual bool IsRayTraceBoundedByAABB() const { return true; }
+
+    /** AABB나 GetWorldAABB에 쓰이는 값을 바꾼 뒤 호출해서, 다음 검색 전에 공간 인덱스에 반영되도록 합니다. */
+    void MarkBoundsDirty();
+
     bool GetGenerateOverlapEvents() const { return bGenerateOverlapEvents; }
     
     bool bGenerateOverlapEvents = true;
@@ -99,6 +111,10 @@ public:
 protected:
     TArray<FOverlapInfo> OverlappingComponents;
 
+    virtual void OnRegister(UWorld* World) override;
+    virtual void OnUnregister(UWorld* World) override;
+    virtual void OnComponentToWorldDirty() override;
+
     virtual void UpdateOverlapsImpl(const TArray<FOverlapInfo>* PendingOverlaps = nullptr, bool bDoNotifies = true, const TArray<const FOverlapInfo>* OverlapsAtEndLocation = nullptr) override;
 
     void ClearComponentOverlaps(bool bDoNotifies, bool bSkipNotifySelf);
@@ -106,6 +122,14 @@ protected:
 private:
     FString m_Type;
 
+    friend class FCollisionManager;
+
+    /** World의 FCollisionManager가 관리하는 Scene 트리의 프록시 ID */
+    int32 SceneProxyId = INDEX_NONE;
+
+    /** FCollisionManager의 갱신 대기 목록에서의 위치, 대기 중이 아니면 INDEX_NONE */
+    int32 SceneDirtyIndex = INDEX_NONE;
+
 public:
     FString GetType() { return m_Type; }
 
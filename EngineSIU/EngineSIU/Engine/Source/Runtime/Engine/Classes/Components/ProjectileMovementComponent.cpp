@@ -1,4 +1,5 @@
 #include "ProjectileMovementComponent.h"
+#include "Components/ComponentPropertyReader.h"
 #include "GameFramework/Actor.h"
 
 UProjectileMovementComponent::UProjectileMovementComponent()
@@ -9,6 +10,11 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     Velocity = FVector(0.f, 0.f, 0.f);
     ProjectileLifetime = 10.0f; // 기본 생명주기 설정
     AccumulatedTime = 0;
+
+    PrimaryComponentTick.bCanEverTick = true;
+
+    // 소유 Actor의 RootComponent만 옮기므로 워커 스레드에서 Tick해도 됨, Destroy만 메인 스레드로 미룸
+    PrimaryComponentTick.SetRunOnAnyThread(true);
 }
 
 UProjectileMovementComponent::~UProjectileMovementComponent()
@@ -55,12 +61,15 @@ void UProjectileMovementComponent::TickComponent(float DeltaTime)
 
     //ToDo : PIE모드 진입 후에도 PickedActor를 유지했을 때 예외발생할 수 있음.
     AccumulatedTime += DeltaTime;
-    if (AccumulatedTime >= ProjectileLifetime)
+    if (AccumulatedTime >= ProjectileLifetime && GetOwner())
     {
-        if (GetOwner())
+        // Destroy는 World를 바꾸므로, 워커에서 실행 중이면 다음 프레임에 메인 스레드에서 Tick하도록 돌려놓음
+        if (PrimaryComponentTick.RunsOnAnyThread())
         {
-            GetOwner()->Destroy();
+            PrimaryComponentTick.SetRunOnAnyThread(false);
+            return;
         }
+        GetOwner()->Destroy();
     }
 }
 
@@ -77,39 +86,13 @@ void UProjectileMovementComponent::GetProperties(TMap<FString, FString>& OutProp
     
 }
 
-void UProjectileMovementComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UProjectileMovementComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("ProjectileLifetime"));
-    if (TempStr)
-    {
-        ProjectileLifetime = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("AccumulatedTime"));
-    if (TempStr)
-    {
-        AccumulatedTime = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("InitialSpeed"));
-    if (TempStr)
-    {
-        InitialSpeed = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("MaxSpeed"));
-    if (TempStr)
-    {
-        MaxSpeed = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Gravity"));
-    if (TempStr)
-    {
-        Gravity = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("Velocity"));
-    if (TempStr)
-    {
-        Velocity.InitFromString(*TempStr);
-    }
-    
+    InProperties.Read(TEXT("ProjectileLifetime"), ProjectileLifetime);
+    InProperties.Read(TEXT("AccumulatedTime"), AccumulatedTime);
+    InProperties.Read(TEXT("InitialSpeed"), InitialSpeed);
+    InProperties.Read(TEXT("MaxSpeed"), MaxSpeed);
+    InProperties.Read(TEXT("Gravity"), Gravity);
+    InProperties.Read(TEXT("Velocity"), Velocity);
 }
@@ -37,7 +37,7 @@ public:
 
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SetProperties(const FComponentPropertyReader& InProperties) override;
 
 private:
     float ProjectileLifetime; // 생명주기
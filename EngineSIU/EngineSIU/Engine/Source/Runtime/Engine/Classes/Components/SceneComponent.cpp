@@ -1,4 +1,7 @@
 #include "Components/SceneComponent.h"
+#include <cassert>
+#include "Async/JobSystem.h"
+#include "Components/ComponentPropertyReader.h"
 #include "Math/Rotator.h"
 #include "Math/JungleMath.h"
 #include "UObject/Casts.h"
@@ -20,10 +23,30 @@ UObject* USceneComponent::Duplicate(UObject* InOuter)
     NewComponent->RelativeLocation = RelativeLocation;
     NewComponent->RelativeRotation = RelativeRotation;
     NewComponent->RelativeScale3D = RelativeScale3D;
+    NewComponent->MarkComponentToWorldDirty();
 
     return NewComponent;
 }
 
+void USceneComponent::PostDuplicate()
+{
+    Super::PostDuplicate();
+
+    // 함께 복제되지 않은 자식은 여전히 원본의 자식이므로 목록에서 제외
+    AttachChildren.RemoveAll([this](const USceneComponent* Child)
+    {
+        return !Child || Child->AttachParent != this;
+    });
+
+    // 함께 복제되지 않은 부모(다른 Actor의 Component)에 붙어 있었다면 복제본도 같은 부모에 붙임
+    if (AttachParent && !AttachParent->AttachChildren.Contains(this))
+    {
+        AttachParent->AttachChildren.Add(this);
+    }
+
+    bComponentToWorldDirty = true;
+}
+
 void USceneComponent::GetProperties(TMap<FString, FString>& OutProperties) const
 {
     Super::GetProperties(OutProperties);
@@ -42,25 +65,14 @@ void USceneComponent::GetProperties(TMap<FString, FString>& OutProperties) const
     }
 }
 
-void USceneComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void USceneComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("RelativeLocation"));
-    if (TempStr)
-    {
-        RelativeLocation.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("RelativeRotation"));
-    if (TempStr)
-    {
-        RelativeRotation.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("RelativeScale3D"));
-    if (TempStr)
-    {
-        RelativeScale3D.InitFromString(*TempStr);
-    }
+    InProperties.Read(TEXT("RelativeLocation"), RelativeLocation);
+    InProperties.Read(TEXT("RelativeRotation"), RelativeRotation);
+    InProperties.Read(TEXT("RelativeScale3D"), RelativeScale3D);
+
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::InitializeComponent()
@@ -155,18 +167,20 @@ FVector USceneComponent::GetUpVector() const
 void USceneComponent::AddLocation(const FVector& InAddValue)
 {
     RelativeLocation = RelativeLocation + InAddValue;
-
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::AddRotation(const FRotator& InAddValue)
 {
     RelativeRotation = RelativeRotation + InAddValue;
     RelativeRotation.Normalize();
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::AddScale(const FVector& InAddValue)
 {
     RelativeScale3D = RelativeScale3D + InAddValue;
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::AttachToComponent(USceneComponent* InParent)
@@ -177,6 +191,8 @@ void USceneComponent::AttachToComponent(USceneComponent* InParent)
         AttachParent->AttachChildren.Remove(this);
     }
 
+    MarkComponentToWorldDirty();
+
     // InParent도 nullptr이면 부모를 nullptr로 설정
     if (InParent == nullptr)
     {
@@ -211,6 +227,7 @@ void USceneComponent::SetWorldLocation(const FVector& InLocation)
     }
     FVector NewRelativeLocation = NewRelativeMatrix.GetTranslationVector();
     RelativeLocation = NewRelativeLocation;
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::SetWorldRotation(const FRotator& InRotation)
@@ -229,7 +246,8 @@ void USceneComponent::SetWorldRotation(const FQuat& InQuat)
     }
     FQuat NewRelativeRotation = FQuat(NewRelativeMatrix);
     RelativeRotation = FRotator(NewRelativeRotation);
-    RelativeRotation.Normalize();   
+    RelativeRotation.Normalize();
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::SetWorldScale3D(const FVector& InScale)
@@ -243,6 +261,7 @@ void USceneComponent::SetWorldScale3D(const FVector& InScale)
     }
     FVector NewRelativeScale = NewRelativeMatrix.GetScaleVector();
     RelativeScale3D = NewRelativeScale;
+    MarkComponentToWorldDirty();
 }
 
 FVector USceneComponent::GetWorldLocation() const
@@ -279,27 +298,55 @@ FMatrix USceneComponent::GetTranslationMatrix() const
 
 FMatrix USceneComponent::GetWorldMatrix() const
 {
-    FMatrix ScaleMat = GetScaleMatrix();
-    FMatrix RotationMat = GetRotationMatrix();
-    FMatrix TranslationMat = GetTranslationMatrix();
+    if (bComponentToWorldDirty)
+    {
+        UpdateComponentToWorld();
+    }
+    return ComponentToWorld;
+}
+
+void USceneComponent::MarkComponentToWorldDirty()
+{
+    // 이미 Dirty라면 자식들도 모두 Dirty 상태이므로 더 내려갈 필요가 없음
+    if (bComponentToWorldDirty)
+    {
+        return;
+    }
 
-    FMatrix RTMat = RotationMat * TranslationMat;
+    bComponentToWorldDirty = true;
+    OnComponentToWorldDirty();
 
-    USceneComponent* Parent = AttachParent;
-    while (Parent)
+    for (USceneComponent* Child : AttachChildren)
     {
-        FMatrix ParentScaleMat = Parent->GetScaleMatrix();
-        FMatrix ParentRotationMat = Parent->GetRotationMatrix();
-        FMatrix ParentTranslationMat = Parent->GetTranslationMatrix();
-        
-        ScaleMat = ScaleMat * ParentScaleMat;
-        
-        FMatrix ParentRTMat = ParentRotationMat * ParentTranslationMat;
-        RTMat = RTMat * ParentRTMat;
-
-        Parent = Parent->AttachParent;
+        if (Child)
+        {
+            Child->MarkComponentToWorldDirty();
+        }
     }
-    return ScaleMat * RTMat;
+}
+
+void USceneComponent::UpdateComponentToWorld() const
+{
+    // mutable 캐시와 부모의 캐시를 잠금 없이 고쳐쓰므로, 워커가 같은 부모를 동시에 계산하지 않도록 막음
+    assert(!FJobSystem::IsInsideJob() && "ComponentToWorld의 지연 계산은 게임 스레드에서만 할 수 있습니다.");
+
+    // Scale과 Rotation * Translation을 따로 누적 (비균등 스케일이 부모 회전에 의해 기울어지지 않도록)
+    WorldScaleMatrix = GetScaleMatrix();
+    WorldRTMatrix = GetRotationMatrix() * GetTranslationMatrix();
+
+    if (AttachParent)
+    {
+        if (AttachParent->bComponentToWorldDirty)
+        {
+            AttachParent->UpdateComponentToWorld();
+        }
+
+        WorldScaleMatrix = WorldScaleMatrix * AttachParent->WorldScaleMatrix;
+        WorldRTMatrix = WorldRTMatrix * AttachParent->WorldRTMatrix;
+    }
+
+    ComponentToWorld = WorldScaleMatrix * WorldRTMatrix;
+    bComponentToWorldDirty = false;
 }
 
 void USceneComponent::SetupAttachment(USceneComponent* InParent)
@@ -318,6 +365,8 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent)
 
         // TODO: .AddUnique의 실행 위치를 RegisterComponent로 바꾸거나 해야할 듯
         InParent->AttachChildren.AddUnique(this);
+
+        MarkComponentToWorldDirty();
     }
 }
 
@@ -331,6 +380,13 @@ void USceneComponent::DetachFromComponent(USceneComponent* Target)
     }
 
     Target->AttachChildren.Remove(this);
+
+    // Target의 자식 목록에서 빠졌으므로 더 이상 Dirty 전파를 받을 수 없음
+    if (AttachParent == Target)
+    {
+        AttachParent = nullptr;
+    }
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::SetRelativeRotation(const FRotator& InRotation)
@@ -344,6 +400,7 @@ void USceneComponent::SetRelativeRotation(const FQuat& InQuat)
 
     RelativeRotation = NormalizedQuat.Rotator();
     RelativeRotation.Normalize();
+    MarkComponentToWorldDirty();
 }
 
 void USceneComponent::UpdateOverlaps(const TArray<FOverlapInfo>* PendingOverlaps, bool bDoNotifies, const TArray<const FOverlapInfo>* OverlapsAtEndLocation)
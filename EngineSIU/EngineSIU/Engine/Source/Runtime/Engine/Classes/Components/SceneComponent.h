@@ -14,9 +14,12 @@ public:
     USceneComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
+
+    /** 복제본끼리 연결된 부모/자식 목록을 정리합니다. */
+    virtual void PostDuplicate() override;
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SetProperties(const FComponentPropertyReader& InProperties) override;
 
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
@@ -39,10 +42,18 @@ public:
     void DetachFromComponent(USceneComponent* Target);
     
 public:
-    void SetRelativeLocation(const FVector& InLocation) { RelativeLocation = InLocation; }
+    void SetRelativeLocation(const FVector& InLocation)
+    {
+        RelativeLocation = InLocation;
+        MarkComponentToWorldDirty();
+    }
     void SetRelativeRotation(const FRotator& InRotation);
     void SetRelativeRotation(const FQuat& InQuat);
-    void SetRelativeScale3D(const FVector& InScale) { RelativeScale3D = InScale; }
+    void SetRelativeScale3D(const FVector& InScale)
+    {
+        RelativeScale3D = InScale;
+        MarkComponentToWorldDirty();
+    }
     
     FVector GetRelativeLocation() const { return RelativeLocation; }
     FRotator GetRelativeRotation() const { return RelativeRotation; }
@@ -62,8 +73,19 @@ public:
     FMatrix GetRotationMatrix() const;
     FMatrix GetTranslationMatrix() const;
 
+    /**
+     * 캐시된 ComponentToWorld를 반환합니다.
+     * @note Dirty이면 자신과 부모의 캐시를 다시 계산해서 쓰므로 게임 스레드에서만 호출해야 합니다. (작업 안에서 호출하면 assert)
+     *       워커가 Transform을 읽어야 한다면 병렬 구간 전에 게임 스레드에서 한 번 호출해 캐시를 채워둬야 합니다.
+     */
     FMatrix GetWorldMatrix() const;
 
+    /**
+     * 캐시된 ComponentToWorld를 무효화하고, 모든 자식 컴포넌트에도 전파합니다.
+     * Relative Transform이나 Attach 관계를 직접 변경한 경우 호출해야 합니다.
+     */
+    void MarkComponentToWorldDirty();
+
     void UpdateOverlaps(const TArray<FOverlapInfo>* PendingOverlaps = nullptr, bool bDoNotifies = true, const TArray<const FOverlapInfo>* OverlapsAtEndLocation = nullptr);
 
     bool MoveComponent(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit = nullptr);
@@ -92,6 +114,24 @@ protected:
 
     virtual bool MoveComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit = nullptr);
 
+    /** MarkComponentToWorldDirty로 캐시가 처음 무효화될 때 호출됩니다. 다시 계산되기 전까지는 중복 호출되지 않습니다. */
+    virtual void OnComponentToWorldDirty() {}
+
+private:
+    /** 부모의 캐시를 이용해 ComponentToWorld를 다시 계산합니다. 게임 스레드 전용 */
+    void UpdateComponentToWorld() const;
+
+    /** 부모 체인까지 누적된 Scale 행렬 */
+    mutable FMatrix WorldScaleMatrix;
+
+    /** 부모 체인까지 누적된 Rotation * Translation 행렬 */
+    mutable FMatrix WorldRTMatrix;
+
+    /** WorldScaleMatrix * WorldRTMatrix */
+    mutable FMatrix ComponentToWorld;
+
+    mutable bool bComponentToWorldDirty = true;
+
 public:
     bool IsUsingAbsoluteRotation() const;
     void SetUsingAbsoluteRotation(const bool bInAbsoluteRotation);
@@ -1,13 +1,73 @@
-
 #include "ShapeComponent.h"
 
+#include "CollisionManager.h"
+#include "World/World.h"
+
 UShapeComponent::UShapeComponent()
 {
+    // 이동이 끝난 위치로 오버랩을 갱신
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.SetTickGroup(TG_PostPhysics);
+}
+
+void UShapeComponent::BeginPlay()
+{
+    UPrimitiveComponent::BeginPlay();
+
+    UpdateBroadphase();
 }
 
 void UShapeComponent::TickComponent(float DeltaTime)
 {
     UPrimitiveComponent::TickComponent(DeltaTime);
 
+    // Broadphase는 OnComponentToWorldDirty에서 모인 이동을 검색 직전에 한 번에 반영함
     UpdateOverlaps();
 }
+
+void UShapeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    RemoveFromBroadphase();
+
+    UPrimitiveComponent::EndPlay(EndPlayReason);
+}
+
+void UShapeComponent::OnComponentDestroyed()
+{
+    RemoveFromBroadphase();
+
+    UPrimitiveComponent::OnComponentDestroyed();
+}
+
+FBoundingBox UShapeComponent::GetWorldAABB() const
+{
+    const FVector Location = GetWorldLocation();
+    return FBoundingBox(Location, Location);
+}
+
+void UShapeComponent::UpdateBroadphase()
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (FCollisionManager* CollisionManager = World->GetCollisionManager())
+        {
+            CollisionManager->UpdateShape(this);
+        }
+    }
+}
+
+void UShapeComponent::RemoveFromBroadphase()
+{
+    if (BroadphaseProxyId == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (FCollisionManager* CollisionManager = World->GetCollisionManager())
+        {
+            CollisionManager->UnregisterShape(this);
+        }
+    }
+}
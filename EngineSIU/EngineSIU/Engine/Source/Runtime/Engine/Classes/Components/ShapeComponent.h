@@ -18,7 +18,13 @@ class UShapeComponent : public UPrimitiveComponent
 public:
     UShapeComponent();
 
+    virtual void BeginPlay() override;
     virtual void TickComponent(float DeltaTime) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void OnComponentDestroyed() override;
+
+    /** Broadphase에 사용할 월드 공간 AABB */
+    virtual FBoundingBox GetWorldAABB() const override;
     
     FColor ShapeColor = FColor(180, 180, 180, 255);
     bool bDrawOnlyIfSelected = true;
@@ -27,4 +33,13 @@ public:
 
 protected:
     EShapeType ShapeType = EShapeType::MAX;
+
+private:
+    friend class FCollisionManager;
+
+    /** World의 FCollisionManager가 관리하는 Broadphase 프록시 ID */
+    int32 BroadphaseProxyId = INDEX_NONE;
+
+    void UpdateBroadphase();
+    void RemoveFromBroadphase();
 };
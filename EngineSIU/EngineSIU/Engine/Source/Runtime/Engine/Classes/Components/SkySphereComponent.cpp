@@ -5,6 +5,10 @@
 USkySphereComponent::USkySphereComponent()
 {
     SetType(StaticClass()->GetName());
+    PrimaryComponentTick.bCanEverTick = true;
+
+    // 자기 UV 오프셋만 바꾸므로 워커 스레드에서 Tick해도 됨
+    PrimaryComponentTick.SetRunOnAnyThread(true);
 }
 
 UObject* USkySphereComponent::Duplicate(UObject* InOuter)
@@ -1,4 +1,5 @@
 #include "SphereComponent.h"
+#include "Components/ComponentPropertyReader.h"
 
 #include "UObject/Casts.h"
 
@@ -16,15 +17,17 @@ UObject* USphereComponent::Duplicate(UObject* InOuter)
     return NewComponent;
 }
 
-void USphereComponent::SetProperties(const TMap<FString, FString>& InProperties)
+FBoundingBox USphereComponent::GetWorldAABB() const
+{
+    const FVector Center = GetWorldLocation();
+    const FVector HalfSize(SphereRadius);
+    return FBoundingBox(Center - HalfSize, Center + HalfSize);
+}
+
+void USphereComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("SphereRadius"));
-    if (TempStr)
-    {
-        SphereRadius = FCString::Atof(**TempStr);
-    }
+    InProperties.Read(TEXT("SphereRadius"), SphereRadius);
 }
 
 void USphereComponent::GetProperties(TMap<FString, FString>& OutProperties) const
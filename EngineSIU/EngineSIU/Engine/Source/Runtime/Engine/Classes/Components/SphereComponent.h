@@ -9,11 +9,16 @@ public:
     USphereComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual FBoundingBox GetWorldAABB() const override;
 
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void SetProperties(const FComponentPropertyReader& InProperties) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
 
-    void SetRadius(float InRadius) { SphereRadius = InRadius; }
+    void SetRadius(float InRadius)
+    {
+        SphereRadius = InRadius;
+        MarkBoundsDirty();
+    }
     float GetRadius() const { return SphereRadius; }
     
 private:
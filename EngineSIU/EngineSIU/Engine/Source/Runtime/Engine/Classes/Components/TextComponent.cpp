@@ -1,4 +1,5 @@
 #include "TextComponent.h"
+#include "Components/ComponentPropertyReader.h"
 
 #include "World/World.h"
 #include "Engine/Source/Editor/PropertyEditor/ShowFlags.h"
@@ -37,41 +38,19 @@ void UTextComponent::GetProperties(TMap<FString, FString>& OutProperties) const
     OutProperties.Add(TEXT("QuadSize"), FString::Printf(TEXT("%i"), QuadSize));
 }
 
-void UTextComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void UTextComponent::SetProperties(const FComponentPropertyReader& InProperties)
 {
     Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("Text"));
-    if (TempStr)
+    FString TextString;
+    if (InProperties.Read(TEXT("Text"), TextString))
     {
-        Text = TempStr->ToWideString();
+        Text = TextString.ToWideString();
     }
-    TempStr = InProperties.Find(TEXT("RowCount"));
-    if (TempStr)
-    {
-        RowCount = FString::ToInt(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("ColumnCount"));
-    if (TempStr)
-    {
-        ColumnCount = FString::ToInt(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("QuadWidth"));
-    if (TempStr)
-    {
-        QuadWidth = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("QuadHeight"));
-    if (TempStr)
-    {
-        QuadHeight = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("QuadSize"));
-    if (TempStr)
-    {
-        QuadSize = FString::ToFloat(*TempStr);
-    }
-    
+    InProperties.Read(TEXT("RowCount"), RowCount);
+    InProperties.Read(TEXT("ColumnCount"), ColumnCount);
+    InProperties.Read(TEXT("QuadWidth"), QuadWidth);
+    InProperties.Read(TEXT("QuadHeight"), QuadHeight);
+    InProperties.Read(TEXT("QuadSize"), QuadSize);
 }
 
 void UTextComponent::InitializeComponent()
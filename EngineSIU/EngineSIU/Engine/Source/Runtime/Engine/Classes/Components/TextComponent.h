@@ -16,7 +16,7 @@ public:
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
     
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
+    void SetProperties(const FComponentPropertyReader& InProperties) override;
 
     virtual void InitializeComponent() override;
     
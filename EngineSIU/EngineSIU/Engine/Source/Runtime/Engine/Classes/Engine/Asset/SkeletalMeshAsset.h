@@ -3,6 +3,7 @@
 #include "Define.h"
 #include "Hal/PlatformType.h"
 #include "Container/Array.h"
+#include "Physics/MeshBVH.h"
 
 struct FSkeletalMeshVertex 
 {
@@ -18,7 +19,7 @@ struct FSkeletalMeshVertex
 struct FSkeletalMeshBoneWeight
 {
     uint8  BoneIndices[4];  // 이 정점에 영향을 주는 본의 인덱스(최대 4개)
-    float  Weights[4];      // 각 본에 대한 가중치 (합이 1.0이 되도록)
+    float  Weights[4];      // 각 본에 대한 가중치 (합이 1.0이 되도록, 큰 순서, 영향이 없으면 모두 0)
 };
 
 struct FBone 
@@ -38,6 +39,9 @@ struct FSkeletonBone
     int32 ParentIndex;
     FMatrix LocalBindPose;
     FMatrix GlobalPose;
+
+    /** 메시 공간 -> 바인드 시점의 본 공간, 스키닝 팔레트는 InverseBindPose * GlobalPose */
+    FMatrix InverseBindPose = FMatrix::Identity;
 };
 
 struct FSkeletalMeshRenderData 
@@ -55,7 +59,24 @@ struct FSkeletalMeshRenderData
     FVector BoundingBoxMax;
 
     TArray<FSkeletonBone> SkeletonBones;
+
+    /** 임포트 시점의 정점, 스키닝의 입력 (Vertices는 스키닝 결과) */
+    TArray<FSkeletalMeshVertex> BindPoseVertices;
+
+    /** BindPoseVertices와 같은 순서의 정점별 본 영향 */
     TArray<FSkeletalMeshBoneWeight> BoneWeights;
 
+    /** 스키닝 팔레트 계산에 재사용하는 버퍼 */
+    TArray<FMatrix> BonePalette;
+
+    /** 포즈가 바뀌어 Vertices를 다시 스키닝해야 하는지 */
+    bool bPoseDirty = false;
+
+    /** Ray 교차 검사용 삼각형 BVH, 위상은 고정이므로 스키닝 후에는 Refit만 함 */
+    FMeshBVH BVH;
+
+    /** CPU 스키닝으로 Vertices가 바뀌어 다음 교차 검사 전에 BVH를 Refit해야 하는지 */
+    bool bBVHDirty = false;
+
     FSkeletalHierarchyData RootSkeletal;
 };
@@ -3,6 +3,7 @@
 #include "Define.h"
 #include "Hal/PlatformType.h"
 #include "Container/Array.h"
+#include "Physics/MeshBVH.h"
 
 struct FStaticMeshVertex
 {
@@ -27,4 +28,7 @@ struct FStaticMeshRenderData
 
     FVector BoundingBoxMin;
     FVector BoundingBoxMax;
+
+    /** Ray 교차 검사용 삼각형 BVH, 로드할 때 만들어지며 캐시 파일에는 저장하지 않음 */
+    FMeshBVH BVH;
 };
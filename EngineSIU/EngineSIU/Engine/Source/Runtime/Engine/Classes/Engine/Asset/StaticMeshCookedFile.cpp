@@ -0,0 +1,746 @@
+#include "StaticMeshCookedFile.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "StaticMeshAsset.h"
+#include "WindowsMappedFile.h"
+
+
+namespace
+{
+constexpr uint32 CookedMeshMagic = 0x4D495553; // "SUIM"
+constexpr uint32 CookedMeshEndianTag = 0x01020304;
+constexpr int64 CookedMeshAlignment = 16;
+constexpr int32 NumTextureSlots = static_cast<int32>(EMaterialTextureSlots::MTS_MAX);
+
+enum ECookedMeshFlags : uint32
+{
+    CMF_None = 0,
+    CMF_CompressedIndices = 1 << 0,
+    CMF_16BitIndices = 1 << 1,
+};
+
+/** 파일 앞부분에 그대로 기록되는 Header, 매핑된 메모리에서 복사해서 읽음 */
+struct FCookedMeshHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    uint32 EndianTag;
+    uint32 Flags;
+
+    // 다른 빌드의 구조체 레이아웃으로 만든 캐시를 걸러냄
+    uint32 VertexSize;
+    uint32 WideCharSize;
+
+    int32 NumVertices;
+    int32 NumIndices;
+    int32 NumMaterials;
+    int32 NumSubsets;
+    int32 NumSources;
+    int32 NumStrings;
+
+    int32 ObjectName;
+    int32 DisplayName;
+    float BoundingBoxMin[3];
+    float BoundingBoxMax[3];
+
+    uint64 SourceHash;  // 모든 원본 내용 해시를 합친 값
+    uint64 PayloadHash; // Header 뒤 전체의 해시
+
+    int64 VerticesOffset;
+    int64 IndicesOffset;
+    int64 IndicesSize;   // 압축했으면 압축된 Byte 수, 아니면 Index 크기(2 또는 4) * NumIndices
+    int64 MaterialsOffset;
+    int64 SubsetsOffset;
+    int64 SourcesOffset;
+    int64 StringOffsetsOffset; // uint32[NumStrings + 1], String Data 기준 위치
+    int64 StringDataOffset;
+    int64 FileSize;
+    int64 Reserved;
+};
+
+struct FCookedTextureRecord
+{
+    int32 TextureName;
+    int32 TexturePath; // Wide
+    uint32 bIsSRGB;
+};
+
+struct FCookedMaterialRecord
+{
+    int32 MaterialName;
+    uint32 TextureFlag;
+    uint32 bTransparent;
+    uint32 IlluminanceModel;
+
+    float DiffuseColor[3];
+    float SpecularColor[3];
+    float AmbientColor[3];
+    float EmissiveColor[3];
+
+    float SpecularExponent;
+    float IOR;
+    float Transparency;
+    float BumpMultiplier;
+    float Metallic;
+    float Roughness;
+
+    FCookedTextureRecord Textures[NumTextureSlots];
+    uint32 Reserved;
+};
+
+struct FCookedSubsetRecord
+{
+    int32 MaterialName;
+    uint32 IndexStart;
+    uint32 IndexCount;
+    uint32 MaterialIndex;
+};
+
+struct FCookedSourceRecord
+{
+    int32 FilePath; // Wide
+    uint32 Reserved;
+    int64 Size;
+    int64 WriteTime;
+    uint64 ContentHash;
+};
+
+static_assert(sizeof(FCookedMeshHeader) % CookedMeshAlignment == 0);
+static_assert(sizeof(FCookedMaterialRecord) % 8 == 0 && sizeof(FCookedSubsetRecord) % 8 == 0 && sizeof(FCookedSourceRecord) % 8 == 0);
+static_assert(std::is_trivially_copyable_v<FCookedMeshHeader>);
+
+int64 AlignOffset(int64 Offset)
+{
+    return (Offset + CookedMeshAlignment - 1) & ~(CookedMeshAlignment - 1);
+}
+
+/** 손상 검사와 원본 비교에 쓰는 64비트 해시, 8 Byte 단위로 섞음 */
+uint64 HashBytes(const uint8* Data, int64 Size)
+{
+    uint64 Hash = 0x9E3779B97F4A7C15ull ^ static_cast<uint64>(Size);
+
+    int64 Offset = 0;
+    for (; Offset + 8 <= Size; Offset += 8)
+    {
+        uint64 Word;
+        std::memcpy(&Word, Data + Offset, sizeof(Word));
+        Hash ^= Word * 0xC2B2AE3D27D4EB4Full;
+        Hash = std::rotl(Hash, 31) * 0x9E3779B97F4A7C15ull;
+    }
+
+    if (Offset < Size)
+    {
+        uint64 Word = 0;
+        std::memcpy(&Word, Data + Offset, static_cast<size_t>(Size - Offset));
+        Hash ^= Word * 0x165667B19E3779F9ull;
+        Hash = std::rotl(Hash, 31) * 0x9E3779B97F4A7C15ull;
+    }
+
+    Hash ^= Hash >> 33;
+    Hash *= 0xFF51AFD7ED558CCDull;
+    Hash ^= Hash >> 33;
+    return Hash;
+}
+
+int64 GetWriteTime(const std::filesystem::path& FilePath, std::error_code& OutErrorCode)
+{
+    return static_cast<int64>(std::filesystem::last_write_time(FilePath, OutErrorCode).time_since_epoch().count());
+}
+
+/** Header 뒤 전체의 해시를 Header에 기록합니다. */
+void WritePayloadHash(TArray<uint8>& Data)
+{
+    FCookedMeshHeader* Header = reinterpret_cast<FCookedMeshHeader*>(Data.GetData());
+    Header->PayloadHash = HashBytes(Data.GetData() + sizeof(FCookedMeshHeader), Data.Num() - static_cast<int64>(sizeof(FCookedMeshHeader)));
+}
+
+/** 검증된 캐시 내용에서 원본 Record의 수정 시간만 Sources의 값으로 고치고 해시를 다시 기록합니다. */
+void WriteSourceWriteTimes(TArray<uint8>& Data, const TArray<FCookedMeshSource>& Sources)
+{
+    FCookedMeshHeader Header;
+    std::memcpy(&Header, Data.GetData(), sizeof(Header));
+
+    for (int32 SourceIndex = 0; SourceIndex < Header.NumSources && SourceIndex < Sources.Num(); ++SourceIndex)
+    {
+        const int64 Offset = Header.SourcesOffset + SourceIndex * static_cast<int64>(sizeof(FCookedSourceRecord)) + offsetof(FCookedSourceRecord, WriteTime);
+        std::memcpy(Data.GetData() + Offset, &Sources[SourceIndex].WriteTime, sizeof(int64));
+    }
+    WritePayloadHash(Data);
+}
+
+/** 임시 파일에 쓴 뒤 교체합니다. */
+bool WriteFileReplacing(const std::filesystem::path& Path, const TArray<uint8>& Data)
+{
+    std::filesystem::path TempPath = Path;
+    TempPath += L".tmp";
+    {
+        std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+        File.write(reinterpret_cast<const char*>(Data.GetData()), Data.Num());
+        if (!File.good())
+        {
+            UE_LOG(ELogLevel::Warning, "Failed to write cooked static mesh: %s", Path.string().c_str());
+            return false;
+        }
+    }
+
+    std::error_code ErrorCode;
+    std::filesystem::rename(TempPath, Path, ErrorCode);
+    if (ErrorCode)
+    {
+        std::filesystem::remove(TempPath, ErrorCode);
+        return false;
+    }
+    return true;
+}
+
+/** ZigZag로 부호를 없앤 이전 Index와의 차이를 7비트씩 기록 */
+void CompressIndices(const TArray<UINT>& Indices, TArray<uint8>& OutBytes)
+{
+    OutBytes.Reserve(Indices.Num() * 2);
+
+    uint32 Previous = 0;
+    for (const UINT Index : Indices)
+    {
+        const int32 Delta = static_cast<int32>(Index - Previous);
+        uint32 ZigZag = (static_cast<uint32>(Delta) << 1) ^ static_cast<uint32>(Delta >> 31);
+        while (ZigZag >= 0x80)
+        {
+            OutBytes.Add(static_cast<uint8>(ZigZag | 0x80));
+            ZigZag >>= 7;
+        }
+        OutBytes.Add(static_cast<uint8>(ZigZag));
+        Previous = Index;
+    }
+}
+
+/** @return Bytes를 정확히 다 써서 NumIndices개를 읽었는지 여부 */
+bool DecompressIndices(const uint8* Bytes, int64 NumBytes, int32 NumIndices, UINT* OutIndices)
+{
+    int64 Offset = 0;
+    uint32 Previous = 0;
+    for (int32 i = 0; i < NumIndices; ++i)
+    {
+        uint32 ZigZag = 0;
+        for (int32 Shift = 0; ; Shift += 7)
+        {
+            if (Offset >= NumBytes || Shift > 28)
+            {
+                return false;
+            }
+
+            const uint8 Byte = Bytes[Offset++];
+            ZigZag |= static_cast<uint32>(Byte & 0x7F) << Shift;
+            if ((Byte & 0x80) == 0)
+            {
+                break;
+            }
+        }
+
+        const uint32 Delta = (ZigZag >> 1) ^ (0u - (ZigZag & 1));
+        Previous += Delta;
+        OutIndices[i] = Previous;
+    }
+    return Offset == NumBytes;
+}
+}
+
+
+bool FStaticMeshCookedFile::MakeSource(const FWString& FilePath, FCookedMeshSource& OutSource)
+{
+    OutSource = FCookedMeshSource();
+    OutSource.FilePath = FilePath;
+
+    std::error_code ErrorCode;
+    const std::filesystem::path Path = FilePath;
+    const uintmax_t Size = std::filesystem::file_size(Path, ErrorCode);
+    if (ErrorCode)
+    {
+        return false;
+    }
+
+    const int64 WriteTime = GetWriteTime(Path, ErrorCode);
+    if (ErrorCode)
+    {
+        return false;
+    }
+
+    // 빈 파일은 매핑할 수 없음
+    FMappedFile MappedFile;
+    if (Size > 0 && !MappedFile.Open(Path))
+    {
+        return false;
+    }
+
+    OutSource.Size = static_cast<int64>(Size);
+    OutSource.WriteTime = WriteTime;
+    OutSource.ContentHash = HashBytes(MappedFile.GetData(), MappedFile.GetSize());
+    return true;
+}
+
+bool FStaticMeshCookedFile::IsSourceUpToDate(FCookedMeshSource& Source)
+{
+    std::error_code ErrorCode;
+    const std::filesystem::path Path = Source.FilePath;
+    if (!std::filesystem::exists(Path, ErrorCode))
+    {
+        // Cook할 때도 없었거나, 원본 없이 캐시만 배포된 경우
+        return true;
+    }
+    if (Source.Size < 0)
+    {
+        return false;
+    }
+
+    const uintmax_t Size = std::filesystem::file_size(Path, ErrorCode);
+    if (ErrorCode || static_cast<int64>(Size) != Source.Size)
+    {
+        return false;
+    }
+
+    const int64 WriteTime = GetWriteTime(Path, ErrorCode);
+    if (!ErrorCode && WriteTime == Source.WriteTime)
+    {
+        return true;
+    }
+
+    // 복사나 체크아웃으로 수정 시간만 바뀐 경우, 다음부터 해시를 다시 계산하지 않도록 수정 시간을 갱신
+    FCookedMeshSource Current;
+    if (!MakeSource(Source.FilePath, Current) || Current.ContentHash != Source.ContentHash)
+    {
+        return false;
+    }
+    Source.WriteTime = Current.WriteTime;
+    return true;
+}
+
+void FStaticMeshCookedFile::Serialize(const FStaticMeshRenderData& StaticMesh, const TArray<FCookedMeshSource>& Sources, bool bCompressIndices, TArray<uint8>& OutData)
+{
+    // 1. String Table과 Record를 만들고
+    std::string StringData;
+    TArray<uint32> StringOffsets;
+    auto AddBytes = [&StringData, &StringOffsets](const void* Bytes, size_t NumBytes) -> int32
+    {
+        if (NumBytes == 0)
+        {
+            return INDEX_NONE;
+        }
+        StringOffsets.Add(static_cast<uint32>(StringData.size()));
+        StringData.append(static_cast<const char*>(Bytes), NumBytes);
+        return StringOffsets.Num() - 1;
+    };
+    auto AddString = [&AddBytes](const FString& String)
+    {
+        return AddBytes(String.GetContainerPrivate().data(), String.GetContainerPrivate().size() * sizeof(TCHAR));
+    };
+    auto AddWideString = [&AddBytes](const FWString& String)
+    {
+        return AddBytes(String.data(), String.size() * sizeof(wchar_t));
+    };
+
+    FCookedMeshHeader Header = {};
+    Header.Magic = CookedMeshMagic;
+    Header.Version = Version;
+    Header.EndianTag = CookedMeshEndianTag;
+    Header.Flags = bCompressIndices ? CMF_CompressedIndices : CMF_None;
+    Header.VertexSize = sizeof(FStaticMeshVertex);
+    Header.WideCharSize = sizeof(wchar_t);
+    Header.NumVertices = StaticMesh.Vertices.Num();
+    Header.NumIndices = StaticMesh.Indices.Num();
+    Header.NumMaterials = StaticMesh.Materials.Num();
+    Header.NumSubsets = StaticMesh.MaterialSubsets.Num();
+    Header.NumSources = Sources.Num();
+    Header.ObjectName = AddWideString(StaticMesh.ObjectName);
+    Header.DisplayName = AddString(StaticMesh.DisplayName);
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Header.BoundingBoxMin[Axis] = StaticMesh.BoundingBoxMin[Axis];
+        Header.BoundingBoxMax[Axis] = StaticMesh.BoundingBoxMax[Axis];
+    }
+
+    TArray<FCookedMaterialRecord> MaterialRecords;
+    MaterialRecords.Reserve(StaticMesh.Materials.Num());
+    for (const FObjMaterialInfo& Material : StaticMesh.Materials)
+    {
+        FCookedMaterialRecord& Record = MaterialRecords[MaterialRecords.Emplace()];
+        Record = {};
+        Record.MaterialName = AddString(Material.MaterialName);
+        Record.TextureFlag = Material.TextureFlag;
+        Record.bTransparent = Material.bTransparent;
+        Record.IlluminanceModel = Material.IlluminanceModel;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            Record.DiffuseColor[Axis] = Material.DiffuseColor[Axis];
+            Record.SpecularColor[Axis] = Material.SpecularColor[Axis];
+            Record.AmbientColor[Axis] = Material.AmbientColor[Axis];
+            Record.EmissiveColor[Axis] = Material.EmissiveColor[Axis];
+        }
+        Record.SpecularExponent = Material.SpecularExponent;
+        Record.IOR = Material.IOR;
+        Record.Transparency = Material.Transparency;
+        Record.BumpMultiplier = Material.BumpMultiplier;
+        Record.Metallic = Material.Metallic;
+        Record.Roughness = Material.Roughness;
+
+        for (int32 SlotIdx = 0; SlotIdx < NumTextureSlots; ++SlotIdx)
+        {
+            FCookedTextureRecord& TextureRecord = Record.Textures[SlotIdx];
+            TextureRecord = { INDEX_NONE, INDEX_NONE, 0 };
+            if (SlotIdx < Material.TextureInfos.Num())
+            {
+                const FTextureInfo& TextureInfo = Material.TextureInfos[SlotIdx];
+                TextureRecord.TextureName = AddString(TextureInfo.TextureName);
+                TextureRecord.TexturePath = AddWideString(TextureInfo.TexturePath);
+                TextureRecord.bIsSRGB = TextureInfo.bIsSRGB;
+            }
+        }
+    }
+
+    TArray<FCookedSubsetRecord> SubsetRecords;
+    SubsetRecords.Reserve(StaticMesh.MaterialSubsets.Num());
+    for (const FMaterialSubset& Subset : StaticMesh.MaterialSubsets)
+    {
+        SubsetRecords.Add({ AddString(Subset.MaterialName), Subset.IndexStart, Subset.IndexCount, Subset.MaterialIndex });
+    }
+
+    TArray<FCookedSourceRecord> SourceRecords;
+    SourceRecords.Reserve(Sources.Num());
+    Header.SourceHash = HashBytes(nullptr, 0);
+    for (const FCookedMeshSource& Source : Sources)
+    {
+        SourceRecords.Add({ AddWideString(Source.FilePath), 0, Source.Size, Source.WriteTime, Source.ContentHash });
+        Header.SourceHash = std::rotl(Header.SourceHash, 17) ^ Source.ContentHash;
+    }
+
+    Header.NumStrings = StringOffsets.Num();
+    StringOffsets.Add(static_cast<uint32>(StringData.size()));
+
+    // 압축하지 않을 때 정점이 65536개 미만이면 16비트로 저장
+    TArray<uint8> CompressedIndices;
+    TArray<uint16> ShortIndices;
+    if (bCompressIndices)
+    {
+        CompressIndices(StaticMesh.Indices, CompressedIndices);
+    }
+    else if (StaticMesh.Vertices.Num() < 65536)
+    {
+        Header.Flags |= CMF_16BitIndices;
+        ShortIndices.SetNum(StaticMesh.Indices.Num());
+        for (int32 Index = 0; Index < StaticMesh.Indices.Num(); ++Index)
+        {
+            ShortIndices[Index] = static_cast<uint16>(StaticMesh.Indices[Index]);
+        }
+    }
+
+    // 2. 각 구역의 위치를 정한 뒤
+    Header.VerticesOffset = sizeof(FCookedMeshHeader);
+    Header.IndicesOffset = AlignOffset(Header.VerticesOffset + Header.NumVertices * static_cast<int64>(sizeof(FStaticMeshVertex)));
+    Header.IndicesSize = bCompressIndices ? CompressedIndices.Num() : Header.NumIndices * static_cast<int64>(ShortIndices.Num() > 0 ? sizeof(uint16) : sizeof(UINT));
+    Header.MaterialsOffset = AlignOffset(Header.IndicesOffset + Header.IndicesSize);
+    Header.SubsetsOffset = AlignOffset(Header.MaterialsOffset + MaterialRecords.Num() * static_cast<int64>(sizeof(FCookedMaterialRecord)));
+    Header.SourcesOffset = AlignOffset(Header.SubsetsOffset + SubsetRecords.Num() * static_cast<int64>(sizeof(FCookedSubsetRecord)));
+    Header.StringOffsetsOffset = AlignOffset(Header.SourcesOffset + SourceRecords.Num() * static_cast<int64>(sizeof(FCookedSourceRecord)));
+    Header.StringDataOffset = AlignOffset(Header.StringOffsetsOffset + StringOffsets.Num() * static_cast<int64>(sizeof(uint32)));
+    Header.FileSize = Header.StringDataOffset + static_cast<int64>(StringData.size());
+
+    // 3. 순서대로 기록, 정렬로 생긴 빈칸은 0
+    OutData.Empty();
+    OutData.SetNum(static_cast<int32>(Header.FileSize));
+    uint8* Data = OutData.GetData();
+
+    auto WriteBytes = [Data](int64 Offset, const void* Bytes, int64 NumBytes)
+    {
+        if (NumBytes > 0)
+        {
+            std::memcpy(Data + Offset, Bytes, static_cast<size_t>(NumBytes));
+        }
+    };
+
+    WriteBytes(0, &Header, sizeof(Header));
+    WriteBytes(Header.VerticesOffset, StaticMesh.Vertices.GetData(), Header.NumVertices * static_cast<int64>(sizeof(FStaticMeshVertex)));
+    if (bCompressIndices)
+    {
+        WriteBytes(Header.IndicesOffset, CompressedIndices.GetData(), Header.IndicesSize);
+    }
+    else if (ShortIndices.Num() > 0)
+    {
+        WriteBytes(Header.IndicesOffset, ShortIndices.GetData(), Header.IndicesSize);
+    }
+    else
+    {
+        WriteBytes(Header.IndicesOffset, StaticMesh.Indices.GetData(), Header.IndicesSize);
+    }
+    WriteBytes(Header.MaterialsOffset, MaterialRecords.GetData(), MaterialRecords.Num() * static_cast<int64>(sizeof(FCookedMaterialRecord)));
+    WriteBytes(Header.SubsetsOffset, SubsetRecords.GetData(), SubsetRecords.Num() * static_cast<int64>(sizeof(FCookedSubsetRecord)));
+    WriteBytes(Header.SourcesOffset, SourceRecords.GetData(), SourceRecords.Num() * static_cast<int64>(sizeof(FCookedSourceRecord)));
+    WriteBytes(Header.StringOffsetsOffset, StringOffsets.GetData(), StringOffsets.Num() * static_cast<int64>(sizeof(uint32)));
+    WriteBytes(Header.StringDataOffset, StringData.data(), static_cast<int64>(StringData.size()));
+
+    WritePayloadHash(OutData);
+}
+
+bool FStaticMeshCookedFile::Deserialize(const uint8* Data, int64 Size, FStaticMeshRenderData& OutStaticMesh, TArray<FCookedMeshSource>* OutSources)
+{
+    if (Size < static_cast<int64>(sizeof(FCookedMeshHeader)))
+    {
+        return false;
+    }
+
+    FCookedMeshHeader Header;
+    std::memcpy(&Header, Data, sizeof(Header));
+
+    if (Header.Magic != CookedMeshMagic || Header.EndianTag != CookedMeshEndianTag
+        || Header.Version != Version || Header.VertexSize != sizeof(FStaticMeshVertex) || Header.WideCharSize != sizeof(wchar_t))
+    {
+        return false;
+    }
+
+    auto IsValidSection = [Size](int64 Offset, int64 Count, int64 ElementSize)
+    {
+        return Offset >= static_cast<int64>(sizeof(FCookedMeshHeader)) && Offset % CookedMeshAlignment == 0
+            && Count >= 0 && Offset <= Size && Count <= (Size - Offset) / ElementSize;
+    };
+
+    const bool bCompressedIndices = (Header.Flags & CMF_CompressedIndices) != 0;
+    const bool b16BitIndices = (Header.Flags & CMF_16BitIndices) != 0;
+    const int64 IndexSize = b16BitIndices ? sizeof(uint16) : sizeof(UINT);
+    if (Header.FileSize != Size || Header.NumStrings < 0 || Header.NumIndices < 0
+        || (Header.Flags & ~(CMF_CompressedIndices | CMF_16BitIndices)) != 0 || (bCompressedIndices && b16BitIndices)
+        || !IsValidSection(Header.VerticesOffset, Header.NumVertices, sizeof(FStaticMeshVertex))
+        || !IsValidSection(Header.IndicesOffset, Header.IndicesSize, 1)
+        || (!bCompressedIndices && Header.IndicesSize != Header.NumIndices * IndexSize)
+        || !IsValidSection(Header.MaterialsOffset, Header.NumMaterials, sizeof(FCookedMaterialRecord))
+        || !IsValidSection(Header.SubsetsOffset, Header.NumSubsets, sizeof(FCookedSubsetRecord))
+        || !IsValidSection(Header.SourcesOffset, Header.NumSources, sizeof(FCookedSourceRecord))
+        || !IsValidSection(Header.StringOffsetsOffset, static_cast<int64>(Header.NumStrings) + 1, sizeof(uint32))
+        || !IsValidSection(Header.StringDataOffset, 0, 1))
+    {
+        return false;
+    }
+
+    if (HashBytes(Data + sizeof(FCookedMeshHeader), Size - static_cast<int64>(sizeof(FCookedMeshHeader))) != Header.PayloadHash)
+    {
+        return false;
+    }
+
+    // String Table
+    const uint32* StringOffsets = reinterpret_cast<const uint32*>(Data + Header.StringOffsetsOffset);
+    const char* StringData = reinterpret_cast<const char*>(Data + Header.StringDataOffset);
+    for (int32 Index = 0; Index < Header.NumStrings; ++Index)
+    {
+        if (StringOffsets[Index] > StringOffsets[Index + 1])
+        {
+            return false;
+        }
+    }
+    if (StringOffsets[Header.NumStrings] > Size - Header.StringDataOffset)
+    {
+        return false;
+    }
+
+    bool bValid = true;
+    auto ReadBytes = [&](int32 Index, size_t CharSize, auto& OutString)
+    {
+        OutString.clear();
+        if (Index == INDEX_NONE)
+        {
+            return;
+        }
+
+        const uint32 NumBytes = Index >= 0 && Index < Header.NumStrings ? StringOffsets[Index + 1] - StringOffsets[Index] : 0;
+        if (Index < 0 || Index >= Header.NumStrings || NumBytes % CharSize != 0)
+        {
+            bValid = false;
+            return;
+        }
+        OutString.resize(NumBytes / CharSize);
+        std::memcpy(OutString.data(), StringData + StringOffsets[Index], NumBytes);
+    };
+    auto ReadString = [&ReadBytes](int32 Index, FString& OutString)
+    {
+        ReadBytes(Index, sizeof(TCHAR), OutString.GetContainerPrivate());
+    };
+    auto ReadWideString = [&ReadBytes](int32 Index, FWString& OutString)
+    {
+        ReadBytes(Index, sizeof(wchar_t), OutString);
+    };
+
+    // Vertex와 Index는 매핑된 메모리에서 한 번에 복사
+    OutStaticMesh.Vertices.SetNum(Header.NumVertices);
+    if (Header.NumVertices > 0)
+    {
+        std::memcpy(OutStaticMesh.Vertices.GetData(), Data + Header.VerticesOffset, Header.NumVertices * sizeof(FStaticMeshVertex));
+    }
+
+    OutStaticMesh.Indices.SetNum(Header.NumIndices);
+    if (bCompressedIndices)
+    {
+        if (!DecompressIndices(Data + Header.IndicesOffset, Header.IndicesSize, Header.NumIndices, OutStaticMesh.Indices.GetData()))
+        {
+            return false;
+        }
+    }
+    else if (b16BitIndices)
+    {
+        const uint8* ShortIndices = Data + Header.IndicesOffset;
+        for (int32 Index = 0; Index < Header.NumIndices; ++Index)
+        {
+            uint16 ShortIndex;
+            std::memcpy(&ShortIndex, ShortIndices + Index * sizeof(uint16), sizeof(uint16));
+            OutStaticMesh.Indices[Index] = ShortIndex;
+        }
+    }
+    else if (Header.NumIndices > 0)
+    {
+        std::memcpy(OutStaticMesh.Indices.GetData(), Data + Header.IndicesOffset, Header.IndicesSize);
+    }
+
+    // 렌더러가 범위 밖을 읽지 않도록 Index를 모두 확인
+    for (const UINT Index : OutStaticMesh.Indices)
+    {
+        if (Index >= static_cast<UINT>(Header.NumVertices))
+        {
+            return false;
+        }
+    }
+
+    ReadWideString(Header.ObjectName, OutStaticMesh.ObjectName);
+    ReadString(Header.DisplayName, OutStaticMesh.DisplayName);
+    OutStaticMesh.BoundingBoxMin = FVector(Header.BoundingBoxMin[0], Header.BoundingBoxMin[1], Header.BoundingBoxMin[2]);
+    OutStaticMesh.BoundingBoxMax = FVector(Header.BoundingBoxMax[0], Header.BoundingBoxMax[1], Header.BoundingBoxMax[2]);
+
+    const FCookedMaterialRecord* MaterialRecords = reinterpret_cast<const FCookedMaterialRecord*>(Data + Header.MaterialsOffset);
+    OutStaticMesh.Materials.SetNum(Header.NumMaterials);
+    for (int32 MaterialIndex = 0; MaterialIndex < Header.NumMaterials; ++MaterialIndex)
+    {
+        const FCookedMaterialRecord& Record = MaterialRecords[MaterialIndex];
+        FObjMaterialInfo& Material = OutStaticMesh.Materials[MaterialIndex];
+
+        ReadString(Record.MaterialName, Material.MaterialName);
+        Material.TextureFlag = Record.TextureFlag;
+        Material.bTransparent = Record.bTransparent != 0;
+        Material.IlluminanceModel = Record.IlluminanceModel;
+        Material.DiffuseColor = FVector(Record.DiffuseColor[0], Record.DiffuseColor[1], Record.DiffuseColor[2]);
+        Material.SpecularColor = FVector(Record.SpecularColor[0], Record.SpecularColor[1], Record.SpecularColor[2]);
+        Material.AmbientColor = FVector(Record.AmbientColor[0], Record.AmbientColor[1], Record.AmbientColor[2]);
+        Material.EmissiveColor = FVector(Record.EmissiveColor[0], Record.EmissiveColor[1], Record.EmissiveColor[2]);
+        Material.SpecularExponent = Record.SpecularExponent;
+        Material.IOR = Record.IOR;
+        Material.Transparency = Record.Transparency;
+        Material.BumpMultiplier = Record.BumpMultiplier;
+        Material.Metallic = Record.Metallic;
+        Material.Roughness = Record.Roughness;
+
+        Material.TextureInfos.SetNum(NumTextureSlots);
+        for (int32 SlotIdx = 0; SlotIdx < NumTextureSlots; ++SlotIdx)
+        {
+            const FCookedTextureRecord& TextureRecord = Record.Textures[SlotIdx];
+            FTextureInfo& TextureInfo = Material.TextureInfos[SlotIdx];
+            ReadString(TextureRecord.TextureName, TextureInfo.TextureName);
+            ReadWideString(TextureRecord.TexturePath, TextureInfo.TexturePath);
+            TextureInfo.bIsSRGB = TextureRecord.bIsSRGB != 0;
+        }
+    }
+
+    const FCookedSubsetRecord* SubsetRecords = reinterpret_cast<const FCookedSubsetRecord*>(Data + Header.SubsetsOffset);
+    OutStaticMesh.MaterialSubsets.SetNum(Header.NumSubsets);
+    for (int32 SubsetIndex = 0; SubsetIndex < Header.NumSubsets; ++SubsetIndex)
+    {
+        const FCookedSubsetRecord& Record = SubsetRecords[SubsetIndex];
+        if (Record.IndexStart > static_cast<uint32>(Header.NumIndices) || Record.IndexCount > static_cast<uint32>(Header.NumIndices) - Record.IndexStart)
+        {
+            return false;
+        }
+
+        FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[SubsetIndex];
+        ReadString(Record.MaterialName, Subset.MaterialName);
+        Subset.IndexStart = Record.IndexStart;
+        Subset.IndexCount = Record.IndexCount;
+        Subset.MaterialIndex = Record.MaterialIndex;
+    }
+
+    if (OutSources)
+    {
+        const FCookedSourceRecord* SourceRecords = reinterpret_cast<const FCookedSourceRecord*>(Data + Header.SourcesOffset);
+        OutSources->SetNum(Header.NumSources);
+        for (int32 SourceIndex = 0; SourceIndex < Header.NumSources; ++SourceIndex)
+        {
+            const FCookedSourceRecord& Record = SourceRecords[SourceIndex];
+            FCookedMeshSource& Source = (*OutSources)[SourceIndex];
+            ReadWideString(Record.FilePath, Source.FilePath);
+            Source.Size = Record.Size;
+            Source.WriteTime = Record.WriteTime;
+            Source.ContentHash = Record.ContentHash;
+        }
+    }
+
+    return bValid;
+}
+
+bool FStaticMeshCookedFile::Save(const FWString& FilePath, const FStaticMeshRenderData& StaticMesh, const TArray<FCookedMeshSource>& Sources, bool bCompressIndices)
+{
+    TArray<uint8> Data;
+    Serialize(StaticMesh, Sources, bCompressIndices, Data);
+    return WriteFileReplacing(FilePath, Data);
+}
+
+bool FStaticMeshCookedFile::Load(const FWString& FilePath, FStaticMeshRenderData& OutStaticMesh)
+{
+    FMappedFile MappedFile;
+    if (!MappedFile.Open(FilePath))
+    {
+        return false;
+    }
+
+    TArray<FCookedMeshSource> Sources;
+    if (!Deserialize(MappedFile.GetData(), MappedFile.GetSize(), OutStaticMesh, &Sources))
+    {
+        // 이전 형식의 캐시도 여기서 걸러지고 다시 Cook됨
+        UE_LOG(ELogLevel::Display, "Cooked static mesh is outdated or corrupted, recooking: %s", std::filesystem::path(FilePath).string().c_str());
+        return false;
+    }
+
+    bool bWriteTimeChanged = false;
+    for (FCookedMeshSource& Source : Sources)
+    {
+        const int64 CookedWriteTime = Source.WriteTime;
+        if (!IsSourceUpToDate(Source))
+        {
+            UE_LOG(ELogLevel::Display, "Source changed, recooking: %s", std::filesystem::path(Source.FilePath).string().c_str());
+            return false;
+        }
+        bWriteTimeChanged |= Source.WriteTime != CookedWriteTime;
+    }
+
+    // 수정 시간만 바뀐 원본이 있으면 캐시의 기록을 고쳐서, 다음 Load에서는 크기와 수정 시간만으로 통과하도록 함
+    if (bWriteTimeChanged)
+    {
+        TArray<uint8> Data;
+        Data.SetNum(static_cast<int32>(MappedFile.GetSize()));
+        std::memcpy(Data.GetData(), MappedFile.GetData(), Data.Num());
+
+        // 매핑된 파일은 교체할 수 없으므로 먼저 닫음
+        MappedFile.Close();
+        WriteSourceWriteTimes(Data, Sources);
+        WriteFileReplacing(FilePath, Data);
+    }
+    return true;
+}
+
+int64 FStaticMeshCookedFile::GetHeaderSize()
+{
+    return sizeof(FCookedMeshHeader);
+}
+
+void FStaticMeshCookedFile::RewriteHeader(TArray<uint8>& InOutData, bool bUpdateFileSize)
+{
+    if (bUpdateFileSize)
+    {
+        reinterpret_cast<FCookedMeshHeader*>(InOutData.GetData())->FileSize = InOutData.Num();
+    }
+    WritePayloadHash(InOutData);
+}
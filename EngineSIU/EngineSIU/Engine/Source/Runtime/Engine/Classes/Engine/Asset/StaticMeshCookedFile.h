@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+struct FStaticMeshRenderData;
+
+/** Cook할 때 읽은 원본 파일 */
+struct FCookedMeshSource
+{
+    FWString FilePath;
+
+    /** 원본이 없었으면 -1 */
+    int64 Size = -1;
+    int64 WriteTime = 0;
+    uint64 ContentHash = 0;
+};
+
+/**
+ * Cook된 Static Mesh 캐시 파일(*.obj.bin)을 읽고 씁니다.
+ *
+ * [Header][Vertices][Indices][Materials][Subsets][Sources][String Offsets][String Data]
+ *
+ * - Header에는 Magic, 버전, 엔디언/레이아웃 표시, 원본 해시, Header 뒤 전체의 해시가 있음
+ * - 각 구역은 16 Byte로 정렬되어 있어 매핑한 파일에서 Vertex와 Index를 한 번에 복사함
+ * - Index는 선택적으로 이전 Index와의 차이를 가변 길이 정수로 압축함, 압축하지 않으면 정점이 65536개 미만일 때 16비트로 저장
+ * - 원본의 크기가 달라졌거나, 수정 시간과 내용 해시가 모두 달라졌으면 캐시를 버리고 다시 Cook함
+ */
+struct FStaticMeshCookedFile
+{
+    /** 포맷이나 Cook 결과(정점 병합 등)가 바뀌면 올려서 기존 캐시를 모두 무효화합니다. */
+    static constexpr uint32 Version = 2;
+
+    /**
+     * 원본 파일의 크기, 수정 시간, 내용 해시를 기록합니다.
+     * @return 파일이 있는지 여부, 없으면 Size가 -1
+     */
+    static bool MakeSource(const FWString& FilePath, FCookedMeshSource& OutSource);
+
+    /**
+     * Cook할 때와 원본이 같은지 여부, 원본 없이 캐시만 있는 경우도 같은 것으로 봅니다.
+     * 수정 시간만 바뀌고 내용 해시가 같으면 Source.WriteTime을 현재 수정 시간으로 갱신합니다.
+     */
+    static bool IsSourceUpToDate(FCookedMeshSource& Source);
+
+    /**
+     * 캐시 파일의 내용을 만듭니다.
+     * @param bCompressIndices Index를 차이값으로 압축할지 여부
+     */
+    static void Serialize(const FStaticMeshRenderData& StaticMesh, const TArray<FCookedMeshSource>& Sources, bool bCompressIndices, TArray<uint8>& OutData);
+
+    /**
+     * 캐시 파일의 내용을 검증하고 읽습니다. 손상된 데이터는 읽지 않고 실패합니다.
+     * @param OutSources [optional] 기록된 원본 파일
+     */
+    static bool Deserialize(const uint8* Data, int64 Size, FStaticMeshRenderData& OutStaticMesh, TArray<FCookedMeshSource>* OutSources = nullptr);
+
+    /** 임시 파일에 쓴 뒤 교체하므로 쓰는 도중에 실패해도 기존 캐시가 깨지지 않습니다. */
+    static bool Save(const FWString& FilePath, const FStaticMeshRenderData& StaticMesh, const TArray<FCookedMeshSource>& Sources, bool bCompressIndices = false);
+
+    /**
+     * 캐시 파일을 매핑해서 읽습니다.
+     * 원본의 수정 시간만 바뀐 경우 캐시 파일의 원본 기록을 갱신해서 다음 Load부터 해시를 다시 계산하지 않습니다.
+     * @return 파일이 없거나, 손상되었거나, 원본이 바뀌었으면 false
+     */
+    static bool Load(const FWString& FilePath, FStaticMeshRenderData& OutStaticMesh);
+
+    /** Header 크기 (Byte), 이보다 짧은 데이터는 읽지 않음 */
+    static int64 GetHeaderSize();
+
+    /**
+     * 캐시 내용을 직접 고친 뒤 Header의 해시(와 파일 크기)를 내용에 맞게 다시 기록합니다.
+     * 손상 검사에서 해시 검증을 넘어 구조 검증까지 가게 할 때 사용합니다. Data는 Header보다 커야 합니다.
+     */
+    static void RewriteHeader(TArray<uint8>& InOutData, bool bUpdateFileSize);
+};
@@ -0,0 +1,490 @@
+#include "StaticMeshOptimizer.h"
+
+#include <algorithm>
+
+#include "StaticMeshAsset.h"
+
+
+namespace
+{
+/** Subset 하나의 삼각형, 정점은 Subset 안에서 0부터 다시 매긴 번호 */
+struct FLocalTriangles
+{
+    TArray<uint32> Indices;
+    TArray<uint32> LocalToGlobal;
+};
+
+/**
+ * 정점 캐시를 Timestamp로 흉내냄
+ * 마지막으로 들어온 시점이 CacheSize번 이전보다 오래되었으면 이미 밀려난 것으로 봄
+ */
+struct FVertexCacheSimulator
+{
+    TArray<uint32> CacheTime;
+    uint32 Time = 0;
+    int32 CacheSize = 0;
+
+    FVertexCacheSimulator(uint32 NumVertices, int32 InCacheSize)
+        : CacheSize(InCacheSize)
+    {
+        CacheTime.Init(0, static_cast<int32>(NumVertices));
+        Flush();
+    }
+
+    void Flush()
+    {
+        Time += CacheSize + 1;
+    }
+
+    /** @return 캐시에 없어서 변환해야 하는지 여부 */
+    bool Access(uint32 Vertex)
+    {
+        if (Time - CacheTime[Vertex] > static_cast<uint32>(CacheSize))
+        {
+            CacheTime[Vertex] = Time++;
+            return true;
+        }
+        return false;
+    }
+};
+
+/**
+ * Tipsify (Sander et al. 2007)
+ * 마지막으로 들어온 정점 중 캐시에서 밀려나지 않을 정점으로 부채꼴을 이어가며 삼각형을 내보냄
+ * @param OutHardBoundaries 이어갈 정점이 없어 새로 시작한 위치, 캐시가 끊기는 곳
+ */
+void TipsifyTriangles(const FLocalTriangles& Triangles, int32 CacheSize, TArray<uint32>& OutTriangleOrder, TArray<int32>& OutHardBoundaries)
+{
+    const int32 NumTriangles = Triangles.Indices.Num() / 3;
+    const int32 NumVertices = Triangles.LocalToGlobal.Num();
+
+    // 정점마다 남은 삼각형 수와 인접 삼각형 목록
+    TArray<uint32> LiveCount;
+    LiveCount.Init(0, NumVertices);
+    for (const uint32 Vertex : Triangles.Indices)
+    {
+        ++LiveCount[Vertex];
+    }
+
+    TArray<uint32> AdjacencyOffsets;
+    AdjacencyOffsets.Init(0, NumVertices + 1);
+    for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+    {
+        AdjacencyOffsets[Vertex + 1] = AdjacencyOffsets[Vertex] + LiveCount[Vertex];
+    }
+
+    TArray<uint32> Adjacency;
+    Adjacency.SetNum(Triangles.Indices.Num());
+    {
+        TArray<uint32> Cursor = AdjacencyOffsets;
+        for (int32 Corner = 0; Corner < Triangles.Indices.Num(); ++Corner)
+        {
+            Adjacency[Cursor[Triangles.Indices[Corner]]++] = Corner / 3;
+        }
+    }
+
+    TArray<uint32> CacheTime;
+    CacheTime.Init(0, NumVertices);
+    TArray<uint8> bEmitted;
+    bEmitted.Init(0, NumTriangles);
+
+    TArray<uint32> DeadEnd;
+    TArray<uint32> Candidates;
+    uint32 Time = CacheSize + 1;
+    int32 ScanCursor = 0;
+
+    OutTriangleOrder.Empty();
+    OutTriangleOrder.Reserve(NumTriangles);
+    OutHardBoundaries.Empty();
+    OutHardBoundaries.Add(0);
+
+    int32 Fanning = NumVertices > 0 ? 0 : INDEX_NONE;
+    while (Fanning != INDEX_NONE)
+    {
+        Candidates.Empty();
+        for (uint32 AdjacencyIdx = AdjacencyOffsets[Fanning]; AdjacencyIdx < AdjacencyOffsets[Fanning + 1]; ++AdjacencyIdx)
+        {
+            const uint32 Triangle = Adjacency[AdjacencyIdx];
+            if (bEmitted[Triangle])
+            {
+                continue;
+            }
+
+            bEmitted[Triangle] = 1;
+            OutTriangleOrder.Add(Triangle);
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const uint32 Vertex = Triangles.Indices[Triangle * 3 + Corner];
+                DeadEnd.Add(Vertex);
+                Candidates.Add(Vertex);
+                --LiveCount[Vertex];
+                if (Time - CacheTime[Vertex] > static_cast<uint32>(CacheSize))
+                {
+                    CacheTime[Vertex] = Time++;
+                }
+            }
+        }
+
+        // 캐시에 남아 있을 정점 중 가장 오래된 것, 인접 삼각형을 다 내보내도 밀려나지 않아야 함
+        int32 Next = INDEX_NONE;
+        int64 BestPriority = -1;
+        for (const uint32 Vertex : Candidates)
+        {
+            if (LiveCount[Vertex] == 0)
+            {
+                continue;
+            }
+
+            int64 Priority = 0;
+            if (static_cast<int64>(Time - CacheTime[Vertex]) + 2 * static_cast<int64>(LiveCount[Vertex]) <= CacheSize)
+            {
+                Priority = Time - CacheTime[Vertex];
+            }
+            if (Priority > BestPriority)
+            {
+                BestPriority = Priority;
+                Next = static_cast<int32>(Vertex);
+            }
+        }
+
+        if (Next == INDEX_NONE)
+        {
+            // 최근에 쓴 정점부터, 없으면 아직 남은 아무 정점에서 다시 시작
+            while (DeadEnd.Num() > 0 && Next == INDEX_NONE)
+            {
+                const uint32 Vertex = DeadEnd.Pop();
+                if (LiveCount[Vertex] > 0)
+                {
+                    Next = static_cast<int32>(Vertex);
+                }
+            }
+            for (; ScanCursor < NumVertices && Next == INDEX_NONE; ++ScanCursor)
+            {
+                if (LiveCount[ScanCursor] > 0)
+                {
+                    Next = ScanCursor;
+                }
+            }
+
+            if (Next != INDEX_NONE && OutTriangleOrder.Num() > OutHardBoundaries[OutHardBoundaries.Num() - 1])
+            {
+                OutHardBoundaries.Add(OutTriangleOrder.Num());
+            }
+        }
+
+        Fanning = Next;
+    }
+}
+
+/**
+ * 캐시가 끊기는 묶음을 캐시 효율이 크게 나빠지지 않는 선에서 더 잘게 나누고,
+ * 메시 중심에서 바깥을 향하는 묶음이 먼저 그려지도록 정렬합니다. (Sander et al. 2007, meshoptimizer)
+ */
+void SortClustersForOverdraw(
+    const TArray<FStaticMeshVertex>& Vertices, const FLocalTriangles& Triangles,
+    const TArray<int32>& HardBoundaries, int32 CacheSize, float Threshold, TArray<uint32>& InOutTriangleOrder
+)
+{
+    const int32 NumTriangles = InOutTriangleOrder.Num();
+    auto GetLocalVertex = [&](int32 OrderIdx, int32 Corner)
+    {
+        return Triangles.Indices[InOutTriangleOrder[OrderIdx] * 3 + Corner];
+    };
+
+    // 1. Soft Boundary
+    TArray<int32> Boundaries;
+    FVertexCacheSimulator Cache(Triangles.LocalToGlobal.Num(), CacheSize);
+    for (int32 HardIdx = 0; HardIdx < HardBoundaries.Num(); ++HardIdx)
+    {
+        const int32 Start = HardBoundaries[HardIdx];
+        const int32 End = HardIdx + 1 < HardBoundaries.Num() ? HardBoundaries[HardIdx + 1] : NumTriangles;
+
+        Cache.Flush();
+        int32 ClusterMisses = 0;
+        for (int32 OrderIdx = Start; OrderIdx < End; ++OrderIdx)
+        {
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                ClusterMisses += Cache.Access(GetLocalVertex(OrderIdx, Corner));
+            }
+        }
+        const float ThresholdACMR = static_cast<float>(ClusterMisses) / static_cast<float>(std::max(End - Start, 1)) * Threshold;
+
+        Cache.Flush();
+        Boundaries.Add(Start);
+        int32 SoftStart = Start;
+        int32 Misses = 0;
+        for (int32 OrderIdx = Start; OrderIdx < End; ++OrderIdx)
+        {
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                Misses += Cache.Access(GetLocalVertex(OrderIdx, Corner));
+            }
+
+            if (OrderIdx + 1 < End && static_cast<float>(Misses) <= ThresholdACMR * static_cast<float>(OrderIdx + 1 - SoftStart))
+            {
+                Boundaries.Add(OrderIdx + 1);
+                SoftStart = OrderIdx + 1;
+                Misses = 0;
+                Cache.Flush();
+            }
+        }
+    }
+
+    const int32 NumClusters = Boundaries.Num();
+    if (NumClusters <= 1)
+    {
+        return;
+    }
+    Boundaries.Add(NumTriangles);
+
+    // 2. 묶음마다 면적 가중 중심과 법선
+    TArray<FVector> ClusterCentroids;
+    TArray<FVector> ClusterNormals;
+    ClusterCentroids.SetNum(NumClusters);
+    ClusterNormals.SetNum(NumClusters);
+
+    FVector MeshCentroid = FVector::ZeroVector;
+    float MeshArea = 0.f;
+    for (int32 ClusterIdx = 0; ClusterIdx < NumClusters; ++ClusterIdx)
+    {
+        FVector Centroid = FVector::ZeroVector;
+        FVector Normal = FVector::ZeroVector;
+        FVector VertexNormal = FVector::ZeroVector;
+        float Area = 0.f;
+        for (int32 OrderIdx = Boundaries[ClusterIdx]; OrderIdx < Boundaries[ClusterIdx + 1]; ++OrderIdx)
+        {
+            FVector Positions[3];
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const FStaticMeshVertex& Vertex = Vertices[Triangles.LocalToGlobal[GetLocalVertex(OrderIdx, Corner)]];
+                Positions[Corner] = FVector(Vertex.X, Vertex.Y, Vertex.Z);
+                VertexNormal += FVector(Vertex.NormalX, Vertex.NormalY, Vertex.NormalZ);
+            }
+
+            const FVector Cross = (Positions[1] - Positions[0]).Cross(Positions[2] - Positions[0]);
+            const float TriangleArea = Cross.Length() * 0.5f;
+            Centroid += (Positions[0] + Positions[1] + Positions[2]) * (TriangleArea / 3.f);
+            Normal += Cross;
+            Area += TriangleArea;
+        }
+
+        // 감기 방향 규약과 상관없이 바깥을 향하도록 정점 법선에 맞춤
+        if (Normal.Dot(VertexNormal) < 0.f)
+        {
+            Normal = Normal * -1.f;
+        }
+
+        MeshCentroid += Centroid;
+        MeshArea += Area;
+        ClusterCentroids[ClusterIdx] = Area > 0.f ? Centroid * (1.f / Area) : Centroid;
+        ClusterNormals[ClusterIdx] = Normal.GetSafeNormal();
+    }
+    if (MeshArea > 0.f)
+    {
+        MeshCentroid = MeshCentroid * (1.f / MeshArea);
+    }
+
+    // 3. 바깥을 향한 정도가 큰 묶음부터
+    TArray<float> SortKeys;
+    TArray<int32> ClusterOrder;
+    SortKeys.SetNum(NumClusters);
+    ClusterOrder.SetNum(NumClusters);
+    for (int32 ClusterIdx = 0; ClusterIdx < NumClusters; ++ClusterIdx)
+    {
+        SortKeys[ClusterIdx] = (ClusterCentroids[ClusterIdx] - MeshCentroid).Dot(ClusterNormals[ClusterIdx]);
+        ClusterOrder[ClusterIdx] = ClusterIdx;
+    }
+    std::stable_sort(ClusterOrder.begin(), ClusterOrder.end(), [&SortKeys](int32 A, int32 B)
+    {
+        return SortKeys[A] > SortKeys[B];
+    });
+
+    TArray<uint32> SortedOrder;
+    SortedOrder.Reserve(NumTriangles);
+    for (const int32 ClusterIdx : ClusterOrder)
+    {
+        for (int32 OrderIdx = Boundaries[ClusterIdx]; OrderIdx < Boundaries[ClusterIdx + 1]; ++OrderIdx)
+        {
+            SortedOrder.Add(InOutTriangleOrder[OrderIdx]);
+        }
+    }
+    InOutTriangleOrder = std::move(SortedOrder);
+}
+
+/** [IndexStart, IndexStart + IndexCount) 구간의 삼각형 순서만 바꿈 */
+void OptimizeTriangleRange(TArray<FStaticMeshVertex>& Vertices, TArray<UINT>& Indices, uint32 IndexStart, uint32 IndexCount, TArray<uint32>& GlobalToLocal)
+{
+    if (IndexCount < 6)
+    {
+        return;
+    }
+
+    FLocalTriangles Triangles;
+    Triangles.Indices.SetNum(static_cast<int32>(IndexCount));
+    for (uint32 Corner = 0; Corner < IndexCount; ++Corner)
+    {
+        const UINT GlobalVertex = Indices[IndexStart + Corner];
+        if (GlobalToLocal[GlobalVertex] == ~0u)
+        {
+            GlobalToLocal[GlobalVertex] = Triangles.LocalToGlobal.Add(GlobalVertex);
+        }
+        Triangles.Indices[Corner] = GlobalToLocal[GlobalVertex];
+    }
+
+    TArray<uint32> TriangleOrder;
+    TArray<int32> HardBoundaries;
+    TipsifyTriangles(Triangles, FStaticMeshOptimizer::VertexCacheSize, TriangleOrder, HardBoundaries);
+    SortClustersForOverdraw(Vertices, Triangles, HardBoundaries, FStaticMeshOptimizer::VertexCacheSize, FStaticMeshOptimizer::OverdrawThreshold, TriangleOrder);
+
+    // 이미 캐시 순서로 저장된 메시는 묶음 정렬로 오히려 나빠질 수 있으므로 원래 순서와 비교
+    FVertexCacheSimulator Cache(Triangles.LocalToGlobal.Num(), FStaticMeshOptimizer::VertexCacheSize);
+    int32 OriginalMisses = 0;
+    for (const uint32 Vertex : Triangles.Indices)
+    {
+        OriginalMisses += Cache.Access(Vertex);
+    }
+    Cache.Flush();
+    int32 OptimizedMisses = 0;
+    for (const uint32 Triangle : TriangleOrder)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            OptimizedMisses += Cache.Access(Triangles.Indices[Triangle * 3 + Corner]);
+        }
+    }
+
+    for (int32 OrderIdx = 0; OptimizedMisses <= OriginalMisses && OrderIdx < TriangleOrder.Num(); ++OrderIdx)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            Indices[IndexStart + OrderIdx * 3 + Corner] = Triangles.LocalToGlobal[Triangles.Indices[TriangleOrder[OrderIdx] * 3 + Corner]];
+        }
+    }
+
+    // 다음 Subset을 위해 사용한 항목만 되돌림
+    for (const uint32 GlobalVertex : Triangles.LocalToGlobal)
+    {
+        GlobalToLocal[GlobalVertex] = ~0u;
+    }
+}
+
+/** 정점을 Index에서 처음 쓰이는 순서로 옮김, 쓰이지 않는 정점은 뒤로 */
+void OptimizeVertexFetch(TArray<FStaticMeshVertex>& Vertices, TArray<UINT>& Indices)
+{
+    TArray<uint32> Remap;
+    Remap.Init(~0u, Vertices.Num());
+
+    TArray<FStaticMeshVertex> SortedVertices;
+    SortedVertices.Reserve(Vertices.Num());
+    for (UINT& Index : Indices)
+    {
+        if (Remap[Index] == ~0u)
+        {
+            Remap[Index] = SortedVertices.Add(Vertices[Index]);
+        }
+        Index = Remap[Index];
+    }
+
+    for (int32 Vertex = 0; Vertex < Vertices.Num(); ++Vertex)
+    {
+        if (Remap[Vertex] == ~0u)
+        {
+            SortedVertices.Add(Vertices[Vertex]);
+        }
+    }
+    Vertices = std::move(SortedVertices);
+}
+}
+
+
+bool FStaticMeshOptimizer::Optimize(FStaticMeshRenderData& StaticMesh, FVertexCacheStatistics* OutBefore, FVertexCacheStatistics* OutAfter)
+{
+    TArray<UINT>& Indices = StaticMesh.Indices;
+    const uint32 NumVertices = static_cast<uint32>(StaticMesh.Vertices.Num());
+    if (Indices.Num() == 0 || Indices.Num() % 3 != 0)
+    {
+        return false;
+    }
+    for (const UINT Index : Indices)
+    {
+        if (Index >= NumVertices)
+        {
+            return false;
+        }
+    }
+
+    if (OutBefore)
+    {
+        *OutBefore = AnalyzeVertexCache(Indices, NumVertices);
+    }
+
+    // Subset 범위가 삼각형 단위로 겹치지 않을 때만 범위 안의 삼각형을 재배치
+    TArray<FMaterialSubset> Ranges = StaticMesh.MaterialSubsets;
+    if (Ranges.Num() == 0)
+    {
+        FMaterialSubset WholeMesh = {};
+        WholeMesh.IndexCount = Indices.Num();
+        Ranges.Add(WholeMesh);
+    }
+    Ranges.Sort([](const FMaterialSubset& A, const FMaterialSubset& B)
+    {
+        return A.IndexStart < B.IndexStart;
+    });
+
+    bool bValidRanges = true;
+    uint64 PreviousEnd = 0;
+    for (const FMaterialSubset& Range : Ranges)
+    {
+        const uint64 End = static_cast<uint64>(Range.IndexStart) + Range.IndexCount;
+        bValidRanges &= Range.IndexStart % 3 == 0 && Range.IndexCount % 3 == 0 && Range.IndexStart >= PreviousEnd && End <= static_cast<uint64>(Indices.Num());
+        PreviousEnd = End;
+    }
+
+    if (bValidRanges)
+    {
+        TArray<uint32> GlobalToLocal;
+        GlobalToLocal.Init(~0u, static_cast<int32>(NumVertices));
+        for (const FMaterialSubset& Range : Ranges)
+        {
+            OptimizeTriangleRange(StaticMesh.Vertices, Indices, Range.IndexStart, Range.IndexCount, GlobalToLocal);
+        }
+    }
+
+    OptimizeVertexFetch(StaticMesh.Vertices, Indices);
+
+    if (OutAfter)
+    {
+        *OutAfter = AnalyzeVertexCache(Indices, NumVertices);
+    }
+    return true;
+}
+
+FVertexCacheStatistics FStaticMeshOptimizer::AnalyzeVertexCache(const TArray<uint32>& Indices, uint32 NumVertices, int32 CacheSize)
+{
+    FVertexCacheStatistics Statistics;
+    if (Indices.Num() < 3)
+    {
+        return Statistics;
+    }
+
+    FVertexCacheSimulator Cache(NumVertices, CacheSize);
+    TArray<uint8> bReferenced;
+    bReferenced.Init(0, static_cast<int32>(NumVertices));
+
+    int32 NumTransformed = 0;
+    int32 NumReferenced = 0;
+    for (const UINT Index : Indices)
+    {
+        NumTransformed += Cache.Access(Index);
+        if (!bReferenced[Index])
+        {
+            bReferenced[Index] = 1;
+            ++NumReferenced;
+        }
+    }
+
+    Statistics.ACMR = static_cast<float>(NumTransformed) / static_cast<float>(Indices.Num() / 3);
+    Statistics.ATVR = static_cast<float>(NumTransformed) / static_cast<float>(std::max(NumReferenced, 1));
+    return Statistics;
+}
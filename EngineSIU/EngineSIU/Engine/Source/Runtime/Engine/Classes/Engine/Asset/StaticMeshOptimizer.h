@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct FStaticMeshRenderData;
+
+/** FIFO 정점 캐시 시뮬레이터로 측정한 Index 버퍼의 캐시 효율 */
+struct FVertexCacheStatistics
+{
+    /** 삼각형 하나당 변환된 정점 수 (Average Cache Miss Ratio), 0.5 ~ 3 */
+    float ACMR = 0.f;
+
+    /** 참조된 정점 하나당 변환 횟수 (Average Transformed Vertex Ratio), 이상적인 값은 1 */
+    float ATVR = 0.f;
+};
+
+/**
+ * Import한 Static Mesh의 Index와 정점 순서를 GPU에 맞게 재배치합니다.
+ *
+ * 1. Tipsify로 Subset마다 삼각형을 정점 캐시 순서로 정렬
+ * 2. 캐시 효율을 크게 잃지 않는 지점에서 삼각형을 묶음으로 나누고, 바깥을 향한 묶음이 먼저 그려지도록 정렬 (Overdraw)
+ * 3. 정점을 Index에서 처음 쓰이는 순서로 재배치 (Vertex Fetch)
+ *
+ * Subset의 범위와 그려지는 삼각형(감기 방향 포함)은 바뀌지 않습니다.
+ */
+struct FStaticMeshOptimizer
+{
+    /** 최적화와 분석에 사용하는 FIFO 캐시 크기 */
+    static constexpr int32 VertexCacheSize = 16;
+
+    /** 묶음의 ACMR이 전체보다 이 비율 이하로만 나빠지면 묶음을 나눔 */
+    static constexpr float OverdrawThreshold = 1.05f;
+
+    /**
+     * @param OutBefore [optional] 최적화 전 캐시 효율
+     * @param OutAfter [optional] 최적화 후 캐시 효율
+     * @return 최적화했는지 여부, 삼각형 목록이 아니면 아무것도 바꾸지 않음
+     */
+    static bool Optimize(FStaticMeshRenderData& StaticMesh, FVertexCacheStatistics* OutBefore = nullptr, FVertexCacheStatistics* OutAfter = nullptr);
+
+    /** FIFO 캐시로 Index 버퍼를 그릴 때의 캐시 효율을 계산합니다. */
+    static FVertexCacheStatistics AnalyzeVertexCache(const TArray<uint32>& Indices, uint32 NumVertices, int32 CacheSize = VertexCacheSize);
+};
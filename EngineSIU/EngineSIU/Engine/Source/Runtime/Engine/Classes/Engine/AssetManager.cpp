@@ -1,8 +1,109 @@
 #include "AssetManager.h"
 #include "Engine.h"
 
+#include <algorithm>
 #include <filesystem>
+#include <mutex>
+#include <thread>
+#include "Async/JobSystem.h"
+#include "Components/Mesh/StaticMeshComponent.h"
 #include "Engine/FObjLoader.h"
+#include "UObject/UObjectIterator.h"
+
+
+struct FStaticMeshLoadRequest
+{
+    FString PathName;
+
+    /** 대기열 항목의 우선순위와 다르면 그 항목은 예전 것 */
+    EAssetLoadPriority Priority = EAssetLoadPriority::Normal;
+
+    /** 워커가 가져갔는지 여부, FStaticMeshLoadQueue::Mutex로 보호 */
+    bool bStarted = false;
+
+    /** 워커가 채우는 결과, 실패하면 nullptr */
+    FStaticMeshRenderData* CookedData = nullptr;
+
+    /** 메인 스레드에서만 접근 */
+    TArray<FOnStaticMeshLoaded> Callbacks;
+};
+
+struct FStaticMeshLoadQueue
+{
+    struct FEntry
+    {
+        EAssetLoadPriority Priority;
+
+        /** 같은 우선순위는 먼저 요청한 것부터 */
+        uint64 Sequence;
+
+        std::shared_ptr<FStaticMeshLoadRequest> Request;
+
+        bool operator<(const FEntry& Other) const
+        {
+            return Priority != Other.Priority ? Priority < Other.Priority : Sequence > Other.Sequence;
+        }
+    };
+
+    std::mutex Mutex;
+
+    /** 우선순위 힙, 우선순위를 올리면 항목을 새로 넣고 예전 항목은 꺼낼 때 버림 */
+    TArray<FEntry> Heap;
+    uint64 NextSequence = 0;
+
+    /** 워커가 끝낸 요청, ProcessAsyncLoads에서 비움 */
+    TArray<std::shared_ptr<FStaticMeshLoadRequest>> Completed;
+
+    /** 메인 스레드에서만 접근, 반영되지 않은 요청 */
+    TMap<FString, std::shared_ptr<FStaticMeshLoadRequest>> Pending;
+
+    /** Mutex를 잡은 상태에서 호출 */
+    void Push(const std::shared_ptr<FStaticMeshLoadRequest>& Request)
+    {
+        Heap.Add({ Request->Priority, NextSequence++, Request });
+        std::push_heap(Heap.begin(), Heap.end());
+    }
+
+    /**
+     * 워커 작업 하나가 실행하는 함수, 실행 시점에 가장 우선순위가 높은 요청을 가져갑니다.
+     * 요청마다 작업을 하나씩 등록하므로 작업 수와 요청 수가 같습니다.
+     */
+    static void ExecuteNext(const std::shared_ptr<FStaticMeshLoadQueue>& Queue)
+    {
+        std::shared_ptr<FStaticMeshLoadRequest> Request;
+        {
+            std::lock_guard Lock(Queue->Mutex);
+            while (!Queue->Heap.IsEmpty())
+            {
+                std::pop_heap(Queue->Heap.begin(), Queue->Heap.end());
+                FEntry Entry = Queue->Heap.Pop();
+                if (!Entry.Request->bStarted && Entry.Priority == Entry.Request->Priority)
+                {
+                    Request = std::move(Entry.Request);
+                    Request->bStarted = true;
+                    break;
+                }
+            }
+        }
+
+        // 취소되었거나 다른 작업이 먼저 가져감
+        if (!Request)
+        {
+            return;
+        }
+
+        FStaticMeshRenderData* CookedData = new FStaticMeshRenderData();
+        if (!FObjManager::CookStaticMeshAsset(Request->PathName, *CookedData))
+        {
+            delete CookedData;
+            CookedData = nullptr;
+        }
+
+        std::lock_guard Lock(Queue->Mutex);
+        Request->CookedData = CookedData;
+        Queue->Completed.Add(std::move(Request));
+    }
+};
 
 bool UAssetManager::IsInitialized()
 {
@@ -31,8 +132,9 @@ UAssetManager* UAssetManager::GetIfInitialized()
 void UAssetManager::InitAssetManager()
 {
     AssetRegistry = std::make_unique<FAssetRegistry>();
+    StaticMeshLoadQueue = std::make_shared<FStaticMeshLoadQueue>();
 
-    LoadObjFiles();
+    LoadObjFiles("Contents/");
 }
 
 const TMap<FName, FAssetInfo>& UAssetManager::GetAssetRegistry()
@@ -40,13 +142,180 @@ const TMap<FName, FAssetInfo>& UAssetManager::GetAssetRegistry()
     return AssetRegistry->PathNameToAssetInfo;
 }
 
-void UAssetManager::LoadObjFiles()
+UStaticMesh* UAssetManager::RequestStaticMeshLoad(const FString& PathName, EAssetLoadPriority Priority, const FOnStaticMeshLoaded& OnLoaded)
 {
-    const std::string BasePathName = "Contents/";
+    // 1. 이미 대기 중이면 우선순위만 올림
+    if (const std::shared_ptr<FStaticMeshLoadRequest>* Found = StaticMeshLoadQueue->Pending.Find(PathName))
+    {
+        const std::shared_ptr<FStaticMeshLoadRequest>& Request = *Found;
+        if (OnLoaded.IsBound())
+        {
+            Request->Callbacks.Add(OnLoaded);
+        }
+
+        std::lock_guard Lock(StaticMeshLoadQueue->Mutex);
+        if (Priority > Request->Priority && !Request->bStarted)
+        {
+            Request->Priority = Priority;
+            StaticMeshLoadQueue->Push(Request);
+        }
+        return FObjManager::CreatePlaceholderStaticMesh(PathName);
+    }
+
+    // 2. 이미 로드됨
+    const TMap<FWString, UStaticMesh*>& StaticMeshes = FObjManager::GetStaticMeshes();
+    if (UStaticMesh* const* Found = StaticMeshes.Find(PathName.ToWideString()))
+    {
+        if (*Found && !(*Found)->IsPlaceholder())
+        {
+            OnLoaded.ExecuteIfBound(*Found);
+            return *Found;
+        }
+    }
+
+    // 3. Placeholder를 등록하고 워커에 맡김
+    UStaticMesh* Placeholder = FObjManager::CreatePlaceholderStaticMesh(PathName);
+
+    std::shared_ptr<FStaticMeshLoadRequest> Request = std::make_shared<FStaticMeshLoadRequest>();
+    Request->PathName = PathName;
+    Request->Priority = Priority;
+    if (OnLoaded.IsBound())
+    {
+        Request->Callbacks.Add(OnLoaded);
+    }
+    StaticMeshLoadQueue->Pending.Add(PathName, Request);
+
+    {
+        std::lock_guard Lock(StaticMeshLoadQueue->Mutex);
+        StaticMeshLoadQueue->Push(Request);
+    }
+
+    FJobSystem::SubmitBackground([Queue = StaticMeshLoadQueue]
+    {
+        FStaticMeshLoadQueue::ExecuteNext(Queue);
+    });
+
+    return Placeholder;
+}
 
-    // Obj 파일 로드
-    
-    for (const auto& Entry : std::filesystem::recursive_directory_iterator(BasePathName))
+void UAssetManager::ProcessAsyncLoads()
+{
+    TArray<std::shared_ptr<FStaticMeshLoadRequest>> Completed;
+    {
+        std::lock_guard Lock(StaticMeshLoadQueue->Mutex);
+        Completed = std::move(StaticMeshLoadQueue->Completed);
+        StaticMeshLoadQueue->Completed.Empty();
+    }
+
+    if (Completed.IsEmpty())
+    {
+        return;
+    }
+
+    // 1. Placeholder를 실제 데이터로 교체
+    const TMap<FWString, UStaticMesh*>& StaticMeshes = FObjManager::GetStaticMeshes();
+    TArray<UStaticMesh*> LoadedMeshes;
+    TSet<UStaticMesh*> ChangedMeshes;
+    TSet<UStaticMesh*> FailedMeshes;
+    LoadedMeshes.Reserve(Completed.Num());
+
+    for (const std::shared_ptr<FStaticMeshLoadRequest>& Request : Completed)
+    {
+        StaticMeshLoadQueue->Pending.Remove(Request->PathName);
+
+        UStaticMesh* const* Found = StaticMeshes.Find(Request->PathName.ToWideString());
+        UStaticMesh* Placeholder = Found ? *Found : nullptr;
+
+        UStaticMesh* LoadedMesh = FObjManager::FinishStaticMeshLoad(Request->PathName, Request->CookedData);
+        Request->CookedData = nullptr;
+
+        if (LoadedMesh)
+        {
+            ChangedMeshes.Add(LoadedMesh);
+        }
+        else
+        {
+            UE_LOG(ELogLevel::Warning, TEXT("Failed to load StaticMesh '%s'"), *Request->PathName);
+            if (Placeholder)
+            {
+                FailedMeshes.Add(Placeholder);
+            }
+        }
+        LoadedMeshes.Add(LoadedMesh);
+    }
+
+    // 2. Placeholder 기준으로 잡힌 Bounding Box와 Material 슬롯 수를 갱신, 이번 프레임에 끝난 Mesh를 모아 한 번만 순회
+    for (UStaticMeshComponent* Component : TObjectRange<UStaticMeshComponent>())
+    {
+        UStaticMesh* StaticMesh = Component->GetStaticMesh();
+        if (StaticMesh == nullptr)
+        {
+            continue;
+        }
+
+        if (ChangedMeshes.Contains(StaticMesh))
+        {
+            Component->SetStaticMesh(StaticMesh);
+        }
+        else if (FailedMeshes.Contains(StaticMesh))
+        {
+            Component->SetStaticMesh(nullptr);
+        }
+    }
+
+    // 3. 콜백은 모든 Component가 갱신된 뒤에 호출
+    for (int32 Index = 0; Index < Completed.Num(); ++Index)
+    {
+        for (const FOnStaticMeshLoaded& Callback : Completed[Index]->Callbacks)
+        {
+            Callback.ExecuteIfBound(LoadedMeshes[Index]);
+        }
+    }
+}
+
+void UAssetManager::FlushAsyncLoads()
+{
+    while (GetNumPendingLoads() > 0)
+    {
+        ProcessAsyncLoads();
+        if (GetNumPendingLoads() > 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void UAssetManager::CancelAsyncLoads()
+{
+    {
+        std::lock_guard Lock(StaticMeshLoadQueue->Mutex);
+        StaticMeshLoadQueue->Heap.Empty();
+
+        TArray<FString> NotStarted;
+        for (const auto& [PathName, Request] : StaticMeshLoadQueue->Pending)
+        {
+            if (!Request->bStarted)
+            {
+                NotStarted.Add(PathName);
+            }
+        }
+        for (const FString& PathName : NotStarted)
+        {
+            StaticMeshLoadQueue->Pending.Remove(PathName);
+        }
+    }
+
+    FlushAsyncLoads();
+}
+
+int32 UAssetManager::GetNumPendingLoads() const
+{
+    return StaticMeshLoadQueue ? StaticMeshLoadQueue->Pending.Num() : 0;
+}
+
+void UAssetManager::LoadObjFiles(const std::filesystem::path& Directory)
+{
+    for (const auto& Entry : std::filesystem::recursive_directory_iterator(Directory))
     {
         if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
         {
@@ -58,10 +327,9 @@ void UAssetManager::LoadObjFiles()
             
             AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
             
+            // 파싱과 변환은 워커에서, 끝나기 전까지는 Placeholder가 등록됨
             FString MeshName = NewAssetInfo.PackagePath.ToString() + "/" + NewAssetInfo.AssetName.ToString();
-            FObjManager::CreateStaticMesh(MeshName);
-            // ObjFileNames.push_back(UGTLStringLibrary::StringToWString(Entry.path().string()));
-            // FObjManager::LoadObjStaticMeshAsset(UGTLStringLibrary::StringToWString(Entry.path().string()));
+            RequestStaticMeshLoad(MeshName);
         }
     }
 }
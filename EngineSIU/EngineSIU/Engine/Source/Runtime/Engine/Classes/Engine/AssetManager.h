@@ -1,6 +1,14 @@
 #pragma once
+#include <filesystem>
+
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
+#include "Delegates/DelegateCombination.h"
+
+class UStaticMesh;
+struct FStaticMeshLoadQueue;
+
+DECLARE_DELEGATE_OneParam(FOnStaticMeshLoaded, UStaticMesh* /* LoadedMesh, 실패하면 nullptr */);
 
 enum class EAssetType : uint8
 {
@@ -23,6 +31,14 @@ struct FAssetRegistry
     TMap<FName, FAssetInfo> PathNameToAssetInfo;
 };
 
+/** 비동기 로드 순서, 높은 것부터 로드 */
+enum class EAssetLoadPriority : uint8
+{
+    Low,
+    Normal,
+    High,   // 월드에서 바로 참조하는 에셋
+};
+
 class UAssetManager : public UObject
 {
     DECLARE_CLASS(UAssetManager, UObject)
@@ -30,6 +46,9 @@ class UAssetManager : public UObject
 private:
     std::unique_ptr<FAssetRegistry> AssetRegistry;
 
+    /** 워커 스레드와 공유하는 비동기 로드 상태, 작업이 끝날 때까지 살아있도록 shared_ptr로 넘김 */
+    std::shared_ptr<FStaticMeshLoadQueue> StaticMeshLoadQueue;
+
 public:
     UAssetManager() = default;
 
@@ -45,6 +64,28 @@ public:
 
     const TMap<FName, FAssetInfo>& GetAssetRegistry();
 
-private:
-    void LoadObjFiles();
+    /**
+     * Static Mesh를 워커 스레드에서 로드하도록 요청합니다.
+     * 로드가 끝날 때까지 Placeholder Mesh가 등록되어 있어 FObjManager에서 바로 가져다 쓸 수 있습니다.
+     * 이미 대기 중인 요청이면 우선순위만 올리고 콜백을 추가합니다.
+     * @param PathName .obj 파일 경로
+     * @param OnLoaded 로드가 끝나면 메인 스레드에서 호출, 이미 로드되어 있으면 바로 호출
+     * @return 등록된 Mesh, 로드 중이면 Placeholder
+     */
+    UStaticMesh* RequestStaticMeshLoad(const FString& PathName, EAssetLoadPriority Priority = EAssetLoadPriority::Normal, const FOnStaticMeshLoaded& OnLoaded = {});
+
+    /** 워커에서 끝난 로드를 Mesh에 반영하고 콜백을 호출합니다. 메인 스레드에서 매 프레임 호출합니다. */
+    void ProcessAsyncLoads();
+
+    /** 대기 중인 로드가 모두 끝날 때까지 기다립니다. */
+    void FlushAsyncLoads();
+
+    /** 시작하지 않은 로드를 취소하고 진행 중인 로드만 기다립니다. 취소된 Mesh는 Placeholder로 남습니다. */
+    void CancelAsyncLoads();
+
+    /** @return 요청되었지만 아직 반영되지 않은 로드 수 */
+    int32 GetNumPendingLoads() const;
+
+    /** Directory 아래의 .obj를 레지스트리에 등록하고 비동기 로드를 요청합니다. */
+    void LoadObjFiles(const std::filesystem::path& Directory);
 };
@@ -8,6 +8,7 @@
 #include "Classes/Engine/AssetManager.h"
 #include "Components/Light/DirectionalLightComponent.h"
 #include "UObject/UObjectIterator.h"
+#include "WindowsPlatformTime.h"
 
 namespace PrivateEditorSelection
 {
@@ -45,11 +46,21 @@ void UEditorEngine::Init()
 
 void UEditorEngine::Release()
 {
+    // 로드가 끝나지 않은 Mesh도 Placeholder가 경로를 갖고 있어 그대로 저장됨
+    if (AssetManager)
+    {
+        AssetManager->CancelAsyncLoads();
+    }
     SaveLevel("Saved/AutoSaves.scene");
 }
 
 void UEditorEngine::Tick(float DeltaTime)
 {
+    if (AssetManager)
+    {
+        AssetManager->ProcessAsyncLoads();
+    }
+
     for (FWorldContext* WorldContext : WorldList)
     {
         if (WorldContext->WorldType == EWorldType::Editor)
@@ -57,20 +68,9 @@ void UEditorEngine::Tick(float DeltaTime)
             if (UWorld* World = WorldContext->World())
             {
                 // TODO: World에서 EditorPlayer 제거 후 Tick 호출 제거 필요.
+                // World의 Actor들은 World::Tick에서 Tick 함수로 실행되고, World에 속하지 않는 EditorPlayer만 직접 Tick
                 World->Tick(DeltaTime);
                 EditorPlayer->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
             }
         }
         else if (WorldContext->WorldType == EWorldType::PIE)
@@ -78,18 +78,6 @@ void UEditorEngine::Tick(float DeltaTime)
             if (UWorld* World = WorldContext->World())
             {
                 World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor)
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
             }
         }
     }
@@ -110,8 +98,15 @@ void UEditorEngine::StartPIE()
 
     FWorldContext& PIEWorldContext = CreateNewWorldContext(EWorldType::PIE);
 
+    const uint64 DuplicateStartCycles = FPlatformTime::Cycles64();
     PIEWorld = Cast<UWorld>(EditorWorld->Duplicate(this));
     PIEWorld->WorldType = EWorldType::PIE;
+    UE_LOG(
+        ELogLevel::Display,
+        TEXT("PIE world duplicated: %d actors in %.2f ms"),
+        PIEWorld->GetActiveLevel()->Actors.Num(),
+        FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - DuplicateStartCycles)
+    );
 
     PIEWorldContext.SetCurrentWorld(PIEWorld);
     ActiveWorld = PIEWorld;
@@ -36,10 +36,20 @@ FWorldContext& UEngine::CreateNewWorldContext(EWorldType InWorldType)
 
 void UEngine::LoadLevel(const FString& FileName) const
 {
+    if (SceneManager::IsBinarySceneFile(*FileName))
+    {
+        SceneManager::LoadSceneFromBinaryFile(*FileName, *ActiveWorld);
+        return;
+    }
     SceneManager::LoadSceneFromJsonFile(*FileName, *ActiveWorld);
 }
 
 void UEngine::SaveLevel(const FString& FileName) const
 {
+    if (SceneManager::IsBinarySceneFile(*FileName))
+    {
+        SceneManager::SaveSceneToBinaryFile(*FileName, *ActiveWorld);
+        return;
+    }
     SceneManager::SaveSceneToJsonFile(*FileName, *ActiveWorld);
 }
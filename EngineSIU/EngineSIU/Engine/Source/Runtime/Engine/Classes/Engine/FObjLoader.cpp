@@ -5,18 +5,54 @@
 #include "Components/Mesh/StaticMeshRenderData.h"
 
 #include "Asset/StaticMeshAsset.h"
-
+#include "Asset/StaticMeshCookedFile.h"
+#include "Asset/StaticMeshOptimizer.h"
+#include "AssetManager.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 
-bool FObjLoader::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+#include "Async/JobSystem.h"
+#include "WindowsMappedFile.h"
+
+
+namespace
+{
+/** Face Corner의 v/vt/vn 인덱스, 없는 인덱스는 UINT32_MAX */
+struct FObjVertexKey
 {
-    std::ifstream OBJ(ObjFilePath.ToWideString());
-    if (!OBJ)
+    uint32 VertexIndex;
+    uint32 UVIndex;
+    uint32 NormalIndex;
+
+    bool operator==(const FObjVertexKey& Other) const
     {
-        return false;
+        return VertexIndex == Other.VertexIndex && UVIndex == Other.UVIndex && NormalIndex == Other.NormalIndex;
+    }
+};
+}
+
+template <>
+struct std::hash<FObjVertexKey>
+{
+    size_t operator()(const FObjVertexKey& Key) const noexcept
+    {
+        // 96비트를 섞은 뒤 상위 비트를 하위로 접어 Bucket Mask(하위 비트)에도 고르게 퍼지게 함
+        uint64 Hash = (static_cast<uint64>(Key.VertexIndex) << 32 | Key.UVIndex) * 0x9E3779B97F4A7C15ull;
+        Hash ^= (Hash >> 29) + Key.NormalIndex * 0xC2B2AE3D27D4EB4Full;
+        Hash *= 0xBF58476D1CE4E5B9ull;
+        return static_cast<size_t>(Hash ^ (Hash >> 32));
     }
+};
 
+namespace
+{
+void SetObjFileNames(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+{
     OutObjInfo.FilePath = ObjFilePath.ToWideString().substr(0, ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);
     OutObjInfo.ObjectName = ObjFilePath.ToWideString();
     // ObjectName은 wstring 타입이므로, 이를 string으로 변환 (간단한 ASCII 변환의 경우)
@@ -33,186 +69,362 @@ bool FObjLoader::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
     {
         OutObjInfo.DisplayName = fileName;
     }
+}
 
-    /**
-     * 블렌더 Export 설정
-     *   > General
-     *       Forward Axis:  Y
-     *       Up Axis:       Z
-     *   > Geometry
-     *       ✅ Triangulated Mesh
-     *   > Materials
-     *       ✅ PBR Extensions
-     *       Path Mode:     Strip
-     */
+/** 청크 결과에서 Face 인덱스가 가리키는 속성, FObjInfo의 Vertices, UVs, Normals 순서 */
+enum EObjIndexType : uint8
+{
+    OIT_Vertex,
+    OIT_UV,
+    OIT_Normal,
+    OIT_MAX,
+};
+
+/** ParseOBJ가 청크 하나에서 모은 결과, 인덱스와 Subset 시작 위치는 청크 안에서의 위치 */
+struct FObjChunkResult
+{
+    TArray<FVector> Vertices;
+    TArray<FVector2D> UVs;
+    TArray<FVector> Normals;
 
-    std::string Line;
+    TArray<uint32> Indices[OIT_MAX];
+
+    /** 음수(상대) 인덱스로 적혀 있어 앞 청크의 속성 개수를 더해야 하는 Indices의 위치 */
+    TArray<int32> RelativeIndices[OIT_MAX];
 
-    while (std::getline(OBJ, Line))
+    TArray<FMaterialSubset> MaterialSubsets;
+    TArray<FString> GroupNames;
+
+    FString MatName;
+    bool bHasMatName = false;
+};
+
+/** Face의 v/vt/vn 하나 */
+struct FObjFaceCorner
+{
+    uint32 Index[OIT_MAX] = { 0, UINT32_MAX, UINT32_MAX };
+    bool bRelative[OIT_MAX] = {};
+};
+
+/** std::istream의 >>와 같은 공백 문자 */
+bool IsObjSpace(char Char)
+{
+    return Char == ' ' || Char == '\t' || Char == '\r' || Char == '\v' || Char == '\f';
+}
+
+const char* SkipObjSpaces(const char* It, const char* End)
+{
+    while (It < End && IsObjSpace(*It))
     {
-        if (Line.empty() || Line[0] == '#')
-            continue;
+        ++It;
+    }
+    return It;
+}
 
-        std::istringstream LineStream(Line);
-        std::string Token;
-        LineStream >> Token;
+const char* FindObjSpace(const char* It, const char* End)
+{
+    while (It < End && !IsObjSpace(*It))
+    {
+        ++It;
+    }
+    return It;
+}
 
-        if (Token == "mtllib")
-        {
-            LineStream >> Line;
-            OutObjInfo.MatName = Line;
-            continue;
-        }
+/** 공백 다음의 단어를 읽습니다. 없으면 빈 문자열 */
+std::string_view ReadObjToken(const char*& It, const char* End)
+{
+    const char* TokenBegin = SkipObjSpaces(It, End);
+    It = FindObjSpace(TokenBegin, End);
+    return { TokenBegin, static_cast<size_t>(It - TokenBegin) };
+}
 
-        if (Token == "usemtl")
-        {
-            LineStream >> Line;
-            FString MatName(Line);
+/** 공백 다음의 실수를 읽습니다. 읽지 못하면 0 */
+float ReadObjFloat(const char*& It, const char* End)
+{
+    It = SkipObjSpaces(It, End);
+    if (It < End && *It == '+')
+    {
+        ++It; // from_chars는 '+' 부호를 받지 않음
+    }
 
-            if (!OutObjInfo.MaterialSubsets.IsEmpty())
+    float Value = 0.f;
+    const std::from_chars_result Result = std::from_chars(It, End, Value);
+    It = Result.ec == std::errc() ? Result.ptr : FindObjSpace(It, End);
+    return Value;
+}
+
+/** "v", "v/vt", "v//vn", "v/vt/vn" 형태의 Face 정점 하나를 읽습니다. */
+FObjFaceCorner ReadObjFaceCorner(std::string_view Token, const FObjChunkResult& Chunk)
+{
+    const int32 LocalCounts[OIT_MAX] = { Chunk.Vertices.Num(), Chunk.UVs.Num(), Chunk.Normals.Num() };
+
+    FObjFaceCorner Corner;
+    const char* Part = Token.data();
+    const char* TokenEnd = Token.data() + Token.size();
+    for (int32 Type = 0; Type < OIT_MAX; ++Type)
+    {
+        const char* PartEnd = std::find(Part, TokenEnd, '/');
+        if (PartEnd != Part)
+        {
+            const char* NumberBegin = *Part == '+' ? Part + 1 : Part;
+            int64 Value = 0;
+            std::from_chars(NumberBegin, PartEnd, Value);
+            if (Value < 0)
             {
-                FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
-                LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+                // -1은 이 줄 앞에서 마지막으로 정의된 속성, 청크 밖을 가리킬 수 있으므로 병합할 때 청크 시작 위치를 더함
+                Corner.Index[Type] = static_cast<uint32>(LocalCounts[Type] + Value);
+                Corner.bRelative[Type] = true;
+            }
+            else
+            {
+                Corner.Index[Type] = static_cast<uint32>(Value - 1);
             }
-
-            FMaterialSubset MaterialSubset;
-            MaterialSubset.MaterialName = MatName;
-            MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
-            MaterialSubset.IndexCount = 0;
-            OutObjInfo.MaterialSubsets.Add(MaterialSubset);
         }
 
-        if (Token == "g" || Token == "o")
+        if (PartEnd == TokenEnd)
         {
-            LineStream >> Line;
-            OutObjInfo.GroupName.Add(Line);
-            OutObjInfo.NumOfGroup++;
+            break;
         }
+        Part = PartEnd + 1;
+    }
+    return Corner;
+}
 
-        if (Token == "v") // Vertex
+void AddObjFaceCorner(const FObjFaceCorner& Corner, FObjChunkResult& OutChunk)
+{
+    for (int32 Type = 0; Type < OIT_MAX; ++Type)
+    {
+        if (Corner.bRelative[Type])
         {
-            float X, Y, Z;
-            LineStream >> X >> Y >> Z;
-            OutObjInfo.Vertices.Add(FVector(X, Y * -1.f, Z));
-            continue;
+            OutChunk.RelativeIndices[Type].Add(OutChunk.Indices[Type].Num());
         }
+        OutChunk.Indices[Type].Add(Corner.Index[Type]);
+    }
+}
 
-        if (Token == "vn") // Normal
+/** [Begin, End) 구간의 줄을 파싱합니다. 구간은 줄 단위로 나뉘어 있어야 합니다. */
+void ParseObjChunk(const char* Begin, const char* End, FObjChunkResult& OutChunk)
+{
+    const char* LineBegin = Begin;
+    while (LineBegin < End)
+    {
+        const char* LineEnd = static_cast<const char*>(std::memchr(LineBegin, '\n', End - LineBegin));
+        if (LineEnd == nullptr)
         {
-            float NormalX, NormalY, NormalZ;
-            LineStream >> NormalX >> NormalY >> NormalZ;
-            OutObjInfo.Normals.Add(FVector(NormalX, NormalY * -1.f, NormalZ));
-            continue;
+            LineEnd = End;
         }
+        const char* NextLine = LineEnd < End ? LineEnd + 1 : End;
 
-        if (Token == "vt") // Texture
+        if (LineBegin == LineEnd || *LineBegin == '#')
         {
-            float U, V;
-            LineStream >> U >> V;
-            OutObjInfo.UVs.Add(FVector2D(U, 1.f - V));
+            LineBegin = NextLine;
             continue;
         }
 
-        if (Token == "f")
+        const char* It = LineBegin;
+        const std::string_view Token = ReadObjToken(It, LineEnd);
+
+        if (Token == "v") // Vertex
+        {
+            const float X = ReadObjFloat(It, LineEnd);
+            const float Y = ReadObjFloat(It, LineEnd);
+            const float Z = ReadObjFloat(It, LineEnd);
+            OutChunk.Vertices.Add(FVector(X, Y * -1.f, Z));
+        }
+        else if (Token == "vn") // Normal
         {
-            TArray<uint32> FaceVertexIndices;  // 이번 페이스의 정점 인덱스
-            TArray<uint32> FaceNormalIndices;  // 이번 페이스의 법선 인덱스
-            TArray<uint32> FaceUVIndices; // 이번 페이스의 텍스처 인덱스
+            const float NormalX = ReadObjFloat(It, LineEnd);
+            const float NormalY = ReadObjFloat(It, LineEnd);
+            const float NormalZ = ReadObjFloat(It, LineEnd);
+            OutChunk.Normals.Add(FVector(NormalX, NormalY * -1.f, NormalZ));
+        }
+        else if (Token == "vt") // Texture
+        {
+            const float U = ReadObjFloat(It, LineEnd);
+            const float V = ReadObjFloat(It, LineEnd);
+            OutChunk.UVs.Add(FVector2D(U, 1.f - V));
+        }
+        else if (Token == "f")
+        {
+            FObjFaceCorner Corners[4];
+            int32 NumCorners = 0;
+            for (std::string_view CornerToken = ReadObjToken(It, LineEnd); !CornerToken.empty(); CornerToken = ReadObjToken(It, LineEnd))
+            {
+                if (NumCorners < 4)
+                {
+                    Corners[NumCorners] = ReadObjFaceCorner(CornerToken, OutChunk);
+                }
+                ++NumCorners;
+            }
 
-            while (LineStream >> Token)
+            // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1, 쿼드는 0-2-1, 0-3-2
+            if (NumCorners == 3 || NumCorners == 4)
+            {
+                AddObjFaceCorner(Corners[0], OutChunk);
+                AddObjFaceCorner(Corners[2], OutChunk);
+                AddObjFaceCorner(Corners[1], OutChunk);
+            }
+            if (NumCorners == 4)
             {
-                std::istringstream TokenStream(Token);
-                std::string Part;
-                TArray<std::string> FacePieces;
+                AddObjFaceCorner(Corners[0], OutChunk);
+                AddObjFaceCorner(Corners[3], OutChunk);
+                AddObjFaceCorner(Corners[2], OutChunk);
+            }
+        }
+        else if (Token == "usemtl")
+        {
+            FMaterialSubset MaterialSubset = {};
+            MaterialSubset.MaterialName = std::string(ReadObjToken(It, LineEnd));
+            MaterialSubset.IndexStart = OutChunk.Indices[OIT_Vertex].Num();
+            OutChunk.MaterialSubsets.Add(MaterialSubset);
+        }
+        else if (Token == "g" || Token == "o")
+        {
+            OutChunk.GroupNames.Add(std::string(ReadObjToken(It, LineEnd)));
+        }
+        else if (Token == "mtllib")
+        {
+            OutChunk.MatName = std::string(ReadObjToken(It, LineEnd));
+            OutChunk.bHasMatName = true;
+        }
 
-                uint32 vertexIndex = 0;
-                uint32 textureIndex = UINT32_MAX;
-                uint32 normalIndex = UINT32_MAX;
+        LineBegin = NextLine;
+    }
+}
 
-                // v
-                if (std::getline(TokenStream, Part, '/'))
-                {
-                    if (!Part.empty())
-                    {
-                        vertexIndex = std::stoi(Part) - 1;
-                    }
-                }
+/** 청크 결과를 순서대로 이어 붙입니다. 배열 복사는 청크마다 병렬로 합니다. */
+void MergeObjChunks(const TArray<FObjChunkResult>& Chunks, FObjInfo& OutObjInfo)
+{
+    struct FChunkOffset
+    {
+        int32 Attributes[OIT_MAX];
+        int32 Indices;
+    };
 
-                // vt
-                if (std::getline(TokenStream, Part, '/'))
-                {
-                    if (!Part.empty())
-                    {
-                        textureIndex = std::stoi(Part) - 1;
-                    }
-                }
+    TArray<FChunkOffset> Offsets;
+    Offsets.SetNum(Chunks.Num());
 
-                // vn
-                if (std::getline(TokenStream, Part, '/'))
-                {
-                    if (!Part.empty())
-                    {
-                        normalIndex = std::stoi(Part) - 1;
-                    }
-                }
+    FChunkOffset Total = {};
+    for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        const FObjChunkResult& Chunk = Chunks[ChunkIndex];
+        Offsets[ChunkIndex] = Total;
+        Total.Attributes[OIT_Vertex] += Chunk.Vertices.Num();
+        Total.Attributes[OIT_UV] += Chunk.UVs.Num();
+        Total.Attributes[OIT_Normal] += Chunk.Normals.Num();
+        Total.Indices += Chunk.Indices[OIT_Vertex].Num();
+
+        for (const FMaterialSubset& Subset : Chunk.MaterialSubsets)
+        {
+            const int32 SubsetIndex = OutObjInfo.MaterialSubsets.Add(Subset);
+            OutObjInfo.MaterialSubsets[SubsetIndex].IndexStart += Offsets[ChunkIndex].Indices;
+        }
+        for (const FString& GroupName : Chunk.GroupNames)
+        {
+            OutObjInfo.GroupName.Add(GroupName);
+        }
+        if (Chunk.bHasMatName)
+        {
+            OutObjInfo.MatName = Chunk.MatName;
+        }
+    }
+    OutObjInfo.NumOfGroup = OutObjInfo.GroupName.Num();
 
-                FaceVertexIndices.Add(vertexIndex);
-                FaceUVIndices.Add(textureIndex);
-                FaceNormalIndices.Add(normalIndex);
-            }
+    // 다음 usemtl까지가 하나의 Subset
+    for (int32 SubsetIndex = 0; SubsetIndex < OutObjInfo.MaterialSubsets.Num(); ++SubsetIndex)
+    {
+        const uint32 SubsetEnd = SubsetIndex + 1 < OutObjInfo.MaterialSubsets.Num() ? OutObjInfo.MaterialSubsets[SubsetIndex + 1].IndexStart : Total.Indices;
+        OutObjInfo.MaterialSubsets[SubsetIndex].IndexCount = SubsetEnd - OutObjInfo.MaterialSubsets[SubsetIndex].IndexStart;
+    }
 
-            if (FaceVertexIndices.Num() == 3) // 삼각형
-            {
-                // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
-            }
-            else if (FaceVertexIndices.Num() == 4) // 쿼드
+    OutObjInfo.Vertices.SetNum(Total.Attributes[OIT_Vertex]);
+    OutObjInfo.UVs.SetNum(Total.Attributes[OIT_UV]);
+    OutObjInfo.Normals.SetNum(Total.Attributes[OIT_Normal]);
+
+    TArray<uint32>* OutIndices[OIT_MAX] = { &OutObjInfo.VertexIndices, &OutObjInfo.UVIndices, &OutObjInfo.NormalIndices };
+    for (TArray<uint32>* Indices : OutIndices)
+    {
+        Indices->SetNum(Total.Indices);
+    }
+
+    FJobSystem::ParallelFor(Chunks.Num(), [&](int32 ChunkIndex)
+    {
+        const FObjChunkResult& Chunk = Chunks[ChunkIndex];
+        const FChunkOffset& Offset = Offsets[ChunkIndex];
+
+        std::copy_n(Chunk.Vertices.GetData(), Chunk.Vertices.Num(), OutObjInfo.Vertices.GetData() + Offset.Attributes[OIT_Vertex]);
+        std::copy_n(Chunk.UVs.GetData(), Chunk.UVs.Num(), OutObjInfo.UVs.GetData() + Offset.Attributes[OIT_UV]);
+        std::copy_n(Chunk.Normals.GetData(), Chunk.Normals.Num(), OutObjInfo.Normals.GetData() + Offset.Attributes[OIT_Normal]);
+
+        for (int32 Type = 0; Type < OIT_MAX; ++Type)
+        {
+            uint32* Indices = OutIndices[Type]->GetData() + Offset.Indices;
+            std::copy_n(Chunk.Indices[Type].GetData(), Chunk.Indices[Type].Num(), Indices);
+            for (const int32 Relative : Chunk.RelativeIndices[Type])
             {
-                // 첫 번째 삼각형: 0-2-1
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
-
-                // 두 번째 삼각형: 0-3-2
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[3]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[3]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[3]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                Indices[Relative] += static_cast<uint32>(Offset.Attributes[Type]);
             }
         }
+    });
+}
+}
+
+
+bool FObjLoader::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+{
+    const std::filesystem::path FilePath = ObjFilePath.ToWideString();
+
+    FMappedFile MappedFile;
+    if (!MappedFile.Open(FilePath))
+    {
+        // 빈 파일은 매핑할 수 없으므로 면이 없는 OBJ로 취급
+        std::error_code ErrorCode;
+        if (!std::filesystem::is_regular_file(FilePath, ErrorCode) || std::filesystem::file_size(FilePath, ErrorCode) != 0)
+        {
+            return false;
+        }
     }
 
-    if (!OutObjInfo.MaterialSubsets.IsEmpty())
+    SetObjFileNames(ObjFilePath, OutObjInfo);
+
+    /**
+     * 블렌더 Export 설정
+     *   > General
+     *       Forward Axis:  Y
+     *       Up Axis:       Z
+     *   > Geometry
+     *       ✅ Triangulated Mesh
+     *   > Materials
+     *       ✅ PBR Extensions
+     *       Path Mode:     Strip
+     */
+
+    const char* Data = reinterpret_cast<const char*>(MappedFile.GetData());
+    const int64 Size = MappedFile.GetSize();
+
+    // 줄 경계에 맞춘 청크로 나눠 병렬로 파싱, 청크가 너무 작으면 스레드를 나누는 비용이 더 큼
+    constexpr int64 MinChunkSize = 1 << 20;
+    const int64 MaxChunks = (FJobSystem::GetNumWorkers() + 1) * 4;
+    const int32 NumChunks = static_cast<int32>(std::clamp<int64>(Size / MinChunkSize, 1, MaxChunks));
+
+    TArray<const char*> ChunkBounds;
+    ChunkBounds.Add(Data);
+    for (int32 ChunkIndex = 1; ChunkIndex < NumChunks; ++ChunkIndex)
     {
-        FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
-        LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+        const char* Bound = std::max(Data + Size * ChunkIndex / NumChunks, ChunkBounds[ChunkIndex - 1]);
+        const char* LineEnd = static_cast<const char*>(std::memchr(Bound, '\n', Data + Size - Bound));
+        ChunkBounds.Add(LineEnd ? LineEnd + 1 : Data + Size);
     }
+    ChunkBounds.Add(Data + Size);
 
+    TArray<FObjChunkResult> Chunks;
+    Chunks.SetNum(NumChunks);
+    FJobSystem::ParallelFor(NumChunks, [&](int32 ChunkIndex)
+    {
+        ParseObjChunk(ChunkBounds[ChunkIndex], ChunkBounds[ChunkIndex + 1], Chunks[ChunkIndex]);
+    });
+
+    MergeObjChunks(Chunks, OutObjInfo);
     return true;
 }
 
@@ -324,7 +536,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutF
             OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
 
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
-            if (CreateTextureFromFile(TexturePath))
+            if (std::filesystem::exists(TexturePath))
             {
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TexturePath = TexturePath;
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].bIsSRGB = true;
@@ -349,7 +561,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutF
                     OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Option;
 
                     FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
-                    if (CreateTextureFromFile(TexturePath, false))
+                    if (std::filesystem::exists(TexturePath))
                     {
                         OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TexturePath = TexturePath;
                         OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].bIsSRGB = false;
@@ -366,7 +578,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutF
             OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
 
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
-            if (CreateTextureFromFile(TexturePath))
+            if (std::filesystem::exists(TexturePath))
             {
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TexturePath = TexturePath;
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].bIsSRGB = true;
@@ -381,7 +593,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutF
             OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
 
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
-            if (CreateTextureFromFile(TexturePath, false))
+            if (std::filesystem::exists(TexturePath))
             {
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TexturePath = TexturePath;
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].bIsSRGB = false;
@@ -396,7 +608,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutF
             OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
 
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
-            if (CreateTextureFromFile(TexturePath))
+            if (std::filesystem::exists(TexturePath))
             {
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TexturePath = TexturePath;
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].bIsSRGB = true;
@@ -411,7 +623,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutF
             OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
 
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
-            if (CreateTextureFromFile(TexturePath))
+            if (std::filesystem::exists(TexturePath))
             {
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TexturePath = TexturePath;
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].bIsSRGB = true;
@@ -426,7 +638,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutF
             OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
 
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
-            if (CreateTextureFromFile(TexturePath, false))
+            if (std::filesystem::exists(TexturePath))
             {
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TexturePath = TexturePath;
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].bIsSRGB = false;
@@ -441,7 +653,7 @@ bool FObjLoader::ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutF
             OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName = Line;
 
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TextureName.ToWideString();
-            if (CreateTextureFromFile(TexturePath, false))
+            if (std::filesystem::exists(TexturePath))
             {
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].TexturePath = TexturePath;
                 OutFStaticMesh.Materials[MaterialIndex].TextureInfos[SlotIdx].bIsSRGB = false;
@@ -459,35 +671,40 @@ bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderD
     OutStaticMesh.ObjectName = RawData.ObjectName;
     OutStaticMesh.DisplayName = RawData.DisplayName;
 
-    // 고유 정점을 기반으로 FVertexSimple 배열 생성
-    TMap<std::string, uint32> IndexMap; // 중복 체크용
+    const int32 NumCorners = RawData.VertexIndices.Num();
+    OutStaticMesh.Vertices.Empty();
+    OutStaticMesh.Vertices.Reserve(NumCorners);
+    OutStaticMesh.Indices.Empty();
+    OutStaticMesh.Indices.Reserve(NumCorners);
+
+    // 고유 정점(v/vt/vn 조합)을 기반으로 FStaticMeshVertex 배열 생성
+    TMap<FObjVertexKey, uint32> IndexMap;
+    IndexMap.Reserve(NumCorners);
 
-    for (int32 i = 0; i < RawData.VertexIndices.Num(); i++)
+    // ParseOBJ의 Subset은 IndexStart 순으로 겹치지 않게 이어지므로 Corner를 따라 앞으로만 이동
+    const TArray<FMaterialSubset>& Subsets = OutStaticMesh.MaterialSubsets;
+    int32 SubsetCursor = 0;
+
+    for (int32 i = 0; i < NumCorners; i++)
     {
         const uint32 VertexIndex = RawData.VertexIndices[i];
         const uint32 UVIndex = RawData.UVIndices[i];
         const uint32 NormalIndex = RawData.NormalIndices[i];
 
-        uint32 MaterialIndex = 0;
-        for (int32 j = 0; j < OutStaticMesh.MaterialSubsets.Num(); j++)
+        while (SubsetCursor < Subsets.Num() && Subsets[SubsetCursor].IndexStart + Subsets[SubsetCursor].IndexCount <= static_cast<uint32>(i))
         {
-            const FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[j];
-            if (Subset.IndexStart <= i && i < Subset.IndexStart + Subset.IndexCount)
-            {
-                MaterialIndex = Subset.MaterialIndex;
-                break;
-            }
+            ++SubsetCursor;
         }
 
-        // 키 생성 (v/vt/vn 조합)
-        std::string Key = std::to_string(VertexIndex) + "/" + std::to_string(UVIndex) + "/" + std::to_string(NormalIndex);
-
-        uint32 FinalIndex;
-        if (IndexMap.Contains(Key))
+        uint32 MaterialIndex = 0;
+        if (SubsetCursor < Subsets.Num() && Subsets[SubsetCursor].IndexStart <= static_cast<uint32>(i))
         {
-            FinalIndex = IndexMap[Key];
+            MaterialIndex = Subsets[SubsetCursor].MaterialIndex;
         }
-        else
+
+        const int32 NumUniqueVertices = IndexMap.Num();
+        uint32& FinalIndex = IndexMap.FindOrAdd({ VertexIndex, UVIndex, NormalIndex });
+        if (IndexMap.Num() != NumUniqueVertices)
         {
             FStaticMeshVertex StaticMeshVertex = {};
             StaticMeshVertex.MaterialIndex = MaterialIndex;
@@ -511,13 +728,18 @@ bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderD
             }
 
             FinalIndex = OutStaticMesh.Vertices.Num();
-            IndexMap[Key] = FinalIndex;
             OutStaticMesh.Vertices.Add(StaticMeshVertex);
         }
 
         OutStaticMesh.Indices.Add(FinalIndex);
     }
 
+    FinalizeStaticMesh(OutStaticMesh);
+    return true;
+}
+
+void FObjLoader::FinalizeStaticMesh(FStaticMeshRenderData& OutStaticMesh)
+{
     // Tangent
     for (int32 i = 0; i < OutStaticMesh.Indices.Num(); i += 3)
     {
@@ -532,8 +754,6 @@ bool FObjLoader::ConvertToStaticMesh(const FObjInfo& RawData, FStaticMeshRenderD
 
     // Calculate StaticMesh BoundingBox
     ComputeBoundingBox(OutStaticMesh.Vertices, OutStaticMesh.BoundingBoxMin, OutStaticMesh.BoundingBoxMax);
-
-    return true;
 }
 
 bool FObjLoader::CreateTextureFromFile(const FWString& Filename, bool bIsSRGB)
@@ -636,255 +856,129 @@ void FObjLoader::CalculateTangent(FStaticMeshVertex& PivotVertex, const FStaticM
 
 FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 {
-    FStaticMeshRenderData* NewStaticMesh = new FStaticMeshRenderData();
-
-    if ( const auto It = ObjStaticMeshMap.Find(PathFileName))
+    if (const auto It = ObjStaticMeshMap.Find(PathFileName))
     {
         return *It;
     }
 
+    FStaticMeshRenderData* NewStaticMesh = new FStaticMeshRenderData();
+    if (!CookStaticMeshAsset(PathFileName, *NewStaticMesh))
+    {
+        delete NewStaticMesh;
+        return nullptr;
+    }
+
+    return RegisterStaticMeshAsset(PathFileName, NewStaticMesh);
+}
+
+bool FObjManager::CookStaticMeshAsset(const FString& PathFileName, FStaticMeshRenderData& OutStaticMesh)
+{
     FWString BinaryPath = (PathFileName + ".bin").ToWideString();
-    if (std::ifstream(BinaryPath).good())
+    if (FStaticMeshCookedFile::Load(BinaryPath, OutStaticMesh))
     {
-        if (LoadStaticMeshFromBinary(BinaryPath, *NewStaticMesh))
-        {
-            ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
-            return NewStaticMesh;
-        }
+        OutStaticMesh.BVH.Build(OutStaticMesh.Vertices, OutStaticMesh.Indices);
+        return true;
     }
+    OutStaticMesh = FStaticMeshRenderData();
 
     // Parse OBJ
     FObjInfo NewObjInfo;
-    bool Result = FObjLoader::ParseOBJ(PathFileName, NewObjInfo);
-
-    if (!Result)
+    if (!FObjLoader::ParseOBJ(PathFileName, NewObjInfo))
     {
-        delete NewStaticMesh;
-        return nullptr;
+        return false;
     }
 
     // Material
     if (NewObjInfo.MaterialSubsets.Num() > 0)
     {
-        Result = FObjLoader::ParseMaterial(NewObjInfo, *NewStaticMesh);
-
-        if (!Result)
+        if (!FObjLoader::ParseMaterial(NewObjInfo, OutStaticMesh))
         {
-            delete NewStaticMesh;
-            return nullptr;
+            return false;
         }
 
-        CombineMaterialIndex(*NewStaticMesh);
-
-        for (int materialIndex = 0; materialIndex < NewStaticMesh->Materials.Num(); materialIndex++) {
-            CreateMaterial(NewStaticMesh->Materials[materialIndex]);
-        }
+        CombineMaterialIndex(OutStaticMesh);
     }
 
     // Convert FStaticMeshRenderData
-    Result = FObjLoader::ConvertToStaticMesh(NewObjInfo, *NewStaticMesh);
-    if (!Result)
-    {
-        delete NewStaticMesh;
-        return nullptr;
-    }
-
-    SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh); 
-    ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
-    return NewStaticMesh;
-}
-
-void FObjManager::CombineMaterialIndex(FStaticMeshRenderData& OutFStaticMesh)
-{
-    for (int32 i = 0; i < OutFStaticMesh.MaterialSubsets.Num(); i++)
-    {
-        FString MatName = OutFStaticMesh.MaterialSubsets[i].MaterialName;
-        for (int32 j = 0; j < OutFStaticMesh.Materials.Num(); j++)
-        {
-            if (OutFStaticMesh.Materials[j].MaterialName == MatName)
-            {
-                OutFStaticMesh.MaterialSubsets[i].MaterialIndex = j;
-                break;
-            }
-        }
-    }
-}
-
-bool FObjManager::SaveStaticMeshToBinary(const FWString& FilePath, const FStaticMeshRenderData& StaticMesh)
-{
-    std::ofstream File(FilePath, std::ios::binary);
-    if (!File.is_open())
+    if (!FObjLoader::ConvertToStaticMesh(NewObjInfo, OutStaticMesh))
     {
-        assert("CAN'T SAVE STATIC MESH BINARY FILE");
         return false;
     }
 
-    // Object Name
-    Serializer::WriteFWString(File, StaticMesh.ObjectName);
-
-    // Display Name
-    Serializer::WriteFString(File, StaticMesh.DisplayName);
-
-    // Vertices
-    uint32 VertexCount = StaticMesh.Vertices.Num();
-    File.write(reinterpret_cast<const char*>(&VertexCount), sizeof(VertexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
-
-    // Indices
-    uint32 IndexCount = StaticMesh.Indices.Num();
-    File.write(reinterpret_cast<const char*>(&IndexCount), sizeof(IndexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
-
-    // Materials
-    uint32 MaterialCount = StaticMesh.Materials.Num();
-    File.write(reinterpret_cast<const char*>(&MaterialCount), sizeof(MaterialCount));
-    for (const FObjMaterialInfo& Material : StaticMesh.Materials)
+    // 캐시에 최적화된 순서로 저장되므로 Cook할 때 한 번만 수행
+    FVertexCacheStatistics Before;
+    FVertexCacheStatistics After;
+    if (FStaticMeshOptimizer::Optimize(OutStaticMesh, &Before, &After))
     {
-        Serializer::WriteFString(File, Material.MaterialName);
-        
-        File.write(reinterpret_cast<const char*>(&Material.TextureFlag), sizeof(Material.TextureFlag));
-        
-        File.write(reinterpret_cast<const char*>(&Material.bTransparent), sizeof(Material.bTransparent));
-        File.write(reinterpret_cast<const char*>(&Material.DiffuseColor), sizeof(Material.DiffuseColor));
-        File.write(reinterpret_cast<const char*>(&Material.SpecularColor), sizeof(Material.SpecularColor));
-        File.write(reinterpret_cast<const char*>(&Material.AmbientColor), sizeof(Material.AmbientColor));
-        File.write(reinterpret_cast<const char*>(&Material.EmissiveColor), sizeof(Material.EmissiveColor));
-        
-        File.write(reinterpret_cast<const char*>(&Material.SpecularExponent), sizeof(Material.SpecularExponent));
-        File.write(reinterpret_cast<const char*>(&Material.IOR), sizeof(Material.IOR));
-        File.write(reinterpret_cast<const char*>(&Material.Transparency), sizeof(Material.Transparency));
-        File.write(reinterpret_cast<const char*>(&Material.BumpMultiplier), sizeof(Material.BumpMultiplier));
-        File.write(reinterpret_cast<const char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
-
-        File.write(reinterpret_cast<const char*>(&Material.Metallic), sizeof(Material.Metallic));
-        File.write(reinterpret_cast<const char*>(&Material.Roughness), sizeof(Material.Roughness));
-
-        for (uint8 i = 0; i < static_cast<uint8>(EMaterialTextureSlots::MTS_MAX); ++i)
-        {
-            Serializer::WriteFString(File, Material.TextureInfos[i].TextureName);
-            Serializer::WriteFWString(File, Material.TextureInfos[i].TexturePath);
-            File.write(reinterpret_cast<const char*>(&Material.TextureInfos[i].bIsSRGB), sizeof(Material.TextureInfos[i].bIsSRGB));
-        }
+        UE_LOG(
+            ELogLevel::Display, "Optimized %s: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+            *PathFileName, Before.ACMR, After.ACMR, Before.ATVR, After.ATVR
+        );
     }
 
-    // Material Subsets
-    uint32 SubsetCount = StaticMesh.MaterialSubsets.Num();
-    File.write(reinterpret_cast<const char*>(&SubsetCount), sizeof(SubsetCount));
-    for (const FMaterialSubset& Subset : StaticMesh.MaterialSubsets)
+    // 원본이 바뀌면 Load에서 캐시를 버릴 수 있도록 읽은 파일을 함께 기록
+    TArray<FCookedMeshSource> Sources;
+    FStaticMeshCookedFile::MakeSource(PathFileName.ToWideString(), Sources[Sources.Emplace()]);
+    if (!NewObjInfo.MatName.IsEmpty())
     {
-        Serializer::WriteFString(File, Subset.MaterialName);
-        File.write(reinterpret_cast<const char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
-        File.write(reinterpret_cast<const char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
-        File.write(reinterpret_cast<const char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
+        FStaticMeshCookedFile::MakeSource(NewObjInfo.FilePath + NewObjInfo.MatName.ToWideString(), Sources[Sources.Emplace()]);
     }
 
-    // Bounding Box
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMin), sizeof(FVector));
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMax), sizeof(FVector));
+    FStaticMeshCookedFile::Save(BinaryPath, OutStaticMesh, Sources);
 
-    File.close();
+    // 최적화로 Index 순서가 바뀐 뒤에 만듦
+    OutStaticMesh.BVH.Build(OutStaticMesh.Vertices, OutStaticMesh.Indices);
     return true;
 }
 
-bool FObjManager::LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMeshRenderData& OutStaticMesh)
+FStaticMeshRenderData* FObjManager::RegisterStaticMeshAsset(const FString& PathFileName, FStaticMeshRenderData* CookedData)
 {
-    std::ifstream File(FilePath, std::ios::binary);
-    if (!File.is_open())
+    if (const auto It = ObjStaticMeshMap.Find(PathFileName))
     {
-        assert("CAN'T OPEN STATIC MESH BINARY FILE");
-        return false;
+        delete CookedData;
+        return *It;
     }
 
-    TArray<TPair<FWString, bool>> Textures;
-
-    // Object Name
-    Serializer::ReadFWString(File, OutStaticMesh.ObjectName);
-
-    //// Path Name
-    //Serializer::ReadFWString(File, OutStaticMesh.PathName);
-
-    // Display Name
-    Serializer::ReadFString(File, OutStaticMesh.DisplayName);
-
-    // Vertices
-    uint32 VertexCount = 0;
-    File.read(reinterpret_cast<char*>(&VertexCount), sizeof(VertexCount));
-    OutStaticMesh.Vertices.SetNum(VertexCount);
-    File.read(reinterpret_cast<char*>(OutStaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
-
-    // Indices
-    uint32 IndexCount = 0;
-    File.read(reinterpret_cast<char*>(&IndexCount), sizeof(IndexCount));
-    OutStaticMesh.Indices.SetNum(IndexCount);
-    File.read(reinterpret_cast<char*>(OutStaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
+    LoadStaticMeshTextures(*CookedData);
+    ObjStaticMeshMap.Add(PathFileName, CookedData);
+    return CookedData;
+}
 
-    // Material
-    uint32 MaterialCount = 0;
-    File.read(reinterpret_cast<char*>(&MaterialCount), sizeof(MaterialCount));
-    OutStaticMesh.Materials.SetNum(MaterialCount);
-    for (FObjMaterialInfo& Material : OutStaticMesh.Materials)
+void FObjManager::LoadStaticMeshTextures(FStaticMeshRenderData& StaticMesh)
+{
+    for (FObjMaterialInfo& Material : StaticMesh.Materials)
     {
-        Serializer::ReadFString(File, Material.MaterialName);
-        File.read(reinterpret_cast<char*>(&Material.TextureFlag), sizeof(Material.TextureFlag));
-        
-        File.read(reinterpret_cast<char*>(&Material.bTransparent), sizeof(Material.bTransparent));
-        File.read(reinterpret_cast<char*>(&Material.DiffuseColor), sizeof(Material.DiffuseColor));
-        File.read(reinterpret_cast<char*>(&Material.SpecularColor), sizeof(Material.SpecularColor));
-        File.read(reinterpret_cast<char*>(&Material.AmbientColor), sizeof(Material.AmbientColor));
-        File.read(reinterpret_cast<char*>(&Material.EmissiveColor), sizeof(Material.EmissiveColor));
-        
-        File.read(reinterpret_cast<char*>(&Material.SpecularExponent), sizeof(Material.SpecularExponent));
-        File.read(reinterpret_cast<char*>(&Material.IOR), sizeof(Material.IOR));
-        File.read(reinterpret_cast<char*>(&Material.Transparency), sizeof(Material.Transparency));
-        File.read(reinterpret_cast<char*>(&Material.BumpMultiplier), sizeof(Material.BumpMultiplier));
-        File.read(reinterpret_cast<char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
-
-        File.read(reinterpret_cast<char*>(&Material.Metallic), sizeof(Material.Metallic));
-        File.read(reinterpret_cast<char*>(&Material.Roughness), sizeof(Material.Roughness));
-
-        uint8 TextureNum = static_cast<uint8>(EMaterialTextureSlots::MTS_MAX);
-        Material.TextureInfos.SetNum(TextureNum);
-        for (uint8 i = 0; i < TextureNum; ++i)
+        for (int32 SlotIdx = 0; SlotIdx < Material.TextureInfos.Num(); ++SlotIdx)
         {
-            Serializer::ReadFString(File, Material.TextureInfos[i].TextureName);
-            Serializer::ReadFWString(File, Material.TextureInfos[i].TexturePath);
-            File.read(reinterpret_cast<char*>(&Material.TextureInfos[i].bIsSRGB), sizeof(Material.TextureInfos[i].bIsSRGB));
+            FTextureInfo& TextureInfo = Material.TextureInfos[SlotIdx];
+            if (TextureInfo.TexturePath.empty())
+            {
+                continue;
+            }
 
-            Textures.AddUnique({Material.TextureInfos[i].TexturePath, Material.TextureInfos[i].bIsSRGB});
+            if (!FObjLoader::CreateTextureFromFile(TextureInfo.TexturePath, TextureInfo.bIsSRGB))
+            {
+                TextureInfo.TexturePath.clear();
+                Material.TextureFlag &= ~(1u << SlotIdx);
+            }
         }
     }
+}
 
-    // Material Subset
-    uint32 SubsetCount = 0;
-    File.read(reinterpret_cast<char*>(&SubsetCount), sizeof(SubsetCount));
-    OutStaticMesh.MaterialSubsets.SetNum(SubsetCount);
-    for (FMaterialSubset& Subset : OutStaticMesh.MaterialSubsets)
-    {
-        Serializer::ReadFString(File, Subset.MaterialName);
-        File.read(reinterpret_cast<char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
-        File.read(reinterpret_cast<char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
-        File.read(reinterpret_cast<char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
-    }
-
-    // Bounding Box
-    File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMin), sizeof(FVector));
-    File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMax), sizeof(FVector));
-
-    File.close();
-
-    // Texture Load
-    if (Textures.Num() > 0)
+void FObjManager::CombineMaterialIndex(FStaticMeshRenderData& OutFStaticMesh)
+{
+    for (int32 i = 0; i < OutFStaticMesh.MaterialSubsets.Num(); i++)
     {
-        for (const TPair<FWString, bool>& Texture : Textures)
+        FString MatName = OutFStaticMesh.MaterialSubsets[i].MaterialName;
+        for (int32 j = 0; j < OutFStaticMesh.Materials.Num(); j++)
         {
-            if (FEngineLoop::ResourceManager.GetTexture(Texture.Key) == nullptr)
+            if (OutFStaticMesh.Materials[j].MaterialName == MatName)
             {
-                FEngineLoop::ResourceManager.LoadTextureFromFile(FEngineLoop::GraphicDevice.Device, Texture.Key.c_str(), Texture.Value);
+                OutFStaticMesh.MaterialSubsets[i].MaterialIndex = j;
+                break;
             }
         }
     }
-
-    return true;
 }
 
 UMaterial* FObjManager::CreateMaterial(FObjMaterialInfo materialInfo)
@@ -905,6 +999,17 @@ UMaterial* FObjManager::GetMaterial(FString name)
 
 UStaticMesh* FObjManager::CreateStaticMesh(const FString& filePath)
 {
+    UStaticMesh* const* Found = StaticMeshMap.Find(filePath.ToWideString());
+    if (Found && *Found && (*Found)->IsPlaceholder())
+    {
+        // 비동기 로드 중이면 Placeholder를 먼저 쓰고, 로드 순서를 앞으로 당김
+        if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+        {
+            AssetManager->RequestStaticMeshLoad(filePath, EAssetLoadPriority::High);
+        }
+        return *Found;
+    }
+
     FStaticMeshRenderData* StaticMeshRenderData = FObjManager::LoadObjStaticMeshAsset(filePath);
 
     if (StaticMeshRenderData == nullptr) return nullptr;
@@ -922,6 +1027,124 @@ UStaticMesh* FObjManager::CreateStaticMesh(const FString& filePath)
     return StaticMesh;
 }
 
+UStaticMesh* FObjManager::CreatePlaceholderStaticMesh(const FString& filePath)
+{
+    const FWString ObjectName = filePath.ToWideString();
+    if (UStaticMesh* const* Found = StaticMeshMap.Find(ObjectName))
+    {
+        if (*Found)
+        {
+            return *Found;
+        }
+    }
+
+    UStaticMesh* StaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr);
+    StaticMesh->SetPlaceholderData(GetPlaceholderRenderData(), ObjectName);
+
+    StaticMeshMap.Add(ObjectName, StaticMesh);
+    return StaticMesh;
+}
+
+UStaticMesh* FObjManager::FinishStaticMeshLoad(const FString& filePath, FStaticMeshRenderData* CookedData)
+{
+    const FWString ObjectName = filePath.ToWideString();
+    UStaticMesh* const* Found = StaticMeshMap.Find(ObjectName);
+    UStaticMesh* StaticMesh = Found ? *Found : nullptr;
+
+    if (CookedData == nullptr)
+    {
+        if (StaticMesh && StaticMesh->IsPlaceholder())
+        {
+            StaticMeshMap.Remove(ObjectName);
+        }
+        return nullptr;
+    }
+
+    FStaticMeshRenderData* RenderData = RegisterStaticMeshAsset(filePath, CookedData);
+
+    if (StaticMesh == nullptr)
+    {
+        StaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr);
+        StaticMeshMap.Add(ObjectName, StaticMesh);
+    }
+    else if (!StaticMesh->IsPlaceholder())
+    {
+        // 그 사이 동기 로드로 이미 만들어짐
+        return StaticMesh;
+    }
+
+    StaticMesh->SetData(RenderData);
+    return StaticMesh;
+}
+
+FStaticMeshRenderData* FObjManager::GetPlaceholderRenderData()
+{
+    static FStaticMeshRenderData* PlaceholderData = nullptr;
+    if (PlaceholderData)
+    {
+        return PlaceholderData;
+    }
+
+    PlaceholderData = new FStaticMeshRenderData();
+
+    // 버퍼 캐시가 ObjectName을 Key로 쓰므로 실제 경로와 겹치지 않는 이름을 사용
+    PlaceholderData->ObjectName = L"__PlaceholderStaticMesh";
+    PlaceholderData->DisplayName = "Placeholder";
+
+    // 면마다 정점 4개인 한 변 1짜리 상자
+    const FVector FaceNormals[6] = {
+        FVector(1, 0, 0), FVector(-1, 0, 0), FVector(0, 1, 0),
+        FVector(0, -1, 0), FVector(0, 0, 1), FVector(0, 0, -1)
+    };
+    const FVector FaceTangents[6] = {
+        FVector(0, 1, 0), FVector(0, -1, 0), FVector(-1, 0, 0),
+        FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, -1, 0)
+    };
+    const float CornerU[4] = { 0.f, 1.f, 1.f, 0.f };
+    const float CornerV[4] = { 1.f, 1.f, 0.f, 0.f };
+
+    for (int32 Face = 0; Face < 6; ++Face)
+    {
+        const FVector& Normal = FaceNormals[Face];
+        const FVector& Tangent = FaceTangents[Face];
+        const FVector Bitangent = FVector::CrossProduct(Normal, Tangent);
+        const uint32 BaseIndex = PlaceholderData->Vertices.Num();
+
+        for (int32 Corner = 0; Corner < 4; ++Corner)
+        {
+            const FVector Position = (Normal + Tangent * (CornerU[Corner] * 2.f - 1.f) + Bitangent * (1.f - CornerV[Corner] * 2.f)) * 0.5f;
+
+            FStaticMeshVertex Vertex = {};
+            Vertex.X = Position.X;
+            Vertex.Y = Position.Y;
+            Vertex.Z = Position.Z;
+            Vertex.R = Vertex.G = Vertex.B = 0.5f;
+            Vertex.A = 1.f;
+            Vertex.NormalX = Normal.X;
+            Vertex.NormalY = Normal.Y;
+            Vertex.NormalZ = Normal.Z;
+            Vertex.TangentX = Tangent.X;
+            Vertex.TangentY = Tangent.Y;
+            Vertex.TangentZ = Tangent.Z;
+            Vertex.TangentW = 1.f;
+            Vertex.U = CornerU[Corner];
+            Vertex.V = CornerV[Corner];
+            Vertex.MaterialIndex = 0;
+            PlaceholderData->Vertices.Add(Vertex);
+        }
+
+        const uint32 FaceIndices[6] = { 0, 1, 2, 0, 2, 3 };
+        for (const uint32 Index : FaceIndices)
+        {
+            PlaceholderData->Indices.Add(BaseIndex + Index);
+        }
+    }
+
+    FObjLoader::ComputeBoundingBox(PlaceholderData->Vertices, PlaceholderData->BoundingBoxMin, PlaceholderData->BoundingBoxMax);
+    PlaceholderData->BVH.Build(PlaceholderData->Vertices, PlaceholderData->Indices);
+    return PlaceholderData;
+}
+
 UStaticMesh* FObjManager::GetStaticMesh(FWString name)
 {
     return StaticMeshMap[name];
@@ -13,10 +13,10 @@ struct FStaticMeshRenderData;
 
 struct FObjLoader
 {
-    // Obj Parsing (*.obj to FObjInfo)
+    // Obj Parsing (*.obj to FObjInfo), 파일을 매핑해 줄 단위 청크로 나눠 병렬로 파싱
     static bool ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo);
 
-    // Material Parsing (*.obj to MaterialInfo)
+    // Material Parsing (*.obj to MaterialInfo), 텍스처는 경로만 기록하고 FObjManager::LoadStaticMeshTextures에서 로드
     static bool ParseMaterial(FObjInfo& OutObjInfo, FStaticMeshRenderData& OutFStaticMesh);
 
     // Convert the Raw data to Cooked data (FStaticMeshRenderData)
@@ -26,6 +26,9 @@ struct FObjLoader
 
     static void ComputeBoundingBox(const TArray<FStaticMeshVertex>& InVertices, FVector& OutMinVector, FVector& OutMaxVector);
 
+    /** 병합된 정점에 Tangent와 BoundingBox를 계산합니다. */
+    static void FinalizeStaticMesh(FStaticMeshRenderData& OutStaticMesh);
+
 private:
     static void CalculateTangent(FStaticMeshVertex& PivotVertex, const FStaticMeshVertex& Vertex1, const FStaticMeshVertex& Vertex2);
 };
@@ -35,11 +38,22 @@ struct FObjManager
 public:
     static FStaticMeshRenderData* LoadObjStaticMeshAsset(const FString& PathFileName);
 
-    static void CombineMaterialIndex(FStaticMeshRenderData& OutFStaticMesh);
+    /**
+     * .bin 캐시 또는 OBJ/MTL에서 FStaticMeshRenderData를 만듭니다.
+     * 전역 상태를 건드리지 않으므로 워커 스레드에서 호출할 수 있고, 텍스처와 Material은 만들지 않습니다.
+     */
+    static bool CookStaticMeshAsset(const FString& PathFileName, FStaticMeshRenderData& OutStaticMesh);
 
-    static bool SaveStaticMeshToBinary(const FWString& FilePath, const FStaticMeshRenderData& StaticMesh);
+    /**
+     * Cook된 데이터의 텍스처를 로드하고 PathFileName으로 등록합니다. 메인 스레드에서만 호출합니다.
+     * @return 등록된 데이터, 이미 등록되어 있으면 CookedData를 지우고 기존 데이터
+     */
+    static FStaticMeshRenderData* RegisterStaticMeshAsset(const FString& PathFileName, FStaticMeshRenderData* CookedData);
 
-    static bool LoadStaticMeshFromBinary(const FWString& FilePath, FStaticMeshRenderData& OutStaticMesh);
+    /** 로드에 실패한 텍스처는 TextureFlag에서 제외합니다. */
+    static void LoadStaticMeshTextures(FStaticMeshRenderData& StaticMesh);
+
+    static void CombineMaterialIndex(FStaticMeshRenderData& OutFStaticMesh);
 
     static UMaterial* CreateMaterial(FObjMaterialInfo materialInfo);
 
@@ -51,6 +65,19 @@ public:
 
     static UStaticMesh* CreateStaticMesh(const FString& filePath);
 
+    /**
+     * 로드가 끝나기 전까지 사용할 Placeholder Mesh를 filePath로 등록합니다.
+     * @return 등록된 Mesh, 이미 있으면 기존 Mesh
+     */
+    static UStaticMesh* CreatePlaceholderStaticMesh(const FString& filePath);
+
+    /**
+     * 비동기로 Cook된 데이터를 filePath의 Mesh에 반영합니다. Placeholder였다면 데이터만 바꿉니다.
+     * @param CookedData 실패했으면 nullptr, Placeholder Mesh는 등록 해제됨
+     * @return 반영된 Mesh, 실패하면 nullptr
+     */
+    static UStaticMesh* FinishStaticMeshLoad(const FString& filePath, FStaticMeshRenderData* CookedData);
+
     static const TMap<FWString, UStaticMesh*>& GetStaticMeshes() { return StaticMeshMap; }
 
     static UStaticMesh* GetStaticMesh(FWString name);
@@ -58,6 +85,9 @@ public:
     static int GetStaticMeshNum() { return StaticMeshMap.Num(); }
 
 private:
+    /** 모든 Placeholder Mesh가 공유하는 상자 */
+    static FStaticMeshRenderData* GetPlaceholderRenderData();
+
     inline static TMap<FString, FStaticMeshRenderData*> ObjStaticMeshMap;
     inline static TMap<FWString, UStaticMesh*> StaticMeshMap;
     inline static TMap<FString, UMaterial*> MaterialMap;
@@ -3,11 +3,13 @@
 #include "Define.h"
 #include "Asset/SkeletalMeshAsset.h"
 #include "Asset/StaticMeshAsset.h"
+#include "Asset/StaticMeshOptimizer.h"
 #include "UObject/ObjectFactory.h"
 #include "Components/Mesh/StaticMeshRenderData.h"
 #include "Components/Mesh/SkeletalMeshRenderData.h"
 #include "FObjLoader.h"
 #include "Math/JungleMath.h"
+#include "SkeletalMeshSkinning.h"
 
 FFBXLoader::~FFBXLoader()
 {
@@ -172,15 +174,16 @@ bool FFBXLoader::FindMesh(FbxNode* Node, const FString& FilePath)
             // Build bones and weights
             //BuildSkeletalBones(Mesh, FFBXManager::SkeletalMeshRenderData->Bones);
             ExtractSkeleton(Mesh, Bones);
-            RecalculateGlobalPoses(Bones);
-            //BuildBoneWeights(Mesh, FFBXManager::SkeletalMeshRenderData->BoneWeights);
-            BuildSkeletalVertexBuffers(Mesh, FFBXManager::SkeletalMeshRenderData->Vertices, FFBXManager::SkeletalMeshRenderData->Indices);
-            ReskinVerticesCPU(Mesh,
-                Bones,
-                FFBXManager::SkeletalMeshRenderData->Vertices);
+            FSkeletalMeshSkinning::RecalculateGlobalPoses(Bones);
+            BuildSkeletalVertexBuffers(Mesh, FFBXManager::SkeletalMeshRenderData->BindPoseVertices, FFBXManager::SkeletalMeshRenderData->Indices);
+            BuildBoneWeights(Mesh, Bones, FFBXManager::SkeletalMeshRenderData->BindPoseVertices, FFBXManager::SkeletalMeshRenderData->BoneWeights);
+            // 이후로는 FbxMesh 없이 구워둔 가중치로 스키닝
+            FSkeletalMeshSkinning::UpdateSkinnedVertices(*FFBXManager::SkeletalMeshRenderData);
             SetupMaterialSubsets(Mesh, FFBXManager::SkeletalMeshRenderData->MaterialSubsets);
             LoadMaterialInfo(Node);
             ComputeBoundingBox(FFBXManager::SkeletalMeshRenderData->Vertices, FFBXManager::SkeletalMeshRenderData->BoundingBoxMin, FFBXManager::SkeletalMeshRenderData->BoundingBoxMax);
+            FFBXManager::SkeletalMeshRenderData->BVH.Build(FFBXManager::SkeletalMeshRenderData->Vertices, FFBXManager::SkeletalMeshRenderData->Indices);
+            FFBXManager::SkeletalMeshRenderData->bBVHDirty = false;
 
         }
         // Static Mesh
@@ -209,7 +212,19 @@ bool FFBXLoader::FindMesh(FbxNode* Node, const FString& FilePath)
                 FFBXManager::StaticMeshRenderData->BoundingBoxMax
             );
 
+            // 6) 정점 캐시, Overdraw, Vertex Fetch 순서로 재배치
+            FVertexCacheStatistics Before;
+            FVertexCacheStatistics After;
+            if (FStaticMeshOptimizer::Optimize(*FFBXManager::StaticMeshRenderData, &Before, &After))
+            {
+                UE_LOG(
+                    ELogLevel::Display, "Optimized %s: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+                    *FilePath, Before.ACMR, After.ACMR, Before.ATVR, After.ATVR
+                );
+            }
 
+            // 7) 재배치된 Index로 Ray 교차 검사용 BVH 생성
+            FFBXManager::StaticMeshRenderData->BVH.Build(FFBXManager::StaticMeshRenderData->Vertices, FFBXManager::StaticMeshRenderData->Indices);
         }
 
         return true;
@@ -257,8 +272,6 @@ void FFBXLoader::BuildSkeletalVertexBuffers(FbxMesh* Mesh, TArray<FSkeletalMeshV
     if (Mesh->GetElementTangentCount() > 0)
         TanElem = Mesh->GetElementTangent(0);
 
-    TArray<FSkeletalMeshBoneWeight> const& BoneWeights = FFBXManager::SkeletalMeshRenderData->BoneWeights;
-
     int polyCount = Mesh->GetPolygonCount();
     int vertexCounter = 0; // DirectArray 인덱스용(탄젠트, 노말, UV 모두 ByPolygonVertex/direct 가정)
 
@@ -422,96 +435,95 @@ void FFBXLoader::ExtractSkeleton(FbxMesh* Mesh, TArray<FSkeletonBone>& OutBones)
 
 }
 
-void FFBXLoader::RecalculateGlobalPoses(TArray<FSkeletonBone>& Bones)
+void FFBXLoader::BuildBoneWeights(FbxMesh* Mesh, TArray<FSkeletonBone>& Bones, const TArray<FSkeletalMeshVertex>& Vertices, TArray<FSkeletalMeshBoneWeight>& OutWeights)
 {
-    for (int i = 0; i < Bones.Num(); ++i)
-    {
-        FSkeletonBone& Bone = Bones[i];
-        if (Bone.ParentIndex == -1)
-        {
-            Bone.GlobalPose = Bone.LocalBindPose;
-        }
-        else
-        {
-            Bone.GlobalPose = Bone.LocalBindPose * Bones[Bone.ParentIndex].GlobalPose;
-        }
-    }
-}
-
-void FFBXLoader::RotateBones(TArray<FSkeletonBone>& Bones, int32 BoneIndex, const FbxVector4& EulerDegrees)
-{
-    if (!Bones.IsValidIndex(BoneIndex)) return;
-
-    FSkeletonBone& Bone = Bones[BoneIndex];
-
-    FMatrix NewRotation = FMatrix::CreateRotationMatrix((float)EulerDegrees[0], (float)EulerDegrees[1], (float)EulerDegrees[2]);
-    //FMatrix NewRotation = JungleMath::CreateRotationMatrix(FVector(EulerDegrees[0], EulerDegrees[1], EulerDegrees[2]));
+    constexpr int32 MaxInfluences = FSkeletalMeshSkinning::MaxBoneInfluences;
 
-    // 기존 로컬 바인드 포즈에서 위치와 스케일 분리
-    FVector Translation = Bone.LocalBindPose.GetTranslationVector();
-    FVector Scale = Bone.LocalBindPose.GetScaleVector();
-
-    // 새로운 로컬 바인드 포즈 생성 (위치와 스케일 유지, 회전만 대체)
-    Bone.LocalBindPose = FMatrix::GetScaleMatrix(Scale) * NewRotation * FMatrix::GetTranslationMatrix(Translation);
-
-    // 회전 후 글로벌 포즈 갱신
-    RecalculateGlobalPoses(Bones);
-}
+    OutWeights.Empty();
+    if (Mesh->GetDeformerCount(FbxDeformer::eSkin) == 0)
+        return;
 
-void FFBXLoader::ReskinVerticesCPU(FbxMesh* Mesh, const TArray<FSkeletonBone>& Bones, TArray<FSkeletalMeshVertex>& Vertices)
-{
-    if (!Mesh || Bones.Num() == 0) return;
+    if (Bones.Num() > 256)
+    {
+        UE_LOG(ELogLevel::Warning, TEXT("Too many bones for 8bit bone indices: %d"), Bones.Num());
+    }
 
     const int ControlPointsCount = Mesh->GetControlPointsCount();
-    FbxVector4* ControlPoints = Mesh->GetControlPoints();
 
-    std::vector<FbxVector4> Skinned(ControlPointsCount);
-    for (int i = 0; i < ControlPointsCount; ++i)
-        Skinned[i] = ControlPoints[i];
+    // 컨트롤 포인트마다 큰 가중치 4개만 남김
+    TArray<FSkeletalMeshBoneWeight> ControlPointWeights;
+    ControlPointWeights.Init(FSkeletalMeshBoneWeight{ {0, 0, 0, 0}, {0.0f, 0.0f, 0.0f, 0.0f} }, ControlPointsCount);
 
     FbxSkin* Skin = static_cast<FbxSkin*>(Mesh->GetDeformer(0, FbxDeformer::eSkin));
-
     for (int c = 0; c < Skin->GetClusterCount(); ++c)
     {
         FbxCluster* Cluster = Skin->GetCluster(c);
-        int* Indices = Cluster->GetControlPointIndices();
-        double* Weights = Cluster->GetControlPointWeights();
-        int Count = Cluster->GetControlPointIndicesCount();
-
         FbxNode* BoneNode = Cluster->GetLink();
-        FString BoneName = BoneNode->GetName();
-        int BoneIndex = Bones.IndexOfByPredicate([&](const FSkeletonBone& B) { return B.Name == BoneName; });
-        if (BoneIndex == INDEX_NONE) continue; 
+        if (!BoneNode)
+            continue;
+
+        const int32 BoneIndex = FindBoneByName(Bones, BoneNode->GetName());
+        if (BoneIndex == INDEX_NONE || BoneIndex > 255)
+            continue;
 
+        // 메시 공간 -> 바인드 시점 본 공간, double로 계산한 뒤 한 번만 float로 변환
         FbxAMatrix TransformMatrix, ReferenceMatrix;
         Cluster->GetTransformMatrix(TransformMatrix);
         Cluster->GetTransformLinkMatrix(ReferenceMatrix);
+        Bones[BoneIndex].InverseBindPose = FbxAMatrixToFMatrix(ReferenceMatrix.Inverse() * TransformMatrix);
 
-        FbxAMatrix BoneOffsetMatrix = ReferenceMatrix.Inverse() * TransformMatrix;
-        FbxAMatrix FinalMatrix = FMatrixToFbxAMatrix(Bones[BoneIndex].GlobalPose) * BoneOffsetMatrix;
+        const int* Indices = Cluster->GetControlPointIndices();
+        const double* Weights = Cluster->GetControlPointWeights();
+        const int Count = Cluster->GetControlPointIndicesCount();
 
         for (int i = 0; i < Count; ++i)
         {
-            int ctrlIdx = Indices[i];
-            double weight = Weights[i];
-            if (ctrlIdx < ControlPointsCount)
+            const int CtrlIdx = Indices[i];
+            const float Weight = static_cast<float>(Weights[i]);
+            if (CtrlIdx < 0 || CtrlIdx >= ControlPointsCount || Weight <= 0.0f)
+                continue;
+
+            // 내림차순 삽입, 가장 작은 값보다 작으면 버림
+            FSkeletalMeshBoneWeight& Influence = ControlPointWeights[CtrlIdx];
+            int32 Slot = MaxInfluences;
+            while (Slot > 0 && Influence.Weights[Slot - 1] < Weight)
             {
-                FbxVector4 SkinnedDelta = (FinalMatrix.MultT(ControlPoints[ctrlIdx]) - ControlPoints[ctrlIdx]) * weight;
-                Skinned[ctrlIdx] += SkinnedDelta;
+                --Slot;
             }
+            if (Slot == MaxInfluences)
+                continue;
+
+            for (int32 k = MaxInfluences - 1; k > Slot; --k)
+            {
+                Influence.Weights[k] = Influence.Weights[k - 1];
+                Influence.BoneIndices[k] = Influence.BoneIndices[k - 1];
+            }
+            Influence.Weights[Slot] = Weight;
+            Influence.BoneIndices[Slot] = static_cast<uint8>(BoneIndex);
         }
     }
 
-    for (auto& V : Vertices)
+    for (FSkeletalMeshBoneWeight& Influence : ControlPointWeights)
     {
-        if ((int)V.ControlPointIndex < ControlPointsCount)
+        const float Sum = Influence.Weights[0] + Influence.Weights[1] + Influence.Weights[2] + Influence.Weights[3];
+        if (Sum > 0.0f)
         {
-            FbxVector4 P = Skinned[V.ControlPointIndex];
-            V.X = (float)P[0];
-            V.Y = (float)P[1];
-            V.Z = (float)P[2];
+            for (float& Weight : Influence.Weights)
+            {
+                Weight /= Sum;
+            }
         }
     }
+
+    // 렌더 정점 순서로 펼침
+    OutWeights.SetNum(Vertices.Num());
+    for (int32 i = 0; i < Vertices.Num(); ++i)
+    {
+        const int32 CtrlIdx = Vertices[i].ControlPointIndex;
+        OutWeights[i] = (CtrlIdx >= 0 && CtrlIdx < ControlPointsCount)
+            ? ControlPointWeights[CtrlIdx]
+            : FSkeletalMeshBoneWeight{ {0, 0, 0, 0}, {0.0f, 0.0f, 0.0f, 0.0f} };
+    }
 }
 
 int32 FFBXLoader::FindBoneByName(const TArray<FSkeletonBone>& Bones, const FString& Name)
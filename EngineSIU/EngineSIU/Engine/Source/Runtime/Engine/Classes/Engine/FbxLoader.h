@@ -76,9 +76,7 @@ public:
     static void SetupMaterialSubsets(FbxMesh* Mesh, TArray<FMaterialSubset>& OutSubsets);
     static void LoadMaterialInfo(FbxNode* Node);
     static void ExtractSkeleton(FbxMesh* Mesh, TArray<FSkeletonBone>& OutBones);
-    static void RecalculateGlobalPoses(TArray<FSkeletonBone>& Bones);
-    static void RotateBones(TArray<FSkeletonBone>& Bones, int32 BoneIndex, const FbxVector4& EulerDegrees);
-    static void ReskinVerticesCPU(FbxMesh* Mesh, const TArray<FSkeletonBone>& Bones, TArray<FSkeletalMeshVertex>& Vertices);
+    static void BuildBoneWeights(FbxMesh* Mesh, TArray<FSkeletonBone>& Bones, const TArray<FSkeletalMeshVertex>& Vertices, TArray<FSkeletalMeshBoneWeight>& OutWeights);
     static int32 FindBoneByName(const TArray<FSkeletonBone>& Bones, const FString& Name);
     static void BuildNodeHierarchyRecursive(const FbxNode* Node, FSkeletalHierarchyData& OutHierarchyData);
     
@@ -91,9 +89,8 @@ public:
     static void ComputeBoundingBox(const TArray<FStaticMeshVertex>& InVerts, FVector& OutMin, FVector& OutMax);
     static void ComputeBoundingBox(const TArray<FSkeletalMeshVertex>& InVerts, FVector& OutMin, FVector& OutMax);
 
-    
-    inline static FbxMesh* Mesh = nullptr;
 private:
+    inline static FbxMesh* Mesh = nullptr;
     inline static FbxManager* Manager = nullptr;
     inline static FbxImporter* Importer = nullptr;
     inline static FbxScene* Scene = nullptr;
@@ -0,0 +1,211 @@
+#include "SkeletalMeshSkinning.h"
+
+#include <cassert>
+#include <cmath>
+
+#include "Asset/SkeletalMeshAsset.h"
+#include "Math/MathSSE.h"
+#include "Math/Rotator.h"
+
+
+void FSkeletalMeshSkinning::RecalculateGlobalPoses(TArray<FSkeletonBone>& Bones)
+{
+    for (int32 i = 0; i < Bones.Num(); ++i)
+    {
+        FSkeletonBone& Bone = Bones[i];
+        if (Bone.ParentIndex == -1)
+        {
+            Bone.GlobalPose = Bone.LocalBindPose;
+        }
+        else
+        {
+            assert(Bone.ParentIndex < i);
+            Bone.GlobalPose = Bone.LocalBindPose * Bones[Bone.ParentIndex].GlobalPose;
+        }
+    }
+}
+
+void FSkeletalMeshSkinning::SetBoneRotation(TArray<FSkeletonBone>& Bones, int32 BoneIndex, const FRotator& Rotation)
+{
+    if (!Bones.IsValidIndex(BoneIndex))
+    {
+        return;
+    }
+
+    FSkeletonBone& Bone = Bones[BoneIndex];
+
+    const FMatrix NewRotation = FMatrix::CreateRotationMatrix(Rotation.Roll, Rotation.Pitch, Rotation.Yaw);
+
+    // 기존 로컬 바인드 포즈에서 위치와 스케일 분리
+    const FVector Translation = Bone.LocalBindPose.GetTranslationVector();
+    const FVector Scale = Bone.LocalBindPose.GetScaleVector();
+
+    Bone.LocalBindPose = FMatrix::GetScaleMatrix(Scale) * NewRotation * FMatrix::GetTranslationMatrix(Translation);
+
+    RecalculateGlobalPoses(Bones);
+}
+
+void FSkeletalMeshSkinning::BuildPalette(const TArray<FSkeletonBone>& Bones, TArray<FMatrix>& OutPalette)
+{
+    OutPalette.SetNum(Bones.Num());
+    for (int32 i = 0; i < Bones.Num(); ++i)
+    {
+        OutPalette[i] = Bones[i].InverseBindPose * Bones[i].GlobalPose;
+    }
+}
+
+void FSkeletalMeshSkinning::SkinVerticesScalar(
+    const FSkeletalMeshVertex* BindVertices, const FSkeletalMeshBoneWeight* Weights, int32 NumVertices,
+    const FMatrix* Palette, FSkeletalMeshVertex* OutVertices
+)
+{
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        const FSkeletalMeshVertex& Bind = BindVertices[VertexIndex];
+        const FSkeletalMeshBoneWeight& Weight = Weights[VertexIndex];
+        FSkeletalMeshVertex& Out = OutVertices[VertexIndex];
+
+        Out = Bind;
+
+        // 가중치는 큰 순서로 구워져 있으므로 첫 값이 0이면 영향받는 본이 없음
+        if (Weight.Weights[0] <= 0.0f)
+        {
+            continue;
+        }
+
+        float M[4][4] = {};
+        for (int32 Influence = 0; Influence < MaxBoneInfluences; ++Influence)
+        {
+            const float W = Weight.Weights[Influence];
+            const FMatrix& Bone = Palette[Weight.BoneIndices[Influence]];
+            for (int32 Row = 0; Row < 4; ++Row)
+            {
+                for (int32 Col = 0; Col < 4; ++Col)
+                {
+                    M[Row][Col] += W * Bone.M[Row][Col];
+                }
+            }
+        }
+
+        Out.X = Bind.X * M[0][0] + Bind.Y * M[1][0] + Bind.Z * M[2][0] + M[3][0];
+        Out.Y = Bind.X * M[0][1] + Bind.Y * M[1][1] + Bind.Z * M[2][1] + M[3][1];
+        Out.Z = Bind.X * M[0][2] + Bind.Y * M[1][2] + Bind.Z * M[2][2] + M[3][2];
+
+        float NX = Bind.NormalX * M[0][0] + Bind.NormalY * M[1][0] + Bind.NormalZ * M[2][0];
+        float NY = Bind.NormalX * M[0][1] + Bind.NormalY * M[1][1] + Bind.NormalZ * M[2][1];
+        float NZ = Bind.NormalX * M[0][2] + Bind.NormalY * M[1][2] + Bind.NormalZ * M[2][2];
+        const float NormalLengthSquared = NX * NX + NY * NY + NZ * NZ;
+        if (NormalLengthSquared > 0.0f)
+        {
+            const float InvLength = 1.0f / std::sqrt(NormalLengthSquared);
+            NX *= InvLength;
+            NY *= InvLength;
+            NZ *= InvLength;
+        }
+        Out.NormalX = NX;
+        Out.NormalY = NY;
+        Out.NormalZ = NZ;
+
+        Out.TangentX = Bind.TangentX * M[0][0] + Bind.TangentY * M[1][0] + Bind.TangentZ * M[2][0];
+        Out.TangentY = Bind.TangentX * M[0][1] + Bind.TangentY * M[1][1] + Bind.TangentZ * M[2][1];
+        Out.TangentZ = Bind.TangentX * M[0][2] + Bind.TangentY * M[1][2] + Bind.TangentZ * M[2][2];
+    }
+}
+
+void FSkeletalMeshSkinning::SkinVerticesSIMD(
+    const FSkeletalMeshVertex* BindVertices, const FSkeletalMeshBoneWeight* Weights, int32 NumVertices,
+    const FMatrix* Palette, FSkeletalMeshVertex* OutVertices
+)
+{
+    using namespace SSE;
+
+    alignas(16) float Result[4];
+
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        const FSkeletalMeshVertex& Bind = BindVertices[VertexIndex];
+        const FSkeletalMeshBoneWeight& Weight = Weights[VertexIndex];
+        FSkeletalMeshVertex& Out = OutVertices[VertexIndex];
+
+        Out = Bind;
+
+        if (Weight.Weights[0] <= 0.0f)
+        {
+            continue;
+        }
+
+        // 남는 슬롯은 가중치 0, 인덱스 0으로 구워져 있으므로 분기 없이 4개를 모두 섞음
+        VectorRegister4Float R0, R1, R2, R3;
+        {
+            const VectorRegister4Float W = VectorSetFloat1(Weight.Weights[0]);
+            const FMatrix& Bone = Palette[Weight.BoneIndices[0]];
+            R0 = VectorMultiply(W, VectorLoad(Bone.M[0]));
+            R1 = VectorMultiply(W, VectorLoad(Bone.M[1]));
+            R2 = VectorMultiply(W, VectorLoad(Bone.M[2]));
+            R3 = VectorMultiply(W, VectorLoad(Bone.M[3]));
+        }
+        for (int32 Influence = 1; Influence < MaxBoneInfluences; ++Influence)
+        {
+            const VectorRegister4Float W = VectorSetFloat1(Weight.Weights[Influence]);
+            const FMatrix& Bone = Palette[Weight.BoneIndices[Influence]];
+            R0 = VectorMultiplyAdd(W, VectorLoad(Bone.M[0]), R0);
+            R1 = VectorMultiplyAdd(W, VectorLoad(Bone.M[1]), R1);
+            R2 = VectorMultiplyAdd(W, VectorLoad(Bone.M[2]), R2);
+            R3 = VectorMultiplyAdd(W, VectorLoad(Bone.M[3]), R3);
+        }
+
+        // 위치: x * R0 + y * R1 + z * R2 + R3
+        VectorRegister4Float Position = VectorMultiplyAdd(VectorSetFloat1(Bind.X), R0, R3);
+        Position = VectorMultiplyAdd(VectorSetFloat1(Bind.Y), R1, Position);
+        Position = VectorMultiplyAdd(VectorSetFloat1(Bind.Z), R2, Position);
+        VectorStore(Position, Result);
+        Out.X = Result[0];
+        Out.Y = Result[1];
+        Out.Z = Result[2];
+
+        // 노말: 평행이동 없이 변환한 뒤 정규화
+        const VectorRegister4Float BindNormal = VectorLoad(&Bind.NormalX);
+        VectorRegister4Float Normal = VectorMultiply(VectorReplicate(BindNormal, 0), R0);
+        Normal = VectorMultiplyAdd(VectorReplicate(BindNormal, 1), R1, Normal);
+        Normal = VectorMultiplyAdd(VectorReplicate(BindNormal, 2), R2, Normal);
+        const VectorRegister4Float LengthSquared = _mm_dp_ps(Normal, Normal, 0x7F);
+        if (_mm_cvtss_f32(LengthSquared) > 0.0f)
+        {
+            Normal = _mm_div_ps(Normal, _mm_sqrt_ps(LengthSquared));
+        }
+        VectorStore(Normal, Result);
+        Out.NormalX = Result[0];
+        Out.NormalY = Result[1];
+        Out.NormalZ = Result[2];
+
+        // 탄젠트: W(손잡이 방향)는 유지
+        const VectorRegister4Float BindTangent = VectorLoad(&Bind.TangentX);
+        VectorRegister4Float Tangent = VectorMultiply(VectorReplicate(BindTangent, 0), R0);
+        Tangent = VectorMultiplyAdd(VectorReplicate(BindTangent, 1), R1, Tangent);
+        Tangent = VectorMultiplyAdd(VectorReplicate(BindTangent, 2), R2, Tangent);
+        VectorStore(Tangent, Result);
+        Out.TangentX = Result[0];
+        Out.TangentY = Result[1];
+        Out.TangentZ = Result[2];
+    }
+}
+
+void FSkeletalMeshSkinning::UpdateSkinnedVertices(FSkeletalMeshRenderData& RenderData)
+{
+    RenderData.bPoseDirty = false;
+
+    const int32 NumVertices = RenderData.BindPoseVertices.Num();
+    if (NumVertices == 0 || RenderData.SkeletonBones.Num() == 0 || RenderData.BoneWeights.Num() != NumVertices)
+    {
+        return;
+    }
+
+    BuildPalette(RenderData.SkeletonBones, RenderData.BonePalette);
+
+    RenderData.Vertices.SetNum(NumVertices);
+    SkinVerticesSIMD(
+        RenderData.BindPoseVertices.GetData(), RenderData.BoneWeights.GetData(), NumVertices,
+        RenderData.BonePalette.GetData(), RenderData.Vertices.GetData()
+    );
+    RenderData.bBVHDirty = true;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "HAL/PlatformType.h"
+#include "Container/Array.h"
+#include "Math/Matrix.h"
+
+struct FRotator;
+struct FSkeletonBone;
+struct FSkeletalMeshVertex;
+struct FSkeletalMeshBoneWeight;
+struct FSkeletalMeshRenderData;
+
+
+/**
+ * FBX SDK 없이 임포트 때 구워둔 본 가중치와 바인드 포즈만으로 스키닝합니다.
+ * 팔레트 행렬은 행 벡터 규약을 따릅니다: Skinned = Bind * (InverseBindPose * GlobalPose)
+ */
+struct FSkeletalMeshSkinning
+{
+public:
+    static constexpr int32 MaxBoneInfluences = 4;
+
+    /**
+     * true면 렌더러가 정점 셰이더에서 스키닝하고 CPU의 Vertices는 갱신하지 않습니다. (본이 MAX_SKINNING_BONES 이하인 메시만)
+     * 이 경우 Vertices를 사용하는 피킹은 마지막으로 CPU 스키닝한 포즈 기준으로 동작합니다.
+     */
+    inline static bool bUseGPUSkinning = false;
+
+    /**
+     * 부모가 앞에 오는 순서로 LocalBindPose를 누적해 GlobalPose를 계산합니다.
+     * @param Bones 부모 인덱스가 자신보다 작은 본 배열
+     */
+    static void RecalculateGlobalPoses(TArray<FSkeletonBone>& Bones);
+
+    /**
+     * 본의 로컬 회전만 교체하고 GlobalPose를 갱신합니다. (위치와 스케일은 유지)
+     * @param Bones 본 배열
+     * @param BoneIndex 회전할 본
+     * @param Rotation 새 로컬 회전
+     */
+    static void SetBoneRotation(TArray<FSkeletonBone>& Bones, int32 BoneIndex, const FRotator& Rotation);
+
+    /**
+     * 본마다 InverseBindPose * GlobalPose를 계산합니다.
+     * @param Bones GlobalPose가 갱신된 본 배열
+     * @param OutPalette 본 인덱스 순서의 스키닝 행렬
+     */
+    static void BuildPalette(const TArray<FSkeletonBone>& Bones, TArray<FMatrix>& OutPalette);
+
+    /**
+     * 기준 구현, 정점마다 팔레트 행렬을 가중합한 뒤 위치/노말/탄젠트를 변환합니다.
+     * @param BindVertices 바인드 포즈 정점
+     * @param Weights BindVertices와 같은 순서의 본 가중치
+     * @param NumVertices 정점 수
+     * @param Palette BuildPalette의 결과
+     * @param OutVertices 결과 정점, 위치/노말/탄젠트 외의 값은 BindVertices에서 복사
+     */
+    static void SkinVerticesScalar(
+        const FSkeletalMeshVertex* BindVertices, const FSkeletalMeshBoneWeight* Weights, int32 NumVertices,
+        const FMatrix* Palette, FSkeletalMeshVertex* OutVertices
+    );
+
+    /** SkinVerticesScalar와 같은 결과를 SSE로 계산합니다. */
+    static void SkinVerticesSIMD(
+        const FSkeletalMeshVertex* BindVertices, const FSkeletalMeshBoneWeight* Weights, int32 NumVertices,
+        const FMatrix* Palette, FSkeletalMeshVertex* OutVertices
+    );
+
+    /**
+     * 현재 포즈로 RenderData.Vertices를 다시 계산하고 bPoseDirty를 내립니다.
+     * @param RenderData BindPoseVertices와 BoneWeights가 구워진 메시
+     */
+    static void UpdateSkinnedVertices(FSkeletalMeshRenderData& RenderData);
+};
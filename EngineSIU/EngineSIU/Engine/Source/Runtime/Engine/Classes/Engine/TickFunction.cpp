@@ -0,0 +1,136 @@
+#include "TickFunction.h"
+
+#include "TickTaskManager.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+
+
+const char* GetTickingGroupName(ETickingGroup Group)
+{
+    switch (Group)
+    {
+    case TG_PrePhysics:
+        return "PrePhysics";
+    case TG_DuringPhysics:
+        return "DuringPhysics";
+    case TG_PostPhysics:
+        return "PostPhysics";
+    case TG_PostUpdateWork:
+        return "PostUpdateWork";
+    default:
+        return "Unknown";
+    }
+}
+
+FTickFunction::~FTickFunction()
+{
+    UnRegisterTickFunction();
+
+    // 파괴된 함수를 가리키는 관계가 남지 않도록 양쪽 모두 정리
+    for (FTickFunction* Prerequisite : Prerequisites)
+    {
+        Prerequisite->Dependents.RemoveSingle(this);
+    }
+    for (FTickFunction* Dependent : Dependents)
+    {
+        Dependent->Prerequisites.RemoveSingle(this);
+        if (Dependent->Manager)
+        {
+            Dependent->Manager->MarkOrderDirty();
+        }
+    }
+}
+
+void FTickFunction::RegisterTickFunction(FTickTaskManager* InManager)
+{
+    if (!bCanEverTick || !InManager || Manager == InManager)
+    {
+        return;
+    }
+
+    UnRegisterTickFunction();
+    InManager->AddTickFunction(this);
+}
+
+void FTickFunction::UnRegisterTickFunction()
+{
+    if (Manager)
+    {
+        Manager->RemoveTickFunction(this);
+    }
+}
+
+void FTickFunction::SetTickGroup(ETickingGroup InTickGroup)
+{
+    TickGroup = InTickGroup;
+    if (Manager)
+    {
+        Manager->MarkOrderDirty();
+    }
+}
+
+void FTickFunction::SetRunOnAnyThread(bool bInRunOnAnyThread)
+{
+    if (bRunOnAnyThread == bInRunOnAnyThread)
+    {
+        return;
+    }
+
+    bRunOnAnyThread = bInRunOnAnyThread;
+    if (Manager)
+    {
+        Manager->MarkOrderDirty();
+    }
+}
+
+void FTickFunction::AddPrerequisite(FTickFunction* Prerequisite)
+{
+    if (!Prerequisite || Prerequisite == this || Prerequisites.Contains(Prerequisite))
+    {
+        return;
+    }
+
+    Prerequisites.Add(Prerequisite);
+    Prerequisite->Dependents.Add(this);
+
+    if (Manager)
+    {
+        Manager->MarkOrderDirty();
+    }
+}
+
+void FTickFunction::RemovePrerequisite(FTickFunction* Prerequisite)
+{
+    if (!Prerequisite || !Prerequisites.RemoveSingle(Prerequisite))
+    {
+        return;
+    }
+
+    Prerequisite->Dependents.RemoveSingle(this);
+
+    if (Manager)
+    {
+        Manager->MarkOrderDirty();
+    }
+}
+
+void FActorTickFunction::ExecuteTick(float DeltaTime)
+{
+    Target->Tick(DeltaTime);
+}
+
+bool FActorTickFunction::ShouldTickInEditor() const
+{
+    return Target->IsActorTickInEditor();
+}
+
+void FActorComponentTickFunction::ExecuteTick(float DeltaTime)
+{
+    Target->TickComponent(DeltaTime);
+}
+
+bool FActorComponentTickFunction::ShouldTickInEditor() const
+{
+    const AActor* Owner = Target->GetOwner();
+    return Owner && Owner->IsActorTickInEditor();
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+class AActor;
+class UActorComponent;
+class FTickTaskManager;
+
+/**
+ * Tick 순서를 정하는 그룹입니다. 앞 그룹의 Tick이 모두 끝난 뒤 다음 그룹이 실행됩니다.
+ * 아직 물리 시뮬레이션은 없으므로 Physics 그룹들은 이동 전/후를 나누는 순서 슬롯으로만 사용합니다.
+ */
+enum ETickingGroup : uint8
+{
+    /** 입력, 이동 등 이번 프레임의 위치를 정하는 로직 */
+    TG_PrePhysics,
+    /** 이동과 함께 돌아도 되는 로직 */
+    TG_DuringPhysics,
+    /** 이동이 끝난 위치를 읽는 로직 (오버랩, 스프링 암) */
+    TG_PostPhysics,
+    /** 프레임의 마지막 갱신 (카메라 등) */
+    TG_PostUpdateWork,
+
+    TG_MAX,
+};
+
+/** 통계 표시용 그룹 이름 */
+const char* GetTickingGroupName(ETickingGroup Group);
+
+
+/**
+ * FTickTaskManager에 등록되어 매 프레임 호출되는 Tick 단위입니다.
+ * 등록된 함수만 그룹별 배열에 들어가므로 Tick하지 않는 객체는 순회 비용이 없습니다.
+ */
+struct FTickFunction
+{
+public:
+    FTickFunction() = default;
+    virtual ~FTickFunction();
+
+    FTickFunction(const FTickFunction&) = delete;
+    FTickFunction& operator=(const FTickFunction&) = delete;
+
+    /**
+     * 실제 Tick을 수행합니다.
+     * @param DeltaTime 마지막 Tick 이후 흐른 시간, TickInterval이 있으면 그동안 누적된 시간
+     */
+    virtual void ExecuteTick(float DeltaTime) = 0;
+
+    /** bTickInEditor인 Actor처럼 Editor World에서도 Tick해야 하는지 */
+    virtual bool ShouldTickInEditor() const { return false; }
+
+    /**
+     * 매니저에 등록하거나 해제합니다. bCanEverTick이 false면 등록하지 않습니다.
+     * @param Manager 등록할 World의 매니저
+     */
+    void RegisterTickFunction(FTickTaskManager* Manager);
+    void UnRegisterTickFunction();
+    bool IsTickFunctionRegistered() const { return Manager != nullptr; }
+
+    /** 등록은 유지한 채로 Tick을 멈추거나 재개합니다. */
+    void SetTickFunctionEnable(bool bInEnabled) { bTickEnabled = bInEnabled; }
+    bool IsTickFunctionEnabled() const { return bTickEnabled; }
+
+    /** 등록된 상태에서 바꾸면 다음 Tick 전에 실행 순서를 다시 계산합니다. */
+    void SetTickGroup(ETickingGroup InTickGroup);
+    ETickingGroup GetTickGroup() const { return TickGroup; }
+
+    void SetRunOnAnyThread(bool bInRunOnAnyThread);
+    bool RunsOnAnyThread() const { return bRunOnAnyThread; }
+
+    /**
+     * 0이면 매 프레임, 0보다 크면 그 간격(초)마다 Tick합니다.
+     * @param InTickInterval Tick 간격
+     */
+    void SetTickInterval(float InTickInterval) { TickInterval = InTickInterval; }
+    float GetTickInterval() const { return TickInterval; }
+
+    /**
+     * Prerequisite가 이번 프레임에 Tick한 뒤에 이 함수가 Tick하도록 합니다.
+     * Prerequisite가 더 늦은 그룹이면 이 함수도 그 그룹에서 실행됩니다.
+     * @param Prerequisite 먼저 실행되어야 하는 함수, 둘 중 하나가 파괴되면 관계도 자동으로 제거됨
+     */
+    void AddPrerequisite(FTickFunction* Prerequisite);
+    void RemovePrerequisite(FTickFunction* Prerequisite);
+
+public:
+    /** false면 RegisterTickFunction을 호출해도 등록되지 않습니다. (Tick 참여 여부) */
+    uint8 bCanEverTick : 1 = false;
+
+private:
+    friend class FTickTaskManager;
+
+    /** TG_PrePhysics부터 TG_PostUpdateWork까지, 실행 순서 */
+    ETickingGroup TickGroup = TG_PrePhysics;
+
+    /** 이 값을 바꾸는 스레드와 무관하게 매니저는 다음 정렬 때 반영함 */
+    uint8 bRunOnAnyThread : 1 = false;
+    uint8 bTickEnabled : 1 = true;
+
+    float TickInterval = 0.0f;
+
+    /** TickInterval이 있을 때 다음 Tick까지 남은 시간과 그동안 누적된 DeltaTime */
+    float TimeUntilNextTick = 0.0f;
+    float AccumulatedDeltaTime = 0.0f;
+
+    TArray<FTickFunction*> Prerequisites;
+
+    /** 이 함수를 Prerequisite로 가진 함수들, 파괴될 때 관계를 끊기 위해 유지 */
+    TArray<FTickFunction*> Dependents;
+
+    FTickTaskManager* Manager = nullptr;
+
+    /** 매니저의 등록 배열 내 위치, O(1) 해제용 */
+    int32 RegisteredIndex = INDEX_NONE;
+
+    /** Prerequisite 때문에 늦춰질 수 있는 실제 실행 그룹과 정렬 중 방문 상태 */
+    ETickingGroup ActualTickGroup = TG_PrePhysics;
+    uint8 SortState = 0;
+};
+
+
+/** AActor::Tick을 호출하는 Tick 함수 */
+struct FActorTickFunction : public FTickFunction
+{
+    AActor* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime) override;
+    virtual bool ShouldTickInEditor() const override;
+};
+
+
+/** UActorComponent::TickComponent를 호출하는 Tick 함수, 소유 Actor의 bTickInEditor를 따릅니다. */
+struct FActorComponentTickFunction : public FTickFunction
+{
+    UActorComponent* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime) override;
+    virtual bool ShouldTickInEditor() const override;
+};
@@ -0,0 +1,229 @@
+#include "TickTaskManager.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "WindowsPlatformTime.h"
+#include "Async/JobSystem.h"
+
+
+namespace
+{
+enum ESortState : uint8
+{
+    Unvisited,
+    Visiting,
+    Visited,
+};
+}
+
+
+FTickTaskManager::~FTickTaskManager()
+{
+    // 남은 함수는 객체보다 매니저가 먼저 사라지는 경우(World 해제)이므로 연결만 끊음
+    while (TickFunctions.Num() > 0)
+    {
+        RemoveTickFunction(TickFunctions[TickFunctions.Num() - 1]);
+    }
+}
+
+void FTickTaskManager::Tick(float DeltaTime, bool bIsEditorWorld)
+{
+    if (bOrderDirty.exchange(false))
+    {
+        RebuildTickOrder();
+    }
+
+    for (int32 GroupIndex = 0; GroupIndex < TG_MAX; ++GroupIndex)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        std::atomic<uint32> NumTicked = 0;
+
+        const TArray<FTickFunction*>& ParallelFunctions = ParallelTickOrder[GroupIndex];
+        FJobSystem::ParallelFor(ParallelFunctions.Num(), [&](int32 Index)
+        {
+            FTickFunction* Function = ParallelFunctions[Index];
+            float FunctionDeltaTime;
+            if (Function->Manager == this && ShouldExecute(Function, DeltaTime, bIsEditorWorld, FunctionDeltaTime))
+            {
+                Function->ExecuteTick(FunctionDeltaTime);
+                NumTicked.fetch_add(1, std::memory_order_relaxed);
+            }
+        }, 16);
+
+        for (FTickFunction* Function : SerialTickOrder[GroupIndex])
+        {
+            // Manager가 다르면 이번 프레임 Tick 도중 해제됨 (객체는 프레임이 끝난 뒤 삭제되므로 포인터는 아직 유효)
+            float FunctionDeltaTime;
+            if (Function->Manager == this && ShouldExecute(Function, DeltaTime, bIsEditorWorld, FunctionDeltaTime))
+            {
+                Function->ExecuteTick(FunctionDeltaTime);
+                NumTicked.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        FTickGroupStats& Stats = GroupStats[GroupIndex];
+        Stats.NumTicked = NumTicked.load();
+        Stats.NumRegistered = ParallelFunctions.Num() + SerialTickOrder[GroupIndex].Num();
+        Stats.Milliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+}
+
+void FTickTaskManager::AddTickFunction(FTickFunction* Function)
+{
+    assert(Function->Manager == nullptr);
+
+    Function->Manager = this;
+    Function->RegisteredIndex = TickFunctions.Add(Function);
+    Function->TimeUntilNextTick = 0.0f;
+    Function->AccumulatedDeltaTime = 0.0f;
+
+    MarkOrderDirty();
+}
+
+void FTickTaskManager::RemoveTickFunction(FTickFunction* Function)
+{
+    assert(Function->Manager == this);
+
+    const int32 Index = Function->RegisteredIndex;
+    FTickFunction* Last = TickFunctions[TickFunctions.Num() - 1];
+    TickFunctions[Index] = Last;
+    Last->RegisteredIndex = Index;
+    TickFunctions.Pop();
+
+    Function->Manager = nullptr;
+    Function->RegisteredIndex = INDEX_NONE;
+
+    MarkOrderDirty();
+}
+
+ETickingGroup FTickTaskManager::ResolveTickGroup(FTickFunction* Function)
+{
+    if (Function->SortState == Visited)
+    {
+        return Function->ActualTickGroup;
+    }
+    if (Function->SortState == Visiting)
+    {
+        // 순환하는 Prerequisite는 자기 그룹을 그대로 사용
+        return Function->TickGroup;
+    }
+
+    Function->SortState = Visiting;
+
+    ETickingGroup Group = Function->TickGroup;
+    for (FTickFunction* Prerequisite : Function->Prerequisites)
+    {
+        if (Prerequisite->Manager == this)
+        {
+            Group = std::max(Group, ResolveTickGroup(Prerequisite));
+        }
+    }
+
+    Function->ActualTickGroup = Group;
+    Function->SortState = Visited;
+    return Group;
+}
+
+void FTickTaskManager::RebuildTickOrder()
+{
+    for (int32 GroupIndex = 0; GroupIndex < TG_MAX; ++GroupIndex)
+    {
+        SerialTickOrder[GroupIndex].Empty();
+        ParallelTickOrder[GroupIndex].Empty();
+    }
+
+    for (FTickFunction* Function : TickFunctions)
+    {
+        Function->SortState = Unvisited;
+    }
+    for (FTickFunction* Function : TickFunctions)
+    {
+        ResolveTickGroup(Function);
+    }
+
+    // 같은 그룹 안의 Prerequisite가 먼저 오도록 등록 순서를 기준으로 깊이 우선 정렬
+    for (FTickFunction* Function : TickFunctions)
+    {
+        Function->SortState = Unvisited;
+    }
+
+    const auto Visit = [this](auto& Self, FTickFunction* Function) -> void
+    {
+        if (Function->SortState != Unvisited)
+        {
+            // Visiting이면 순환, 이미 앞에서 처리된 관계이므로 무시
+            return;
+        }
+        Function->SortState = Visiting;
+
+        bool bHasPrerequisite = false;
+        for (FTickFunction* Prerequisite : Function->Prerequisites)
+        {
+            if (Prerequisite->Manager != this)
+            {
+                continue;
+            }
+            bHasPrerequisite = true;
+            if (Prerequisite->ActualTickGroup == Function->ActualTickGroup)
+            {
+                Self(Self, Prerequisite);
+            }
+        }
+
+        Function->SortState = Visited;
+
+        // 워커에서 먼저 실행되는 함수는 다른 함수를 기다릴 수 없음
+        if (Function->bRunOnAnyThread && !bHasPrerequisite)
+        {
+            ParallelTickOrder[Function->ActualTickGroup].Add(Function);
+        }
+        else
+        {
+            SerialTickOrder[Function->ActualTickGroup].Add(Function);
+        }
+    };
+
+    for (FTickFunction* Function : TickFunctions)
+    {
+        Visit(Visit, Function);
+    }
+}
+
+bool FTickTaskManager::ShouldExecute(FTickFunction* Function, float DeltaTime, bool bIsEditorWorld, float& OutDeltaTime)
+{
+    if (!Function->bTickEnabled)
+    {
+        return false;
+    }
+
+    if (bIsEditorWorld && !Function->ShouldTickInEditor())
+    {
+        return false;
+    }
+
+    if (Function->TickInterval <= 0.0f)
+    {
+        OutDeltaTime = DeltaTime;
+        return true;
+    }
+
+    Function->AccumulatedDeltaTime += DeltaTime;
+    Function->TimeUntilNextTick -= DeltaTime;
+    if (Function->TimeUntilNextTick > 0.0f)
+    {
+        return false;
+    }
+
+    OutDeltaTime = Function->AccumulatedDeltaTime;
+    Function->AccumulatedDeltaTime = 0.0f;
+
+    // 긴 프레임 뒤에 밀린 횟수만큼 몰아서 실행하지 않도록 한 번만 실행하고 간격을 다시 채움
+    Function->TimeUntilNextTick += Function->TickInterval;
+    if (Function->TimeUntilNextTick <= 0.0f)
+    {
+        Function->TimeUntilNextTick = Function->TickInterval;
+    }
+    return true;
+}
+
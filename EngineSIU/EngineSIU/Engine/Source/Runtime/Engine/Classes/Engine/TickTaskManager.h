@@ -0,0 +1,85 @@
+#pragma once
+#include <atomic>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "TickFunction.h"
+
+
+/** 그룹 하나의 지난 프레임 Tick 통계 (stat tick) */
+struct FTickGroupStats
+{
+    /** 실제로 ExecuteTick이 호출된 수 */
+    uint32 NumTicked = 0;
+
+    /** 그룹에 등록된 함수 수 */
+    uint32 NumRegistered = 0;
+
+    double Milliseconds = 0.0;
+};
+
+
+/**
+ * World 하나에 등록된 Tick 함수들을 그룹 순서대로 실행합니다.
+ * 그룹마다 Prerequisite를 반영한 실행 순서를 캐시해 두고, 등록/해제나 설정 변경이 있을 때만 다시 정렬합니다.
+ * 그룹 안에서는 bRunOnAnyThread이고 Prerequisite가 없는 함수를 먼저 워커 스레드에서 실행한 뒤(배리어),
+ * 나머지를 메인 스레드에서 순서대로 실행합니다.
+ *
+ * @note 워커 단계는 SetRunOnAnyThread(true)로 직접 옵트인한 함수만 실행합니다.
+ *       현재는 UProjectileMovementComponent, USkySphereComponent, UParticleSubUVComponent처럼 소유 Actor 안의 상태만 바꾸는 컴포넌트뿐이고,
+ *       Actor Tick과 World, GEngine, Lua를 건드리는 나머지 컴포넌트는 모두 메인 스레드 단계에서 실행됩니다.
+ */
+class FTickTaskManager
+{
+public:
+    FTickTaskManager() = default;
+    ~FTickTaskManager();
+
+    FTickTaskManager(const FTickTaskManager&) = delete;
+    FTickTaskManager& operator=(const FTickTaskManager&) = delete;
+
+    /**
+     * 모든 그룹을 실행합니다. Tick 도중 등록된 함수는 다음 프레임부터 실행됩니다.
+     * @param DeltaTime 프레임 시간
+     * @param bIsEditorWorld true면 ShouldTickInEditor인 함수만 실행
+     */
+    void Tick(float DeltaTime, bool bIsEditorWorld);
+
+    const FTickGroupStats& GetGroupStats(ETickingGroup Group) const { return GroupStats[Group]; }
+
+    int32 GetNumRegistered() const { return TickFunctions.Num(); }
+
+private:
+    friend struct FTickFunction;
+
+    /** 등록과 해제는 메인 스레드에서만 호출합니다. */
+    void AddTickFunction(FTickFunction* Function);
+    void RemoveTickFunction(FTickFunction* Function);
+
+    void MarkOrderDirty() { bOrderDirty.store(true); }
+
+    /** Prerequisite를 따라 그룹을 늦추고, 그룹별로 위상 정렬합니다. */
+    void RebuildTickOrder();
+
+    /** Prerequisite 중 가장 늦은 그룹과 자기 그룹 중 늦은 쪽을 ActualTickGroup으로 정합니다. */
+    ETickingGroup ResolveTickGroup(FTickFunction* Function);
+
+    /**
+     * 이번 프레임에 실행할지 판단하고 TickInterval을 처리합니다.
+     * @param OutDeltaTime 실행한다면 넘길 DeltaTime
+     */
+    static bool ShouldExecute(FTickFunction* Function, float DeltaTime, bool bIsEditorWorld, float& OutDeltaTime);
+
+private:
+    /** 등록 순서 배열, 해제 시 마지막 원소와 자리를 바꿈 */
+    TArray<FTickFunction*> TickFunctions;
+
+    /** 그룹별 실행 순서 (Prerequisite 반영), 워커에서 먼저 실행할 함수는 ParallelTickOrder에 분리 */
+    TArray<FTickFunction*> SerialTickOrder[TG_MAX];
+    TArray<FTickFunction*> ParallelTickOrder[TG_MAX];
+
+    /** 워커 스레드에서 SetRunOnAnyThread를 호출할 수 있으므로 atomic */
+    std::atomic<bool> bOrderDirty = false;
+
+    FTickGroupStats GroupStats[TG_MAX];
+};
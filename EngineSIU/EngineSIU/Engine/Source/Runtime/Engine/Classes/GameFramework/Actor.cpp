@@ -5,6 +5,7 @@
 
 AActor::AActor()
 {
+    PrimaryActorTick.Target = this;
     RootComponent = AddComponent<USceneComponent>();
 }
 
@@ -14,87 +15,83 @@ void AActor::PostSpawnInitialize()
 
 UObject* AActor::Duplicate(UObject* InOuter)
 {
+    assert(FObjectDuplicator::GetActive() && "Actor는 UWorld::DuplicateActor나 World 복제를 통해 복제해야 합니다.");
+
+    // Owner, RootComponent 등 UPROPERTY는 UObject::Duplicate에서 복사됨
     ThisClass* NewActor = Cast<ThisClass>(Super::Duplicate(InOuter));
 
-    NewActor->Owner = Owner;
     NewActor->bTickInEditor = bTickInEditor;
-    // 기본적으로 있던 컴포넌트 제거
-    TSet CopiedComponents = NewActor->OwnedComponents;
+    NewActor->PrimaryActorTick.bCanEverTick = PrimaryActorTick.bCanEverTick;
+    NewActor->PrimaryActorTick.SetTickGroup(PrimaryActorTick.GetTickGroup());
+    NewActor->PrimaryActorTick.SetTickInterval(PrimaryActorTick.GetTickInterval());
 
-    //임시용 디폴트 컴포넌트 이름 저장
-    //TODO: 디퐅트 컴포넌트를 삭제하지 않고 그 컴포넌트에 프로퍼티를 복사하는 방법으로 변경 필요
-    TArray<FName> DefaultCopiedComponentNames;
-    for (UActorComponent* Components : CopiedComponents)
+    // PreallocateDuplicate에서 정해 둔 복제본에 값만 복사, 부모-자식 관계는 FixupReferences에서 복제본끼리 연결됨
+    for (UActorComponent* Component : OwnedComponents)
     {
-        if (Components)
+        UActorComponent* NewComponent = Cast<UActorComponent>(Component->Duplicate(NewActor));
+        NewComponent->OwnerPrivate = NewActor;
+        NewActor->OwnedComponents.Add(NewComponent);
+
+        // 컴포넌트 초기화
+        /* ActorComponent가 Actor와 World에 등록이 되었다는 전제하에 호출됩니다 */
+        if (!NewComponent->HasBeenInitialized())
         {
-            DefaultCopiedComponentNames.Add(Components->GetFName());
-            Components->DestroyComponent(true);
+            // TODO: RegisterComponent() 생기면 제거
+            NewComponent->InitializeComponent();
         }
     }
-    NewActor->OwnedComponents.Empty();
 
+    return NewActor;
+}
 
-    // 부모-자식 관계 저장용 맵
-    TMap<USceneComponent*, USceneComponent*> ParentChildMap;
+void AActor::PreallocateDuplicate(UObject* InOuter, FObjectDuplicator& Duplicator) const
+{
+    AActor* NewActor = Cast<AActor>(FObjectFactory::ConstructObject(GetClass(), InOuter));
+    Duplicator.AddDuplicate(this, NewActor);
 
-    // 컴포넌트 복제 및 부모-자식 관계 추적
-    TMap<USceneComponent*, USceneComponent*> OriginalToDuplicateMap; // 원본 -> 복제된 컴포넌트 매핑
+    // 생성자가 만든 기본 Component
+    TArray<UActorComponent*> DefaultComponents;
+    DefaultComponents.Reserve(static_cast<int32>(NewActor->OwnedComponents.Num()));
+    for (UActorComponent* DefaultComponent : NewActor->OwnedComponents)
+    {
+        DefaultComponents.Add(DefaultComponent);
+    }
 
     for (UActorComponent* Component : OwnedComponents)
     {
-
-        UActorComponent* NewComponent = Cast<UActorComponent>(Component->Duplicate(NewActor));
-        NewComponent->OwnerPrivate = NewActor;
-        NewActor->OwnedComponents.Add(NewComponent);
-
-        //디폴트 컴포넌트 이름 동일하게 
-        for (const auto DefaultCopiedName : DefaultCopiedComponentNames)
+        int32 MatchIndex = INDEX_NONE;
+        for (int32 Index = 0; Index < DefaultComponents.Num(); ++Index)
         {
-            if (DefaultCopiedName == Component->GetFName())
+            if (DefaultComponents[Index]->GetClass() != Component->GetClass())
             {
-                NewComponent->SetFName(DefaultCopiedName);
+                continue;
             }
-        }
-  
-        // RootComponent 설정
-        if (RootComponent == Component)
-        {
-            NewActor->RootComponent = static_cast<USceneComponent*>(NewComponent);
-        }
 
-        // 부모-자식 관계 저장 (USceneComponent만 해당)
-        if (USceneComponent* SceneComp = Cast<USceneComponent>(Component))
-        {
-            OriginalToDuplicateMap.Add(SceneComp, static_cast<USceneComponent*>(NewComponent));
-            if (USceneComponent* ParentComp = SceneComp->GetAttachParent())
+            MatchIndex = Index;
+            if (DefaultComponents[Index]->GetFName() == Component->GetFName())
             {
-                ParentChildMap.Add(static_cast<USceneComponent*>(NewComponent), ParentComp);
+                break;
             }
         }
 
-        // 컴포넌트 초기화
-        /* ActorComponent가 Actor와 World에 등록이 되었다는 전제하에 호출됩니다 */
-        if (!NewComponent->HasBeenInitialized())
+        if (MatchIndex != INDEX_NONE)
         {
-            // TODO: RegisterComponent() 생기면 제거
-            NewComponent->InitializeComponent();
+            Duplicator.AddDuplicate(Component, DefaultComponents[MatchIndex]);
+            DefaultComponents[MatchIndex] = DefaultComponents[DefaultComponents.Num() - 1];
+            DefaultComponents.Pop();
         }
-    }
-
-    // 부모-자식 관계 복원
-    for (const auto& [ChildComp, OriginalParentComp] : ParentChildMap)
-    {
-        // 복제된 부모를 찾아 설정
-        if (USceneComponent** NewParentComp = OriginalToDuplicateMap.Find(OriginalParentComp))
+        else
         {
-            ChildComp->AttachToComponent(*NewParentComp);
+            // 에디터에서 추가된 Component
+            Duplicator.AddDuplicate(Component, FObjectFactory::ConstructObject(Component->GetClass(), NewActor));
         }
     }
 
-    
-
-    return NewActor;
+    // 원본에서 삭제된 기본 Component, 남은 Component의 부착 관계는 복사될 값으로 덮어써지므로 자식은 제거하지 않음
+    for (UActorComponent* DefaultComponent : DefaultComponents)
+    {
+        DefaultComponent->DestroyComponent(false);
+    }
 }
 
 void AActor::BeginPlay()
@@ -109,13 +106,22 @@ void AActor::BeginPlay()
 
 void AActor::Tick(float DeltaTime)
 {
-    // TODO: 임시로 Actor에서 Tick 돌리기
+    // World에 등록된 Actor는 컴포넌트가 각자 FTickTaskManager에서 Tick됨
+    if (bTickFunctionsRegistered)
+    {
+        return;
+    }
+
+    // 기즈모, EditorPlayer처럼 World 밖에서 소유자가 직접 Tick하는 Actor
     // TODO: 나중에 삭제를 Pending으로 하던가 해서 복사비용 줄이기
     const auto CopyComponents = OwnedComponents;
 
     for (UActorComponent* Comp : CopyComponents)
     {
-        Comp->TickComponent(DeltaTime);
+        if (Comp->PrimaryComponentTick.bCanEverTick && Comp->IsActive())
+        {
+            Comp->TickComponent(DeltaTime);
+        }
     }
 }
 
@@ -137,7 +143,9 @@ void AActor::Destroyed()
 void AActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     // 본인이 소유하고 있는 모든 컴포넌트의 EndPlay 호출
-    for (UActorComponent* Component : GetComponents())
+    // EndPlay 안에서 컴포넌트가 제거되면 OwnedComponents의 원소가 옮겨지므로 복사본을 순회
+    const TArray<UActorComponent*> Components = OwnedComponents.Array();
+    for (UActorComponent* Component : Components)
     {
         if (Component->HasBegunPlay())
         {
@@ -198,6 +206,11 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
         OwnedComponents.Add(Component);
         Component->OwnerPrivate = this;
 
+        if (bTickFunctionsRegistered)
+        {
+            Component->RegisterComponentTickFunctions(true);
+        }
+
         // 만약 SceneComponent를 상속 받았다면
 
         if (bTryRootComponent)
@@ -223,6 +236,11 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
             Component->InitializeComponent();
         }
 
+        if (bComponentsRegisteredWithWorld)
+        {
+            Component->RegisterComponentWithWorld(true);
+        }
+
         return Component;
     }
     
@@ -264,6 +282,40 @@ void AActor::UninitializeComponents()
     }
 }
 
+void AActor::RegisterAllActorTickFunctions(bool bRegister)
+{
+    bTickFunctionsRegistered = bRegister;
+
+    for (UActorComponent* Component : OwnedComponents)
+    {
+        Component->RegisterComponentTickFunctions(bRegister);
+    }
+
+    if (!bRegister)
+    {
+        PrimaryActorTick.UnRegisterTickFunction();
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    if (World && World->GetTickTaskManager())
+    {
+        PrimaryActorTick.RegisterTickFunction(World->GetTickTaskManager());
+    }
+}
+
+void AActor::RegisterAllComponentsWithWorld(bool bRegister)
+{
+    bComponentsRegisteredWithWorld = bRegister;
+
+    // OnRegister/OnUnregister에서 컴포넌트를 추가/제거할 수 있으므로 복사본을 순회
+    const TArray<UActorComponent*> Components = OwnedComponents.Array();
+    for (UActorComponent* Component : Components)
+    {
+        Component->RegisterComponentWithWorld(bRegister);
+    }
+}
+
 bool AActor::SetRootComponent(USceneComponent* NewRootComponent)
 {
     if (NewRootComponent == nullptr || NewRootComponent->GetOwner() == this)
@@ -2,6 +2,7 @@
 #include "Components/SceneComponent.h"
 #include "Container/Set.h"
 #include "Engine/EngineTypes.h"
+#include "Engine/TickFunction.h"
 #include "UObject/Casts.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectFactory.h"
@@ -17,13 +18,27 @@ class AActor : public UObject
 {
     DECLARE_CLASS(AActor, UObject)
 
+    friend class ULevel;
+
 public:
     AActor();
 
     virtual void PostSpawnInitialize();
 
+    /**
+     * FObjectDuplicator가 활성화된 상태에서만 호출할 수 있습니다. (UWorld::DuplicateActor, World 복제)
+     * PreallocateDuplicate로 미리 만든 Actor와 Component에 값을 복사하며, 참조는 FixupReferences에서 정리됩니다.
+     */
     virtual UObject* Duplicate(UObject* InOuter) override;
 
+    /**
+     * 묶음 복제의 첫 단계로, 복제본 Actor를 생성하고 Component들의 복제본을 미리 정해 Duplicator에 등록합니다.
+     * 생성자가 만든 기본 Component는 버리지 않고 같은 Class(이름이 같으면 우선)의 원본 Component에 대응시킵니다.
+     * @param InOuter 복제본의 Outer (World)
+     * @param Duplicator 활성화된 Duplicator
+     */
+    void PreallocateDuplicate(UObject* InOuter, FObjectDuplicator& Duplicator) const;
+
     /** Actor가 게임에 배치되거나 스폰될 때 호출됩니다. */
     virtual void BeginPlay();
 
@@ -67,7 +82,10 @@ public:
     /** Actor가 가지고 있는 Component를 제거합니다. */
     void RemoveOwnedComponent(UActorComponent* Component);
 
-    /** Actor가 가지고 있는 모든 컴포넌트를 가져옵니다. */
+    /**
+     * Actor가 가지고 있는 모든 컴포넌트를 가져옵니다.
+     * @note 순회 중에 컴포넌트를 추가/제거할 수 있다면 GetComponents().Array()로 복사해서 순회해야 합니다.
+     */
     const TSet<UActorComponent*>& GetComponents() const { return OwnedComponents; }
 
     template<typename T>
@@ -77,6 +95,20 @@ public:
     void InitializeComponents();
     void UninitializeComponents();
 
+    /**
+     * PrimaryActorTick과 모든 컴포넌트의 Tick 함수를 World의 FTickTaskManager에 등록하거나 해제합니다.
+     * 등록된 동안 새로 추가되는 컴포넌트도 자동으로 등록됩니다.
+     * @param bRegister false면 해제
+     */
+    void RegisterAllActorTickFunctions(bool bRegister);
+
+    /**
+     * 모든 컴포넌트를 World의 시스템(Scene의 공간 인덱스 등)에 등록하거나 해제합니다.
+     * 등록된 동안 새로 추가되는 컴포넌트도 자동으로 등록됩니다.
+     * @param bRegister false면 해제
+     */
+    void RegisterAllComponentsWithWorld(bool bRegister);
+
 public:
     USceneComponent* GetRootComponent() const { return RootComponent; }
     bool SetRootComponent(USceneComponent* NewRootComponent);
@@ -113,6 +145,22 @@ private:
     /** 현재 Actor가 삭제 처리중인지 여부 */
     uint8 bActorIsBeingDestroyed : 1 = false;
 
+    /** RegisterAllActorTickFunctions(true)가 호출되었는지 여부 */
+    uint8 bTickFunctionsRegistered : 1 = false;
+
+    /** RegisterAllComponentsWithWorld(true)가 호출되었는지 여부 */
+    uint8 bComponentsRegisteredWithWorld : 1 = false;
+
+    /** ULevel::Actors에서의 위치, Level에서 O(1)로 제거하기 위해 사용 */
+    int32 LevelActorIndex = INDEX_NONE;
+
+public:
+    /**
+     * Tick을 호출하는 Tick 함수, 생성자에서 bCanEverTick을 켠 Actor만 등록됩니다.
+     * 컴포넌트는 각자의 PrimaryComponentTick으로 따로 Tick합니다.
+     */
+    FActorTickFunction PrimaryActorTick;
+
 #if 1 // TODO: WITH_EDITOR 추가
 public:
     /** Actor의 기본 Label을 가져옵니다. */
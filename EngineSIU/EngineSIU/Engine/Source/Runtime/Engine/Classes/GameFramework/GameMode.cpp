@@ -16,6 +16,7 @@ AGameMode::AGameMode()
     //LuaScriptComp->GetOuter()->
 
     SetActorTickInEditor(false); // PIE 모드에서만 Tick 수행
+    PrimaryActorTick.bCanEverTick = true;
 
     if (FSlateAppMessageHandler* Handler = GEngineLoop.GetAppMessageHandler())
     {
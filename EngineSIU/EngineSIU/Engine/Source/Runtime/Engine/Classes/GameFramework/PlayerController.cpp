@@ -9,6 +9,7 @@
 APlayerController::APlayerController()
     : PlayerCameraManager(nullptr)
 {
+    PrimaryActorTick.bCanEverTick = true;
 }
 
 
@@ -1,17 +1,20 @@
 #include "SpringArmComponent.h"
 
 #include "Actor.h"
+#include "CollisionManager.h"
 #include "HAL/PlatformType.h"
 #include "Components/BoxComponent.h"
 #include "Components/SphereComponent.h"
 #include "Engine/OverlapResult.h"
-#include "UObject/UObjectIterator.h"
 #include "World/World.h"
 
 USpringArmComponent::USpringArmComponent()
 {
     // SetRelativeRotation(FRotator(FVector(-3, -14, -5)));
 
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.SetTickGroup(TG_PostPhysics);
+
     TargetArmLength = 5.f;
     TargetOffset = FVector(-13.f, 0.f, 4.f); // 부모에 대한 상대 위치
 
@@ -179,9 +182,19 @@ void USpringArmComponent::UpdateDesiredArmLocation(bool bDoTrace, bool bDoLocati
             float ClosestT = 1.f;               // 가중치 (0: 시작점, 1: 끝점)
             FVector BestHitWorld = DesiredLoc;
 
-            for (UBoxComponent* BoxComp : TObjectRange<UBoxComponent>())
+            // Probe를 쓸어 가는 경로에 월드 AABB가 닿는 상자만 검사
+            // RaySweepBox는 Probe를 상자의 축 방향으로 넓히므로, 회전한 상자도 포함하도록 월드 축 기준 √3배로 검색
+            TArray<UPrimitiveComponent*> Candidates;
+            UWorld* World = GetWorld();
+            if (FCollisionManager* CollisionManager = World ? World->GetCollisionManager() : nullptr)
+            {
+                CollisionManager->SweepBox(RayStart, RayEnd, FVector(ProbeSize * FMath::Sqrt(3.f)), Candidates);
+            }
+
+            for (UPrimitiveComponent* Candidate : Candidates)
             {
-                if (BoxComp->GetOwner() == GetOwner()) { continue; }
+                UBoxComponent* BoxComp = Cast<UBoxComponent>(Candidate);
+                if (!BoxComp || BoxComp->GetOwner() == GetOwner()) { continue; }
 
                 float t;
                 if (RaySweepBox(
@@ -234,8 +247,13 @@ bool USpringArmComponent::RaySweepBox(const FVector& Start, const FVector& Dir,
                                       float MaxDist, const FMatrix& BoxMatrix,
                                       const FVector& BoxExtents, float ProbeRadius, float& OutT)       // 0~1
 {
-    // 1) OBB 를 Probe만큼 확장한 AABB 로 변환
-    FVector Extents = BoxExtents + FVector(ProbeRadius);
+    // 1) OBB 를 Probe만큼 확장한 AABB 로 변환, Probe는 월드 단위이므로 상자의 스케일로 나눠서 로컬 단위로 바꿈
+    const FVector BoxScale = BoxMatrix.GetScaleVector();
+    FVector Extents = BoxExtents + FVector(
+        ProbeRadius / FMath::Max(BoxScale.X, KINDA_SMALL_NUMBER),
+        ProbeRadius / FMath::Max(BoxScale.Y, KINDA_SMALL_NUMBER),
+        ProbeRadius / FMath::Max(BoxScale.Z, KINDA_SMALL_NUMBER)
+    );
 
     // 2) 월드→박스 로컬
     FMatrix InvBox = FMatrix::Inverse(BoxMatrix);
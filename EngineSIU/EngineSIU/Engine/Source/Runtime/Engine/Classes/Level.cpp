@@ -1,6 +1,7 @@
 #include "Level.h"
 #include "GameFramework/Actor.h"
 #include "UObject/Casts.h"
+#include "UObject/ObjectDuplicator.h"
 
 
 void ULevel::InitLevel(UWorld* InOwningWorld)
@@ -22,6 +23,7 @@ void ULevel::Release()
             GUObjectArray.MarkRemoveObject(Component);
         }
         GUObjectArray.MarkRemoveObject(Actor);
+        Actor->LevelActorIndex = INDEX_NONE;
     }
     Actors.Empty();
 }
@@ -32,10 +34,47 @@ UObject* ULevel::Duplicate(UObject* InOuter)
 
     NewLevel->OwningWorld = OwningWorld;
 
+    FObjectDuplicator* Duplicator = FObjectDuplicator::GetActive();
+    assert(Duplicator && "Level은 UWorld::Duplicate를 통해 복제해야 합니다.");
+
+    // 1. 모든 Actor와 Component를 먼저 생성해서 원본과의 대응을 만듦 (Actor당 Component 몇 개를 가정)
+    Duplicator->Reserve(Duplicator->GetNumDuplicates() + Actors.Num() * 4);
+    for (const AActor* Actor : Actors)
+    {
+        Actor->PreallocateDuplicate(InOuter, *Duplicator);
+    }
+
+    // 2. 값 복사, 서로를 가리키는 참조는 UWorld::Duplicate가 끝날 때 한 번에 바뀜
+    NewLevel->Actors.Reserve(Actors.Num());
     for (AActor* Actor : Actors)
     {
-        NewLevel->Actors.Emplace(static_cast<AActor*>(Actor->Duplicate(InOuter)));
+        NewLevel->AddActor(static_cast<AActor*>(Actor->Duplicate(InOuter)));
     }
 
     return NewLevel;
 }
+
+void ULevel::AddActor(AActor* Actor)
+{
+    assert(Actor->LevelActorIndex == INDEX_NONE);
+    Actor->LevelActorIndex = Actors.Add(Actor);
+}
+
+bool ULevel::RemoveActor(AActor* Actor)
+{
+    const int32 Index = Actor->LevelActorIndex;
+    if (Index == INDEX_NONE || Index >= Actors.Num() || Actors[Index] != Actor)
+    {
+        return false;
+    }
+
+    // 마지막 Actor를 빈 자리로 옮겨 배열을 밀집 상태로 유지
+    AActor* LastActor = Actors.Pop();
+    if (LastActor != Actor)
+    {
+        Actors[Index] = LastActor;
+        LastActor->LevelActorIndex = Index;
+    }
+    Actor->LevelActorIndex = INDEX_NONE;
+    return true;
+}
@@ -18,6 +18,17 @@ public:
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
+    /** Actors 끝에 Actor를 추가합니다. */
+    void AddActor(AActor* Actor);
+
+    /**
+     * Actors에서 Actor를 제거합니다.
+     * 마지막 Actor를 빈 자리로 옮기므로 O(1)이지만 Actors의 순서는 유지되지 않습니다.
+     * @return Actor가 이 Level에 있었는지 여부
+     */
+    bool RemoveActor(AActor* Actor);
+
+    /** 추가, 제거는 AddActor, RemoveActor로만 해야 함 */
     TArray<AActor*> Actors;
     UWorld* OwningWorld;
 };
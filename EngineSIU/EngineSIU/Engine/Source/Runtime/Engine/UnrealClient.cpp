@@ -130,7 +130,12 @@ HRESULT FViewportResource::CreateDepthStencil(EResourceType Type)
         return hr;
     }
 
-    DepthStencils.Add(Type, NewResource);
+    std::unique_ptr<FDepthStencilRHI>& Resource = DepthStencils.FindOrAdd(Type);
+    if (!Resource)
+    {
+        Resource = std::make_unique<FDepthStencilRHI>();
+    }
+    *Resource = NewResource;
 
     return hr;
 }
@@ -144,7 +149,7 @@ FDepthStencilRHI* FViewportResource::GetDepthStencil(EResourceType Type)
             return nullptr;
         }
     }
-    return DepthStencils.Find(Type);
+    return DepthStencils.Find(Type)->get();
 }
 
 bool FViewportResource::HasDepthStencil(EResourceType Type) const
@@ -213,7 +218,12 @@ HRESULT FViewportResource::CreateRenderTarget(EResourceType Type)
         return hr;
     }
 
-    RenderTargets.Add(Type, NewResource);
+    std::unique_ptr<FRenderTargetRHI>& Resource = RenderTargets.FindOrAdd(Type);
+    if (!Resource)
+    {
+        Resource = std::make_unique<FRenderTargetRHI>();
+    }
+    *Resource = NewResource;
 
     return hr;
 }
@@ -227,7 +237,7 @@ FRenderTargetRHI* FViewportResource::GetRenderTarget(EResourceType Type)
             return nullptr;
         }
     }
-    return RenderTargets.Find(Type);
+    return RenderTargets.Find(Type)->get();
 }
 
 bool FViewportResource::HasRenderTarget(EResourceType Type) const
@@ -264,11 +274,11 @@ void FViewportResource::ReleaseAllResources()
 {
     for (auto& [Type, Resource] : RenderTargets)
     {
-        Resource.Release();
+        Resource->Release();
     }
     for (auto& [Type, Resource] : DepthStencils)
     {
-        Resource.Release();
+        Resource->Release();
     }
 }
 
@@ -276,7 +286,7 @@ void FViewportResource::ReleaseDepthStencil(EResourceType Type)
 {
     if (HasDepthStencil(Type))
     {
-        DepthStencils[Type].Release();
+        DepthStencils[Type]->Release();
     }
 }
 
@@ -284,7 +294,7 @@ void FViewportResource::ReleaseRenderTarget(EResourceType Type)
 {
     if (HasRenderTarget(Type))
     {
-        RenderTargets[Type].Release();
+        RenderTargets[Type]->Release();
     }
 }
 
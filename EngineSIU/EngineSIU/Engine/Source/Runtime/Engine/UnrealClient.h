@@ -1,6 +1,7 @@
 #pragma once
 #include "Define.h" 
 #include <d3d11.h>
+#include <memory>
 
 #include "Container/Map.h"
 
@@ -136,8 +137,9 @@ private:
     // DirectX
     D3D11_VIEWPORT D3DViewport = {};
 
-    TMap<EResourceType, FDepthStencilRHI> DepthStencils;
-    TMap<EResourceType, FRenderTargetRHI> RenderTargets;
+    /** Get으로 얻은 포인터를 들고 다른 타입을 생성해도 주소가 바뀌지 않도록 힙에 따로 할당 */
+    TMap<EResourceType, std::unique_ptr<FDepthStencilRHI>> DepthStencils;
+    TMap<EResourceType, std::unique_ptr<FRenderTargetRHI>> RenderTargets;
 
     void ReleaseAllResources();
     void ReleaseDepthStencil(EResourceType Type);
@@ -1,16 +1,77 @@
 #include "Console.h"
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
+#include <cstdlib>
 
 #include "Actors/PointLightActor.h"
 #include "Actors/SpotLightActor.h"
+#include "Async/JobSystem.h"
 #include "Components/Light/LightComponent.h"
 #include "Engine/Engine.h"
+#include "Engine/SkeletalMeshSkinning.h"
+#include "Engine/TickTaskManager.h"
 #include "Renderer/UpdateLightBufferPass.h"
 #include "Stats/GPUTimingManager.h"
 #include "Stats/ProfilerStatsManager.h"
 #include "UnrealEd/EditorViewportClient.h"
 #include "UObject/UObjectIterator.h"
+#include "World/World.h"
+#include "Container/CString.h"
+
+
+FLogCategory::FLogCategory(const char* InName, ELogLevel InDefaultVerbosity)
+    : Name(InName)
+    , Verbosity(InDefaultVerbosity)
+{
+    GetRegistry().Add(this);
+}
+
+FLogCategory* FLogCategory::Find(const std::string& InName)
+{
+    for (FLogCategory* Category : GetRegistry())
+    {
+        if (FCStringAnsi::Stricmp(Category->Name, InName.c_str()) == 0)
+        {
+            return Category;
+        }
+    }
+    return nullptr;
+}
+
+TArray<FLogCategory*>& FLogCategory::GetRegistry()
+{
+    static TArray<FLogCategory*> Categories;
+    return Categories;
+}
+
+const char* GetLogLevelName(ELogLevel Level)
+{
+    switch (Level)
+    {
+    case ELogLevel::Verbose:
+        return "Verbose";
+    case ELogLevel::Display:
+        return "Display";
+    case ELogLevel::Warning:
+        return "Warning";
+    case ELogLevel::Error:
+        return "Error";
+    default:
+        return "Unknown";
+    }
+}
+
+/** Command가 Name이거나 "Name <Args>"이면 true, 이름 뒤의 인자를 OutArgs에 담음 */
+static bool MatchCommand(const std::string& Command, const std::string& Name, std::string& OutArgs)
+{
+    if (!Command.starts_with(Name) || (Command.size() > Name.size() && Command[Name.size()] != ' '))
+    {
+        return false;
+    }
+    OutArgs = Command.size() > Name.size() ? Command.substr(Name.size() + 1) : std::string();
+    return true;
+}
 
 
 void FStatOverlay::ToggleStat(const std::string& Command)
@@ -30,6 +91,16 @@ void FStatOverlay::ToggleStat(const std::string& Command)
         bShowLight = true;
         bShowRender = true;
     }
+    else if (Command == "stat draw")
+    {
+        bShowDraw = true;
+        bShowRender = true;
+    }
+    else if (Command == "stat tick")
+    {
+        bShowTick = true;
+        bShowRender = true;
+    }
     else if (Command == "stat all")
     {
         StatFlags = 0xFF;
@@ -88,8 +159,11 @@ void FStatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::SeparatorText("Memory Usage");
         ImGui::Text("Allocated Object Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Object>());
         ImGui::Text("Allocated Object Memory: %llu Byte", FPlatformMemory::GetAllocationBytes<EAT_Object>());
+        ImGui::Text("UObject Pool Reserved: %llu Byte", FUObjectAllocator::Get().GetReservedBytes());
         ImGui::Text("Allocated Container Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Container>());
         ImGui::Text("Allocated Container Memory: %llu Byte", FPlatformMemory::GetAllocationBytes<EAT_Container>());
+        ImGui::Text("FName Count: %u", FName::GetNumNameEntries());
+        ImGui::Text("FName Pool Memory: %llu Byte", FName::GetNameTableMemorySize());
     }
 
     if (bShowLight)
@@ -99,6 +173,31 @@ void FStatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::Text("Spot Light: %d", GetNumOfObjectsByClass(ASpotLight::StaticClass()));
     }
 
+    if (bShowDraw)
+    {
+        const FMeshDrawStats& DrawStats = FEngineLoop::Renderer.MeshDrawStats;
+        ImGui::SeparatorText("[ Mesh Draw ]\n");
+        ImGui::Text("Draw Calls: %u", DrawStats.NumDraws);
+        ImGui::Text("Material Binds: %u", DrawStats.NumMaterialBinds);
+        ImGui::Text("Buffer Binds: %u", DrawStats.NumBufferBinds);
+        ImGui::Text("Object Updates: %u", DrawStats.NumObjectUpdates);
+        ImGui::Text("Instanced Objects: %u", DrawStats.NumInstances);
+    }
+
+    if (bShowTick && GEngine && GEngine->ActiveWorld)
+    {
+        if (const FTickTaskManager* TickTaskManager = GEngine->ActiveWorld->GetTickTaskManager())
+        {
+            ImGui::SeparatorText("[ Tick Groups ]\n");
+            for (int32 GroupIndex = 0; GroupIndex < TG_MAX; ++GroupIndex)
+            {
+                const ETickingGroup Group = static_cast<ETickingGroup>(GroupIndex);
+                const FTickGroupStats& Stats = TickTaskManager->GetGroupStats(Group);
+                ImGui::Text("%s: %u / %u ticked, %.3f ms", GetTickingGroupName(Group), Stats.NumTicked, Stats.NumRegistered, Stats.Milliseconds);
+            }
+        }
+    }
+
     ImGui::PopStyleColor();
     ImGui::End();
 }
@@ -182,6 +281,7 @@ FConsole& FConsole::GetInstance() {
 
 // 로그 초기화
 void FConsole::Clear() {
+    std::lock_guard Lock(ItemsMutex);
     Items.Empty();
 }
 
@@ -195,7 +295,11 @@ void FConsole::AddLog(ELogLevel Level, const ANSICHAR* Fmt, ...)
     char Buf[1024];
     vsnprintf_s(Buf, sizeof(Buf), _TRUNCATE, Fmt, Args);
 
-    Items.Emplace(Level, std::string(Buf));
+    {
+        std::lock_guard Lock(ItemsMutex);
+        Items.Emplace(Level, std::string(Buf));
+        TrimLogItems();
+    }
     va_end(Args);
 }
 
@@ -208,10 +312,26 @@ void FConsole::AddLog(ELogLevel Level, const WIDECHAR* Fmt, ...)
     wchar_t Buf[1024];
     _vsnwprintf_s(Buf, sizeof(Buf), _TRUNCATE, Fmt, Args);
 
-    Items.Emplace(Level, FString(Buf).ToAnsiString());
+    {
+        std::lock_guard Lock(ItemsMutex);
+        Items.Emplace(Level, FString(Buf).ToAnsiString());
+        TrimLogItems();
+    }
     va_end(Args);
 }
 
+void FConsole::TrimLogItems()
+{
+    if (Items.Num() <= MaxLogItems)
+    {
+        return;
+    }
+
+    // 매번 한 개씩 지우면 로그마다 배열 전체를 당기게 되므로 한 번에 지움
+    auto& Container = Items.GetContainerPrivate();
+    Container.erase(Container.begin(), Container.begin() + MaxLogItems / 10);
+}
+
 // 콘솔 창 렌더링
 void FConsole::Draw() {
     if (!bWasOpen)
@@ -283,7 +403,7 @@ void FConsole::Draw() {
         }
 
         // 로그 수준에 맞는 필터링
-        if ((Level == ELogLevel::Display && !ShowLogTemp) ||
+        if (((Level == ELogLevel::Verbose || Level == ELogLevel::Display) && !ShowLogTemp) ||
             (Level == ELogLevel::Warning && !ShowWarning) ||
             (Level == ELogLevel::Error && !ShowError))
         {
@@ -294,6 +414,9 @@ void FConsole::Draw() {
         ImVec4 Color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
         switch (Level)
         {
+        case ELogLevel::Verbose:
+            Color = ImVec4(0.6f, 0.6f, 0.6f, 1.0f); // 회색
+            break;
         case ELogLevel::Display:
             Color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f); // 기본 흰색
             break;
@@ -347,6 +470,8 @@ void FConsole::ExecuteCommand(const std::string& Command)
 {
     AddLog(ELogLevel::Display, "Executing command: %s", Command.c_str());
 
+    std::string Args;
+
     if (Command == "clear")
     {
         Clear();
@@ -358,10 +483,52 @@ void FConsole::ExecuteCommand(const std::string& Command)
         AddLog(ELogLevel::Display, " - help: Shows available commands");
         AddLog(ELogLevel::Display, " - stat fps: Toggle FPS display");
         AddLog(ELogLevel::Display, " - stat memory: Toggle Memory display");
+        AddLog(ELogLevel::Display, " - stat tick: Toggle tick group counts and cost");
         AddLog(ELogLevel::Display, " - stat none: Hide all stat overlays");
         AddLog(ELogLevel::Display, " - stat 1: Show Engine Profiler");
         AddLog(ELogLevel::Display, " - stat 0: Hide Engine Profiler");
+        AddLog(ELogLevel::Display, " - skinning gpu|cpu: Select skeletal mesh skinning path");
+        AddLog(ELogLevel::Display, " - jobs <N>: Restart job system with N worker threads (0 = single thread)");
+        AddLog(ELogLevel::Display, " - log list: Show log categories and their verbosity");
+        AddLog(ELogLevel::Display, " - log <Category> verbose|display|warning|error: Set category verbosity");
+        AddLog(ELogLevel::Display, " - profile summary [N]: Show min/avg/p50/p95/p99/max of each CPU stat over the last N (default 300) frames");
+        AddLog(ELogLevel::Display, " - profile dump [Path]: Write the last 300 frames of CPU scopes as chrome://tracing JSON (default Saved/ProfileTrace.json)");
+#if WITH_BENCHMARKS
+        LogBenchUsage();
+#endif
     }
+    else if (Command == "skinning gpu" || Command == "skinning cpu")
+    {
+        FSkeletalMeshSkinning::bUseGPUSkinning = (Command == "skinning gpu");
+        AddLog(ELogLevel::Display, "Skinning: %s", FSkeletalMeshSkinning::bUseGPUSkinning ? "GPU" : "CPU");
+    }
+    else if (Command.starts_with("jobs "))
+    {
+        // 작업은 매 프레임 배리어에서 모두 끝나므로 프레임 사이에 다시 만들어도 안전함
+        FJobSystem::Initialize(std::max(std::atoi(Command.c_str() + 5), 0));
+        AddLog(ELogLevel::Display, "Job workers: %d", FJobSystem::GetNumWorkers());
+    }
+    else if (Command.starts_with("log "))
+    {
+        ExecuteLogCommand(Command.substr(4));
+    }
+    else if (MatchCommand(Command, "profile summary", Args))
+    {
+        // 결과는 FProfilerStatsManager에서 로그로 출력됨
+        FProfilerStatsManager::LogStatSummaries(Args.empty() ? FProfilerStatsManager::HistoryFrames : std::max(std::atoi(Args.c_str()), 1));
+    }
+    else if (MatchCommand(Command, "profile dump", Args))
+    {
+        // 결과는 FProfilerStatsManager에서 로그로 출력됨
+        FProfilerStatsManager::WriteChromeTrace(Args.empty() ? FString("Saved/ProfileTrace.json") : FString(Args));
+    }
+#if WITH_BENCHMARKS
+    else if (MatchCommand(Command, "bench", Args))
+    {
+        // 결과는 각 벤치마크에서 로그로 출력됨
+        ExecuteBenchCommand(Args);
+    }
+#endif
     else if (Command.starts_with("stat "))
     {
         Overlay.ToggleStat(Command);
@@ -380,3 +547,43 @@ void FConsole::OnResize(HWND hWnd)
     Height = ClientRect.bottom - ClientRect.top;
 }
 
+void FConsole::ExecuteLogCommand(const std::string& Args)
+{
+    if (Args == "list")
+    {
+        for (const FLogCategory* Category : FLogCategory::GetAll())
+        {
+            AddLog(ELogLevel::Display, " - %s: %s", Category->GetName(), GetLogLevelName(Category->GetVerbosity()));
+        }
+        return;
+    }
+
+    const size_t Space = Args.find(' ');
+    if (Space == std::string::npos)
+    {
+        AddLog(ELogLevel::Error, "Usage: log <Category> verbose|display|warning|error");
+        return;
+    }
+
+    const std::string CategoryName = Args.substr(0, Space);
+    const std::string LevelName = Args.substr(Space + 1);
+
+    FLogCategory* Category = FLogCategory::Find(CategoryName);
+    if (!Category)
+    {
+        AddLog(ELogLevel::Error, "Unknown log category: %s", CategoryName.c_str());
+        return;
+    }
+
+    for (ELogLevel Level : { ELogLevel::Verbose, ELogLevel::Display, ELogLevel::Warning, ELogLevel::Error })
+    {
+        if (FCStringAnsi::Stricmp(GetLogLevelName(Level), LevelName.c_str()) == 0)
+        {
+            Category->SetVerbosity(Level);
+            AddLog(ELogLevel::Display, "%s: %s", Category->GetName(), GetLogLevelName(Level));
+            return;
+        }
+    }
+
+    AddLog(ELogLevel::Error, "Unknown verbosity: %s", LevelName.c_str());
+}
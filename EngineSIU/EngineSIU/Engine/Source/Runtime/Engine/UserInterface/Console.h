@@ -1,4 +1,7 @@
 #pragma once
+#include <atomic>
+#include <mutex>
+
 #include "Container/Array.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "HAL/PlatformType.h"
@@ -23,14 +26,75 @@ static consteval const char* GetFileName(const char* Path)
 #define FILENAME GetFileName(__FILE__)
 #define UE_LOG(Level, Fmt, ...) FConsole::GetInstance().AddLog(Level, "[%s:%d] " Fmt, FILENAME, __LINE__, __VA_ARGS__)
 
+/**
+ * Category의 Verbosity보다 낮은 Level의 로그는 인자를 평가하지도 않고 버립니다.
+ * 생성 로그처럼 자주 호출되는 곳은 UE_LOG 대신 이 매크로를 사용합니다.
+ */
+#define UE_LOG_CATEGORY(Category, Level, Fmt, ...) \
+    do \
+    { \
+        if (!(Category).IsSuppressed(Level)) \
+        { \
+            FConsole::GetInstance().AddLog(Level, "[%s][%s:%d] " Fmt, (Category).GetName(), FILENAME, __LINE__, __VA_ARGS__); \
+        } \
+    } while (0)
+
+/** 헤더에서 Category를 선언합니다. */
+#define DECLARE_LOG_CATEGORY_EXTERN(CategoryName) extern FLogCategory CategoryName;
+
+/** cpp 하나에서 Category를 정의합니다. DefaultVerbosity는 ELogLevel의 이름 (Verbose, Display, ...) */
+#define DEFINE_LOG_CATEGORY(CategoryName, DefaultVerbosity) FLogCategory CategoryName(#CategoryName, ELogLevel::DefaultVerbosity);
+
 
 enum class ELogLevel : uint8
 {
+    Verbose,
     Display,
     Warning,
     Error
 };
 
+/**
+ * 이름으로 찾아서 Verbosity를 바꿀 수 있는 로그 분류입니다. (콘솔 명령 log)
+ * 정의될 때 전역 목록에 등록되므로 DEFINE_LOG_CATEGORY로 전역 변수로만 만들어야 합니다.
+ */
+struct FLogCategory
+{
+    FLogCategory(const char* InName, ELogLevel InDefaultVerbosity);
+
+    FLogCategory(const FLogCategory&) = delete;
+    FLogCategory& operator=(const FLogCategory&) = delete;
+
+    const char* GetName() const { return Name; }
+
+    /** @return Level이 Verbosity보다 낮아서 출력하지 않아야 하면 true */
+    bool IsSuppressed(ELogLevel Level) const { return Level < Verbosity.load(std::memory_order_relaxed); }
+
+    ELogLevel GetVerbosity() const { return Verbosity.load(std::memory_order_relaxed); }
+    void SetVerbosity(ELogLevel InVerbosity) { Verbosity.store(InVerbosity, std::memory_order_relaxed); }
+
+    /**
+     * 등록된 Category를 찾습니다.
+     * @param InName Category 이름 (대소문자 무시)
+     * @return 없으면 nullptr
+     */
+    static FLogCategory* Find(const std::string& InName);
+
+    static const TArray<FLogCategory*>& GetAll() { return GetRegistry(); }
+
+private:
+    /** 다른 전역 변수의 초기화 순서와 무관하게 사용할 수 있도록 함수 안의 static으로 둠 */
+    static TArray<FLogCategory*>& GetRegistry();
+
+    const char* Name;
+
+    /** 워커 스레드의 로그와 콘솔 명령이 동시에 접근할 수 있으므로 atomic */
+    std::atomic<ELogLevel> Verbosity;
+};
+
+/** 로그 Level의 표시 이름 (Verbose, Display, Warning, Error) */
+const char* GetLogLevelName(ELogLevel Level);
+
 class FStatOverlay
 {
 public:
@@ -44,6 +108,8 @@ public:
             uint8 bShowMemory : 1;
             uint8 bShowLight : 1;
             uint8 bShowRender : 1;
+            uint8 bShowDraw : 1;
+            uint8 bShowTick : 1;
         };
         uint8 StatFlags = 0; // 기본적으로 다 끄기
     };
@@ -122,6 +188,12 @@ public:
     };
 
     TArray<LogEntry> Items;
+
+    /** Items가 이 수를 넘으면 오래된 로그부터 지웁니다. */
+    static constexpr int32 MaxLogItems = 10000;
+
+    /** 워커 스레드의 UE_LOG가 Items에 동시에 추가하지 않도록 보호 (Draw는 Tick이 끝난 뒤 메인 스레드에서만 호출) */
+    std::mutex ItemsMutex;
     TArray<FString> History;
     int32 HistoryPos = -1;
     char InputBuf[256] = "";
@@ -138,6 +210,20 @@ public:
     FStatOverlay Overlay;
 
 private:
+    /** ItemsMutex를 잡은 상태에서 호출, MaxLogItems를 넘으면 앞의 10%를 한 번에 지움 */
+    void TrimLogItems();
+
+    /** log 명령 처리: log list, log <Category> <Verbosity> */
+    void ExecuteLogCommand(const std::string& Args);
+
+#if WITH_BENCHMARKS
+    /** bench 명령 처리: bench <Name> [Args], 구현은 ConsoleBenchmarks.cpp */
+    void ExecuteBenchCommand(const std::string& Args);
+
+    /** bench 명령마다 사용법 한 줄씩 출력 */
+    void LogBenchUsage();
+#endif
+
     bool bExpand = true;
     UINT Width;
     UINT Height;
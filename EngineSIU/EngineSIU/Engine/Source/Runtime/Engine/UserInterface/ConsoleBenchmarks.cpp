@@ -0,0 +1,3578 @@
+#include "Console.h"
+
+#if WITH_BENCHMARKS
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <Windows.h>
+#include <psapi.h>
+
+#include "Async/JobSystem.h"
+#include "Components/BoxComponent.h"
+#include "Components/ProjectileMovementComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SkySphereComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/Mesh/SkeletalMeshRenderData.h"
+#include "Components/Mesh/StaticMeshRenderData.h"
+#include "Container/Map.h"
+#include "Container/Set.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Asset/StaticMeshAsset.h"
+#include "Engine/Asset/StaticMeshCookedFile.h"
+#include "Engine/Asset/StaticMeshOptimizer.h"
+#include "Engine/EditorEngine.h"
+#include "Engine/Engine.h"
+#include "Engine/FbxLoader.h"
+#include "Engine/FObjLoader.h"
+#include "Engine/SkeletalMeshSkinning.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/TickTaskManager.h"
+#include "LuaScripts/LuaScriptManager.h"
+#include "Math/Frustum.h"
+#include "Math/JungleMath.h"
+#include "Physics/CollisionManager.h"
+#include "Physics/MeshBVH.h"
+#include "Renderer/MeshDrawCommand.h"
+#include "Renderer/MeshInstanceGrouper.h"
+#include "Serialization/MemoryArchive.h"
+#include "Stats/ProfilerStatsManager.h"
+#include "UObject/ObjectFactory.h"
+#include "UnrealEd/SceneManager.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+#include "World/World.h"
+#include "WindowsFileWatcher.h"
+#include "WindowsPlatformTime.h"
+
+#pragma comment(lib, "Psapi.lib")
+
+/**
+ * bench 콘솔 명령의 구현을 모아 둔 파일입니다.
+ * 검증과 측정에만 쓰는 코드(기존 구현의 참조 복사본 포함)는 런타임 클래스에 두지 않고 여기에 두며,
+ * WITH_BENCHMARKS가 0인 빌드(기본값: Release)에는 포함되지 않습니다.
+ */
+namespace
+{
+    struct FBenchCommand
+    {
+        const char* Name;
+        const char* Usage;
+        void (*Run)(const std::string& Args);
+    };
+
+    int32 ParseCount(const std::string& Args, int32 DefaultCount)
+    {
+        return Args.empty() ? DefaultCount : std::max(std::atoi(Args.c_str()), 0);
+    }
+
+    FString ParsePath(const std::string& Args, const FString& DefaultPath = FString())
+    {
+        return Args.empty() ? DefaultPath : FString(Args);
+    }
+
+    /** ObjFilePath가 비어 있으면 Assets/와 Contents/ 아래의 모든 OBJ, 아니면 그 파일 하나 */
+    TArray<FString> FindObjFiles(const FString& ObjFilePath)
+    {
+        TArray<FString> ObjFilePaths;
+        if (!ObjFilePath.IsEmpty())
+        {
+            ObjFilePaths.Add(ObjFilePath);
+            return ObjFilePaths;
+        }
+
+        for (const char* Directory : { "Assets", "Contents" })
+        {
+            std::error_code ErrorCode;
+            for (const auto& Entry : std::filesystem::recursive_directory_iterator(Directory, ErrorCode))
+            {
+                if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+                {
+                    ObjFilePaths.Add(Entry.path().generic_string());
+                }
+            }
+        }
+        return ObjFilePaths;
+    }
+
+    void SpinFor(double Milliseconds)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        while (FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) < Milliseconds)
+        {
+        }
+    }
+
+    uint64 GetProcessWorkingSetBytes()
+    {
+        PROCESS_MEMORY_COUNTERS Counters = {};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters)))
+        {
+            return Counters.WorkingSetSize;
+        }
+        return 0;
+    }
+
+    double ToMegabytes(int64 Bytes)
+    {
+        return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+    }
+
+    // Tick마다 전역 변수와 FVector 바인딩을 쓰는 간단한 스크립트
+    const char* BenchmarkScript = R"(
+Speed = 2
+Elapsed = 0
+Offset = FVector(0, 0, 0)
+
+function BeginPlay()
+    Offset = FVector(1, 2, 3)
+end
+
+function Tick(dt)
+    Elapsed = Elapsed + dt * Speed
+    Offset = Offset + FVector(math.sin(Elapsed), math.cos(Elapsed), 0) * dt
+end
+)";
+
+    /**
+     * World에 측정용 Actor를 생성하고, 끝날 때 아직 남은 Actor를 생성 순서대로 파괴하는 Fixture입니다.
+     * World가 없거나 Count가 0 이하이면 Usage를 출력하고 IsValid()가 false가 됩니다.
+     */
+    class FBenchWorldFixture
+    {
+    public:
+        FBenchWorldFixture(const char* Usage, int32 Count, UWorld* InWorld = GEngine ? GEngine->ActiveWorld : nullptr)
+            : World(Count > 0 ? InWorld : nullptr)
+        {
+            if (!World)
+            {
+                UE_LOG(ELogLevel::Error, "Usage: %s", Usage);
+                return;
+            }
+            Actors.Reserve(Count);
+        }
+
+        ~FBenchWorldFixture()
+        {
+            DestroyActors(Actors.Num());
+        }
+
+        FBenchWorldFixture(const FBenchWorldFixture&) = delete;
+        FBenchWorldFixture& operator=(const FBenchWorldFixture&) = delete;
+
+        bool IsValid() const { return World != nullptr; }
+        UWorld* GetWorld() const { return World; }
+
+        const TArray<AActor*>& GetActors() const { return Actors; }
+        int32 GetNumDestroyed() const { return NumDestroyed; }
+
+        template <typename ActorType = AActor>
+        ActorType* SpawnActor()
+        {
+            ActorType* Actor = World->SpawnActor<ActorType>();
+            Actors.Add(Actor);
+            return Actor;
+        }
+
+        /** 아직 파괴하지 않은 Actor 중 EndIndex 앞의 Actor를 파괴합니다. */
+        void DestroyActors(int32 EndIndex)
+        {
+            for (EndIndex = std::min(EndIndex, Actors.Num()); NumDestroyed < EndIndex; ++NumDestroyed)
+            {
+                World->DestroyActor(Actors[NumDestroyed]);
+            }
+        }
+
+    private:
+        UWorld* World;
+        TArray<AActor*> Actors;
+        int32 NumDestroyed = 0;
+    };
+
+    /**
+     * 현재 World에 Actor(SceneComponent 하나 포함)를 Count개 생성한 뒤 모두 파괴하고 걸린 시간을 출력합니다.
+     * 생성 로그 Category(LogObject)의 Verbosity를 바꿔 가며 생성 경로의 비용을 비교할 때 사용합니다.
+     */
+    void RunSpawnBenchmark(int32 Count)
+    {
+        FBenchWorldFixture Fixture("bench spawn <N> (requires an active world)", Count);
+        if (!Fixture.IsValid())
+        {
+            return;
+        }
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Fixture.SpawnActor()->AddComponent<USceneComponent>();
+        }
+        const uint64 SpawnedCycles = FPlatformTime::Cycles64();
+
+        Fixture.DestroyActors(Count);
+        const uint64 DestroyedCycles = FPlatformTime::Cycles64();
+
+        // 실제 메모리 해제는 프레임이 끝날 때 ProcessPendingDestroyObjects에서 일어남
+        const double SpawnMs = FPlatformTime::ToMilliseconds(SpawnedCycles - StartCycles);
+        const double DestroyMs = FPlatformTime::ToMilliseconds(DestroyedCycles - SpawnedCycles);
+        UE_LOG(ELogLevel::Display, "bench spawn %d: spawn %.2f ms (%.2f us/actor), destroy %.2f ms (%.2f us/actor)",
+            Count, SpawnMs, SpawnMs * 1000.0 / Count, DestroyMs, DestroyMs * 1000.0 / Count
+        );
+    }
+
+    /**
+     * Editor World에 StaticMeshActor를 늘려 가며(MaxCount/8, /4, /2, MaxCount) PIE World 복제 시간을 측정합니다.
+     * 측정용 World와 Actor는 측정이 끝나면 모두 제거합니다.
+     */
+    void RunPIEDuplicateBenchmark(int32 MaxCount)
+    {
+        UEditorEngine* EditorEngine = Cast<UEditorEngine>(GEngine);
+        if (!EditorEngine || !EditorEngine->EditorWorld || EditorEngine->PIEWorld || MaxCount <= 0)
+        {
+            UE_LOG(ELogLevel::Error, "Usage: bench pie <N> (editor only, not while playing)");
+            return;
+        }
+
+        UWorld* EditorWorld = EditorEngine->EditorWorld;
+        FBenchWorldFixture Fixture("bench pie <N> (editor only, not while playing)", MaxCount, EditorWorld);
+
+        for (int32 Count = std::max(MaxCount / 8, 1); ; Count = std::min(Count * 2, MaxCount))
+        {
+            while (Fixture.GetActors().Num() < Count)
+            {
+                Fixture.SpawnActor<AStaticMeshActor>();
+            }
+
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            UWorld* DuplicatedWorld = Cast<UWorld>(EditorWorld->Duplicate(EditorEngine));
+            const double DuplicateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            const int32 NumActors = DuplicatedWorld->GetActiveLevel()->Actors.Num();
+            UE_LOG(ELogLevel::Display, "bench pie: %d actors (%d extra) duplicated in %.2f ms (%.2f us/actor)",
+                NumActors, Count, DuplicateMs, DuplicateMs * 1000.0 / std::max(NumActors, 1)
+            );
+
+            // EndPIE와 같은 방식으로 정리
+            DuplicatedWorld->Release();
+            GUObjectArray.MarkRemoveObject(DuplicatedWorld);
+
+            if (Count >= MaxCount)
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * 투사체처럼 짧게 살다 사라지는 Actor를 흉내 내어, 프레임마다 Actor를 생성하고 일정 프레임이 지난 Actor를 파괴합니다.
+     * 각 프레임 끝에 제거 대기열을 비우며, 총 TotalCount개를 생성하고 모두 파괴할 때까지의 프레임 시간을 출력합니다.
+     */
+    void RunChurnBenchmark(int32 TotalCount)
+    {
+        FBenchWorldFixture Fixture("bench churn [N] (requires an active world)", TotalCount);
+        if (!Fixture.IsValid())
+        {
+            return;
+        }
+        UWorld* World = Fixture.GetWorld();
+
+        // 프레임마다 SpawnPerFrame개를 생성하고, LifetimeFrames 프레임이 지난 Actor부터 파괴
+        constexpr int32 NumSpawnFrames = 500;
+        constexpr int32 LifetimeFrames = 30;
+        const int32 SpawnPerFrame = std::max(TotalCount / NumSpawnFrames, 1);
+
+        const int32 NumActorsBefore = World->GetActiveLevel()->Actors.Num();
+        const int32 NumObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+        int32 NumFrames = 0;
+        double TotalMs = 0.0;
+        double WorstFrameMs = 0.0;
+        double DestroyMs = 0.0;
+        double FlushMs = 0.0;
+
+        while (Fixture.GetNumDestroyed() < TotalCount)
+        {
+            const uint64 FrameStartCycles = FPlatformTime::Cycles64();
+
+            for (int32 i = 0; i < SpawnPerFrame && Fixture.GetActors().Num() < TotalCount; ++i)
+            {
+                Fixture.SpawnActor()->AddComponent<USceneComponent>();
+            }
+            const uint64 SpawnedCycles = FPlatformTime::Cycles64();
+
+            // 오래된 Actor는 Level의 앞쪽에 있으므로, 배열을 당기는 제거라면 매번 거의 전체를 옮기게 됨
+            Fixture.DestroyActors(std::max((NumFrames + 1 - LifetimeFrames) * SpawnPerFrame, 0));
+            const uint64 DestroyedCycles = FPlatformTime::Cycles64();
+
+            // 프레임이 끝날 때와 같이 제거 대기열을 한 번에 비움
+            GUObjectArray.ProcessPendingDestroyObjects();
+            const uint64 FrameEndCycles = FPlatformTime::Cycles64();
+
+            const double FrameMs = FPlatformTime::ToMilliseconds(FrameEndCycles - FrameStartCycles);
+            TotalMs += FrameMs;
+            WorstFrameMs = std::max(WorstFrameMs, FrameMs);
+            DestroyMs += FPlatformTime::ToMilliseconds(DestroyedCycles - SpawnedCycles);
+            FlushMs += FPlatformTime::ToMilliseconds(FrameEndCycles - DestroyedCycles);
+            ++NumFrames;
+        }
+
+        UE_LOG(ELogLevel::Display, "bench churn %d: %d frames, avg %.3f ms, worst %.3f ms, destroy %.2f ms (%.2f us/actor), flush %.2f ms",
+            TotalCount, NumFrames, TotalMs / NumFrames, WorstFrameMs, DestroyMs, DestroyMs * 1000.0 / TotalCount, FlushMs
+        );
+
+        const int32 LeakedActors = World->GetActiveLevel()->Actors.Num() - NumActorsBefore;
+        const int32 LeakedObjects = GUObjectArray.GetObjectArrayNumMinusAvailable() - NumObjectsBefore;
+        if (LeakedActors != 0 || LeakedObjects != 0)
+        {
+            UE_LOG(ELogLevel::Warning, "bench churn: %d actors, %d objects left after destroy", LeakedActors, LeakedObjects);
+        }
+    }
+
+    /** 현재 스레드가 기록한 구간 수, 이 스레드의 구간이 없으면 0 */
+    int32 CountCurrentThreadScopes(const TArray<FProfilerThreadScopes>& Threads)
+    {
+        for (const FProfilerThreadScopes& Thread : Threads)
+        {
+            if (Thread.ThreadId == GetCurrentThreadId())
+            {
+                return Thread.Scopes.Num();
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * 중첩 구간과 잡 워커 구간을 NumFrames 프레임 동안 기록하고 FProfilerStatsManager를 검사합니다.
+     * 링 버퍼 덮어쓰기, 구간 중첩, 스파이크 프레임 분리, 백분위 계산, 트레이스 파일 내용을 확인합니다.
+     */
+    bool RunProfilerTests(int32 NumFrames)
+    {
+        using Profiler = FProfilerStatsManager;
+        constexpr uint32 EventsPerThread = Profiler::EventsPerThread;
+
+        NumFrames = std::clamp(NumFrames, 2, Profiler::HistoryFrames);
+        bool bPassed = true;
+
+        // 1) 버퍼의 절반을 기록한 프레임은 모두 남아야 함
+        Profiler::BeginFrame();
+        for (uint32 Index = 0; Index < EventsPerThread / 2; ++Index)
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(ProfilerTest_Half)
+        }
+        Profiler::BeginFrame();
+
+        TArray<FProfilerThreadScopes> Threads;
+        Profiler::GetRecordedScopes(1, Threads);
+        const int32 NumHalfScopes = CountCurrentThreadScopes(Threads);
+
+        // 2) 구간 기록 비용과 링 버퍼 덮어쓰기, 버퍼보다 많은 구간을 기록한 프레임은 잘린 채로 집계되지 않아야 함
+        Profiler::BeginFrame();
+        constexpr int32 NumExtraScopes = 1000;
+        const uint64 OverheadStartCycles = FPlatformTime::Cycles64();
+        for (int32 Index = 0; Index < static_cast<int32>(EventsPerThread) + NumExtraScopes; ++Index)
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(ProfilerTest_Empty)
+        }
+        const double ScopeNs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - OverheadStartCycles) * 1e6 / (EventsPerThread + NumExtraScopes);
+        Profiler::BeginFrame();
+
+        const int32 NumOverflowFrames = Profiler::GetRecordedScopes(2, Threads);
+        UE_LOG(ELogLevel::Display, "bench profiler: scope cost %.1f ns, half-buffer frame kept %d of %u scopes, overflowed frames kept %d of 2",
+            ScopeNs, NumHalfScopes, EventsPerThread / 2, NumOverflowFrames
+        );
+        if (NumHalfScopes != static_cast<int32>(EventsPerThread / 2) || NumOverflowFrames != 0)
+        {
+            UE_LOG(ELogLevel::Error, "bench profiler: expected the half-buffer frame intact and the overflowed frames dropped");
+            bPassed = false;
+        }
+
+        // 3) 중첩 구간과 잡 워커 구간을 NumFrames 프레임 동안 기록하고, 가운데 프레임 하나만 느리게 만듦
+        constexpr int32 NumInner = 3;
+        constexpr double InnerMs = 0.05;
+        constexpr double SpikeMs = 4.0;
+        const int32 NumJobs = std::max(FJobSystem::GetNumWorkers(), 1) * 4;
+        const int32 SpikeFrame = NumFrames / 2;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            Profiler::BeginFrame();
+            QUICK_SCOPE_CYCLE_COUNTER(ProfilerTest_Outer)
+            for (int32 Index = 0; Index < NumInner; ++Index)
+            {
+                QUICK_SCOPE_CYCLE_COUNTER(ProfilerTest_Inner)
+                SpinFor(Frame == SpikeFrame && Index == 0 ? SpikeMs : InnerMs);
+            }
+            FJobSystem::ParallelFor(NumJobs, [](int32)
+            {
+                QUICK_SCOPE_CYCLE_COUNTER(ProfilerTest_Job)
+                SpinFor(0.02);
+            });
+        }
+        Profiler::BeginFrame();
+
+        const FName OuterName("ProfilerTest_Outer");
+        const FName InnerName("ProfilerTest_Inner");
+        const FName JobName("ProfilerTest_Job");
+
+        const FProfilerStatSummary* Outer = nullptr;
+        const FProfilerStatSummary* Inner = nullptr;
+        const FProfilerStatSummary* Job = nullptr;
+        const TArray<FProfilerStatSummary> Summaries = Profiler::GetStatSummaries(NumFrames);
+        for (const FProfilerStatSummary& Summary : Summaries)
+        {
+            if (Summary.StatName == OuterName) Outer = &Summary;
+            else if (Summary.StatName == InnerName) Inner = &Summary;
+            else if (Summary.StatName == JobName) Job = &Summary;
+        }
+
+        if (!Outer || !Inner || !Job || Outer->NumFrames != NumFrames || Inner->NumFrames != NumFrames || Job->NumFrames != NumFrames)
+        {
+            UE_LOG(ELogLevel::Error, "bench profiler: expected every test stat in all %d frames", NumFrames);
+            return false;
+        }
+        if (Outer->P50Ms < Inner->P50Ms || Inner->MinMs < NumInner * InnerMs)
+        {
+            UE_LOG(ELogLevel::Error, "bench profiler: outer p50 %.3f ms must include inner p50 %.3f ms (>= %.3f ms)",
+                Outer->P50Ms, Inner->P50Ms, NumInner * InnerMs
+            );
+            bPassed = false;
+        }
+        if (Outer->MaxMs < SpikeMs || Outer->P50Ms >= SpikeMs)
+        {
+            UE_LOG(ELogLevel::Error, "bench profiler: spike frame not isolated, outer p50 %.3f ms, max %.3f ms", Outer->P50Ms, Outer->MaxMs);
+            bPassed = false;
+        }
+
+        // 4) 메인 스레드의 Inner 구간은 모두 한 단계 위의 Outer 구간 안에 있어야 함
+        Profiler::GetRecordedScopes(NumFrames, Threads);
+
+        int32 NumJobThreads = 0;
+        int32 NumNested = 0;
+        int32 NumInnerScopes = 0;
+        for (const FProfilerThreadScopes& Thread : Threads)
+        {
+            bool bRanJob = false;
+            TArray<const FProfilerScope*> OuterScopes;
+            for (const FProfilerScope& Scope : Thread.Scopes)
+            {
+                bRanJob |= Scope.Name == JobName;
+                if (Scope.Name == OuterName)
+                {
+                    OuterScopes.Add(&Scope);
+                }
+            }
+            NumJobThreads += bRanJob ? 1 : 0;
+
+            for (const FProfilerScope& Scope : Thread.Scopes)
+            {
+                if (Scope.Name != InnerName)
+                {
+                    continue;
+                }
+                ++NumInnerScopes;
+                for (const FProfilerScope* Parent : OuterScopes)
+                {
+                    if (Parent->Depth + 1 == Scope.Depth && Parent->StartCycles <= Scope.StartCycles && Scope.EndCycles <= Parent->EndCycles)
+                    {
+                        ++NumNested;
+                        break;
+                    }
+                }
+            }
+        }
+        if (NumInnerScopes != NumFrames * NumInner || NumNested != NumInnerScopes)
+        {
+            UE_LOG(ELogLevel::Error, "bench profiler: %d of %d inner scopes nested under an outer scope (expected %d)",
+                NumNested, NumInnerScopes, NumFrames * NumInner
+            );
+            bPassed = false;
+        }
+
+        // 5) 백분위 계산 (1..100)
+        {
+            TArray<double> Values;
+            for (int32 Value = 100; Value >= 1; --Value)
+            {
+                Values.Add(Value);
+            }
+            const FProfilerStatSummary Summary = Profiler::SummarizeValues(FName("ProfilerTest_Percentile"), Values);
+            if (Summary.MinMs != 1.0 || Summary.MaxMs != 100.0 || Summary.AvgMs != 50.5 || Summary.P50Ms != 50.0 || Summary.P95Ms != 95.0 || Summary.P99Ms != 99.0)
+            {
+                UE_LOG(ELogLevel::Error, "bench profiler: percentiles of 1..100 are p50 %.1f p95 %.1f p99 %.1f", Summary.P50Ms, Summary.P95Ms, Summary.P99Ms);
+                bPassed = false;
+            }
+        }
+
+        // 6) 트레이스 파일에 모든 Inner 구간이 들어가는지
+        const FString TracePath = "Saved/ProfilerTest.json";
+        int32 NumTracedInner = 0;
+        if (Profiler::WriteChromeTrace(TracePath, NumFrames))
+        {
+            std::ifstream File(std::filesystem::path(TracePath.ToWideString()));
+            std::stringstream Contents;
+            Contents << File.rdbuf();
+            const std::string Text = Contents.str();
+            for (size_t Found = Text.find("\"ProfilerTest_Inner\""); Found != std::string::npos; Found = Text.find("\"ProfilerTest_Inner\"", Found + 1))
+            {
+                ++NumTracedInner;
+            }
+        }
+        if (NumTracedInner != NumFrames * NumInner)
+        {
+            UE_LOG(ELogLevel::Error, "bench profiler: trace has %d inner scopes, expected %d", NumTracedInner, NumFrames * NumInner);
+            bPassed = false;
+        }
+
+        UE_LOG(ELogLevel::Display,
+            "bench profiler %d frames: outer p50 %.3f p99 %.3f max %.3f ms, inner nested %d/%d, job on %d thread(s), trace %d scopes -> %s",
+            NumFrames, Outer->P50Ms, Outer->P99Ms, Outer->MaxMs, NumNested, NumInnerScopes, NumJobThreads, NumTracedInner,
+            bPassed ? "passed" : "FAILED"
+        );
+        return bPassed;
+    }
+
+    /**
+     * NumFiles개의 파일을 감시한 뒤 다음을 확인합니다.
+     * - 변경이 없는 프레임의 ProcessEvents가 대기열을 건드리지 않는지, 파일마다 수정 시각을 읽던 방식과 비용 비교
+     * - 파일을 고친 뒤 한 프레임(1/60초) 안에 콜백이 호출되는지
+     * - 수정 시각 비교 방식에서도 변경이 전달되는지
+     */
+    bool RunFileWatcherTests(int32 NumFiles)
+    {
+        NumFiles = std::max(NumFiles, 1);
+        constexpr int32 NumEditedFiles = 16;
+        constexpr int32 NumIdleFrames = 1000;
+        constexpr DWORD FrameTimeMs = 16;
+
+        const std::filesystem::path Directory = "Saved/FileWatchTest";
+        const std::filesystem::path PolledDirectory = Directory / "Polled";
+
+        std::error_code ErrorCode;
+        std::filesystem::remove_all(Directory, ErrorCode);
+        std::filesystem::create_directories(PolledDirectory, ErrorCode);
+
+        auto WriteTestFile = [](const std::filesystem::path& FilePath, int32 Value)
+        {
+            std::ofstream File(FilePath, std::ios::trunc);
+            File << "Value = " << Value << "\n";
+            return File.good();
+        };
+
+        TArray<std::filesystem::path> FilePaths;
+        FilePaths.Reserve(NumFiles);
+        for (int32 Index = 0; Index < NumFiles; ++Index)
+        {
+            std::filesystem::path FilePath = Directory / ("Script" + std::to_string(Index) + ".lua");
+            if (!WriteTestFile(FilePath, 0))
+            {
+                UE_LOG(ELogLevel::Error, "Failed to write test file: %s", FilePath.string().c_str());
+                return false;
+            }
+            FilePaths.Add(std::move(FilePath));
+        }
+        const std::filesystem::path PolledFilePath = PolledDirectory / "Polled.lua";
+        WriteTestFile(PolledFilePath, 0);
+
+        TArray<int32> NumCallbacks;
+        NumCallbacks.SetNum(NumFiles);
+        TArray<int32> ExpectedCallbacks;
+        ExpectedCallbacks.SetNum(NumFiles);
+        TArray<FFileWatchHandle> Handles;
+        for (int32 Index = 0; Index < NumFiles; ++Index)
+        {
+            Handles.Add(FFileWatcher::Watch(FilePaths[Index], [&NumCallbacks, Index](const std::filesystem::path&) { ++NumCallbacks[Index]; }));
+        }
+        int32 NumPolledCallbacks = 0;
+        Handles.Add(FFileWatcher::Watch(PolledFilePath, [&NumPolledCallbacks](const std::filesystem::path&) { ++NumPolledCallbacks; }, true));
+
+        // 파일을 만들 때의 알림이 늦게 도착할 수 있으므로 한 프레임 기다렸다가 비움
+        Sleep(FrameTimeMs);
+        FFileWatcher::ProcessEvents();
+        for (int32 Index = 0; Index < NumFiles; ++Index)
+        {
+            NumCallbacks[Index] = 0;
+        }
+        NumPolledCallbacks = 0;
+
+        bool bPassed = true;
+
+        // 1. 변경이 없는 프레임: 기존 방식은 파일마다 수정 시각을 읽었음
+        std::filesystem::file_time_type LatestWriteTime = std::filesystem::file_time_type::min();
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        for (const std::filesystem::path& FilePath : FilePaths)
+        {
+            LatestWriteTime = std::max(LatestWriteTime, std::filesystem::last_write_time(FilePath, ErrorCode));
+        }
+        const double StatMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        const uint64 DrainsBefore = FFileWatcher::GetNumDrains();
+        int32 NumIdleCallbacks = 0;
+        StartCycles = FPlatformTime::Cycles64();
+        for (int32 Frame = 0; Frame < NumIdleFrames; ++Frame)
+        {
+            NumIdleCallbacks += FFileWatcher::ProcessEvents();
+        }
+        const double IdleUs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) * 1000.0 / NumIdleFrames;
+        const uint64 IdleDrains = FFileWatcher::GetNumDrains() - DrainsBefore;
+        if (IdleDrains != 0 || NumIdleCallbacks != 0)
+        {
+            bPassed = false;
+        }
+
+        UE_LOG(ELogLevel::Display,
+            "bench filewatch %d files: idle frame %.3f us (%llu drains, %d callbacks over %d frames), stat per file %.3f ms/frame",
+            NumFiles, IdleUs, IdleDrains, NumIdleCallbacks, NumIdleFrames, StatMs
+        );
+
+        // 2. 파일을 고치고 한 프레임 뒤에 모두 전달되는지
+        const int32 NumEdited = std::min(NumEditedFiles, NumFiles);
+        const uint64 EditCycles = FPlatformTime::Cycles64();
+        for (int32 Index = 0; Index < NumEdited; ++Index)
+        {
+            const int32 FileIndex = Index * NumFiles / NumEdited;
+            WriteTestFile(FilePaths[FileIndex], 1);
+            ExpectedCallbacks[FileIndex] = 1;
+        }
+        Sleep(FrameTimeMs);
+        const int32 NumDelivered = FFileWatcher::ProcessEvents();
+        const double LatencyMs = FPlatformTime::ToMilliseconds(FFileWatcher::GetLastChangeCycles() - EditCycles);
+
+        int32 NumWrong = 0;
+        for (int32 Index = 0; Index < NumFiles; ++Index)
+        {
+            NumWrong += (NumCallbacks[Index] != ExpectedCallbacks[Index]) ? 1 : 0;
+        }
+        if (NumDelivered != NumEdited || NumWrong != 0)
+        {
+            bPassed = false;
+        }
+
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error,
+            "bench filewatch: %d edits, %d delivered after one frame (%d wrong), last change queued %.2f ms after the first write",
+            NumEdited, NumDelivered, NumWrong, LatencyMs
+        );
+
+        // 3. 수정 시각 비교: 주기 + 한 프레임 안에 전달되어야 함
+        WriteTestFile(PolledFilePath, 1);
+        const int32 MaxPolledFrames = static_cast<int32>(FFileWatcher::PollingIntervalMs / FrameTimeMs) + 2;
+        int32 NumPolledFrames = 0;
+        while (NumPolledCallbacks == 0 && NumPolledFrames < MaxPolledFrames)
+        {
+            Sleep(FrameTimeMs);
+            FFileWatcher::ProcessEvents();
+            ++NumPolledFrames;
+        }
+        if (NumPolledCallbacks != 1)
+        {
+            bPassed = false;
+        }
+
+        UE_LOG(NumPolledCallbacks == 1 ? ELogLevel::Display : ELogLevel::Error,
+            "bench filewatch: polling fallback delivered %d change(s) after %d frame(s) (limit %d)",
+            NumPolledCallbacks, NumPolledFrames, MaxPolledFrames
+        );
+
+        for (const FFileWatchHandle Handle : Handles)
+        {
+            FFileWatcher::Unwatch(Handle);
+        }
+        std::filesystem::remove_all(Directory, ErrorCode);
+
+        // 지운 파일의 알림이 남아 있을 수 있으므로 비움 (감시 해제 뒤라 전달되지는 않음)
+        FFileWatcher::ProcessEvents();
+        return bPassed;
+    }
+
+    /**
+     * 생성한 Mesh로 Cook된 캐시 파일의 Round Trip을 검사하고, 무작위로 손상시킨 데이터를 읽어 검증을 통과한 결과가 안전한지 검사합니다.
+     * @param NumFuzzIterations 손상시킨 데이터를 읽을 횟수
+     */
+    bool RunCookedMeshFileTests(int32 NumFuzzIterations)
+    {
+        std::mt19937 Random(1234);
+        std::uniform_real_distribution<float> FloatDist(-100.f, 100.f);
+
+        // 1. 테스트용 Mesh
+        constexpr int32 GridSize = 64;
+        FStaticMeshRenderData Mesh;
+        Mesh.ObjectName = L"Contents/CookedFileTest.obj";
+        Mesh.DisplayName = "CookedFileTest";
+        for (int32 i = 0; i < (GridSize + 1) * (GridSize + 1); ++i)
+        {
+            FStaticMeshVertex& Vertex = Mesh.Vertices[Mesh.Vertices.Emplace()];
+            Vertex = {};
+            float* Floats = &Vertex.X;
+            for (int32 FloatIndex = 0; FloatIndex < 16; ++FloatIndex)
+            {
+                Floats[FloatIndex] = FloatDist(Random);
+            }
+            Vertex.MaterialIndex = i % 2;
+        }
+        for (int32 Quad = 0; Quad < GridSize * GridSize; ++Quad)
+        {
+            const UINT Base = Quad / GridSize * (GridSize + 1) + Quad % GridSize;
+            for (const UINT Corner : { Base, Base + GridSize + 2, Base + 1, Base, Base + GridSize + 1, Base + GridSize + 2 })
+            {
+                Mesh.Indices.Add(Corner);
+            }
+        }
+        for (int32 MaterialIndex = 0; MaterialIndex < 2; ++MaterialIndex)
+        {
+            FObjMaterialInfo& Material = Mesh.Materials[Mesh.Materials.Emplace()];
+            Material.MaterialName = MaterialIndex == 0 ? "Body" : "Trim";
+            Material.IlluminanceModel = 2;
+            Material.TextureInfos.SetNum(static_cast<int32>(EMaterialTextureSlots::MTS_MAX));
+            Material.TextureInfos[0] = { "Body_BaseColor.png", L"Contents/Body_BaseColor.png", true };
+            Material.TextureFlag = static_cast<uint16>(EMaterialTextureFlags::MTF_Diffuse);
+
+            FMaterialSubset Subset = {};
+            Subset.MaterialName = Material.MaterialName;
+            Subset.IndexStart = MaterialIndex * Mesh.Indices.Num() / 2;
+            Subset.IndexCount = Mesh.Indices.Num() / 2;
+            Subset.MaterialIndex = MaterialIndex;
+            Mesh.MaterialSubsets.Add(Subset);
+        }
+        Mesh.BoundingBoxMin = FVector(-100.f, -100.f, -100.f);
+        Mesh.BoundingBoxMax = FVector(100.f, 100.f, 100.f);
+
+        TArray<FCookedMeshSource> Sources;
+        Sources.Add({ L"Contents/CookedFileTest.obj", 1234, 5678, 0x1234567890ABCDEFull });
+        Sources.Add({ L"Contents/CookedFileTest.mtl", -1, 0, 0 });
+
+        auto IsSameMesh = [](const FStaticMeshRenderData& A, const FStaticMeshRenderData& B)
+        {
+            if (A.ObjectName != B.ObjectName || !(A.DisplayName == B.DisplayName)
+                || A.Vertices.Num() != B.Vertices.Num() || A.Indices.Num() != B.Indices.Num()
+                || A.Materials.Num() != B.Materials.Num() || A.MaterialSubsets.Num() != B.MaterialSubsets.Num()
+                || std::memcmp(A.Vertices.GetData(), B.Vertices.GetData(), A.Vertices.Num() * sizeof(FStaticMeshVertex)) != 0
+                || std::memcmp(A.Indices.GetData(), B.Indices.GetData(), A.Indices.Num() * sizeof(UINT)) != 0
+                || !(A.BoundingBoxMin == B.BoundingBoxMin) || !(A.BoundingBoxMax == B.BoundingBoxMax))
+            {
+                return false;
+            }
+            for (int32 i = 0; i < A.Materials.Num(); ++i)
+            {
+                const FObjMaterialInfo& MaterialA = A.Materials[i];
+                const FObjMaterialInfo& MaterialB = B.Materials[i];
+                if (!(MaterialA.MaterialName == MaterialB.MaterialName) || MaterialA.TextureFlag != MaterialB.TextureFlag
+                    || MaterialA.IlluminanceModel != MaterialB.IlluminanceModel || !(MaterialA.DiffuseColor == MaterialB.DiffuseColor)
+                    || MaterialA.Roughness != MaterialB.Roughness || MaterialA.TextureInfos.Num() != MaterialB.TextureInfos.Num())
+                {
+                    return false;
+                }
+                for (int32 SlotIdx = 0; SlotIdx < MaterialA.TextureInfos.Num(); ++SlotIdx)
+                {
+                    const FTextureInfo& TextureA = MaterialA.TextureInfos[SlotIdx];
+                    const FTextureInfo& TextureB = MaterialB.TextureInfos[SlotIdx];
+                    if (!(TextureA.TextureName == TextureB.TextureName) || TextureA.TexturePath != TextureB.TexturePath || TextureA.bIsSRGB != TextureB.bIsSRGB)
+                    {
+                        return false;
+                    }
+                }
+            }
+            for (int32 i = 0; i < A.MaterialSubsets.Num(); ++i)
+            {
+                const FMaterialSubset& SubsetA = A.MaterialSubsets[i];
+                const FMaterialSubset& SubsetB = B.MaterialSubsets[i];
+                if (!(SubsetA.MaterialName == SubsetB.MaterialName) || SubsetA.IndexStart != SubsetB.IndexStart
+                    || SubsetA.IndexCount != SubsetB.IndexCount || SubsetA.MaterialIndex != SubsetB.MaterialIndex)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        // 2. Round Trip, 압축 여부 모두
+        TArray<uint8> ValidData[2];
+        bool bRoundTrip = true;
+        for (int32 bCompress = 0; bCompress < 2; ++bCompress)
+        {
+            FStaticMeshCookedFile::Serialize(Mesh, Sources, bCompress != 0, ValidData[bCompress]);
+
+            FStaticMeshRenderData Loaded;
+            TArray<FCookedMeshSource> LoadedSources;
+            bRoundTrip &= FStaticMeshCookedFile::Deserialize(ValidData[bCompress].GetData(), ValidData[bCompress].Num(), Loaded, &LoadedSources)
+                && IsSameMesh(Mesh, Loaded) && LoadedSources.Num() == Sources.Num();
+            for (int32 i = 0; bRoundTrip && i < Sources.Num(); ++i)
+            {
+                bRoundTrip &= LoadedSources[i].FilePath == Sources[i].FilePath && LoadedSources[i].Size == Sources[i].Size
+                    && LoadedSources[i].WriteTime == Sources[i].WriteTime && LoadedSources[i].ContentHash == Sources[i].ContentHash;
+            }
+        }
+
+        // 정점이 65536개 이상이면 32비트 Index로 저장됨
+        {
+            FStaticMeshRenderData LargeMesh = Mesh;
+            LargeMesh.Vertices.SetNum(70000);
+            LargeMesh.Indices.Add(69999);
+            LargeMesh.Indices.Add(65536);
+            LargeMesh.Indices.Add(0);
+
+            TArray<uint8> LargeData;
+            FStaticMeshCookedFile::Serialize(LargeMesh, Sources, false, LargeData);
+
+            FStaticMeshRenderData Loaded;
+            bRoundTrip &= FStaticMeshCookedFile::Deserialize(LargeData.GetData(), LargeData.Num(), Loaded) && IsSameMesh(LargeMesh, Loaded);
+        }
+
+        // 3. Fuzz: 손상시킨 뒤 절반은 해시를 다시 계산해서 구조 검증까지 가게 함
+        const int32 HeaderSize = static_cast<int32>(FStaticMeshCookedFile::GetHeaderSize());
+        int32 NumAccepted = 0;
+        bool bFuzzSafe = true;
+        std::uniform_int_distribution<int32> MutationDist(1, 8);
+        for (int32 Iteration = 0; Iteration < NumFuzzIterations; ++Iteration)
+        {
+            TArray<uint8> Data = ValidData[Iteration % 2];
+            const int32 NumMutations = MutationDist(Random);
+            for (int32 Mutation = 0; Mutation < NumMutations && Data.Num() > 0; ++Mutation)
+            {
+                // Header를 더 자주 건드림
+                const int32 Range = Random() % 2 ? HeaderSize : Data.Num();
+                const int32 Position = static_cast<int32>(Random() % std::min(Range, Data.Num()));
+                switch (Random() % 4)
+                {
+                case 0:
+                    Data[Position] ^= static_cast<uint8>(1u << (Random() % 8));
+                    break;
+                case 1:
+                    Data[Position] = static_cast<uint8>(Random());
+                    break;
+                case 2:
+                    if (Position + 4 <= Data.Num())
+                    {
+                        const uint32 Value = Random() % 3 == 0 ? 0xFFFFFFFFu : static_cast<uint32>(Random() % 1024);
+                        std::memcpy(Data.GetData() + Position, &Value, sizeof(Value));
+                    }
+                    break;
+                default:
+                    Data.SetNum(Position);
+                    break;
+                }
+            }
+
+            if (Data.Num() >= HeaderSize && Random() % 2)
+            {
+                FStaticMeshCookedFile::RewriteHeader(Data, Random() % 2 != 0);
+            }
+
+            FStaticMeshRenderData Loaded;
+            if (FStaticMeshCookedFile::Deserialize(Data.GetData(), Data.Num(), Loaded))
+            {
+                ++NumAccepted;
+
+                // 통과했다면 렌더러가 그대로 써도 안전해야 함
+                for (const UINT Index : Loaded.Indices)
+                {
+                    bFuzzSafe &= Index < static_cast<UINT>(Loaded.Vertices.Num());
+                }
+                for (const FMaterialSubset& Subset : Loaded.MaterialSubsets)
+                {
+                    bFuzzSafe &= static_cast<uint64>(Subset.IndexStart) + Subset.IndexCount <= static_cast<uint64>(Loaded.Indices.Num());
+                }
+            }
+        }
+
+        // 4. 읽기 시간
+        constexpr int32 Iterations = 50;
+        double LoadMs[2] = {};
+        for (int32 bCompress = 0; bCompress < 2; ++bCompress)
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            for (int32 i = 0; i < Iterations; ++i)
+            {
+                FStaticMeshRenderData Loaded;
+                FStaticMeshCookedFile::Deserialize(ValidData[bCompress].GetData(), ValidData[bCompress].Num(), Loaded);
+            }
+            LoadMs[bCompress] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / Iterations;
+        }
+
+        UE_LOG(
+            ELogLevel::Display,
+            "bench meshcache: round trip %s, fuzz %d iterations (%d accepted) %s, 16-bit indices %d bytes %.3f ms, compressed indices %d bytes %.3f ms",
+            bRoundTrip ? "OK" : "FAILED", NumFuzzIterations, NumAccepted, bFuzzSafe ? "OK" : "FAILED",
+            ValidData[0].Num(), LoadMs[0], ValidData[1].Num(), LoadMs[1]
+        );
+        return bRoundTrip && bFuzzSafe;
+    }
+
+    /**
+     * 스크립트 인스턴스 NumInstances개를 컴포넌트마다 sol::state를 만들던 방식과 공유 VM 방식으로 각각 만들고,
+     * NumFrames 프레임 동안 Tick을 호출하며 생성 시간, 프레임당 Tick 시간, Lua 힙과 프로세스 메모리 증가량을 비교합니다.
+     * @return 공유 VM에서 인스턴스끼리 전역 변수가 섞이지 않았는지 여부
+     */
+    bool RunLuaBenchmark(int32 NumInstances, int32 NumFrames)
+    {
+        NumInstances = FMath::Max(NumInstances, 1);
+        NumFrames = FMath::Max(NumFrames, 1);
+        constexpr float DeltaTime = 1.f / 60.f;
+
+        // 1) 기존 방식: 인스턴스마다 sol::state를 열고, 호출할 때마다 문자열로 함수를 찾음
+        {
+            const uint64 MemoryBefore = GetProcessWorkingSetBytes();
+            uint64 StartCycles = FPlatformTime::Cycles64();
+
+            TArray<std::unique_ptr<sol::state>> States;
+            States.Reserve(NumInstances);
+            for (int32 Index = 0; Index < NumInstances; ++Index)
+            {
+                std::unique_ptr<sol::state> State = std::make_unique<sol::state>();
+                State->open_libraries();
+                FLuaScriptManager::BindEngineAPI(*State);
+                State->script(BenchmarkScript);
+                if ((*State)["BeginPlay"].valid())
+                {
+                    (*State)["BeginPlay"]();
+                }
+                States.Add(std::move(State));
+            }
+            const double CreateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+            const int64 MemoryDelta = static_cast<int64>(GetProcessWorkingSetBytes()) - static_cast<int64>(MemoryBefore);
+
+            StartCycles = FPlatformTime::Cycles64();
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                for (const std::unique_ptr<sol::state>& State : States)
+                {
+                    if ((*State)["Tick"].valid())
+                    {
+                        (*State)["Tick"](DeltaTime);
+                    }
+                }
+            }
+            const double TickMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / NumFrames;
+
+            int64 HeapKB = 0;
+            for (const std::unique_ptr<sol::state>& State : States)
+            {
+                HeapKB += lua_gc(State->lua_state(), LUA_GCCOUNT, 0);
+            }
+
+            UE_LOG(ELogLevel::Display,
+                TEXT("bench lua %d: state per instance, create %.2f ms, tick %.3f ms/frame, Lua heap %.1f MB, working set +%.1f MB"),
+                NumInstances, CreateMs, TickMs, HeapKB / 1024.0, ToMegabytes(MemoryDelta)
+            );
+        }
+
+        // 2) 공유 VM: 한 번 컴파일한 스크립트를 인스턴스마다 환경 테이블에서 실행하고, Tick은 미리 찾아 둔 함수로 호출
+        // 컴포넌트와 같은 경로(파일 컴파일과 바이트코드 캐시)를 거치도록 스크립트를 파일로 씀
+        const FString ScriptPath = "Saved/LuaBenchmark.lua";
+        {
+            std::ofstream File(std::filesystem::path(ScriptPath.ToWideString()), std::ios::trunc);
+            File << BenchmarkScript;
+            if (!File.good())
+            {
+                UE_LOG(ELogLevel::Error, "bench lua: failed to write %s", *ScriptPath);
+                return false;
+            }
+        }
+
+        bool bIsolated = true;
+        {
+            const uint64 MemoryBefore = GetProcessWorkingSetBytes();
+            uint64 StartCycles = FPlatformTime::Cycles64();
+
+            FLuaScriptManager Manager;
+            TArray<sol::environment> Environments;
+            TArray<sol::protected_function> TickFunctions;
+            Environments.Reserve(NumInstances);
+            TickFunctions.Reserve(NumInstances);
+            for (int32 Index = 0; Index < NumInstances; ++Index)
+            {
+                sol::environment Environment = Manager.CreateScriptEnvironment(ScriptPath, nullptr);
+                const sol::protected_function BeginPlay = Environment.raw_get<sol::protected_function>("BeginPlay");
+                if (BeginPlay.valid())
+                {
+                    BeginPlay();
+                }
+                TickFunctions.Add(Environment.raw_get<sol::protected_function>("Tick"));
+                Environments.Add(std::move(Environment));
+            }
+            const double CreateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+            const int64 MemoryDelta = static_cast<int64>(GetProcessWorkingSetBytes()) - static_cast<int64>(MemoryBefore);
+
+            StartCycles = FPlatformTime::Cycles64();
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                for (const sol::protected_function& Tick : TickFunctions)
+                {
+                    Tick(DeltaTime);
+                }
+            }
+            const double TickMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / NumFrames;
+
+            UE_LOG(ELogLevel::Display,
+                TEXT("bench lua %d: shared VM, create %.2f ms, tick %.3f ms/frame, Lua heap %.1f MB, working set +%.1f MB"),
+                NumInstances, CreateMs, TickMs, Manager.GetMemoryUsageKB() / 1024.0, ToMegabytes(MemoryDelta)
+            );
+
+            // 전역 변수가 섞였다면 Elapsed가 인스턴스 수만큼 더 커짐
+            const double Expected = static_cast<double>(NumFrames) * DeltaTime * 2.0;
+            for (const sol::environment& Environment : Environments)
+            {
+                const double Elapsed = Environment.get_or("Elapsed", -1.0);
+                if (FMath::Abs(Elapsed - Expected) > Expected * 1e-3)
+                {
+                    bIsolated = false;
+                    break;
+                }
+            }
+        }
+
+        if (!bIsolated)
+        {
+            UE_LOG(ELogLevel::Error, TEXT("bench lua: script globals leaked between environments"));
+        }
+        return bIsolated;
+    }
+
+    /** UPrimitiveComponent::IntersectRayTriangle과 같은 계산 (Möller–Trumbore) */
+    bool IntersectRayTriangle(const FVector& RayOrigin, const FVector& RayDirection, const FVector& v0, const FVector& v1, const FVector& v2, float& OutHitDistance)
+    {
+        const FVector Edge1 = v1 - v0;
+        const FVector Edge2 = v2 - v0;
+
+        const FVector h = RayDirection.Cross(Edge2);
+        const float a = Edge1.Dot(h);
+        if (fabs(a) < SMALL_NUMBER)
+        {
+            return false;
+        }
+
+        const float f = 1.0f / a;
+        const FVector s = RayOrigin - v0;
+        const float u = f * s.Dot(h);
+        if (u < 0.0f || u > 1.0f)
+        {
+            return false;
+        }
+
+        const FVector q = s.Cross(Edge1);
+        const float v = f * RayDirection.Dot(q);
+        if (v < 0.0f || (u + v) > 1.0f)
+        {
+            return false;
+        }
+
+        const float t = f * Edge2.Dot(q);
+        if (t > SMALL_NUMBER)
+        {
+            OutHitDistance = t;
+            return true;
+        }
+        return false;
+    }
+
+    /** 컴포넌트의 CheckRayIntersection처럼 교차 수와 가장 가까운 거리를 구함 */
+    struct FRayHitResult
+    {
+        int32 NumHits = 0;
+        float Distance = FLT_MAX;
+
+        bool operator==(const FRayHitResult& Other) const
+        {
+            return NumHits == Other.NumHits && Distance == Other.Distance;
+        }
+    };
+
+    void TestTriangle(const FStaticMeshRenderData& StaticMesh, int32 TriangleIndex, const FVector& Origin, const FVector& Direction, FRayHitResult& Result)
+    {
+        FVector Corners[3];
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const FStaticMeshVertex& Vertex = StaticMesh.Vertices[StaticMesh.Indices[TriangleIndex * 3 + Corner]];
+            Corners[Corner] = FVector(Vertex.X, Vertex.Y, Vertex.Z);
+        }
+
+        float HitDistance = FLT_MAX;
+        if (IntersectRayTriangle(Origin, Direction, Corners[0], Corners[1], Corners[2], HitDistance))
+        {
+            Result.Distance = std::min(Result.Distance, HitDistance);
+            ++Result.NumHits;
+        }
+    }
+
+    /**
+     * 반직선을 쏴서 전체 검사와 BVH의 결과를 비교합니다.
+     * @return 결과가 다른 반직선 수
+     */
+    int32 CompareRayCasts(
+        const FStaticMeshRenderData& StaticMesh, const FMeshBVH& BVH, const TArray<FVector>& Origins, const TArray<FVector>& Directions,
+        double& OutBruteForceMs, double& OutBVHMs
+    )
+    {
+        const int32 NumTriangles = StaticMesh.Indices.Num() / 3;
+
+        TArray<FRayHitResult> BruteForceResults;
+        BruteForceResults.SetNum(Origins.Num());
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 RayIdx = 0; RayIdx < Origins.Num(); ++RayIdx)
+        {
+            for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
+            {
+                TestTriangle(StaticMesh, TriangleIdx, Origins[RayIdx], Directions[RayIdx], BruteForceResults[RayIdx]);
+            }
+        }
+        OutBruteForceMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        TArray<FRayHitResult> BVHResults;
+        BVHResults.SetNum(Origins.Num());
+        StartCycles = FPlatformTime::Cycles64();
+        for (int32 RayIdx = 0; RayIdx < Origins.Num(); ++RayIdx)
+        {
+            BVH.RayCast(
+                Origins[RayIdx], Directions[RayIdx], [&](int32 TriangleIdx)
+                {
+                    TestTriangle(StaticMesh, TriangleIdx, Origins[RayIdx], Directions[RayIdx], BVHResults[RayIdx]);
+                }
+            );
+        }
+        OutBVHMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        int32 NumMismatches = 0;
+        for (int32 RayIdx = 0; RayIdx < Origins.Num(); ++RayIdx)
+        {
+            if (!(BruteForceResults[RayIdx] == BVHResults[RayIdx]))
+            {
+                ++NumMismatches;
+            }
+        }
+        return NumMismatches;
+    }
+
+    /**
+     * 메시를 둘러싼 구 위에서 메시 쪽으로 반직선을 만듭니다.
+     * 절반은 삼각형 위의 점(꼭짓점과 모서리 포함)을, 나머지는 Bounding Box 안의 임의의 점을 향합니다.
+     */
+    void MakeRays(const FStaticMeshRenderData& StaticMesh, int32 NumRays, std::mt19937& Random, TArray<FVector>& OutOrigins, TArray<FVector>& OutDirections)
+    {
+        FVector Min(FLT_MAX);
+        FVector Max(-FLT_MAX);
+        for (const FStaticMeshVertex& Vertex : StaticMesh.Vertices)
+        {
+            Min = FVector(std::min(Min.X, Vertex.X), std::min(Min.Y, Vertex.Y), std::min(Min.Z, Vertex.Z));
+            Max = FVector(std::max(Max.X, Vertex.X), std::max(Max.Y, Vertex.Y), std::max(Max.Z, Vertex.Z));
+        }
+        const FVector Center = (Min + Max) * 0.5f;
+        const float Radius = std::max((Max - Min).Length(), 1.f) * 2.f;
+
+        std::uniform_real_distribution<float> Unit(0.f, 1.f);
+        std::uniform_int_distribution<int32> Triangle(0, StaticMesh.Indices.Num() / 3 - 1);
+
+        OutOrigins.Empty();
+        OutDirections.Empty();
+        for (int32 RayIdx = 0; RayIdx < NumRays; ++RayIdx)
+        {
+            const float CosTheta = Unit(Random) * 2.f - 1.f;
+            const float SinTheta = std::sqrt(std::max(1.f - CosTheta * CosTheta, 0.f));
+            const float Phi = Unit(Random) * 2.f * PI;
+            const FVector Origin = Center + FVector(SinTheta * std::cos(Phi), SinTheta * std::sin(Phi), CosTheta) * Radius;
+
+            FVector Target;
+            if (RayIdx % 2 == 0)
+            {
+                const int32 TriangleIdx = Triangle(Random);
+                FVector Corners[3];
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const FStaticMeshVertex& Vertex = StaticMesh.Vertices[StaticMesh.Indices[TriangleIdx * 3 + Corner]];
+                    Corners[Corner] = FVector(Vertex.X, Vertex.Y, Vertex.Z);
+                }
+
+                // 경계에서 놓치는 삼각형이 없는지 보기 위해 꼭짓점과 모서리도 겨냥
+                switch (RayIdx % 8)
+                {
+                case 0:
+                    Target = Corners[RayIdx / 8 % 3];
+                    break;
+                case 2:
+                    Target = (Corners[0] + Corners[1]) * 0.5f;
+                    break;
+                default:
+                {
+                    float U = Unit(Random);
+                    float V = Unit(Random);
+                    if (U + V > 1.f)
+                    {
+                        U = 1.f - U;
+                        V = 1.f - V;
+                    }
+                    Target = Corners[0] + (Corners[1] - Corners[0]) * U + (Corners[2] - Corners[0]) * V;
+                    break;
+                }
+                }
+            }
+            else
+            {
+                Target = FVector(
+                    Min.X + (Max.X - Min.X) * Unit(Random),
+                    Min.Y + (Max.Y - Min.Y) * Unit(Random),
+                    Min.Z + (Max.Z - Min.Z) * Unit(Random)
+                );
+            }
+
+            OutOrigins.Add(Origin);
+            OutDirections.Add((Target - Origin).GetSafeNormal());
+        }
+    }
+
+    /**
+     * OBJ마다 무작위 반직선을 전체 삼각형 검사와 BVH로 쏴서 교차 수와 가장 가까운 거리가 같은지 비교하고 시간을 측정합니다.
+     * 정점을 흔든 뒤 Refit한 결과도 같은 방법으로 비교합니다.
+     * @param ObjFilePath 검사할 OBJ, 비어 있으면 Assets/와 Contents/ 아래의 모든 OBJ
+     * @param NumRays 메시마다 쏠 반직선 수
+     * @return 모든 결과가 같은지 여부
+     */
+    bool RunMeshBVHBenchmark(const FString& ObjFilePath, int32 NumRays)
+    {
+        const TArray<FString> ObjFilePaths = FindObjFiles(ObjFilePath);
+
+        std::mt19937 Random(1234);
+        int32 NumMeshes = 0;
+        int32 NumMismatches = 0;
+        double TotalBruteForceMs = 0.0;
+        double TotalBVHMs = 0.0;
+        for (const FString& Path : ObjFilePaths)
+        {
+            FObjInfo ObjInfo;
+            FStaticMeshRenderData StaticMesh;
+            if (!FObjLoader::ParseOBJ(Path, ObjInfo))
+            {
+                UE_LOG(ELogLevel::Error, "Failed to open file for reading: %s", *Path);
+                ++NumMismatches;
+                continue;
+            }
+            StaticMesh.MaterialSubsets = ObjInfo.MaterialSubsets;
+            if (!FObjLoader::ConvertToStaticMesh(ObjInfo, StaticMesh) || StaticMesh.Indices.Num() < 3)
+            {
+                continue;
+            }
+
+            FMeshBVH BVH;
+            uint64 StartCycles = FPlatformTime::Cycles64();
+            BVH.Build(StaticMesh.Vertices, StaticMesh.Indices);
+            const double BuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            TArray<FVector> Origins;
+            TArray<FVector> Directions;
+            MakeRays(StaticMesh, NumRays, Random, Origins, Directions);
+
+            double BruteForceMs = 0.0;
+            double BVHMs = 0.0;
+            int32 MeshMismatches = CompareRayCasts(StaticMesh, BVH, Origins, Directions, BruteForceMs, BVHMs);
+
+            // 스키닝처럼 정점만 움직인 뒤 Refit한 트리도 같은 결과를 내는지 확인
+            FVector Min(FLT_MAX);
+            FVector Max(-FLT_MAX);
+            for (const FStaticMeshVertex& Vertex : StaticMesh.Vertices)
+            {
+                Min = FVector(std::min(Min.X, Vertex.X), std::min(Min.Y, Vertex.Y), std::min(Min.Z, Vertex.Z));
+                Max = FVector(std::max(Max.X, Vertex.X), std::max(Max.Y, Vertex.Y), std::max(Max.Z, Vertex.Z));
+            }
+            const float Size = std::max((Max - Min).Length(), 1.f);
+            for (FStaticMeshVertex& Vertex : StaticMesh.Vertices)
+            {
+                Vertex.Z += std::sin(Vertex.X / Size * 2.f * PI) * Size * 0.1f;
+            }
+
+            StartCycles = FPlatformTime::Cycles64();
+            BVH.Refit(StaticMesh.Vertices, StaticMesh.Indices);
+            const double RefitMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            double RefitBruteForceMs = 0.0;
+            double RefitBVHMs = 0.0;
+            MakeRays(StaticMesh, NumRays, Random, Origins, Directions);
+            MeshMismatches += CompareRayCasts(StaticMesh, BVH, Origins, Directions, RefitBruteForceMs, RefitBVHMs);
+
+            if (MeshMismatches > 0)
+            {
+                UE_LOG(ELogLevel::Warning, "BVH ray cast differs from brute force on %d rays: %s", MeshMismatches, *Path);
+            }
+
+            UE_LOG(
+                ELogLevel::Display,
+                "%s: %d triangles, %d nodes, depth %d, build %.2f ms, refit %.2f ms, %d rays brute force %.2f ms, BVH %.2f ms (x%.1f), refit BVH %.2f ms",
+                *Path, StaticMesh.Indices.Num() / 3, BVH.GetNumNodes(), BVH.GetDepth(), BuildMs, RefitMs, NumRays,
+                BruteForceMs, BVHMs, BruteForceMs / std::max(BVHMs, 0.001), RefitBVHMs
+            );
+
+            ++NumMeshes;
+            NumMismatches += MeshMismatches;
+            TotalBruteForceMs += BruteForceMs;
+            TotalBVHMs += BVHMs;
+        }
+
+        UE_LOG(
+            ELogLevel::Display,
+            "bench meshbvh %d meshes: brute force %.2f ms, BVH %.2f ms (x%.1f), %d mismatches",
+            NumMeshes, TotalBruteForceMs, TotalBVHMs, TotalBruteForceMs / std::max(TotalBVHMs, 0.001), NumMismatches
+        );
+        return NumMismatches == 0;
+    }
+
+    /** 정점 내용과 감기 방향으로 비교하는 삼각형, 시작 정점에 상관없이 같은 값이 되도록 회전 */
+    struct FTriangleKey
+    {
+        uint64 Hashes[3];
+
+        bool operator<(const FTriangleKey& Other) const
+        {
+            return std::lexicographical_compare(Hashes, Hashes + 3, Other.Hashes, Other.Hashes + 3);
+        }
+        bool operator==(const FTriangleKey& Other) const
+        {
+            return std::equal(Hashes, Hashes + 3, Other.Hashes);
+        }
+    };
+
+    uint64 HashVertex(const FStaticMeshVertex& Vertex)
+    {
+        const uint8* Bytes = reinterpret_cast<const uint8*>(&Vertex);
+        uint64 Hash = 0xCBF29CE484222325ull;
+        for (size_t ByteIdx = 0; ByteIdx < sizeof(FStaticMeshVertex); ++ByteIdx)
+        {
+            Hash = (Hash ^ Bytes[ByteIdx]) * 0x100000001B3ull;
+        }
+        return Hash;
+    }
+
+    TArray<FTriangleKey> MakeTriangleKeys(const FStaticMeshRenderData& StaticMesh, uint32 IndexStart, uint32 IndexCount)
+    {
+        TArray<FTriangleKey> Keys;
+        Keys.Reserve(static_cast<int32>(IndexCount / 3));
+        for (uint32 Corner = IndexStart; Corner + 3 <= IndexStart + IndexCount; Corner += 3)
+        {
+            uint64 Hashes[3];
+            for (int32 CornerIdx = 0; CornerIdx < 3; ++CornerIdx)
+            {
+                Hashes[CornerIdx] = HashVertex(StaticMesh.Vertices[StaticMesh.Indices[Corner + CornerIdx]]);
+            }
+
+            const int32 First = static_cast<int32>(std::min_element(Hashes, Hashes + 3) - Hashes);
+            Keys.Add({ { Hashes[First], Hashes[(First + 1) % 3], Hashes[(First + 2) % 3] } });
+        }
+        Keys.Sort();
+        return Keys;
+    }
+
+    /**
+     * OBJ를 최적화하며 시간과 ACMR/ATVR을 측정하고, Subset마다 같은 삼각형이 그려지는지 검사합니다.
+     * @param ObjFilePath 최적화할 OBJ, 비어 있으면 Assets/와 Contents/ 아래의 모든 OBJ
+     * @return 모든 파일의 삼각형이 같은지 여부
+     */
+    bool RunMeshOptimizeBenchmark(const FString& ObjFilePath)
+    {
+        const TArray<FString> ObjFilePaths = FindObjFiles(ObjFilePath);
+
+        int32 NumMeshes = 0;
+        int32 NumMismatches = 0;
+        int64 TotalTriangles = 0;
+        double TotalMs = 0.0;
+        double WeightedBefore = 0.0;
+        double WeightedAfter = 0.0;
+        for (const FString& Path : ObjFilePaths)
+        {
+            FObjInfo ObjInfo;
+            FStaticMeshRenderData StaticMesh;
+            if (!FObjLoader::ParseOBJ(Path, ObjInfo))
+            {
+                UE_LOG(ELogLevel::Error, "Failed to open file for reading: %s", *Path);
+                ++NumMismatches;
+                continue;
+            }
+            StaticMesh.MaterialSubsets = ObjInfo.MaterialSubsets;
+            if (!FObjLoader::ConvertToStaticMesh(ObjInfo, StaticMesh) || StaticMesh.Indices.Num() == 0)
+            {
+                continue;
+            }
+
+            TArray<FMaterialSubset> Ranges = StaticMesh.MaterialSubsets;
+            if (Ranges.Num() == 0)
+            {
+                FMaterialSubset WholeMesh = {};
+                WholeMesh.IndexCount = StaticMesh.Indices.Num();
+                Ranges.Add(WholeMesh);
+            }
+
+            TArray<TArray<FTriangleKey>> KeysBefore;
+            for (const FMaterialSubset& Range : Ranges)
+            {
+                KeysBefore.Add(MakeTriangleKeys(StaticMesh, Range.IndexStart, Range.IndexCount));
+            }
+
+            FVertexCacheStatistics Before;
+            FVertexCacheStatistics After;
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            const bool bOptimized = FStaticMeshOptimizer::Optimize(StaticMesh, &Before, &After);
+            const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            bool bSame = bOptimized;
+            for (int32 RangeIdx = 0; bSame && RangeIdx < Ranges.Num(); ++RangeIdx)
+            {
+                const TArray<FTriangleKey> KeysAfter = MakeTriangleKeys(StaticMesh, Ranges[RangeIdx].IndexStart, Ranges[RangeIdx].IndexCount);
+                bSame = KeysAfter.GetContainerPrivate() == KeysBefore[RangeIdx].GetContainerPrivate();
+            }
+            if (!bSame)
+            {
+                UE_LOG(ELogLevel::Warning, "Mesh optimization changed the triangles: %s", *Path);
+                ++NumMismatches;
+            }
+
+            const int32 NumTriangles = StaticMesh.Indices.Num() / 3;
+            UE_LOG(
+                ELogLevel::Display,
+                "%s: %d triangles, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, %.2f ms",
+                *Path, NumTriangles, Before.ACMR, After.ACMR, Before.ATVR, After.ATVR, ElapsedMs
+            );
+
+            ++NumMeshes;
+            TotalTriangles += NumTriangles;
+            TotalMs += ElapsedMs;
+            WeightedBefore += static_cast<double>(Before.ACMR) * NumTriangles;
+            WeightedAfter += static_cast<double>(After.ACMR) * NumTriangles;
+        }
+
+        const double TriangleCount = static_cast<double>(std::max<int64>(TotalTriangles, 1));
+        UE_LOG(
+            ELogLevel::Display,
+            "bench meshopt %d meshes (%lld triangles): ACMR %.3f -> %.3f, %.2f ms (%.1f M triangles/s), %d mismatches",
+            NumMeshes, TotalTriangles, WeightedBefore / TriangleCount, WeightedAfter / TriangleCount,
+            TotalMs, static_cast<double>(TotalTriangles) / std::max(TotalMs, 0.001) / 1000.0, NumMismatches
+        );
+        return NumMismatches == 0;
+    }
+
+    /** 기존 파서가 FObjInfo의 파일 경로와 이름을 채우던 방식 */
+    void SetLegacyObjFileNames(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+    {
+        OutObjInfo.FilePath = ObjFilePath.ToWideString().substr(0, ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);
+        OutObjInfo.ObjectName = ObjFilePath.ToWideString();
+        // ObjectName은 wstring 타입이므로, 이를 string으로 변환 (간단한 ASCII 변환의 경우)
+        std::wstring wideName = OutObjInfo.ObjectName.substr(ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);;
+        std::string fileName(wideName.begin(), wideName.end());
+
+        // 마지막 '.'을 찾아 확장자를 제거
+        size_t dotPos = fileName.find_last_of('.');
+        if (dotPos != std::string::npos)
+        {
+            OutObjInfo.DisplayName = fileName.substr(0, dotPos);
+        }
+        else
+        {
+            OutObjInfo.DisplayName = fileName;
+        }
+    }
+
+    /**
+     * std::getline과 std::istringstream으로 한 줄씩 읽던 기존 OBJ 파서입니다.
+     * bench objparse에서 FObjLoader::ParseOBJ와 결과와 속도를 비교하는 기준으로만 사용합니다.
+     */
+    bool ParseOBJLegacy(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+    {
+        std::ifstream OBJ(ObjFilePath.ToWideString());
+        if (!OBJ)
+        {
+            return false;
+        }
+
+        SetLegacyObjFileNames(ObjFilePath, OutObjInfo);
+
+        std::string Line;
+
+        while (std::getline(OBJ, Line))
+        {
+            if (Line.empty() || Line[0] == '#')
+                continue;
+
+            std::istringstream LineStream(Line);
+            std::string Token;
+            LineStream >> Token;
+
+            if (Token == "mtllib")
+            {
+                LineStream >> Line;
+                OutObjInfo.MatName = Line;
+                continue;
+            }
+
+            if (Token == "usemtl")
+            {
+                LineStream >> Line;
+                FString MatName(Line);
+
+                if (!OutObjInfo.MaterialSubsets.IsEmpty())
+                {
+                    FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+                    LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+                }
+
+                FMaterialSubset MaterialSubset;
+                MaterialSubset.MaterialName = MatName;
+                MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
+                MaterialSubset.IndexCount = 0;
+                OutObjInfo.MaterialSubsets.Add(MaterialSubset);
+            }
+
+            if (Token == "g" || Token == "o")
+            {
+                LineStream >> Line;
+                OutObjInfo.GroupName.Add(Line);
+                OutObjInfo.NumOfGroup++;
+            }
+
+            if (Token == "v") // Vertex
+            {
+                float X, Y, Z;
+                LineStream >> X >> Y >> Z;
+                OutObjInfo.Vertices.Add(FVector(X, Y * -1.f, Z));
+                continue;
+            }
+
+            if (Token == "vn") // Normal
+            {
+                float NormalX, NormalY, NormalZ;
+                LineStream >> NormalX >> NormalY >> NormalZ;
+                OutObjInfo.Normals.Add(FVector(NormalX, NormalY * -1.f, NormalZ));
+                continue;
+            }
+
+            if (Token == "vt") // Texture
+            {
+                float U, V;
+                LineStream >> U >> V;
+                OutObjInfo.UVs.Add(FVector2D(U, 1.f - V));
+                continue;
+            }
+
+            if (Token == "f")
+            {
+                TArray<uint32> FaceVertexIndices;  // 이번 페이스의 정점 인덱스
+                TArray<uint32> FaceNormalIndices;  // 이번 페이스의 법선 인덱스
+                TArray<uint32> FaceUVIndices; // 이번 페이스의 텍스처 인덱스
+
+                while (LineStream >> Token)
+                {
+                    std::istringstream TokenStream(Token);
+                    std::string Part;
+                    TArray<std::string> FacePieces;
+
+                    uint32 vertexIndex = 0;
+                    uint32 textureIndex = UINT32_MAX;
+                    uint32 normalIndex = UINT32_MAX;
+
+                    // v
+                    if (std::getline(TokenStream, Part, '/'))
+                    {
+                        if (!Part.empty())
+                        {
+                            vertexIndex = std::stoi(Part) - 1;
+                        }
+                    }
+
+                    // vt
+                    if (std::getline(TokenStream, Part, '/'))
+                    {
+                        if (!Part.empty())
+                        {
+                            textureIndex = std::stoi(Part) - 1;
+                        }
+                    }
+
+                    // vn
+                    if (std::getline(TokenStream, Part, '/'))
+                    {
+                        if (!Part.empty())
+                        {
+                            normalIndex = std::stoi(Part) - 1;
+                        }
+                    }
+
+                    FaceVertexIndices.Add(vertexIndex);
+                    FaceUVIndices.Add(textureIndex);
+                    FaceNormalIndices.Add(normalIndex);
+                }
+
+                if (FaceVertexIndices.Num() == 3) // 삼각형
+                {
+                    // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
+
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
+
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
+                }
+                else if (FaceVertexIndices.Num() == 4) // 쿼드
+                {
+                    // 첫 번째 삼각형: 0-2-1
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
+
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
+
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
+
+                    // 두 번째 삼각형: 0-3-2
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[3]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
+
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[3]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
+
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[3]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                }
+            }
+        }
+
+        if (!OutObjInfo.MaterialSubsets.IsEmpty())
+        {
+            FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+            LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+        }
+
+        return true;
+    }
+
+    /** MaterialIndex는 CombineMaterialIndex에서 정해지므로 비교하지 않습니다. */
+    bool IsSameObjInfo(const FObjInfo& A, const FObjInfo& B)
+    {
+        auto IsSameArray = [](const auto& ArrayA, const auto& ArrayB)
+        {
+            return ArrayA.Num() == ArrayB.Num() && std::memcmp(ArrayA.GetData(), ArrayB.GetData(), sizeof(*ArrayA.GetData()) * ArrayA.Num()) == 0;
+        };
+
+        if (A.ObjectName != B.ObjectName || A.FilePath != B.FilePath || A.DisplayName != B.DisplayName || A.MatName != B.MatName
+            || A.NumOfGroup != B.NumOfGroup || A.GroupName.Num() != B.GroupName.Num() || A.MaterialSubsets.Num() != B.MaterialSubsets.Num())
+        {
+            return false;
+        }
+
+        for (int32 i = 0; i < A.GroupName.Num(); ++i)
+        {
+            if (A.GroupName[i] != B.GroupName[i])
+            {
+                return false;
+            }
+        }
+
+        for (int32 i = 0; i < A.MaterialSubsets.Num(); ++i)
+        {
+            const FMaterialSubset& SubsetA = A.MaterialSubsets[i];
+            const FMaterialSubset& SubsetB = B.MaterialSubsets[i];
+            if (SubsetA.MaterialName != SubsetB.MaterialName || SubsetA.IndexStart != SubsetB.IndexStart || SubsetA.IndexCount != SubsetB.IndexCount)
+            {
+                return false;
+            }
+        }
+
+        return IsSameArray(A.Vertices, B.Vertices) && IsSameArray(A.Normals, B.Normals) && IsSameArray(A.UVs, B.UVs)
+            && IsSameArray(A.VertexIndices, B.VertexIndices) && IsSameArray(A.UVIndices, B.UVIndices) && IsSameArray(A.NormalIndices, B.NormalIndices);
+    }
+
+    /**
+     * FObjLoader::ParseOBJ를 기존 getline 파서와 비교해 시간을 측정하고 FObjInfo가 같은지 검사합니다.
+     * @param ObjFilePath 파싱할 OBJ, 비어 있으면 Assets/와 Contents/ 아래의 모든 OBJ
+     * @param Iterations 파일마다 측정할 반복 횟수
+     * @return 모든 파일의 결과가 같은지 여부
+     */
+    bool RunObjParseBenchmark(const FString& ObjFilePath, int32 Iterations)
+    {
+        Iterations = std::max(Iterations, 1);
+
+        const TArray<FString> ObjFilePaths = FindObjFiles(ObjFilePath);
+
+        int64 TotalBytes = 0;
+        double LegacyMs = 0.0;
+        double MappedMs = 0.0;
+        int32 NumMismatches = 0;
+        for (const FString& Path : ObjFilePaths)
+        {
+            FObjInfo LegacyObjInfo;
+            bool bLegacyParsed = false;
+            const uint64 LegacyStartCycles = FPlatformTime::Cycles64();
+            for (int32 i = 0; i < Iterations; ++i)
+            {
+                LegacyObjInfo = FObjInfo();
+                bLegacyParsed = ParseOBJLegacy(Path, LegacyObjInfo);
+            }
+            LegacyMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LegacyStartCycles) / Iterations;
+
+            FObjInfo MappedObjInfo;
+            bool bMappedParsed = false;
+            const uint64 MappedStartCycles = FPlatformTime::Cycles64();
+            for (int32 i = 0; i < Iterations; ++i)
+            {
+                MappedObjInfo = FObjInfo();
+                bMappedParsed = FObjLoader::ParseOBJ(Path, MappedObjInfo);
+            }
+            MappedMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - MappedStartCycles) / Iterations;
+
+            if (bLegacyParsed != bMappedParsed || !IsSameObjInfo(LegacyObjInfo, MappedObjInfo))
+            {
+                UE_LOG(ELogLevel::Warning, "OBJ parse mismatch: %s", *Path);
+                ++NumMismatches;
+            }
+
+            std::error_code ErrorCode;
+            const uintmax_t FileSize = std::filesystem::file_size(Path.ToWideString(), ErrorCode);
+            TotalBytes += ErrorCode ? 0 : static_cast<int64>(FileSize);
+        }
+
+        const double TotalMB = static_cast<double>(TotalBytes) / (1024.0 * 1024.0);
+        UE_LOG(
+            ELogLevel::Display,
+            "bench objparse %d files (%.2f MB): getline %.3f ms, mapped %.3f ms (x%.1f, %.0f MB/s), %d mismatches",
+            ObjFilePaths.Num(), TotalMB, LegacyMs, MappedMs,
+            LegacyMs / std::max(MappedMs, 0.001), TotalMB / std::max(MappedMs / 1000.0, 0.000001),
+            NumMismatches
+        );
+        return NumMismatches == 0;
+    }
+
+    /**
+     * 문자열 Key를 쓰던 기존 정점 병합, bench objconvert에서 FObjLoader::ConvertToStaticMesh와 결과와 속도를 비교하는 기준으로만 사용합니다.
+     * Tangent와 BoundingBox는 계산하지 않습니다.
+     */
+    void ConvertToStaticMeshLegacy(const FObjInfo& RawData, FStaticMeshRenderData& OutStaticMesh)
+    {
+        OutStaticMesh.ObjectName = RawData.ObjectName;
+        OutStaticMesh.DisplayName = RawData.DisplayName;
+
+        TMap<std::string, uint32> IndexMap; // 중복 체크용
+
+        for (int32 i = 0; i < RawData.VertexIndices.Num(); i++)
+        {
+            const uint32 VertexIndex = RawData.VertexIndices[i];
+            const uint32 UVIndex = RawData.UVIndices[i];
+            const uint32 NormalIndex = RawData.NormalIndices[i];
+
+            uint32 MaterialIndex = 0;
+            for (int32 j = 0; j < OutStaticMesh.MaterialSubsets.Num(); j++)
+            {
+                const FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[j];
+                if (Subset.IndexStart <= i && i < Subset.IndexStart + Subset.IndexCount)
+                {
+                    MaterialIndex = Subset.MaterialIndex;
+                    break;
+                }
+            }
+
+            std::string Key = std::to_string(VertexIndex) + "/" + std::to_string(UVIndex) + "/" + std::to_string(NormalIndex);
+
+            uint32 FinalIndex;
+            if (IndexMap.Contains(Key))
+            {
+                FinalIndex = IndexMap[Key];
+            }
+            else
+            {
+                FStaticMeshVertex StaticMeshVertex = {};
+                StaticMeshVertex.MaterialIndex = MaterialIndex;
+                StaticMeshVertex.X = RawData.Vertices[VertexIndex].X;
+                StaticMeshVertex.Y = RawData.Vertices[VertexIndex].Y;
+                StaticMeshVertex.Z = RawData.Vertices[VertexIndex].Z;
+
+                StaticMeshVertex.R = 0.7f; StaticMeshVertex.G = 0.7f; StaticMeshVertex.B = 0.7f; StaticMeshVertex.A = 1.0f;
+
+                if (UVIndex != UINT32_MAX && UVIndex < RawData.UVs.Num())
+                {
+                    StaticMeshVertex.U = RawData.UVs[UVIndex].X;
+                    StaticMeshVertex.V = RawData.UVs[UVIndex].Y;
+                }
+
+                if (NormalIndex != UINT32_MAX && NormalIndex < RawData.Normals.Num())
+                {
+                    StaticMeshVertex.NormalX = RawData.Normals[NormalIndex].X;
+                    StaticMeshVertex.NormalY = RawData.Normals[NormalIndex].Y;
+                    StaticMeshVertex.NormalZ = RawData.Normals[NormalIndex].Z;
+                }
+
+                FinalIndex = OutStaticMesh.Vertices.Num();
+                IndexMap[Key] = FinalIndex;
+                OutStaticMesh.Vertices.Add(StaticMeshVertex);
+            }
+
+            OutStaticMesh.Indices.Add(FinalIndex);
+        }
+    }
+
+    /**
+     * GridSize x GridSize 사각형으로 된 높이맵을 ParseOBJ 결과 형태로 만듭니다.
+     * Material 없는 앞부분, 빈 Subset, 여러 Subset이 모두 들어가도록 나눕니다.
+     */
+    void MakeConvertBenchmarkMesh(int32 GridSize, FObjInfo& OutObjInfo)
+    {
+        const int32 NumSide = GridSize + 1;
+        for (int32 Y = 0; Y < NumSide; ++Y)
+        {
+            for (int32 X = 0; X < NumSide; ++X)
+            {
+                const float Height = FMath::Sin(X * 0.3f) * FMath::Cos(Y * 0.2f);
+                OutObjInfo.Vertices.Add(FVector(static_cast<float>(X), static_cast<float>(Y), Height));
+                OutObjInfo.UVs.Add(FVector2D(static_cast<float>(X) / GridSize, static_cast<float>(Y) / GridSize));
+                OutObjInfo.Normals.Add(FVector(-Height * 0.3f, Height * 0.2f, 1.f).GetSafeNormal());
+            }
+        }
+
+        const int32 NumQuads = GridSize * GridSize;
+        for (int32 Quad = 0; Quad < NumQuads; ++Quad)
+        {
+            const uint32 Base = static_cast<uint32>(Quad / GridSize * NumSide + Quad % GridSize);
+            const uint32 Corners[6] = { Base, Base + 1, Base + NumSide + 1, Base, Base + NumSide + 1, Base + NumSide };
+            for (const uint32 Corner : Corners)
+            {
+                OutObjInfo.VertexIndices.Add(Corner);
+                OutObjInfo.UVIndices.Add(Corner);
+                OutObjInfo.NormalIndices.Add(Corner);
+            }
+
+            // ParseOBJ처럼 usemtl을 만날 때 Subset을 닫고 새로 엶
+            if (Quad == NumQuads / 8 || Quad == NumQuads / 2 || Quad == NumQuads / 2 + 1 || Quad == NumQuads * 3 / 4)
+            {
+                if (!OutObjInfo.MaterialSubsets.IsEmpty())
+                {
+                    FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+                    LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+                }
+
+                FMaterialSubset MaterialSubset = {};
+                MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
+                MaterialSubset.IndexCount = 0;
+                OutObjInfo.MaterialSubsets.Add(MaterialSubset);
+                if (Quad == NumQuads / 2)
+                {
+                    // 연속된 usemtl, 앞의 Subset은 면이 없음
+                    OutObjInfo.MaterialSubsets.Add(MaterialSubset);
+                }
+            }
+        }
+
+        FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+        LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+
+        OutObjInfo.ObjectName = L"ConvertBenchmarkGrid";
+        OutObjInfo.DisplayName = "ConvertBenchmarkGrid";
+    }
+
+    /**
+     * FObjLoader::ConvertToStaticMesh를 기존 문자열 Key 방식과 비교해 시간을 측정하고 출력이 같은지 검사합니다.
+     * @param ObjFilePath 변환할 OBJ, 비어 있으면 생성한 높이맵 사용
+     * @param Iterations 측정 반복 횟수
+     * @return 두 출력이 비트 단위로 같은지 여부
+     */
+    bool RunObjConvertBenchmark(const FString& ObjFilePath, int32 Iterations)
+    {
+        Iterations = std::max(Iterations, 1);
+
+        FObjInfo RawData;
+        if (ObjFilePath.IsEmpty())
+        {
+            MakeConvertBenchmarkMesh(256, RawData);
+        }
+        else if (!FObjLoader::ParseOBJ(ObjFilePath, RawData))
+        {
+            UE_LOG(ELogLevel::Error, "Failed to open file for reading: %s", *ObjFilePath);
+            return false;
+        }
+
+        // CombineMaterialIndex 없이도 Subset마다 다른 MaterialIndex가 나오도록 순서대로 매김
+        FStaticMeshRenderData Template;
+        Template.MaterialSubsets = RawData.MaterialSubsets;
+        for (int32 i = 0; i < Template.MaterialSubsets.Num(); ++i)
+        {
+            Template.MaterialSubsets[i].MaterialIndex = i + 1;
+        }
+
+        FStaticMeshRenderData LegacyMesh;
+        const uint64 LegacyStartCycles = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            LegacyMesh = Template;
+            ConvertToStaticMeshLegacy(RawData, LegacyMesh);
+            FObjLoader::FinalizeStaticMesh(LegacyMesh);
+        }
+        const double LegacyMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LegacyStartCycles) / Iterations;
+
+        FStaticMeshRenderData NewMesh;
+        const uint64 NewStartCycles = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            NewMesh = Template;
+            FObjLoader::ConvertToStaticMesh(RawData, NewMesh);
+        }
+        const double NewMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - NewStartCycles) / Iterations;
+
+        // 출력은 기존 방식과 비트 단위로 같아야 함
+        const bool bIdentical =
+            LegacyMesh.Vertices.Num() == NewMesh.Vertices.Num()
+            && LegacyMesh.Indices.Num() == NewMesh.Indices.Num()
+            && std::memcmp(LegacyMesh.Vertices.GetData(), NewMesh.Vertices.GetData(), sizeof(FStaticMeshVertex) * NewMesh.Vertices.Num()) == 0
+            && std::memcmp(LegacyMesh.Indices.GetData(), NewMesh.Indices.GetData(), sizeof(UINT) * NewMesh.Indices.Num()) == 0
+            && std::memcmp(&LegacyMesh.BoundingBoxMin, &NewMesh.BoundingBoxMin, sizeof(FVector)) == 0
+            && std::memcmp(&LegacyMesh.BoundingBoxMax, &NewMesh.BoundingBoxMax, sizeof(FVector)) == 0;
+
+        UE_LOG(
+            ELogLevel::Display,
+            "bench objconvert %s (%d corners, %d vertices): string key %.3f ms, packed key %.3f ms (x%.1f), output %s",
+            ObjFilePath.IsEmpty() ? "synthetic grid" : *ObjFilePath, RawData.VertexIndices.Num(), NewMesh.Vertices.Num(),
+            LegacyMs, NewMs, LegacyMs / std::max(NewMs, 0.001),
+            bIdentical ? "identical" : "DIFFERENT"
+        );
+        return bIdentical;
+    }
+
+    /** 벤치마크용 OBJ, Resolution x Resolution 쿼드의 높이맵 */
+    bool WriteBenchmarkObj(const std::filesystem::path& FilePath, int32 Seed, int32 Resolution)
+    {
+        std::ofstream File(FilePath);
+        if (!File.is_open())
+        {
+            return false;
+        }
+
+        const float Phase = static_cast<float>(Seed) * 0.37f;
+        for (int32 Y = 0; Y <= Resolution; ++Y)
+        {
+            for (int32 X = 0; X <= Resolution; ++X)
+            {
+                const float U = static_cast<float>(X) / Resolution;
+                const float V = static_cast<float>(Y) / Resolution;
+                const float Height = 0.1f * std::sin(U * 6.28f + Phase) * std::cos(V * 6.28f - Phase);
+                File << "v " << U - 0.5f << ' ' << V - 0.5f << ' ' << Height << '\n';
+                File << "vt " << U << ' ' << V << '\n';
+                File << "vn 0 0 1\n";
+            }
+        }
+
+        const int32 Stride = Resolution + 1;
+        for (int32 Y = 0; Y < Resolution; ++Y)
+        {
+            for (int32 X = 0; X < Resolution; ++X)
+            {
+                const int32 Corners[4] = { Y * Stride + X + 1, Y * Stride + X + 2, (Y + 1) * Stride + X + 2, (Y + 1) * Stride + X + 1 };
+                File << 'f';
+                for (const int32 Corner : Corners)
+                {
+                    File << ' ' << Corner << '/' << Corner << '/' << Corner;
+                }
+                File << '\n';
+            }
+        }
+
+        return File.good();
+    }
+
+    /**
+     * 임시 폴더에 OBJ를 NumMeshes개 만들어 동기 로드와 비동기 로드의 시작 시간을 비교합니다.
+     * 생성된 Mesh는 에셋으로 등록된 채 남습니다.
+     */
+    void RunAssetImportBenchmark(UAssetManager& AssetManager, int32 NumMeshes)
+    {
+        NumMeshes = std::max(NumMeshes, 1);
+        constexpr int32 Resolution = 24;
+
+        // 같은 경로는 이미 등록되어 있으므로 실행마다 다른 폴더 사용
+        static int32 RunIndex = 0;
+        const std::filesystem::path Directory = std::filesystem::path("Saved/AssetBench") / ("Run" + std::to_string(RunIndex++));
+
+        std::error_code ErrorCode;
+        std::filesystem::remove_all(Directory, ErrorCode);
+        std::filesystem::create_directories(Directory, ErrorCode);
+
+        // 1. 합성 OBJ 생성
+        TArray<std::filesystem::path> FilePaths;
+        FilePaths.Reserve(NumMeshes);
+        for (int32 Index = 0; Index < NumMeshes; ++Index)
+        {
+            std::filesystem::path FilePath = Directory / ("Mesh" + std::to_string(Index) + ".obj");
+            if (!WriteBenchmarkObj(FilePath, Index, Resolution))
+            {
+                UE_LOG(ELogLevel::Error, "Failed to write benchmark mesh: %s", FilePath.string().c_str());
+                return;
+            }
+            FilePaths.Add(std::move(FilePath));
+        }
+
+        auto RemoveCookedCaches = [&FilePaths]
+        {
+            for (const std::filesystem::path& FilePath : FilePaths)
+            {
+                std::error_code RemoveError;
+                std::filesystem::remove(FilePath.string() + ".bin", RemoveError);
+            }
+        };
+
+        // 2. 기존 방식: 메인 스레드에서 하나씩 Cook
+        const uint64 SyncStartCycles = FPlatformTime::Cycles64();
+        for (const std::filesystem::path& FilePath : FilePaths)
+        {
+            FStaticMeshRenderData RenderData;
+            FObjManager::CookStaticMeshAsset(FilePath.string(), RenderData);
+        }
+        const double SyncMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - SyncStartCycles);
+
+        // 3. 비동기: 등록까지가 에디터가 뜨기 전에 기다리는 시간
+        RemoveCookedCaches();
+        AssetManager.FlushAsyncLoads();
+
+        const uint64 AsyncStartCycles = FPlatformTime::Cycles64();
+        AssetManager.LoadObjFiles(Directory);
+        const double RegisterMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - AsyncStartCycles);
+
+        int32 NumCallbacks = 0;
+        int32 NumLoaded = 0;
+        FOnStaticMeshLoaded OnLoaded;
+        OnLoaded.BindLambda([&NumCallbacks, &NumLoaded](UStaticMesh* LoadedMesh)
+        {
+            ++NumCallbacks;
+            NumLoaded += LoadedMesh && !LoadedMesh->IsPlaceholder() ? 1 : 0;
+        });
+        for (const std::filesystem::path& FilePath : FilePaths)
+        {
+            const FString PathName = FilePath.parent_path().string() + "/" + FilePath.filename().string();
+            AssetManager.RequestStaticMeshLoad(PathName, EAssetLoadPriority::Normal, OnLoaded);
+        }
+
+        AssetManager.FlushAsyncLoads();
+        const double AsyncMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - AsyncStartCycles);
+
+        UE_LOG(
+            ELogLevel::Display,
+            "bench assets %d meshes (%d workers): sync %.1f ms, async ready %.2f ms, all loaded %.1f ms (x%.1f), callbacks %d, loaded %d",
+            NumMeshes, FJobSystem::GetNumWorkers(), SyncMs, RegisterMs, AsyncMs, SyncMs / std::max(AsyncMs, 0.001),
+            NumCallbacks, NumLoaded
+        );
+    }
+
+    /**
+     * Json 파일과 이를 변환한 바이너리 파일을 각각 반복해서 읽어 걸린 시간을 출력하고,
+     * 두 결과가 같은지(Round Trip) 확인합니다. 바이너리 파일은 Json 파일 옆에 .scenebin으로 저장됩니다.
+     * @return Round Trip 결과가 같은지 여부
+     */
+    bool RunSceneFormatBenchmark(const std::filesystem::path& JsonFilePath, int32 Iterations)
+    {
+        Iterations = std::max(Iterations, 1);
+
+        std::filesystem::path BinaryFilePath = JsonFilePath;
+        BinaryFilePath.replace_extension(".scenebin");
+        const bool bRoundTrip = SceneManager::ConvertJsonToBinaryFile(JsonFilePath, BinaryFilePath);
+        if (!std::filesystem::exists(BinaryFilePath))
+        {
+            return false;
+        }
+
+        // 파일 읽기 + 파싱 시간, World에는 올리지 않음
+        int32 NumActors = 0;
+        auto MeasureParse = [Iterations, &NumActors](const std::filesystem::path& FilePath) -> double
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            for (int32 i = 0; i < Iterations; ++i)
+            {
+                if (!SceneManager::ParseSceneFile(FilePath, NumActors))
+                {
+                    return -1.0;
+                }
+            }
+            return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / Iterations;
+        };
+        const double JsonMs = MeasureParse(JsonFilePath);
+        const double BinaryMs = MeasureParse(BinaryFilePath);
+        if (JsonMs < 0.0 || BinaryMs < 0.0)
+        {
+            return false;
+        }
+
+        UE_LOG(
+            ELogLevel::Display,
+            "Scene format %s (%d actors): json %lld bytes %.3f ms, binary %lld bytes %.3f ms (x%.1f), round trip %s",
+            JsonFilePath.filename().string().c_str(), NumActors,
+            static_cast<int64>(std::filesystem::file_size(JsonFilePath)), JsonMs,
+            static_cast<int64>(std::filesystem::file_size(BinaryFilePath)), BinaryMs, JsonMs / std::max(BinaryMs, 0.001),
+            bRoundTrip ? "OK" : "FAILED"
+        );
+        return bRoundTrip;
+    }
+
+    /**
+     * UBoxComponent를 Root로 가진 투사체 Actor를 Count개 만들어 별도의 FTickTaskManager에 이동과 SkySphere Tick만 등록하고,
+     * 메인 스레드만 쓰는 경우와 워커 1/2/4/8개로 같은 프레임 수를 Tick한 시간을 비교합니다.
+     * 두 Tick 모두 Actor마다 독립적이므로 워커 수와 관계없이 최종 위치와 UV 오프셋이 메인 스레드 결과와 같아야 합니다.
+     */
+    bool RunTickBenchmark(int32 Count)
+    {
+        FBenchWorldFixture Fixture("bench tick [N] (requires an active world)", Count);
+        if (!Fixture.IsValid())
+        {
+            return false;
+        }
+
+        constexpr int32 NumFrames = 60;
+        constexpr float DeltaTime = 1.0f / 60.0f;
+        const int32 NumWorkersBefore = FJobSystem::GetNumWorkers();
+
+        TArray<UProjectileMovementComponent*> Movements;
+        TArray<USkySphereComponent*> SkySpheres;
+        Movements.Reserve(Count);
+        SkySpheres.Reserve(Count);
+
+        FTickTaskManager TickManager;
+        for (int32 i = 0; i < Count; ++i)
+        {
+            AActor* Actor = Fixture.SpawnActor();
+            Actor->AddComponent<UBoxComponent>();
+            UProjectileMovementComponent* Movement = Actor->AddComponent<UProjectileMovementComponent>();
+            Movement->SetMaxSpeed(1000.0f);
+            Movement->SetGravity(-980.0f);
+            Movement->SetLifetime(1.0e6f);
+            Movement->PrimaryComponentTick.RegisterTickFunction(&TickManager);
+            USkySphereComponent* SkySphere = Actor->AddComponent<USkySphereComponent>();
+            SkySphere->PrimaryComponentTick.RegisterTickFunction(&TickManager);
+            Movements.Add(Movement);
+            SkySpheres.Add(SkySphere);
+        }
+
+        const TArray<AActor*>& Actors = Fixture.GetActors();
+        auto RunFrames = [&](bool bParallel, TArray<FVector>& OutLocations, TArray<float>& OutUOffsets) -> double
+        {
+            for (int32 i = 0; i < Count; ++i)
+            {
+                Movements[i]->PrimaryComponentTick.SetRunOnAnyThread(bParallel);
+                SkySpheres[i]->PrimaryComponentTick.SetRunOnAnyThread(bParallel);
+                SkySpheres[i]->UOffset = 0.0f;
+                Movements[i]->SetVelocity(FVector(100.0f + static_cast<float>(i % 7), 50.0f, 200.0f));
+                Actors[i]->GetRootComponent()->SetRelativeLocation(FVector(static_cast<float>(i), 0.0f, 0.0f));
+            }
+
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                TickManager.Tick(DeltaTime, false);
+            }
+            const double FrameMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / NumFrames;
+
+            OutLocations.SetNum(Count);
+            OutUOffsets.SetNum(Count);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                OutLocations[i] = Actors[i]->GetRootComponent()->GetRelativeLocation();
+                OutUOffsets[i] = SkySpheres[i]->UOffset;
+            }
+            return FrameMs;
+        };
+
+        TArray<FVector> SerialLocations;
+        TArray<float> SerialUOffsets;
+        const double SerialMs = RunFrames(false, SerialLocations, SerialUOffsets);
+        UE_LOG(ELogLevel::Display, "bench tick %d actors x %d frames: main thread only %.3f ms/frame", Count, NumFrames, SerialMs);
+
+        bool bPassed = true;
+        for (const int32 NumWorkers : { 1, 2, 4, 8 })
+        {
+            FJobSystem::Initialize(NumWorkers);
+
+            TArray<FVector> Locations;
+            TArray<float> UOffsets;
+            const double ParallelMs = RunFrames(true, Locations, UOffsets);
+
+            int32 NumMismatches = 0;
+            for (int32 i = 0; i < Count; ++i)
+            {
+                NumMismatches += Locations[i] == SerialLocations[i] && UOffsets[i] == SerialUOffsets[i] ? 0 : 1;
+            }
+            bPassed &= NumMismatches == 0;
+
+            UE_LOG(NumMismatches == 0 ? ELogLevel::Display : ELogLevel::Error,
+                "bench tick %d workers: %.3f ms/frame (x%.2f), %d state mismatches",
+                NumWorkers, ParallelMs, SerialMs / std::max(ParallelMs, 0.001), NumMismatches
+            );
+        }
+
+        FJobSystem::Initialize(NumWorkersBefore);
+        return bPassed;
+    }
+
+    /** 검사용으로 Broadphase 반영과 좁은 단계 판정을 직접 부르기 위한 FCollisionManager */
+    class FBenchCollisionManager : public FCollisionManager
+    {
+    public:
+        using FCollisionManager::FlushDirtyPrimitives;
+        using FCollisionManager::IsOverlapped;
+    };
+
+    /**
+     * World 없이 Sphere Shape Count개를 FCollisionManager에 등록하고, 프레임마다 모두 움직인 뒤 모든 Shape의 오버랩을 검사합니다.
+     * 이동은 MarkPrimitiveDirty로 모였다가 첫 검사 직전에 한 번에 반영되므로, 마지막 프레임의 결과는 현재 위치로 전수 검사한 결과와 같고
+     * A가 B와 겹치면 B도 A와 겹쳐야 합니다.
+     */
+    bool RunOverlapBenchmark(int32 Count)
+    {
+        constexpr int32 NumFrames = 30;
+        const float WorldSize = 60.0f * std::cbrt(Count / 10000.0f);
+
+        std::mt19937 Random(1234);
+        std::uniform_real_distribution<float> Position(0.0f, WorldSize);
+        std::uniform_real_distribution<float> Radius(0.5f, 2.0f);
+        std::uniform_real_distribution<float> Step(-0.5f, 0.5f);
+
+        FBenchCollisionManager Manager;
+        TArray<USphereComponent*> Shapes;
+        Shapes.Reserve(Count);
+        for (int32 i = 0; i < Count; ++i)
+        {
+            USphereComponent* Shape = FObjectFactory::ConstructObject<USphereComponent>(nullptr);
+            Shape->SetRadius(Radius(Random));
+            Shape->SetRelativeLocation(FVector(Position(Random), Position(Random), Position(Random)));
+            Manager.RegisterShape(Shape);
+            Shapes.Add(Shape);
+        }
+
+        double MoveMs = 0.0;
+        double FlushMs = 0.0;
+        double QueryMs = 0.0;
+        int64 NumOverlaps = 0;
+        TArray<TArray<const UPrimitiveComponent*>> Overlaps;
+        Overlaps.SetNum(Count);
+
+        TArray<FOverlapResult> Results;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            // World에 등록된 Shape는 OnComponentToWorldDirty에서 MarkPrimitiveDirty가 불리므로 여기서 직접 호출
+            const uint64 MoveStartCycles = FPlatformTime::Cycles64();
+            for (USphereComponent* Shape : Shapes)
+            {
+                Shape->SetRelativeLocation(Shape->GetRelativeLocation() + FVector(Step(Random), Step(Random), Step(Random)));
+                Manager.MarkPrimitiveDirty(Shape);
+            }
+            const uint64 FlushStartCycles = FPlatformTime::Cycles64();
+            Manager.FlushDirtyPrimitives();
+            const uint64 QueryStartCycles = FPlatformTime::Cycles64();
+
+            NumOverlaps = 0;
+            for (int32 i = 0; i < Count; ++i)
+            {
+                Manager.CheckOverlap(nullptr, Shapes[i], Results);
+                Overlaps[i].Empty();
+                for (const FOverlapResult& Result : Results)
+                {
+                    Overlaps[i].Add(Result.Component);
+                }
+                NumOverlaps += Results.Num();
+            }
+            const uint64 EndCycles = FPlatformTime::Cycles64();
+
+            MoveMs += FPlatformTime::ToMilliseconds(FlushStartCycles - MoveStartCycles);
+            FlushMs += FPlatformTime::ToMilliseconds(QueryStartCycles - FlushStartCycles);
+            QueryMs += FPlatformTime::ToMilliseconds(EndCycles - QueryStartCycles);
+        }
+
+        // 마지막 프레임을 현재 위치로 전수 검사한 결과와 비교
+        TMap<const UPrimitiveComponent*, int32> ShapeIndices;
+        TArray<FBoundingBox> Boxes;
+        TArray<TArray<int32>> Found;
+        Boxes.SetNum(Count);
+        Found.SetNum(Count);
+        for (int32 i = 0; i < Count; ++i)
+        {
+            ShapeIndices.Add(Shapes[i], i);
+            Boxes[i] = Shapes[i]->GetWorldAABB();
+        }
+        for (int32 i = 0; i < Count; ++i)
+        {
+            for (const UPrimitiveComponent* Other : Overlaps[i])
+            {
+                Found[i].Add(*ShapeIndices.Find(Other));
+            }
+            Found[i].Sort();
+        }
+
+        const uint64 BruteStartCycles = FPlatformTime::Cycles64();
+        int32 NumMismatches = 0;
+        int32 NumAsymmetric = 0;
+        TArray<int32> Expected;
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Expected.Empty();
+            for (int32 j = 0; j < Count; ++j)
+            {
+                FOverlapResult Result;
+                if (i != j && FBoundingBox::CheckOverlap(Boxes[i], Boxes[j]) && Manager.IsOverlapped(Shapes[i], Shapes[j], Result))
+                {
+                    Expected.Add(j);
+                }
+            }
+
+            bool bSame = Expected.Num() == Found[i].Num();
+            for (int32 k = 0; bSame && k < Expected.Num(); ++k)
+            {
+                bSame = Expected[k] == Found[i][k];
+            }
+            NumMismatches += bSame ? 0 : 1;
+
+            for (const int32 j : Found[i])
+            {
+                NumAsymmetric += Found[j].Contains(i) ? 0 : 1;
+            }
+        }
+        const double BruteMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BruteStartCycles);
+
+        UE_LOG(NumMismatches == 0 && NumAsymmetric == 0 ? ELogLevel::Display : ELogLevel::Error,
+            "bench overlap %d shapes x %d frames: move %.3f ms, flush %.3f ms, query %.3f ms per frame (%lld overlaps), "
+            "brute force %.1f ms, %d mismatches, %d asymmetric",
+            Count, NumFrames, MoveMs / NumFrames, FlushMs / NumFrames, QueryMs / NumFrames, NumOverlaps,
+            BruteMs, NumMismatches, NumAsymmetric
+        );
+
+        for (USphereComponent* Shape : Shapes)
+        {
+            Manager.UnregisterShape(Shape);
+            GUObjectArray.MarkRemoveObject(Shape);
+        }
+        return NumMismatches == 0 && NumAsymmetric == 0;
+    }
+
+    /** ComponentToWorld 캐시 이전의 GetWorldMatrix, 부모 체인을 매번 끝까지 따라가며 ((S * Sp) * Sgp) 순서로 누적 */
+    FMatrix GetWorldMatrixLegacy(const USceneComponent* Component)
+    {
+        FMatrix ScaleMat = Component->GetScaleMatrix();
+        FMatrix RTMat = Component->GetRotationMatrix() * Component->GetTranslationMatrix();
+
+        const USceneComponent* Parent = Component->GetAttachParent();
+        while (Parent)
+        {
+            ScaleMat = ScaleMat * Parent->GetScaleMatrix();
+            RTMat = RTMat * (Parent->GetRotationMatrix() * Parent->GetTranslationMatrix());
+            Parent = Parent->GetAttachParent();
+        }
+        return ScaleMat * RTMat;
+    }
+
+    /** 원소별 차이를 max(1, |기존 값|)로 나눈 값 중 가장 큰 값 */
+    float GetMatrixError(const FMatrix& Expected, const FMatrix& Actual)
+    {
+        float MaxError = 0.0f;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Col = 0; Col < 4; ++Col)
+            {
+                const float Error = std::abs(Expected.M[Row][Col] - Actual.M[Row][Col]) / std::max(1.0f, std::abs(Expected.M[Row][Col]));
+                MaxError = std::max(MaxError, Error);
+            }
+        }
+        return MaxError;
+    }
+
+    /**
+     * World 없이 SceneComponent Count개로 넓은 트리(자식 4개씩)와 깊은 체인(길이 ChainLength)을 만들고,
+     * 캐시된 GetWorldMatrix를 부모 체인을 매번 따라가던 기존 계산과 비교합니다.
+     * 곱하는 순서가 달라 생기는 오차만 허용하며, 기존 계산/전체 갱신/캐시 읽기 시간을 함께 출력합니다.
+     */
+    bool RunTransformBenchmark(int32 Count)
+    {
+        constexpr int32 ChainLength = 64;
+        constexpr int32 NumIterations = 10;
+        constexpr float Tolerance = 1.0e-3f;
+
+        std::mt19937 Random(42);
+        std::uniform_real_distribution<float> Offset(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> Angle(-30.0f, 30.0f);
+        std::uniform_real_distribution<float> Scale(0.9f, 1.1f);
+
+        bool bPassed = true;
+        for (const bool bDeep : { false, true })
+        {
+            TArray<USceneComponent*> Components;
+            TArray<USceneComponent*> Roots;
+            Components.Reserve(Count);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                USceneComponent* Component = FObjectFactory::ConstructObject<USceneComponent>(nullptr);
+                Component->SetRelativeLocation(FVector(Offset(Random), Offset(Random), Offset(Random)));
+                Component->SetRelativeRotation(FRotator(Angle(Random), Angle(Random), Angle(Random)));
+                Component->SetRelativeScale3D(FVector(Scale(Random), Scale(Random), Scale(Random)));
+
+                const int32 ParentIndex = bDeep ? (i % ChainLength == 0 ? INDEX_NONE : i - 1) : (i == 0 ? INDEX_NONE : (i - 1) / 4);
+                if (ParentIndex == INDEX_NONE)
+                {
+                    Roots.Add(Component);
+                }
+                else
+                {
+                    Component->AttachToComponent(Components[ParentIndex]);
+                }
+                Components.Add(Component);
+            }
+
+            // 기존 계산, 모든 컴포넌트가 부모 체인을 끝까지 따라감
+            TArray<FMatrix> Expected;
+            Expected.SetNum(Count);
+            const uint64 LegacyStartCycles = FPlatformTime::Cycles64();
+            for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+            {
+                for (int32 i = 0; i < Count; ++i)
+                {
+                    Expected[i] = GetWorldMatrixLegacy(Components[i]);
+                }
+            }
+            const double LegacyMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LegacyStartCycles) / NumIterations;
+
+            // 루트를 움직여 모든 캐시를 무효화한 뒤 다시 계산
+            double UpdateMs = 0.0;
+            for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+            {
+                for (USceneComponent* Root : Roots)
+                {
+                    Root->SetRelativeLocation(Root->GetRelativeLocation());
+                }
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                for (USceneComponent* Component : Components)
+                {
+                    Component->GetWorldMatrix();
+                }
+                UpdateMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+            }
+            UpdateMs /= NumIterations;
+
+            // 바뀐 것이 없으면 캐시만 읽음
+            const uint64 CachedStartCycles = FPlatformTime::Cycles64();
+            float Checksum = 0.0f;
+            for (const USceneComponent* Component : Components)
+            {
+                Checksum += Component->GetWorldMatrix().M[3][0];
+            }
+            const double CachedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CachedStartCycles);
+
+            float MaxError = 0.0f;
+            int32 NumMismatches = 0;
+            for (int32 i = 0; i < Count; ++i)
+            {
+                const float Error = GetMatrixError(Expected[i], Components[i]->GetWorldMatrix());
+                MaxError = std::max(MaxError, Error);
+                NumMismatches += Error > Tolerance ? 1 : 0;
+            }
+            bPassed &= NumMismatches == 0 && std::isfinite(Checksum);
+
+            UE_LOG(NumMismatches == 0 ? ELogLevel::Display : ELogLevel::Error,
+                "bench transform %s %d components: legacy walk %.3f ms, full update %.3f ms (x%.1f), cached read %.3f ms, max error %g, %d over %g",
+                bDeep ? "deep" : "wide", Count, LegacyMs, UpdateMs, LegacyMs / std::max(UpdateMs, 0.001), CachedMs,
+                MaxError, NumMismatches, Tolerance
+            );
+
+            for (USceneComponent* Component : Components)
+            {
+                GUObjectArray.MarkRemoveObject(Component);
+            }
+        }
+        return bPassed;
+    }
+
+    /**
+     * 카메라 절두체와 Near/Far가 없는 그림자용 절두체에서 무작위 AABB Count개를 CullBoxes_Scalar와 SSE 커널로 각각 검사합니다.
+     * 4개 중 1개는 임의의 평면에 딱 닿도록(Distance + Radius = 0) 옮겨서 경계의 비교 결과도 확인합니다.
+     * @return 두 커널의 결과가 모두 같은지 여부
+     */
+    bool RunCullBenchmark(int32 Count)
+    {
+        constexpr int32 NumIterations = 20;
+
+        const FMatrix View = JungleMath::CreateViewMatrix(FVector(-50.0f, 10.0f, 20.0f), FVector(100.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f));
+        const FMatrix Projection = JungleMath::CreateProjectionMatrix(FMath::DegreesToRadians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+
+        std::mt19937 Random(7);
+        std::uniform_real_distribution<float> Position(-600.0f, 600.0f);
+        std::uniform_real_distribution<float> Size(0.0f, 20.0f);
+
+        bool bPassed = true;
+        for (const bool bIncludeNearFar : { true, false })
+        {
+            const FFrustum Frustum(View * Projection, bIncludeNearFar);
+            std::uniform_int_distribution<int32> PlaneIndex(0, Frustum.NumPlanes - 1);
+
+            FCullingBounds Bounds;
+            Bounds.Reserve(Count);
+            int32 NumTouching = 0;
+            for (int32 i = 0; i < Count; ++i)
+            {
+                FVector Center(Position(Random), Position(Random), Position(Random));
+                // 4개 중 1개는 크기가 0인 점 상자
+                const FVector Extent = i % 4 == 1 ? FVector::ZeroVector : FVector(Size(Random), Size(Random), Size(Random));
+                if (i % 4 == 0 || i % 4 == 1)
+                {
+                    // 평면 바깥쪽으로 상자가 평면에 닿는 위치까지 옮김
+                    const FPlane& Plane = Frustum.Planes[PlaneIndex(Random)];
+                    const float Distance = Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z + Plane.W;
+                    const float Radius = FMath::Abs(Plane.X) * Extent.X + FMath::Abs(Plane.Y) * Extent.Y + FMath::Abs(Plane.Z) * Extent.Z;
+                    Center = Center - FVector(Plane.X, Plane.Y, Plane.Z) * (Distance + Radius);
+                    ++NumTouching;
+                }
+                Bounds.Add(Center, Extent);
+            }
+
+            TArray<uint8> ScalarVisible;
+            TArray<uint8> SimdVisible;
+            ScalarVisible.SetNum(Count);
+            SimdVisible.SetNum(Count);
+
+            const uint64 ScalarStartCycles = FPlatformTime::Cycles64();
+            for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+            {
+                FrustumCulling::CullBoxes_Scalar(Frustum, Bounds, ScalarVisible.GetData());
+            }
+            const double ScalarMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ScalarStartCycles) / NumIterations;
+
+            const uint64 SimdStartCycles = FPlatformTime::Cycles64();
+            for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+            {
+                FrustumCulling::CullBoxes_SSE(Frustum, Bounds, SimdVisible.GetData());
+            }
+            const double SimdMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - SimdStartCycles) / NumIterations;
+
+            int32 NumVisible = 0;
+            int32 NumMismatches = 0;
+            int32 NumTouchingMismatches = 0;
+            for (int32 i = 0; i < Count; ++i)
+            {
+                NumVisible += ScalarVisible[i];
+                if (ScalarVisible[i] != SimdVisible[i])
+                {
+                    ++NumMismatches;
+                    NumTouchingMismatches += i % 4 <= 1 ? 1 : 0;
+                }
+            }
+            bPassed &= NumMismatches == 0;
+
+            UE_LOG(NumMismatches == 0 ? ELogLevel::Display : ELogLevel::Error,
+                "bench cull %s %d boxes (%d touching a plane): scalar %.3f ms, sse %.3f ms (x%.1f), %d visible, %d mismatches (%d touching)",
+                bIncludeNearFar ? "camera" : "shadow", Count, NumTouching, ScalarMs, SimdMs, ScalarMs / std::max(SimdMs, 0.001),
+                NumVisible, NumMismatches, NumTouchingMismatches
+            );
+        }
+        return bPassed;
+    }
+
+    /** GPU 호출 대신 FMeshDrawCommandList::Submit이 부른 바인딩 횟수만 세는 Visitor */
+    struct FCountingDrawVisitor
+    {
+        uint32 NumPipelineBinds = 0;
+        uint32 NumSubMeshBinds = 0;
+
+        void BindPipeline(EMeshDrawPipeline) { ++NumPipelineBinds; }
+        void BindMesh(const FMeshDrawCommand&) {}
+        void BindMaterial(const FObjMaterialInfo&) {}
+        void BindObject(const FMeshDrawObject&) {}
+        void BindSubMesh(bool) { ++NumSubMeshBinds; }
+        void Draw(const FMeshDrawCommand&) {}
+    };
+
+    /**
+     * 메시 NumMeshes개와 머티리얼 NumMaterials개를 무작위로 섞은 오브젝트 Count개로 드로우 커맨드 목록을 만들고 검사합니다.
+     * 같은 MeshData/Material에 같은 Id가 붙는지, 기수 정렬 결과가 std::stable_sort와 같은 순서인지 확인하고,
+     * 정렬 전후로 Submit을 돌려 드로우/바인딩 횟수를 비교합니다.
+     */
+    bool RunDrawCommandBenchmark(int32 Count)
+    {
+        constexpr int32 NumMeshes = 64;
+        constexpr int32 NumMaterials = 32;
+        constexpr int32 NumIterations = 20;
+
+        // 커맨드는 주소만 들고 있으므로 실제 리소스 대신 배열 원소의 주소를 사용
+        TArray<uint64> Meshes;
+        TArray<FObjMaterialInfo> Materials;
+        Meshes.SetNum(NumMeshes);
+        Materials.SetNum(NumMaterials);
+
+        std::mt19937 Random(3);
+        std::uniform_int_distribution<int32> MeshIndex(0, NumMeshes - 1);
+        std::uniform_int_distribution<int32> MaterialIndex(0, NumMaterials - 1);
+        std::uniform_int_distribution<int32> NumSubMeshes(1, 3);
+        std::uniform_int_distribution<int32> Pipeline(0, 3);
+
+        FMeshDrawCommandList DrawCommands;
+        TArray<int32> CommandMeshes;
+        TArray<int32> CommandMaterials;
+        for (int32 ObjectIndex = 0; ObjectIndex < Count; ++ObjectIndex)
+        {
+            DrawCommands.AddObject(nullptr, false);
+            const int32 Mesh = MeshIndex(Random);
+            const EMeshDrawPipeline ObjectPipeline = static_cast<EMeshDrawPipeline>(Pipeline(Random));
+            const int32 SubMeshCount = NumSubMeshes(Random);
+            for (int32 SubMesh = 0; SubMesh < SubMeshCount; ++SubMesh)
+            {
+                const int32 Material = MaterialIndex(Random);
+                DrawCommands.AddCommand(ObjectPipeline, &Meshes[Mesh], &Materials[Material], ObjectIndex, SubMesh * 300, 300, false);
+                CommandMeshes.Add(Mesh);
+                CommandMaterials.Add(Material);
+            }
+        }
+
+        // 1) 커맨드 생성: 같은 주소에는 같은 Id, 다른 주소에는 처음 본 순서대로 새 Id
+        int32 NumIdErrors = 0;
+        {
+            TArray<int32> MeshIds;
+            TArray<int32> MaterialIds;
+            MeshIds.Init(INDEX_NONE, NumMeshes);
+            MaterialIds.Init(INDEX_NONE, NumMaterials);
+            TSet<uint32> SeenMeshIds;
+            TSet<uint32> SeenMaterialIds;
+
+            const TArray<FMeshDrawCommand>& Commands = DrawCommands.GetCommands();
+            for (int32 Index = 0; Index < Commands.Num(); ++Index)
+            {
+                const FMeshDrawCommand& Command = Commands[Index];
+                int32& MeshId = MeshIds[CommandMeshes[Index]];
+                int32& MaterialId = MaterialIds[CommandMaterials[Index]];
+                if (MeshId == INDEX_NONE && Command.MeshId == static_cast<uint32>(SeenMeshIds.Num()))
+                {
+                    MeshId = static_cast<int32>(Command.MeshId);
+                    SeenMeshIds.Add(Command.MeshId);
+                }
+                if (MaterialId == INDEX_NONE && Command.MaterialId == static_cast<uint32>(SeenMaterialIds.Num()))
+                {
+                    MaterialId = static_cast<int32>(Command.MaterialId);
+                    SeenMaterialIds.Add(Command.MaterialId);
+                }
+                NumIdErrors += MeshId == static_cast<int32>(Command.MeshId) && MaterialId == static_cast<int32>(Command.MaterialId) ? 0 : 1;
+            }
+        }
+
+        // 2) 정렬 전 제출
+        FMeshDrawStats UnsortedStats;
+        FCountingDrawVisitor UnsortedVisitor;
+        DrawCommands.Submit(UnsortedVisitor, UnsortedStats);
+
+        // 3) 기수 정렬과 std::stable_sort 비교
+        TArray<FMeshDrawCommand> Expected = DrawCommands.GetCommands();
+        const TArray<FMeshDrawCommand> Unsorted = Expected;
+        const auto KeyLess = [](const FMeshDrawCommand& A, const FMeshDrawCommand& B) { return A.SortKey < B.SortKey; };
+
+        const uint64 StableStartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            Expected = Unsorted;
+            std::stable_sort(Expected.begin(), Expected.end(), KeyLess);
+        }
+        const double StableMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StableStartCycles) / NumIterations;
+
+        TArray<FMeshDrawCommand> Sorted;
+        TArray<FMeshDrawCommand> Scratch;
+        const uint64 RadixStartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            Sorted = Unsorted;
+            FMeshDrawCommandList::RadixSort(Sorted, Scratch);
+        }
+        const double RadixMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RadixStartCycles) / NumIterations;
+
+        DrawCommands.Sort();
+        int32 NumOrderErrors = 0;
+        const TArray<FMeshDrawCommand>& Commands = DrawCommands.GetCommands();
+        for (int32 Index = 0; Index < Commands.Num(); ++Index)
+        {
+            // 키가 같은 커맨드는 추가된 순서(ObjectIndex, StartIndex)까지 같아야 안정 정렬
+            const bool bSame = Commands[Index].SortKey == Expected[Index].SortKey
+                && Commands[Index].ObjectIndex == Expected[Index].ObjectIndex
+                && Commands[Index].StartIndex == Expected[Index].StartIndex
+                && Sorted[Index].ObjectIndex == Expected[Index].ObjectIndex
+                && Sorted[Index].StartIndex == Expected[Index].StartIndex;
+            NumOrderErrors += bSame ? 0 : 1;
+        }
+
+        // 4) 정렬 후 제출
+        FMeshDrawStats SortedStats;
+        FCountingDrawVisitor SortedVisitor;
+        DrawCommands.Submit(SortedVisitor, SortedStats);
+
+        const bool bPassed = NumIdErrors == 0 && NumOrderErrors == 0 && SortedStats.NumDraws == UnsortedStats.NumDraws;
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error,
+            "bench drawcmd %d objects, %d commands: radix %.3f ms, stable_sort %.3f ms (x%.1f), %d id errors, %d order errors",
+            Count, Commands.Num(), RadixMs, StableMs, StableMs / std::max(RadixMs, 0.001), NumIdErrors, NumOrderErrors
+        );
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error,
+            "bench drawcmd binds unsorted -> sorted: draws %u -> %u, pipeline %u -> %u, material %u -> %u, buffer %u -> %u, object %u -> %u",
+            UnsortedStats.NumDraws, SortedStats.NumDraws, UnsortedVisitor.NumPipelineBinds, SortedVisitor.NumPipelineBinds,
+            UnsortedStats.NumMaterialBinds, SortedStats.NumMaterialBinds, UnsortedStats.NumBufferBinds, SortedStats.NumBufferBinds,
+            UnsortedStats.NumObjectUpdates, SortedStats.NumObjectUpdates
+        );
+        return bPassed;
+    }
+
+    /**
+     * 메시 NumMeshes개와 머티리얼 구성 4가지를 무작위로 고른 오브젝트 Count개를 FMeshInstanceGrouper로 묶고,
+     * 그룹/인스턴스/단일 오브젝트 수를 (메시, 머티리얼 내용) 키로 직접 센 값과 비교합니다.
+     * 내용은 같지만 다른 배열인 머티리얼 구성도 섞어서 배열 주소가 아닌 내용으로 묶이는지 확인합니다.
+     */
+    bool RunInstancingBenchmark(int32 Count)
+    {
+        constexpr int32 NumMeshes = 48;
+        constexpr int32 NumIterations = 20;
+
+        // FStaticMeshRenderPass::MinInstancesPerBatch와 같은 값
+        constexpr int32 MinInstances = 2;
+
+        // 그루퍼는 주소만 비교하므로 실제 리소스 대신 배열 원소의 주소를 사용
+        TArray<uint64> Meshes;
+        Meshes.SetNum(NumMeshes);
+        uint64 MaterialStorage[2] = {};
+        UMaterial* MaterialA = reinterpret_cast<UMaterial*>(&MaterialStorage[0]);
+        UMaterial* MaterialB = reinterpret_cast<UMaterial*>(&MaterialStorage[1]);
+
+        // 1번과 2번은 내용이 같은 다른 배열이므로 같은 그룹이어야 함
+        TArray<UMaterial*> MaterialSets[4];
+        MaterialSets[1].Add(MaterialA);
+        MaterialSets[2].Add(MaterialA);
+        MaterialSets[3].Add(MaterialA);
+        MaterialSets[3].Add(MaterialB);
+        constexpr int32 MaterialSetKeys[4] = { 0, 1, 1, 2 };
+        constexpr int32 NumMaterialKeys = 3;
+
+        // 메시마다 복사본 수가 크게 다르도록 앞쪽 메시를 자주 고름
+        std::mt19937 Random(11);
+        std::geometric_distribution<int32> MeshIndex(4.0 / NumMeshes);
+        std::uniform_int_distribution<int32> MaterialSet(0, 3);
+
+        TArray<int32> ObjectMeshes;
+        TArray<int32> ObjectMaterialSets;
+        ObjectMeshes.SetNum(Count);
+        ObjectMaterialSets.SetNum(Count);
+        TArray<int32> KeyCounts;
+        KeyCounts.Init(0, NumMeshes * NumMaterialKeys);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            ObjectMeshes[Index] = std::min(MeshIndex(Random), NumMeshes - 1);
+            ObjectMaterialSets[Index] = MaterialSet(Random);
+            ++KeyCounts[ObjectMeshes[Index] * NumMaterialKeys + MaterialSetKeys[ObjectMaterialSets[Index]]];
+        }
+
+        int32 ExpectedGroups = 0;
+        int32 ExpectedInstances = 0;
+        for (const int32 KeyCount : KeyCounts)
+        {
+            if (KeyCount >= MinInstances)
+            {
+                ++ExpectedGroups;
+                ExpectedInstances += KeyCount;
+            }
+        }
+
+        FMeshInstanceGrouper Grouper;
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            Grouper.Reset();
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                Grouper.Add(&Meshes[ObjectMeshes[Index]], MaterialSets[ObjectMaterialSets[Index]], Index);
+            }
+            Grouper.Build(MinInstances);
+        }
+        const double GroupMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / NumIterations;
+
+        const TArray<FMeshInstanceGroup>& Groups = Grouper.GetGroups();
+        const TArray<int32>& InstanceObjects = Grouper.GetInstanceObjects();
+        const TArray<int32>& SingleObjects = Grouper.GetSingleObjects();
+
+        // 모든 오브젝트가 정확히 한 번 나와야 하고, 그룹 안의 오브젝트는 키가 같고 추가된 순서여야 함
+        int32 NumErrors = 0;
+        TArray<int32> Seen;
+        Seen.Init(0, Count);
+        for (const FMeshInstanceGroup& Group : Groups)
+        {
+            const int32 First = InstanceObjects[Group.FirstInstance];
+            const int32 GroupKey = ObjectMeshes[First] * NumMaterialKeys + MaterialSetKeys[ObjectMaterialSets[First]];
+            NumErrors += Group.MeshData == &Meshes[ObjectMeshes[First]] && Group.RepresentativeObject == First ? 0 : 1;
+            NumErrors += Group.NumInstances == KeyCounts[GroupKey] ? 0 : 1;
+            for (int32 Instance = Group.FirstInstance; Instance < Group.FirstInstance + Group.NumInstances; ++Instance)
+            {
+                const int32 Object = InstanceObjects[Instance];
+                ++Seen[Object];
+                NumErrors += ObjectMeshes[Object] * NumMaterialKeys + MaterialSetKeys[ObjectMaterialSets[Object]] == GroupKey ? 0 : 1;
+                NumErrors += Instance == Group.FirstInstance || InstanceObjects[Instance - 1] < Object ? 0 : 1;
+            }
+        }
+        for (const int32 Object : SingleObjects)
+        {
+            ++Seen[Object];
+            NumErrors += KeyCounts[ObjectMeshes[Object] * NumMaterialKeys + MaterialSetKeys[ObjectMaterialSets[Object]]] < MinInstances ? 0 : 1;
+        }
+        for (const int32 Times : Seen)
+        {
+            NumErrors += Times == 1 ? 0 : 1;
+        }
+
+        const bool bPassed = NumErrors == 0 && Groups.Num() == ExpectedGroups && InstanceObjects.Num() == ExpectedInstances
+            && SingleObjects.Num() == Count - ExpectedInstances;
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error,
+            "bench instancing %d objects: %d batches (expected %d), %d instanced (expected %d), %d single, %.3f ms per build, %d errors",
+            Count, Groups.Num(), ExpectedGroups, InstanceObjects.Num(), ExpectedInstances, SingleObjects.Num(), GroupMs, NumErrors
+        );
+        return bPassed;
+    }
+
+    /**
+     * FilePath의 스켈레탈 메시를 무작위 포즈로 돌린 뒤 스칼라와 SSE 스키닝 커널을 NumIterations번씩 실행합니다.
+     * 두 커널의 위치/노말/탄젠트 차이와 초당 정점 수를 출력합니다. 메시의 본 배열은 복사해서 쓰므로 원본 포즈는 바뀌지 않습니다.
+     */
+    bool RunSkinningBenchmark(const FString& FilePath, int32 NumIterations)
+    {
+        const USkeletalMesh* SkeletalMesh = FFBXManager::CreateSkeletalMesh(FilePath);
+        const FSkeletalMeshRenderData* RenderData = SkeletalMesh ? SkeletalMesh->GetRenderData() : nullptr;
+        if (!RenderData || RenderData->BindPoseVertices.IsEmpty() || RenderData->BoneWeights.Num() != RenderData->BindPoseVertices.Num())
+        {
+            UE_LOG(ELogLevel::Error, "bench skin: %s has no baked bone weights", *FilePath);
+            return false;
+        }
+
+        TArray<FSkeletonBone> Bones = RenderData->SkeletonBones;
+        std::mt19937 Random(5);
+        std::uniform_real_distribution<float> Angle(-30.0f, 30.0f);
+        for (int32 BoneIndex = 0; BoneIndex < Bones.Num(); ++BoneIndex)
+        {
+            FSkeletalMeshSkinning::SetBoneRotation(Bones, BoneIndex, FRotator(Angle(Random), Angle(Random), Angle(Random)));
+        }
+
+        TArray<FMatrix> Palette;
+        FSkeletalMeshSkinning::BuildPalette(Bones, Palette);
+
+        const int32 NumVertices = RenderData->BindPoseVertices.Num();
+        TArray<FSkeletalMeshVertex> ScalarVertices;
+        TArray<FSkeletalMeshVertex> SIMDVertices;
+        ScalarVertices.SetNum(NumVertices);
+        SIMDVertices.SetNum(NumVertices);
+
+        const uint64 ScalarStartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            FSkeletalMeshSkinning::SkinVerticesScalar(
+                RenderData->BindPoseVertices.GetData(), RenderData->BoneWeights.GetData(), NumVertices, Palette.GetData(), ScalarVertices.GetData()
+            );
+        }
+        const double ScalarMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ScalarStartCycles) / NumIterations;
+
+        const uint64 SIMDStartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            FSkeletalMeshSkinning::SkinVerticesSIMD(
+                RenderData->BindPoseVertices.GetData(), RenderData->BoneWeights.GetData(), NumVertices, Palette.GetData(), SIMDVertices.GetData()
+            );
+        }
+        const double SIMDMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - SIMDStartCycles) / NumIterations;
+
+        // 곱셈 순서만 다르므로 위치는 메시 크기에 비례한 오차, 방향 벡터는 작은 절대 오차만 허용
+        const float Extent = (RenderData->BoundingBoxMax - RenderData->BoundingBoxMin).Length();
+        const float PositionTolerance = std::max(Extent, 1.0f) * 1e-5f;
+        constexpr float DirectionTolerance = 1e-4f;
+
+        float MaxPositionError = 0.0f;
+        float MaxDirectionError = 0.0f;
+        int32 NumMismatches = 0;
+        for (int32 Index = 0; Index < NumVertices; ++Index)
+        {
+            const FSkeletalMeshVertex& A = ScalarVertices[Index];
+            const FSkeletalMeshVertex& B = SIMDVertices[Index];
+            const float PositionError = std::max({ std::abs(A.X - B.X), std::abs(A.Y - B.Y), std::abs(A.Z - B.Z) });
+            const float DirectionError = std::max({
+                std::abs(A.NormalX - B.NormalX), std::abs(A.NormalY - B.NormalY), std::abs(A.NormalZ - B.NormalZ),
+                std::abs(A.TangentX - B.TangentX), std::abs(A.TangentY - B.TangentY), std::abs(A.TangentZ - B.TangentZ),
+                std::abs(A.TangentW - B.TangentW)
+            });
+            MaxPositionError = std::max(MaxPositionError, PositionError);
+            MaxDirectionError = std::max(MaxDirectionError, DirectionError);
+            NumMismatches += PositionError <= PositionTolerance && DirectionError <= DirectionTolerance ? 0 : 1;
+        }
+
+        const double ScalarRate = NumVertices / std::max(ScalarMs, 0.001) / 1000.0;
+        const double SIMDRate = NumVertices / std::max(SIMDMs, 0.001) / 1000.0;
+        UE_LOG(NumMismatches == 0 ? ELogLevel::Display : ELogLevel::Error,
+            "bench skin %s: %d vertices, %d bones, scalar %.3f ms (%.1fM verts/s), SSE %.3f ms (%.1fM verts/s, x%.2f), max error position %g, direction %g, %d mismatches",
+            *FilePath, NumVertices, Bones.Num(), ScalarMs, ScalarRate, SIMDMs, SIMDRate, ScalarMs / std::max(SIMDMs, 0.001),
+            MaxPositionError, MaxDirectionError, NumMismatches
+        );
+        return NumMismatches == 0;
+    }
+
+    /** 방문한 Object 수와 UUID 합, 세 가지 순회가 같은 집합을 도는지 비교하는 데 사용 */
+    struct FIterateChecksum
+    {
+        int32 NumObjects = 0;
+        uint64 UUIDSum = 0;
+
+        void Visit(const UObject* Object)
+        {
+            ++NumObjects;
+            UUIDSum += Object->GetUUID();
+        }
+
+        bool operator==(const FIterateChecksum& Other) const
+        {
+            return NumObjects == Other.NumObjects && UUIDSum == Other.UUIDSum;
+        }
+    };
+
+    /**
+     * USceneComponent와 파생 클래스(UBoxComponent) Object Count개를 만들고, 파생 클래스까지 NumIterations번 순회하는 시간을 비교합니다.
+     * - legacy: 예전 ClassToObjectListMap처럼 Class별 TSet에서 TArray로 복사한 뒤 순회
+     * - copy: 현재 GetObjectsOfClass로 밀집 배열을 TArray로 복사한 뒤 순회
+     * - range: TObjectRange로 복사 없이 순회
+     */
+    bool RunIterateBenchmark(int32 Count)
+    {
+        constexpr int32 NumIterations = 100;
+
+        TArray<UObject*> Objects;
+        Objects.Reserve(Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            if (Index % 2 == 0)
+            {
+                Objects.Add(FObjectFactory::ConstructObject<USceneComponent>(nullptr));
+            }
+            else
+            {
+                Objects.Add(FObjectFactory::ConstructObject<UBoxComponent>(nullptr));
+            }
+        }
+
+        // 예전 구조를 흉내 낸 Class별 TSet, 이미 있던 컴포넌트도 포함
+        TArray<UClass*> Classes;
+        GetChildOfClass(USceneComponent::StaticClass(), Classes);
+        TMap<UClass*, TSet<UObject*>> LegacyClassToObjectListMap;
+        {
+            TArray<UObject*> AllObjects;
+            GetObjectsOfClass(USceneComponent::StaticClass(), AllObjects, true);
+            for (UObject* Object : AllObjects)
+            {
+                LegacyClassToObjectListMap.FindOrAdd(Object->GetClass()).Add(Object);
+            }
+        }
+
+        FIterateChecksum LegacyChecksum;
+        const uint64 LegacyStartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            TArray<UObject*> Results;
+            for (UClass* Class : Classes)
+            {
+                if (const TSet<UObject*>* List = LegacyClassToObjectListMap.Find(Class))
+                {
+                    for (UObject* Object : *List)
+                    {
+                        Results.Add(Object);
+                    }
+                }
+            }
+            LegacyChecksum = FIterateChecksum();
+            for (const UObject* Object : Results)
+            {
+                LegacyChecksum.Visit(Object);
+            }
+        }
+        const double LegacyMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LegacyStartCycles) / NumIterations;
+
+        FIterateChecksum CopyChecksum;
+        const uint64 CopyStartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            TArray<UObject*> Results;
+            GetObjectsOfClass(USceneComponent::StaticClass(), Results, true);
+            CopyChecksum = FIterateChecksum();
+            for (const UObject* Object : Results)
+            {
+                CopyChecksum.Visit(Object);
+            }
+        }
+        const double CopyMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CopyStartCycles) / NumIterations;
+
+        FIterateChecksum RangeChecksum;
+        const uint64 RangeStartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            RangeChecksum = FIterateChecksum();
+            for (const USceneComponent* Component : TObjectRange<USceneComponent>())
+            {
+                RangeChecksum.Visit(Component);
+            }
+        }
+        const double RangeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RangeStartCycles) / NumIterations;
+
+        for (UObject* Object : Objects)
+        {
+            GUObjectArray.MarkRemoveObject(Object);
+        }
+
+        const bool bPassed = LegacyChecksum == RangeChecksum && CopyChecksum == RangeChecksum;
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error,
+            "bench iterate %d objects (%d visited): legacy TSet copy %.3f ms, dense copy %.3f ms, zero-copy range %.3f ms (x%.1f vs legacy)%s",
+            Count, RangeChecksum.NumObjects, LegacyMs, CopyMs, RangeMs, LegacyMs / std::max(RangeMs, 0.001),
+            bPassed ? "" : ", visited sets differ"
+        );
+        return bPassed;
+    }
+
+    /** Body를 한 번 실행하는 데 걸린 시간 (ms) */
+    template <typename BodyType>
+    double MeasureMs(BodyType&& Body)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        Body();
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    /**
+     * 같은 Key로 TMap과 std::unordered_map에 추가/검색(있는 Key, 없는 Key)/순회/절반 제거를 하고 시간과 결과를 비교합니다.
+     * @return 두 컨테이너의 결과가 다른 횟수
+     */
+    template <typename KeyType>
+    int32 RunMapBenchmarkForKeys(const char* KeyName, const TArray<KeyType>& Keys, const TArray<KeyType>& MissingKeys)
+    {
+        TMap<KeyType, int32> Map;
+        std::unordered_map<KeyType, int32> StdMap;
+        int64 Sums[2][4] = {};
+
+        double Times[2][5];
+        Times[0][0] = MeasureMs([&] { for (int32 i = 0; i < Keys.Num(); ++i) { Map.Add(Keys[i], i); } });
+        Times[1][0] = MeasureMs([&] { for (int32 i = 0; i < Keys.Num(); ++i) { StdMap.emplace(Keys[i], i); } });
+
+        Times[0][1] = MeasureMs([&] { for (const KeyType& Key : Keys) { if (const int32* Value = Map.Find(Key)) { Sums[0][0] += *Value; } } });
+        Times[1][1] = MeasureMs([&] { for (const KeyType& Key : Keys) { const auto It = StdMap.find(Key); if (It != StdMap.end()) { Sums[1][0] += It->second; } } });
+
+        Times[0][2] = MeasureMs([&] { for (const KeyType& Key : MissingKeys) { Sums[0][1] += Map.Contains(Key) ? 1 : 0; } });
+        Times[1][2] = MeasureMs([&] { for (const KeyType& Key : MissingKeys) { Sums[1][1] += StdMap.contains(Key) ? 1 : 0; } });
+
+        Times[0][3] = MeasureMs([&] { for (const auto& Pair : Map) { Sums[0][2] += Pair.Value; } });
+        Times[1][3] = MeasureMs([&] { for (const auto& Pair : StdMap) { Sums[1][2] += Pair.second; } });
+
+        Times[0][4] = MeasureMs([&] { for (int32 i = 0; i < Keys.Num(); i += 2) { Map.Remove(Keys[i]); } });
+        Times[1][4] = MeasureMs([&] { for (int32 i = 0; i < Keys.Num(); i += 2) { StdMap.erase(Keys[i]); } });
+        for (const KeyType& Key : Keys)
+        {
+            Sums[0][3] += Map.Contains(Key) ? 1 : 0;
+            Sums[1][3] += StdMap.contains(Key) ? 1 : 0;
+        }
+
+        int32 NumErrors = Map.Num() == static_cast<int32>(StdMap.size()) ? 0 : 1;
+        for (int32 Index = 0; Index < 4; ++Index)
+        {
+            NumErrors += Sums[0][Index] == Sums[1][Index] ? 0 : 1;
+        }
+
+        UE_LOG(NumErrors == 0 ? ELogLevel::Display : ELogLevel::Error,
+            "bench containers TMap<%s> vs std::unordered_map, %d keys (ms): add %.2f / %.2f, find %.2f / %.2f, miss %.2f / %.2f, iterate %.2f / %.2f, remove %.2f / %.2f%s",
+            KeyName, Keys.Num(), Times[0][0], Times[1][0], Times[0][1], Times[1][1], Times[0][2], Times[1][2],
+            Times[0][3], Times[1][3], Times[0][4], Times[1][4], NumErrors == 0 ? "" : ", results differ"
+        );
+        return NumErrors;
+    }
+
+    /**
+     * TMap/TSet과 예전 구현이 감싸던 std::unordered_map/std::unordered_set을 비교합니다.
+     * - TMap<uint64>: FUObjectHashTables처럼 포인터 크기의 Key
+     * - TMap<FString>: FDXDBufferManager의 버퍼 풀처럼 문자열 Key
+     * - TSet<const void*>: AActor::OwnedComponents처럼 작은 Set 여러 개를 만들고 순회
+     * 끝으로 TMap<FString, int32>를 FArchive로 저장/로드해 같은 내용이 되는지 확인합니다.
+     */
+    bool RunContainerBenchmark(int32 Count)
+    {
+        constexpr int32 NumPerSet = 8;
+        Count = std::max(Count, NumPerSet);
+        std::mt19937_64 Random(17);
+
+        TArray<uint64> IntKeys;
+        TArray<uint64> MissingIntKeys;
+        TArray<FString> StringKeys;
+        TArray<FString> MissingStringKeys;
+        IntKeys.Reserve(Count);
+        MissingIntKeys.Reserve(Count);
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            // 16 Byte 정렬된 포인터처럼 하위 비트가 0인 Key
+            IntKeys.Add((Random() | 1) << 4);
+            MissingIntKeys.Add(Random() << 4 | 8);
+            StringKeys.Add(FString::Printf(TEXT("Contents/Mesh_%d.obj"), Index * 2));
+            MissingStringKeys.Add(FString::Printf(TEXT("Contents/Mesh_%d.obj"), Index * 2 + 1));
+        }
+
+        int32 NumErrors = 0;
+        NumErrors += RunMapBenchmarkForKeys("uint64", IntKeys, MissingIntKeys);
+        NumErrors += RunMapBenchmarkForKeys("FString", StringKeys, MissingStringKeys);
+
+        // 컴포넌트 8개 정도의 작은 Set을 Count / 8개 만들고 모두 순회
+        const int32 NumSets = Count / NumPerSet;
+        TArray<TSet<const void*>> Sets;
+        std::vector<std::unordered_set<const void*>> StdSets;
+        uint64 SetSums[2] = {};
+        const double SetAddMs = MeasureMs([&]
+        {
+            Sets.SetNum(NumSets);
+            for (int32 Index = 0; Index < NumSets * NumPerSet; ++Index)
+            {
+                Sets[Index / NumPerSet].Add(reinterpret_cast<const void*>(IntKeys[Index % IntKeys.Num()]));
+            }
+        });
+        const double StdSetAddMs = MeasureMs([&]
+        {
+            StdSets.resize(NumSets);
+            for (int32 Index = 0; Index < NumSets * NumPerSet; ++Index)
+            {
+                StdSets[Index / NumPerSet].insert(reinterpret_cast<const void*>(IntKeys[Index % IntKeys.Num()]));
+            }
+        });
+        const double SetIterateMs = MeasureMs([&]
+        {
+            for (const TSet<const void*>& Set : Sets)
+            {
+                for (const void* Item : Set)
+                {
+                    SetSums[0] += reinterpret_cast<uint64>(Item);
+                }
+            }
+        });
+        const double StdSetIterateMs = MeasureMs([&]
+        {
+            for (const std::unordered_set<const void*>& Set : StdSets)
+            {
+                for (const void* Item : Set)
+                {
+                    SetSums[1] += reinterpret_cast<uint64>(Item);
+                }
+            }
+        });
+        NumErrors += SetSums[0] == SetSums[1] ? 0 : 1;
+        UE_LOG(SetSums[0] == SetSums[1] ? ELogLevel::Display : ELogLevel::Error,
+            "bench containers %d TSet<const void*> of %d vs std::unordered_set (ms): add %.2f / %.2f, iterate %.2f / %.2f",
+            NumSets, NumPerSet, SetAddMs, StdSetAddMs, SetIterateMs, StdSetIterateMs
+        );
+
+        // FArchive 직렬화 왕복
+        TMap<FString, int32> Saved;
+        for (int32 Index = 0; Index < std::min(Count, 1000); ++Index)
+        {
+            Saved.Add(StringKeys[Index], Index);
+        }
+        TArray<uint8> Bytes;
+        FMemoryWriter Writer(Bytes);
+        Writer << Saved;
+        TMap<FString, int32> Loaded;
+        FMemoryReader Reader(Bytes);
+        Reader << Loaded;
+
+        int32 NumArchiveErrors = Loaded.Num() == Saved.Num() ? 0 : 1;
+        for (const auto& [Key, Value] : Saved)
+        {
+            const int32* LoadedValue = Loaded.Find(Key);
+            NumArchiveErrors += LoadedValue && *LoadedValue == Value ? 0 : 1;
+        }
+        NumErrors += NumArchiveErrors;
+        UE_LOG(NumArchiveErrors == 0 ? ELogLevel::Display : ELogLevel::Error,
+            "bench containers FArchive round trip of %d entries (%d bytes): %d errors", Saved.Num(), Bytes.Num(), NumArchiveErrors
+        );
+
+        return NumErrors == 0;
+    }
+
+    /**
+     * 워커 스레드에서 FName Count개를 만들고 Name Pool의 메모리 사용량을 출력합니다.
+     * 서로 다른 문자열은 Count / 2개로, 같은 문자열이 서로 다른 스레드에서 두 번씩 만들어집니다.
+     * 같은 문자열이 같은 Entry로, 대소문자만 다른 문자열이 같은 Name으로 묶이는지와 ToString 왕복을 확인하고,
+     * 이미 있는 Name을 다시 찾는 (잠금 없는 읽기) 시간도 측정합니다.
+     */
+    bool RunNameBenchmark(int32 Count)
+    {
+        // 실행마다 새 문자열이 되도록 접두사에 실행 번호를 붙임, 끝이 숫자면 "_숫자" 접미사로 분리되므로 문자로 끝냄
+        static int32 RunIndex = 0;
+        const int32 Run = RunIndex++;
+        const int32 NumUnique = std::max(Count / 2, 1);
+        const auto MakeName = [Run](int32 Index) { return FString::Printf(TEXT("BenchName%d_%dX"), Run, Index); };
+
+        TArray<FName> Names;
+        Names.SetNum(Count);
+
+        const uint32 EntriesBefore = FName::GetNumNameEntries();
+        const uint64 PoolBytesBefore = FName::GetNameTableMemorySize();
+        const uint64 WorkingSetBefore = GetProcessWorkingSetBytes();
+
+        const double CreateMs = MeasureMs([&]
+        {
+            FJobSystem::ParallelFor(Count, [&](int32 Index) { Names[Index] = FName(MakeName(Index % NumUnique)); }, 1024);
+        });
+
+        const uint32 NewEntries = FName::GetNumNameEntries() - EntriesBefore;
+        const int64 PoolBytes = static_cast<int64>(FName::GetNameTableMemorySize() - PoolBytesBefore);
+        const int64 WorkingSetDelta = static_cast<int64>(GetProcessWorkingSetBytes()) - static_cast<int64>(WorkingSetBefore);
+
+        std::atomic<int32> NumLookupErrors = 0;
+        const double FindMs = MeasureMs([&]
+        {
+            FJobSystem::ParallelFor(Count, [&](int32 Index)
+            {
+                if (FName(MakeName(Index % NumUnique)).GetDisplayIndex() != Names[Index].GetDisplayIndex())
+                {
+                    ++NumLookupErrors;
+                }
+            }, 1024);
+        });
+
+        int32 NumErrors = NumLookupErrors.load();
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const FName& Name = Names[Index];
+            const FName& First = Names[Index % NumUnique];
+            NumErrors += Name.GetDisplayIndex() == First.GetDisplayIndex() && Name.GetComparisonIndex() == First.GetComparisonIndex() ? 0 : 1;
+        }
+
+        // 문자열 왕복과 대소문자 무시 비교는 일부만 확인
+        const int32 NumSamples = std::min(NumUnique, 10000);
+        for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+        {
+            const int32 Index = static_cast<int32>(static_cast<int64>(Sample) * NumUnique / NumSamples);
+            const FString Expected = MakeName(Index);
+            NumErrors += Names[Index].ToString().Equals(Expected, ESearchCase::CaseSensitive) ? 0 : 1;
+            NumErrors += FName(Expected.ToLower()) == Names[Index] ? 0 : 1;
+        }
+
+        const bool bPassed = NumErrors == 0;
+        UE_LOG(bPassed ? ELogLevel::Display : ELogLevel::Error,
+            "bench names %d names (%d unique) on %d threads: create %.1f ms, find %.1f ms, %u new entries, pool +%.1f MB (%.1f B/name), working set %+.1f MB, %d errors",
+            Count, NumUnique, FJobSystem::GetNumWorkers() + 1, CreateMs, FindMs, NewEntries, ToMegabytes(PoolBytes),
+            static_cast<double>(PoolBytes) / std::max(NewEntries, 1u), ToMegabytes(WorkingSetDelta), NumErrors
+        );
+        return bPassed;
+    }
+
+    /** 선분 Origin + Direction * t (0 <= t <= MaxT)가 Box를 지나는지 (Slab 검사) */
+    bool SegmentIntersectsBox(const FVector& Origin, const FVector& Direction, float MaxT, const FBoundingBox& Box)
+    {
+        float TMin = 0.0f;
+        float TMax = MaxT;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const float O = Origin[Axis];
+            const float D = Direction[Axis];
+            if (std::abs(D) < 1e-8f)
+            {
+                if (O < Box.MinLocation[Axis] || O > Box.MaxLocation[Axis])
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            float T1 = (Box.MinLocation[Axis] - O) / D;
+            float T2 = (Box.MaxLocation[Axis] - O) / D;
+            if (T1 > T2)
+            {
+                std::swap(T1, T2);
+            }
+            TMin = std::max(TMin, T1);
+            TMax = std::min(TMax, T2);
+            if (TMin > TMax)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * World 없이 Box Count개를 FCollisionManager의 Scene 트리에 등록하고 한 번 움직인 뒤,
+     * 무작위 LineTrace와 SweepBox의 후보를 모든 Primitive의 월드 AABB를 직접 검사한 결과와 비교합니다.
+     * 트리는 Fat AABB를 쓰므로 후보가 더 많을 수는 있지만, 직접 검사에서 맞은 Primitive가 빠지면 안 됩니다.
+     */
+    bool RunTraceBenchmark(int32 Count)
+    {
+        constexpr int32 NumQueries = 2000;
+        const float WorldSize = 100.0f * std::cbrt(Count / 10000.0f);
+
+        std::mt19937 Random(99);
+        std::uniform_real_distribution<float> Position(0.0f, WorldSize);
+        std::uniform_real_distribution<float> Extent(0.2f, 2.0f);
+        std::uniform_real_distribution<float> Step(-1.0f, 1.0f);
+
+        FBenchCollisionManager Manager;
+        TArray<UBoxComponent*> Boxes;
+        Boxes.Reserve(Count);
+        for (int32 i = 0; i < Count; ++i)
+        {
+            UBoxComponent* Box = FObjectFactory::ConstructObject<UBoxComponent>(nullptr);
+            Box->SetBoxExtent(FVector(Extent(Random), Extent(Random), Extent(Random)));
+            Box->SetRelativeLocation(FVector(Position(Random), Position(Random), Position(Random)));
+            Manager.RegisterPrimitive(Box);
+            Boxes.Add(Box);
+        }
+
+        // World에 등록된 Primitive는 OnComponentToWorldDirty에서 MarkPrimitiveDirty가 불리므로 여기서 직접 호출
+        for (UBoxComponent* Box : Boxes)
+        {
+            Box->SetRelativeLocation(Box->GetRelativeLocation() + FVector(Step(Random), Step(Random), Step(Random)));
+            Manager.MarkPrimitiveDirty(Box);
+        }
+        Manager.FlushDirtyPrimitives();
+
+        // 절반은 짧은 선분(스프링 암 탐침), 절반은 월드를 가로지르는 픽킹 광선
+        struct FTraceQuery
+        {
+            FVector Start;
+            FVector End;
+            FVector HalfExtent;
+        };
+        TArray<FTraceQuery> Queries;
+        Queries.SetNum(NumQueries);
+        for (int32 q = 0; q < NumQueries; ++q)
+        {
+            FTraceQuery& Query = Queries[q];
+            Query.Start = FVector(Position(Random), Position(Random), Position(Random));
+            const float Length = q % 2 == 0 ? 5.0f : WorldSize;
+            FVector Direction = FVector(Step(Random), Step(Random), Step(Random)).GetSafeNormal();
+            if (Direction.IsNearlyZero())
+            {
+                Direction = FVector(1.0f, 0.0f, 0.0f);
+            }
+            Query.End = Query.Start + Direction * Length;
+            Query.HalfExtent = FVector(0.25f, 0.25f, 0.25f);
+        }
+
+        int64 NumLineCandidates = 0;
+        int64 NumSweepCandidates = 0;
+        TArray<TArray<UPrimitiveComponent*>> LineCandidates;
+        TArray<TArray<UPrimitiveComponent*>> SweepCandidates;
+        LineCandidates.SetNum(NumQueries);
+        SweepCandidates.SetNum(NumQueries);
+
+        const uint64 LineStartCycles = FPlatformTime::Cycles64();
+        for (int32 q = 0; q < NumQueries; ++q)
+        {
+            const FVector Delta = Queries[q].End - Queries[q].Start;
+            const float Length = Delta.Length();
+            Manager.LineTrace(Queries[q].Start, Delta / Length, Length, LineCandidates[q]);
+            NumLineCandidates += LineCandidates[q].Num();
+        }
+        const uint64 SweepStartCycles = FPlatformTime::Cycles64();
+        for (int32 q = 0; q < NumQueries; ++q)
+        {
+            Manager.SweepBox(Queries[q].Start, Queries[q].End, Queries[q].HalfExtent, SweepCandidates[q]);
+            NumSweepCandidates += SweepCandidates[q].Num();
+        }
+        const uint64 TreeEndCycles = FPlatformTime::Cycles64();
+
+        // 예전 PickActor/스프링 암처럼 모든 Primitive의 AABB를 매번 검사, 맞은 Primitive의 Index만 기록
+        int64 NumLineHits = 0;
+        int64 NumSweepHits = 0;
+        TArray<TArray<int32>> LineHits;
+        TArray<TArray<int32>> SweepHits;
+        LineHits.SetNum(NumQueries);
+        SweepHits.SetNum(NumQueries);
+        const uint64 BruteStartCycles = FPlatformTime::Cycles64();
+        for (int32 q = 0; q < NumQueries; ++q)
+        {
+            const FTraceQuery& Query = Queries[q];
+            const FVector Delta = Query.End - Query.Start;
+            for (int32 i = 0; i < Count; ++i)
+            {
+                const FBoundingBox WorldAABB = Boxes[i]->GetWorldAABB();
+                if (SegmentIntersectsBox(Query.Start, Delta, 1.0f, WorldAABB))
+                {
+                    LineHits[q].Add(i);
+                }
+
+                const FBoundingBox SweptAABB(WorldAABB.MinLocation - Query.HalfExtent, WorldAABB.MaxLocation + Query.HalfExtent);
+                if (SegmentIntersectsBox(Query.Start, Delta, 1.0f, SweptAABB))
+                {
+                    SweepHits[q].Add(i);
+                }
+            }
+            NumLineHits += LineHits[q].Num();
+            NumSweepHits += SweepHits[q].Num();
+        }
+        const double BruteMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BruteStartCycles);
+
+        int32 NumMissed = 0;
+        for (int32 q = 0; q < NumQueries; ++q)
+        {
+            for (const int32 i : LineHits[q])
+            {
+                NumMissed += LineCandidates[q].Contains(Boxes[i]) ? 0 : 1;
+            }
+            for (const int32 i : SweepHits[q])
+            {
+                NumMissed += SweepCandidates[q].Contains(Boxes[i]) ? 0 : 1;
+            }
+        }
+        const double LineMs = FPlatformTime::ToMilliseconds(SweepStartCycles - LineStartCycles);
+        const double SweepMs = FPlatformTime::ToMilliseconds(TreeEndCycles - SweepStartCycles);
+
+        UE_LOG(NumMissed == 0 ? ELogLevel::Display : ELogLevel::Error,
+            "bench trace %d primitives x %d queries: LineTrace %.3f ms (%lld candidates / %lld hits), SweepBox %.3f ms (%lld / %lld), "
+            "brute force %.1f ms (x%.1f), %d missed",
+            Count, NumQueries, LineMs, NumLineCandidates, NumLineHits, SweepMs, NumSweepCandidates, NumSweepHits,
+            BruteMs, BruteMs / std::max(LineMs + SweepMs, 0.001), NumMissed
+        );
+
+        for (UBoxComponent* Box : Boxes)
+        {
+            Manager.UnregisterPrimitive(Box);
+            GUObjectArray.MarkRemoveObject(Box);
+        }
+        return NumMissed == 0;
+    }
+
+    const FBenchCommand BenchCommands[] =
+    {
+        {
+            "spawn", "bench spawn <N>: Spawn and destroy N actors and report the time",
+            [](const std::string& Args) { RunSpawnBenchmark(ParseCount(Args, 0)); }
+        },
+        {
+            "pie", "bench pie <N>: Measure PIE world duplication time with up to N extra actors",
+            [](const std::string& Args) { RunPIEDuplicateBenchmark(ParseCount(Args, 0)); }
+        },
+        {
+            "churn", "bench churn [N]: Spawn and destroy N (default 50000) short-lived actors over simulated frames",
+            [](const std::string& Args) { RunChurnBenchmark(ParseCount(Args, 50000)); }
+        },
+        {
+            "tick", "bench tick [N]: Tick N (default 20000) projectile + sky sphere actors on the main thread and on 1/2/4/8 job workers",
+            [](const std::string& Args) { RunTickBenchmark(ParseCount(Args, 20000)); }
+        },
+        {
+            "scene", "bench scene [Path]: Compare JSON and binary scene load time and check the round trip (default Saved/level2.scene)",
+            [](const std::string& Args) { RunSceneFormatBenchmark(Args.empty() ? std::string("Saved/level2.scene") : Args, 20); }
+        },
+        {
+            "assets", "bench assets [N]: Compare synchronous and asynchronous import of N (default 500) generated OBJ meshes",
+            [](const std::string& Args)
+            {
+                if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+                {
+                    RunAssetImportBenchmark(*AssetManager, ParseCount(Args, 500));
+                }
+            }
+        },
+        {
+            "objparse", "bench objparse [Path]: Compare the mapped OBJ parser against the getline parser on one file or every OBJ under Assets/ and Contents/",
+            [](const std::string& Args) { RunObjParseBenchmark(ParsePath(Args), 3); }
+        },
+        {
+            "objconvert", "bench objconvert [Path]: Compare OBJ vertex welding against the string key version and check the output (default generated grid)",
+            [](const std::string& Args) { RunObjConvertBenchmark(ParsePath(Args), 10); }
+        },
+        {
+            "meshcache", "bench meshcache [N]: Check the cooked mesh file round trip and load N (default 2000) corrupted copies",
+            [](const std::string& Args) { RunCookedMeshFileTests(ParseCount(Args, 2000)); }
+        },
+        {
+            "meshopt", "bench meshopt [Path]: Report ACMR/ATVR before and after mesh optimization on one file or every OBJ under Assets/ and Contents/",
+            [](const std::string& Args) { RunMeshOptimizeBenchmark(ParsePath(Args)); }
+        },
+        {
+            "meshbvh", "bench meshbvh [Path]: Compare brute-force and BVH ray casts (hit count and distance, before and after refit) on one file or every OBJ under Assets/ and Contents/",
+            [](const std::string& Args) { RunMeshBVHBenchmark(ParsePath(Args), 500); }
+        },
+        {
+            "overlap", "bench overlap [N]: Move N (default 10000) sphere shapes without a world and check the overlap queries against brute force",
+            [](const std::string& Args) { RunOverlapBenchmark(ParseCount(Args, 10000)); }
+        },
+        {
+            "transform", "bench transform [N]: Compare cached world matrices of N (default 10000) components in a wide tree and deep chains with the old parent walk",
+            [](const std::string& Args) { RunTransformBenchmark(ParseCount(Args, 10000)); }
+        },
+        {
+            "cull", "bench cull [N]: Compare the scalar and SSE frustum culling kernels on N (default 1000000) random boxes, half of them touching a plane",
+            [](const std::string& Args) { RunCullBenchmark(ParseCount(Args, 1000000)); }
+        },
+        {
+            "drawcmd", "bench drawcmd [N]: Build draw commands for N (default 20000) objects, check the radix sort against std::stable_sort and count binds",
+            [](const std::string& Args) { RunDrawCommandBenchmark(ParseCount(Args, 20000)); }
+        },
+        {
+            "instancing", "bench instancing [N]: Group N (default 10000) objects with FMeshInstanceGrouper and check batch and instance counts",
+            [](const std::string& Args) { RunInstancingBenchmark(ParseCount(Args, 10000)); }
+        },
+        {
+            "skin", "bench skin [Path]: Skin a randomly posed skeletal mesh with the scalar and SSE kernels and compare (default Contents/Mutant_Unreal.fbx)",
+            [](const std::string& Args) { RunSkinningBenchmark(ParsePath(Args, "Contents/Mutant_Unreal.fbx"), 50); }
+        },
+        {
+            "iterate", "bench iterate [N]: Compare copying and zero-copy iteration over N (default 100000) scene components",
+            [](const std::string& Args) { RunIterateBenchmark(ParseCount(Args, 100000)); }
+        },
+        {
+            "containers", "bench containers [N]: Compare TMap/TSet with std::unordered_map/std::unordered_set on N (default 200000) keys",
+            [](const std::string& Args) { RunContainerBenchmark(ParseCount(Args, 200000)); }
+        },
+        {
+            "names", "bench names [N]: Create N (default 1000000) FNames on the job workers and report Name Pool memory",
+            [](const std::string& Args) { RunNameBenchmark(ParseCount(Args, 1000000)); }
+        },
+        {
+            "trace", "bench trace [N]: Compare LineTrace/SweepBox candidates over N (default 20000) boxes against brute force",
+            [](const std::string& Args) { RunTraceBenchmark(ParseCount(Args, 20000)); }
+        },
+        {
+            "lua", "bench lua [N]: Compare N (default 1000) scripts with a Lua state each against one shared VM (create time, tick time, memory)",
+            [](const std::string& Args) { RunLuaBenchmark(ParseCount(Args, 1000), 600); }
+        },
+        {
+            "filewatch", "bench filewatch [N]: Watch N (default 1000) files and check that idle frames do no file access and edits arrive within one frame",
+            [](const std::string& Args) { RunFileWatcherTests(ParseCount(Args, 1000)); }
+        },
+        {
+            "profiler", "bench profiler [N]: Record N (default 120) frames of nested and job scopes and check ring buffer, nesting, percentiles and trace dump",
+            [](const std::string& Args) { RunProfilerTests(ParseCount(Args, 120)); }
+        },
+    };
+}
+
+void FConsole::ExecuteBenchCommand(const std::string& Args)
+{
+    const size_t Space = Args.find(' ');
+    const std::string Name = Args.substr(0, Space);
+    const size_t ArgsStart = Args.find_first_not_of(' ', Space);
+    const std::string BenchArgs = ArgsStart == std::string::npos ? std::string() : Args.substr(ArgsStart);
+
+    for (const FBenchCommand& Bench : BenchCommands)
+    {
+        if (Name == Bench.Name)
+        {
+            Bench.Run(BenchArgs);
+            return;
+        }
+    }
+
+    if (!Name.empty())
+    {
+        AddLog(ELogLevel::Error, "Unknown bench: %s", Name.c_str());
+    }
+    LogBenchUsage();
+}
+
+void FConsole::LogBenchUsage()
+{
+    for (const FBenchCommand& Bench : BenchCommands)
+    {
+        AddLog(ELogLevel::Display, " - %s", Bench.Usage);
+    }
+}
+
+#endif // WITH_BENCHMARKS
@@ -1,6 +1,8 @@
 #include "World.h"
 
 #include "CollisionManager.h"
+#include "LuaScripts/LuaScriptManager.h"
+#include "Engine/TickTaskManager.h"
 #include "Actors/Cube.h"
 #include "Actors/Player.h"
 #include "BaseGizmos/TransformGizmo.h"
@@ -37,6 +39,7 @@ void UWorld::InitializeNewWorld()
     //InitializeLightScene(); // 테스트용 LightScene 비활성화
 
     CollisionManager = new FCollisionManager();
+    TickTaskManager = new FTickTaskManager();
 }
 
 void UWorld::InitializeLightScene()
@@ -102,11 +105,24 @@ void UWorld::InitializeLightScene()
 UObject* UWorld::Duplicate(UObject* InOuter)
 {
     // TODO: UWorld의 Duplicate는 역할 분리후 만드는것이 좋을듯
-    UWorld* NewWorld = Cast<UWorld>(Super::Duplicate(InOuter));
-    NewWorld->ActiveLevel = Cast<ULevel>(ActiveLevel->Duplicate(NewWorld));
+    UWorld* NewWorld;
+    {
+        // Level의 모든 객체를 한 번에 복제하고, 원본을 가리키는 참조는 마지막에 한 번만 정리
+        FObjectDuplicator Duplicator;
+        NewWorld = Cast<UWorld>(Super::Duplicate(InOuter));
+        NewWorld->ActiveLevel = Cast<ULevel>(ActiveLevel->Duplicate(NewWorld));
+        Duplicator.FixupReferences();
+    }
     NewWorld->ActiveLevel->InitLevel(NewWorld);
     
     NewWorld->CollisionManager = new FCollisionManager();
+    NewWorld->TickTaskManager = new FTickTaskManager();
+
+    for (AActor* Actor : NewWorld->ActiveLevel->Actors)
+    {
+        Actor->RegisterAllActorTickFunctions(true);
+        Actor->RegisterAllComponentsWithWorld(true);
+    }
     
     return NewWorld;
 }
@@ -118,12 +134,24 @@ void UWorld::Tick(float DeltaTime)
     // SpawnActor()에 의해 Actor가 생성된 경우, 여기서 BeginPlay 호출
     if (WorldType != EWorldType::Editor)
     {
-        for (AActor* Actor : PendingBeginPlayActors)
+        for (const TWeakObjectPtr<AActor>& Actor : PendingBeginPlayActors)
         {
-            Actor->BeginPlay();
+            // BeginPlay 전에 파괴된 Actor는 건너뜀
+            if (AActor* PendingActor = Actor.Get())
+            {
+                PendingActor->BeginPlay();
+            }
         }
         PendingBeginPlayActors.Empty();
     }
+    else
+    {
+        // Editor World의 Actor는 BeginPlay가 호출되지 않으므로 대기열을 쌓아두지 않음
+        PendingBeginPlayActors.Empty();
+    }
+
+    // Editor World에서는 bTickInEditor인 Actor의 Tick 함수만 실행됨
+    TickTaskManager->Tick(DeltaTime, WorldType == EWorldType::Editor);
 }
 
 void UWorld::BeginPlay()
@@ -213,8 +241,31 @@ void UWorld::Release()
         delete CollisionManager;
         CollisionManager = nullptr;
     }
+
+    // 남은 Tick 함수의 등록은 여기서 끊기고, 객체는 아래에서 삭제됨
+    if (TickTaskManager)
+    {
+        delete TickTaskManager;
+        TickTaskManager = nullptr;
+    }
     
     GUObjectArray.ProcessPendingDestroyObjects();
+
+    // 컴포넌트와 PlayerController가 잡고 있던 Lua 참조가 위에서 모두 풀린 뒤에 VM을 닫음
+    if (LuaScriptManager)
+    {
+        delete LuaScriptManager;
+        LuaScriptManager = nullptr;
+    }
+}
+
+FLuaScriptManager* UWorld::GetLuaScriptManager()
+{
+    if (!LuaScriptManager)
+    {
+        LuaScriptManager = new FLuaScriptManager();
+    }
+    return LuaScriptManager;
 }
 
 AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
@@ -235,10 +286,12 @@ AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
         // TODO: 일단 AddComponent에서 Component마다 초기화
         // 추후에 RegisterComponent() 만들어지면 주석 해제
         // Actor->InitializeComponents();
-        ActiveLevel->Actors.Add(NewActor);
+        ActiveLevel->AddActor(NewActor);
         PendingBeginPlayActors.Add(NewActor);
 
         NewActor->PostSpawnInitialize();
+        NewActor->RegisterAllActorTickFunctions(true);
+        NewActor->RegisterAllComponentsWithWorld(true);
         return NewActor;
     }
     
@@ -262,6 +315,9 @@ bool UWorld::DestroyActor(AActor* ThisActor)
     //
     // Engine->DeselectActor(ThisActor);
 
+    ThisActor->RegisterAllActorTickFunctions(false);
+    ThisActor->RegisterAllComponentsWithWorld(false);
+
     // 액터의 Destroyed 호출
     ThisActor->Destroyed();
 
@@ -277,7 +333,7 @@ bool UWorld::DestroyActor(AActor* ThisActor)
     }
 
     // World에서 제거
-    ActiveLevel->Actors.Remove(ThisActor);
+    ActiveLevel->RemoveActor(ThisActor);
 
     // 제거 대기열에 추가
     GUObjectArray.MarkRemoveObject(ThisActor);
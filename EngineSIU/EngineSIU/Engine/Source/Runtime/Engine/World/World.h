@@ -1,6 +1,7 @@
 #pragma once
 #include "Define.h"
 #include "Container/Set.h"
+#include "UObject/ObjectDuplicator.h"
 #include "UObject/ObjectFactory.h"
 #include "UObject/ObjectMacros.h"
 #include "WorldType.h"
@@ -12,6 +13,7 @@
 #include "Engine/Engine.h"
 #include "Engine/EventManager.h"
 #include "UObject/UObjectIterator.h"
+#include "UObject/WeakObjectPtr.h"
 
 class UPrimitiveComponent;
 struct FOverlapResult;
@@ -21,6 +23,8 @@ class AActor;
 class UObject;
 class USceneComponent;
 class FCollisionManager;
+class FTickTaskManager;
+class FLuaScriptManager;
 class AGameMode;
 class UTextComponent;
 
@@ -82,6 +86,14 @@ public:
     
     void CheckOverlap(const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps) const;
 
+    FCollisionManager* GetCollisionManager() const { return CollisionManager; }
+
+    /** 이 World의 Actor와 컴포넌트가 등록하는 Tick 함수 관리자 */
+    FTickTaskManager* GetTickTaskManager() const { return TickTaskManager; }
+
+    /** 이 World의 Lua 스크립트가 함께 쓰는 VM, 처음 요청할 때 만들어짐 */
+    FLuaScriptManager* GetLuaScriptManager();
+
 public:
     double TimeSeconds;
     
@@ -92,8 +104,11 @@ private:
 
     ULevel* ActiveLevel;
 
-    /** Actor가 Spawn되었고, 아직 BeginPlay가 호출되지 않은 Actor들 */
-    TArray<AActor*> PendingBeginPlayActors;
+    /**
+     * Actor가 Spawn되었고, 아직 BeginPlay가 호출되지 않은 Actor들
+     * BeginPlay 전에 파괴된 Actor는 목록에서 찾아 지우지 않고 Weak 참조가 무효가 되어 건너뜀
+     */
+    TArray<TWeakObjectPtr<AActor>> PendingBeginPlayActors;
 
     // TODO: 싱글 플레이어면 상관 없지만, 로컬 멀티 플레이어인 경우를 위해 배열로 관리하는 방법을 고려하기.
     APlayerController* PlayerController = nullptr;
@@ -103,6 +118,10 @@ private:
     UTextComponent* MainTextComponent = nullptr;
 
     FCollisionManager* CollisionManager = nullptr;
+
+    FTickTaskManager* TickTaskManager = nullptr;
+
+    FLuaScriptManager* LuaScriptManager = nullptr;
 };
 
 
@@ -119,9 +138,15 @@ T* UWorld::DuplicateActor(T* InActor)
 {
     if (ULevel* ActiveLevel = GetActiveLevel())
     {
+        FObjectDuplicator Duplicator;
+        InActor->PreallocateDuplicate(this, Duplicator);
         T* NewActor = static_cast<T*>(InActor->Duplicate(this));
-        ActiveLevel->Actors.Add(NewActor);
+        Duplicator.FixupReferences();
+
+        ActiveLevel->AddActor(NewActor);
         PendingBeginPlayActors.Add(NewActor);
+        NewActor->RegisterAllActorTickFunctions(true);
+        NewActor->RegisterAllComponentsWithWorld(true);
         return NewActor;
     }
     return nullptr;
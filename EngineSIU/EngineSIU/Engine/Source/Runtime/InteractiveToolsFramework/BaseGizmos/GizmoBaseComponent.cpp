@@ -6,6 +6,12 @@
 #include "UnrealEd/EditorViewportClient.h"
 
 
+UGizmoBaseComponent::UGizmoBaseComponent()
+{
+    // 기즈모 Actor는 World 밖에서 EditorViewportClient가 직접 Tick하므로 매니저에는 등록되지 않음
+    PrimaryComponentTick.bCanEverTick = true;
+}
+
 void UGizmoBaseComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
@@ -22,12 +28,12 @@ void UGizmoBaseComponent::TickComponent(float DeltaTime)
             float Scaler = (ViewportClient->PerspectiveCamera.GetLocation() - GetOwner()->GetActorLocation()).Length();
             
             Scaler *= GizmoScale;
-            RelativeScale3D = FVector(Scaler);
+            SetRelativeScale3D(FVector(Scaler));
         }
         else
         {
             float Scaler = FEditorViewportClient::OrthoSize * GizmoScale;
-            RelativeScale3D = FVector(Scaler);
+            SetRelativeScale3D(FVector(Scaler));
         }
     }
 }
@@ -10,7 +10,6 @@
 #include "Components/Mesh/SkeletalMeshComponent.h"
 #include "Engine/Asset/SkeletalMeshAsset.h"
 #include "Engine/SkeletalMeshActor.h"
-#include "Engine/FbxLoader.h"
 
 ATransformGizmo::ATransformGizmo()
 {
@@ -137,15 +136,11 @@ void ATransformGizmo::Tick(float DeltaTime)
                 else
                 {
                     RenderData->SkeletonBones[i].LocalBindPose = Cast<ASkeletalMeshActor>(SkeletalMeshComp->GetOwner())->BoneGizmoSceneComponents[i]->GetRelativeModelMatrix();
-                    RenderData->SkeletonBones[i].GlobalPose = RenderData->SkeletonBones[i].LocalBindPose * FFBXManager::SkeletalMeshRenderData->SkeletonBones[RenderData->SkeletonBones[i].ParentIndex].GlobalPose;
+                    RenderData->SkeletonBones[i].GlobalPose = RenderData->SkeletonBones[i].LocalBindPose * RenderData->SkeletonBones[RenderData->SkeletonBones[i].ParentIndex].GlobalPose;
                 }
             }
 
-            FFBXLoader::ReskinVerticesCPU(
-                FFBXLoader::Mesh, // 필요시 원본 FbxMesh 포인터 보존 필요
-                RenderData->SkeletonBones,
-                RenderData->Vertices
-            );
+            RenderData->bPoseDirty = true;
         }
 
         SetActorLocation(TargetComponent->GetWorldLocation());
@@ -22,6 +22,9 @@
 #define PHONG "LIGHTING_MODEL_BLINN_PHONG"
 #define PBR "LIGHTING_MODEL_PBR"
 
+#define MESH_INSTANCING "MESH_INSTANCING"
+#define GPU_SKINNING "GPU_SKINNING"
+
 // Material Subset
 struct FMaterialSubset
 {
@@ -328,6 +331,7 @@ struct FPrimitiveCounts
 #define MAX_LIGHTS 16
 #define NUM_FACES 6
 #define MAX_CASCADE_NUM 5
+#define MAX_SKINNING_BONES 128
 
 enum ELightType {
     POINT_LIGHT = 1,
@@ -387,6 +391,19 @@ struct FObjectConstantBuffer
     FVector pad;
 };
 
+// 인스턴스드 드로우에서 Slot 1 정점 버퍼로 들어가는 인스턴스별 데이터
+struct FMeshInstanceData
+{
+    FMatrix WorldMatrix;
+    FMatrix InverseTransposedWorld;
+};
+
+// GPU 스키닝에서 메시마다 갱신하는 본 팔레트 (InverseBindPose * GlobalPose)
+struct FBonePaletteConstants
+{
+    FMatrix BonePalette[MAX_SKINNING_BONES];
+};
+
 struct FCameraConstantBuffer
 {
     FMatrix ViewMatrix;
@@ -468,6 +485,7 @@ struct FIndexInfo
 {
     uint32_t NumIndices;
     ID3D11Buffer* IndexBuffer;
+    DXGI_FORMAT Format = DXGI_FORMAT_R32_UINT;
 };
 
 struct FBufferInfo
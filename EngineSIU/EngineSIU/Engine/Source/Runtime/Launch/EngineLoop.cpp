@@ -1,6 +1,12 @@
 #include "EngineLoop.h"
+#pragma comment(lib, "winmm")
+
+#include <thread>
+#include <timeapi.h>
+
 #include "ImGuiManager.h"
 #include "UnrealClient.h"
+#include "WindowsFileWatcher.h"
 #include "WindowsPlatformTime.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "Engine/EditorEngine.h"
@@ -17,6 +23,7 @@
 #include "SubWindow/SubCamera.h"
 #include "SubWindow/SubRenderer.h"
 #include "UserInterface/Drawer.h"
+#include "Async/JobSystem.h"
 
 extern LRESULT ImGui_ImplWin32_WndProcHandler(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
@@ -51,6 +58,15 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
 {
     FPlatformTime::InitTiming();
 
+    // 프레임 제한에서 Sleep이 1ms 단위로 깨어나도록 타이머 해상도를 올림
+    timeBeginPeriod(1);
+
+    // 메인 스레드도 Wait 중에 작업을 실행하므로 워커는 코어 수 - 1
+    FJobSystem::Initialize(static_cast<int32>(std::thread::hardware_concurrency()) - 1);
+
+    // 셰이더와 Lua 스크립트가 등록하기 전에 감시 스레드 시작
+    FFileWatcher::Initialize();
+
     /* must be initialized before window. */
     WindowInit(hInstance);
     SubWindowInit(hInstance);
@@ -132,6 +148,9 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
 void FEngineLoop::Render(float DeltaTime)
 {
     GraphicDevice.Prepare();
+
+    // 멀티 뷰포트면 뷰포트 수만큼 누적됨
+    Renderer.MeshDrawStats.Reset();
     
     if (LevelEditor->IsMultiViewport())
     {
@@ -201,7 +220,7 @@ void FEngineLoop::Tick()
 
     while (bIsExit == false)
     {
-        FProfilerStatsManager::BeginFrame();    // Clear previous frame stats
+        FProfilerStatsManager::BeginFrame();    // Close previous frame and update its stats
         if (GPUTimingManager.IsInitialized())
         {
             GPUTimingManager.BeginFrame();      // Start GPU frame timing
@@ -236,6 +255,9 @@ void FEngineLoop::Tick()
 
         const float DeltaTime = static_cast<float>(ElapsedTime / 1000.f);
 
+        // 지난 프레임 동안 바뀐 파일을 한 번에 전달, 변경이 없으면 바로 반환
+        FFileWatcher::ProcessEvents();
+
         GEngine->Tick(DeltaTime);
         LevelEditor->Tick(DeltaTime);
         
@@ -273,12 +295,19 @@ void FEngineLoop::Tick()
             bIsShowSubWindow = false;
         }
         
-        do
+        // 남은 시간 동안은 스레드를 재워 워커에게 코어를 양보하고, 마지막 1ms 정도만 돌면서 맞춤
+        while (true)
         {
-            Sleep(0);
             QueryPerformanceCounter(&EndTime);
             ElapsedTime = (static_cast<double>(EndTime.QuadPart - StartTime.QuadPart) * 1000.f / static_cast<double>(Frequency.QuadPart));
-        } while (ElapsedTime < TargetFrameTime);
+
+            const double RemainingTime = TargetFrameTime - ElapsedTime;
+            if (RemainingTime <= 0.0)
+            {
+                break;
+            }
+            Sleep(RemainingTime > 2.0 ? static_cast<DWORD>(RemainingTime - 1.0) : 0);
+        }
     }
 }
 
@@ -293,6 +322,9 @@ void FEngineLoop::GetClientSize(uint32& OutWidth, uint32& OutHeight) const
 
 void FEngineLoop::Exit()
 {
+    FJobSystem::Shutdown();
+    timeEndPeriod(1);
+
     if (SubGraphicDevice.Device)
     {
         SubGraphicDevice.Release();
@@ -322,6 +354,8 @@ void FEngineLoop::Exit()
     delete UnrealEditor;
     delete BufferManager;
     delete LevelEditor;
+
+    FFileWatcher::Shutdown();
 }
 
 void FEngineLoop::CleanupSubWindow()
@@ -0,0 +1,342 @@
+#include "AABBTree.h"
+
+FDynamicAABBTree::FDynamicAABBTree()
+{
+    Nodes.Reserve(64);
+}
+
+int32 FDynamicAABBTree::CreateProxy(const FBoundingBox& InBox, void* InUserData)
+{
+    const int32 ProxyId = AllocateNode();
+
+    const FVector Margin(AABBMargin);
+    FTreeNode& Node = Nodes[ProxyId];
+    Node.Box = FBoundingBox(InBox.MinLocation - Margin, InBox.MaxLocation + Margin);
+    Node.UserData = InUserData;
+    Node.Height = 0;
+
+    InsertLeaf(ProxyId);
+    ++ProxyCount;
+
+    return ProxyId;
+}
+
+void FDynamicAABBTree::DestroyProxy(int32 ProxyId)
+{
+    if (!Nodes.IsValidIndex(ProxyId) || !Nodes[ProxyId].IsLeaf() || Nodes[ProxyId].Height != 0)
+    {
+        return;
+    }
+
+    RemoveLeaf(ProxyId);
+    FreeNode(ProxyId);
+    --ProxyCount;
+}
+
+bool FDynamicAABBTree::MoveProxy(int32 ProxyId, const FBoundingBox& InBox)
+{
+    if (!Nodes.IsValidIndex(ProxyId) || !Nodes[ProxyId].IsLeaf())
+    {
+        return false;
+    }
+
+    // 아직 Fat AABB 안에 있으면 트리를 건드리지 않음
+    if (Contains(Nodes[ProxyId].Box, InBox))
+    {
+        return false;
+    }
+
+    RemoveLeaf(ProxyId);
+
+    const FVector Margin(AABBMargin);
+    Nodes[ProxyId].Box = FBoundingBox(InBox.MinLocation - Margin, InBox.MaxLocation + Margin);
+
+    InsertLeaf(ProxyId);
+    return true;
+}
+
+void* FDynamicAABBTree::GetUserData(int32 ProxyId) const
+{
+    return Nodes.IsValidIndex(ProxyId) ? Nodes[ProxyId].UserData : nullptr;
+}
+
+const FBoundingBox& FDynamicAABBTree::GetFatAABB(int32 ProxyId) const
+{
+    return Nodes[ProxyId].Box;
+}
+
+int32 FDynamicAABBTree::GetHeight() const
+{
+    return Root == INDEX_NONE ? 0 : Nodes[Root].Height;
+}
+
+void FDynamicAABBTree::Clear()
+{
+    Nodes.Empty();
+    Root = INDEX_NONE;
+    FreeList = INDEX_NONE;
+    ProxyCount = 0;
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+    if (FreeList == INDEX_NONE)
+    {
+        Nodes.Add(FTreeNode());
+        return Nodes.Num() - 1;
+    }
+
+    const int32 NodeId = FreeList;
+    FreeList = Nodes[NodeId].ParentOrNext;
+    Nodes[NodeId] = FTreeNode();
+    return NodeId;
+}
+
+void FDynamicAABBTree::FreeNode(int32 NodeId)
+{
+    FTreeNode& Node = Nodes[NodeId];
+    Node.UserData = nullptr;
+    Node.Child1 = INDEX_NONE;
+    Node.Child2 = INDEX_NONE;
+    Node.Height = -1;
+    Node.ParentOrNext = FreeList;
+    FreeList = NodeId;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 Leaf)
+{
+    if (Root == INDEX_NONE)
+    {
+        Root = Leaf;
+        Nodes[Root].ParentOrNext = INDEX_NONE;
+        return;
+    }
+
+    // 표면적 증가량이 가장 작은 형제 노드를 찾음
+    const FBoundingBox LeafBox = Nodes[Leaf].Box;
+    int32 Index = Root;
+    while (!Nodes[Index].IsLeaf())
+    {
+        const FTreeNode& Node = Nodes[Index];
+        const int32 Child1 = Node.Child1;
+        const int32 Child2 = Node.Child2;
+
+        const float Area = GetSurfaceArea(Node.Box);
+        const float CombinedArea = GetSurfaceArea(Combine(Node.Box, LeafBox));
+
+        // 현재 노드와 새 리프를 묶어 새 부모를 만드는 비용
+        const float Cost = 2.0f * CombinedArea;
+        // 더 아래로 내려갈 때 상속되는 비용
+        const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+        auto ChildCost = [&](int32 Child)
+        {
+            const FBoundingBox Combined = Combine(LeafBox, Nodes[Child].Box);
+            if (Nodes[Child].IsLeaf())
+            {
+                return GetSurfaceArea(Combined) + InheritanceCost;
+            }
+            return GetSurfaceArea(Combined) - GetSurfaceArea(Nodes[Child].Box) + InheritanceCost;
+        };
+
+        const float Cost1 = ChildCost(Child1);
+        const float Cost2 = ChildCost(Child2);
+
+        if (Cost < Cost1 && Cost < Cost2)
+        {
+            break;
+        }
+
+        Index = Cost1 < Cost2 ? Child1 : Child2;
+    }
+
+    const int32 Sibling = Index;
+
+    // 새 부모 노드 생성 (AllocateNode가 Nodes를 재할당할 수 있으므로 참조를 미리 잡지 않음)
+    const int32 OldParent = Nodes[Sibling].ParentOrNext;
+    const int32 NewParent = AllocateNode();
+    Nodes[NewParent].ParentOrNext = OldParent;
+    Nodes[NewParent].Box = Combine(LeafBox, Nodes[Sibling].Box);
+    Nodes[NewParent].Height = Nodes[Sibling].Height + 1;
+    Nodes[NewParent].Child1 = Sibling;
+    Nodes[NewParent].Child2 = Leaf;
+    Nodes[Sibling].ParentOrNext = NewParent;
+    Nodes[Leaf].ParentOrNext = NewParent;
+
+    if (OldParent != INDEX_NONE)
+    {
+        if (Nodes[OldParent].Child1 == Sibling)
+        {
+            Nodes[OldParent].Child1 = NewParent;
+        }
+        else
+        {
+            Nodes[OldParent].Child2 = NewParent;
+        }
+    }
+    else
+    {
+        Root = NewParent;
+    }
+
+    // 루트까지 올라가며 높이와 AABB를 갱신
+    Index = Nodes[Leaf].ParentOrNext;
+    while (Index != INDEX_NONE)
+    {
+        Index = Balance(Index);
+
+        FTreeNode& Node = Nodes[Index];
+        Node.Height = 1 + FMath::Max(Nodes[Node.Child1].Height, Nodes[Node.Child2].Height);
+        Node.Box = Combine(Nodes[Node.Child1].Box, Nodes[Node.Child2].Box);
+
+        Index = Node.ParentOrNext;
+    }
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 Leaf)
+{
+    if (Leaf == Root)
+    {
+        Root = INDEX_NONE;
+        return;
+    }
+
+    const int32 Parent = Nodes[Leaf].ParentOrNext;
+    const int32 GrandParent = Nodes[Parent].ParentOrNext;
+    const int32 Sibling = Nodes[Parent].Child1 == Leaf ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+    if (GrandParent != INDEX_NONE)
+    {
+        // 부모를 제거하고 형제를 조부모에 연결
+        if (Nodes[GrandParent].Child1 == Parent)
+        {
+            Nodes[GrandParent].Child1 = Sibling;
+        }
+        else
+        {
+            Nodes[GrandParent].Child2 = Sibling;
+        }
+        Nodes[Sibling].ParentOrNext = GrandParent;
+        FreeNode(Parent);
+
+        int32 Index = GrandParent;
+        while (Index != INDEX_NONE)
+        {
+            Index = Balance(Index);
+
+            FTreeNode& Node = Nodes[Index];
+            Node.Box = Combine(Nodes[Node.Child1].Box, Nodes[Node.Child2].Box);
+            Node.Height = 1 + FMath::Max(Nodes[Node.Child1].Height, Nodes[Node.Child2].Height);
+
+            Index = Node.ParentOrNext;
+        }
+    }
+    else
+    {
+        Root = Sibling;
+        Nodes[Sibling].ParentOrNext = INDEX_NONE;
+        FreeNode(Parent);
+    }
+}
+
+int32 FDynamicAABBTree::Balance(int32 NodeA)
+{
+    // A가 리프이거나 높이가 2 미만이면 회전할 필요 없음
+    if (Nodes[NodeA].IsLeaf() || Nodes[NodeA].Height < 2)
+    {
+        return NodeA;
+    }
+
+    const int32 NodeB = Nodes[NodeA].Child1;
+    const int32 NodeC = Nodes[NodeA].Child2;
+
+    const int32 BalanceFactor = Nodes[NodeC].Height - Nodes[NodeB].Height;
+
+    // 회전 대상(Up)을 A 자리로 끌어올리고, 나머지(Side)는 A의 자식으로 둠
+    auto Rotate = [this, NodeA](int32 Up, int32 Side, bool bUpIsChild2) -> int32
+    {
+        FTreeNode& A = Nodes[NodeA];
+        FTreeNode& U = Nodes[Up];
+
+        const int32 UpChild1 = U.Child1;
+        const int32 UpChild2 = U.Child2;
+
+        // Up을 A의 위치로 올림
+        U.Child1 = NodeA;
+        U.ParentOrNext = A.ParentOrNext;
+        A.ParentOrNext = Up;
+
+        if (U.ParentOrNext != INDEX_NONE)
+        {
+            FTreeNode& OldParent = Nodes[U.ParentOrNext];
+            if (OldParent.Child1 == NodeA)
+            {
+                OldParent.Child1 = Up;
+            }
+            else
+            {
+                OldParent.Child2 = Up;
+            }
+        }
+        else
+        {
+            Root = Up;
+        }
+
+        // Up의 더 높은 자식은 Up에 남기고, 낮은 자식은 A로 내림
+        int32 Keep = UpChild1;
+        int32 Give = UpChild2;
+        if (Nodes[UpChild1].Height < Nodes[UpChild2].Height)
+        {
+            Keep = UpChild2;
+            Give = UpChild1;
+        }
+
+        U.Child2 = Keep;
+        if (bUpIsChild2)
+        {
+            A.Child2 = Give;
+        }
+        else
+        {
+            A.Child1 = Give;
+        }
+        Nodes[Give].ParentOrNext = NodeA;
+
+        A.Box = Combine(Nodes[Side].Box, Nodes[Give].Box);
+        A.Height = 1 + FMath::Max(Nodes[Side].Height, Nodes[Give].Height);
+
+        U.Box = Combine(A.Box, Nodes[Keep].Box);
+        U.Height = 1 + FMath::Max(A.Height, Nodes[Keep].Height);
+
+        return Up;
+    };
+
+    if (BalanceFactor > 1)
+    {
+        return Rotate(NodeC, NodeB, true);
+    }
+    if (BalanceFactor < -1)
+    {
+        return Rotate(NodeB, NodeC, false);
+    }
+
+    return NodeA;
+}
+
+FBoundingBox FDynamicAABBTree::Combine(const FBoundingBox& A, const FBoundingBox& B)
+{
+    return FBoundingBox(A.MinLocation.ComponentMin(B.MinLocation), A.MaxLocation.ComponentMax(B.MaxLocation));
+}
+
+float FDynamicAABBTree::GetSurfaceArea(const FBoundingBox& Box)
+{
+    const FVector Size = Box.MaxLocation - Box.MinLocation;
+    return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+}
+
+bool FDynamicAABBTree::Contains(const FBoundingBox& Outer, const FBoundingBox& Inner)
+{
+    return Outer.MinLocation.X <= Inner.MinLocation.X && Outer.MinLocation.Y <= Inner.MinLocation.Y && Outer.MinLocation.Z <= Inner.MinLocation.Z
+        && Inner.MaxLocation.X <= Outer.MaxLocation.X && Inner.MaxLocation.Y <= Outer.MaxLocation.Y && Inner.MaxLocation.Z <= Outer.MaxLocation.Z;
+}
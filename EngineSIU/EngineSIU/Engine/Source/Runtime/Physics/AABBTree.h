@@ -0,0 +1,222 @@
+#pragma once
+#include <cstring>
+
+#include "Define.h"
+#include "Container/Array.h"
+
+/**
+ * 동적 AABB 트리 (Broadphase)
+ * 리프마다 실제 AABB보다 Margin 만큼 넓힌 Fat AABB를 저장하므로,
+ * 작은 이동은 트리 재구성 없이 흡수됩니다.
+ * 노드는 TArray 풀에 저장되며, 회전(Rotate)으로 높이 균형을 유지합니다.
+ */
+class FDynamicAABBTree
+{
+public:
+    FDynamicAABBTree();
+    ~FDynamicAABBTree() = default;
+
+    /** Fat AABB 확장 크기 */
+    static constexpr float AABBMargin = 0.1f;
+
+    /**
+     * 트리에 프록시를 추가합니다.
+     * @param InBox 월드 공간 AABB
+     * @param InUserData 프록시에 연결할 사용자 데이터
+     * @return 프록시 ID
+     */
+    int32 CreateProxy(const FBoundingBox& InBox, void* InUserData);
+
+    void DestroyProxy(int32 ProxyId);
+
+    /**
+     * 프록시의 AABB를 갱신합니다.
+     * @return 새 AABB가 기존 Fat AABB를 벗어나 트리를 재구성했으면 true
+     */
+    bool MoveProxy(int32 ProxyId, const FBoundingBox& InBox);
+
+    void* GetUserData(int32 ProxyId) const;
+    const FBoundingBox& GetFatAABB(int32 ProxyId) const;
+
+    /**
+     * InBox와 Fat AABB가 겹치는 모든 프록시에 대해 Callback을 호출합니다.
+     * Callback은 bool(int32 ProxyId)의 형태이며, false를 반환하면 탐색을 중단합니다.
+     */
+    template <typename CallbackType>
+    void Query(const FBoundingBox& InBox, CallbackType&& Callback) const;
+
+    /**
+     * 반직선 Origin + Direction * t (0 <= t <= MaxT)가 Extent만큼 넓힌 Fat AABB를 지나는 모든 프록시에 대해 Callback을 호출합니다.
+     * Extent가 0이면 선분 검사, 0보다 크면 Extent 크기의 상자를 쓸어 가는 검사가 됩니다.
+     * Callback은 bool(int32 ProxyId, float EntryT)의 형태이며, false를 반환하면 탐색을 중단합니다.
+     * 호출 순서는 거리 순이 아닙니다.
+     */
+    template <typename CallbackType>
+    void RayCast(const FVector& Origin, const FVector& Direction, float MaxT, const FVector& Extent, CallbackType&& Callback) const;
+
+    int32 GetProxyCount() const { return ProxyCount; }
+    int32 GetHeight() const;
+
+    void Clear();
+
+private:
+    /**
+     * Query와 RayCast가 쓰는 탐색 스택입니다.
+     * 보통은 스택에 잡힌 고정 크기 배열을 쓰고, 트리가 깊어서 넘치면 힙 배열로 옮겨 계속 늘립니다.
+     */
+    struct FTraversalStack
+    {
+        static constexpr int32 InlineCapacity = 256;
+
+        int32 InlineNodes[InlineCapacity];
+        TArray<int32> HeapNodes;
+        int32* Data = InlineNodes;
+        int32 Num = 0;
+        int32 Capacity = InlineCapacity;
+
+        FTraversalStack() = default;
+        FTraversalStack(const FTraversalStack&) = delete;
+        FTraversalStack& operator=(const FTraversalStack&) = delete;
+
+        bool IsEmpty() const { return Num == 0; }
+        int32 Pop() { return Data[--Num]; }
+
+        void Push(int32 NodeId)
+        {
+            if (Num == Capacity)
+            {
+                Capacity *= 2;
+                HeapNodes.SetNum(Capacity);
+                if (Data == InlineNodes)
+                {
+                    std::memcpy(HeapNodes.GetData(), InlineNodes, sizeof(InlineNodes));
+                }
+                Data = HeapNodes.GetData();
+            }
+            Data[Num++] = NodeId;
+        }
+    };
+
+    struct FTreeNode
+    {
+        FBoundingBox Box;
+        void* UserData = nullptr;
+
+        /** 사용 중인 노드는 Parent, 프리 리스트에 있는 노드는 Next로 사용합니다. */
+        int32 ParentOrNext = INDEX_NONE;
+        int32 Child1 = INDEX_NONE;
+        int32 Child2 = INDEX_NONE;
+
+        /** 리프 = 0, 프리 노드 = -1 */
+        int32 Height = -1;
+
+        bool IsLeaf() const { return Child1 == INDEX_NONE; }
+    };
+
+    int32 AllocateNode();
+    void FreeNode(int32 NodeId);
+
+    void InsertLeaf(int32 Leaf);
+    void RemoveLeaf(int32 Leaf);
+
+    int32 Balance(int32 NodeA);
+
+    static FBoundingBox Combine(const FBoundingBox& A, const FBoundingBox& B);
+    static float GetSurfaceArea(const FBoundingBox& Box);
+    static bool Contains(const FBoundingBox& Outer, const FBoundingBox& Inner);
+
+    TArray<FTreeNode> Nodes;
+    int32 Root = INDEX_NONE;
+    int32 FreeList = INDEX_NONE;
+    int32 ProxyCount = 0;
+};
+
+template <typename CallbackType>
+void FDynamicAABBTree::Query(const FBoundingBox& InBox, CallbackType&& Callback) const
+{
+    if (Root == INDEX_NONE)
+    {
+        return;
+    }
+
+    // 재귀 대신 명시적 스택 사용
+    FTraversalStack Stack;
+    Stack.Push(Root);
+
+    while (!Stack.IsEmpty())
+    {
+        const int32 NodeId = Stack.Pop();
+        const FTreeNode& Node = Nodes[NodeId];
+
+        if (!FBoundingBox::CheckOverlap(Node.Box, InBox))
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            if (!Callback(NodeId))
+            {
+                return;
+            }
+        }
+        else
+        {
+            Stack.Push(Node.Child1);
+            Stack.Push(Node.Child2);
+        }
+    }
+}
+
+template <typename CallbackType>
+void FDynamicAABBTree::RayCast(const FVector& Origin, const FVector& Direction, float MaxT, const FVector& Extent, CallbackType&& Callback) const
+{
+    if (Root == INDEX_NONE)
+    {
+        return;
+    }
+
+    const FVector InvDirection(1.f / Direction.X, 1.f / Direction.Y, 1.f / Direction.Z);
+
+    FTraversalStack Stack;
+    Stack.Push(Root);
+
+    while (!Stack.IsEmpty())
+    {
+        const int32 NodeId = Stack.Pop();
+        const FTreeNode& Node = Nodes[NodeId];
+
+        // Slab 검사, 방향 성분이 0이면 InvDirection이 무한대가 되고 면 위에서 생기는 NaN은 비교에서 무시됨
+        float TMin = 0.f;
+        float TMax = MaxT;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            float T1 = (Node.Box.MinLocation[Axis] - Extent[Axis] - Origin[Axis]) * InvDirection[Axis];
+            float T2 = (Node.Box.MaxLocation[Axis] + Extent[Axis] - Origin[Axis]) * InvDirection[Axis];
+            if (T1 > T2)
+            {
+                std::swap(T1, T2);
+            }
+            TMin = (T1 > TMin) ? T1 : TMin;
+            TMax = (T2 < TMax) ? T2 : TMax;
+        }
+
+        if (TMin > TMax)
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            if (!Callback(NodeId, TMin))
+            {
+                return;
+            }
+        }
+        else
+        {
+            Stack.Push(Node.Child1);
+            Stack.Push(Node.Child2);
+        }
+    }
+}
@@ -9,7 +9,6 @@
 #include "Engine/OverlapResult.h"
 #include "Math/Quat.h"
 #include "UObject/Casts.h"
-#include "UObject/UObjectIterator.h"
 
 /**
  * @brief 점 Point와 선분 SegmentStart-SegmentEnd 사이의 가장 가까운 점을 찾습니다.
@@ -246,47 +245,202 @@ FCollisionManager::FCollisionManager()
     CollisionMatrix[static_cast<size_t>(EShapeType::Capsule)][static_cast<size_t>(EShapeType::Capsule)] = &FCollisionManager::Check_Capsule_Capsule;
 }
 
-void FCollisionManager::CheckOverlap(const UWorld* World, const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps) const
+void FCollisionManager::CheckOverlap(const UWorld* World, const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps)
 {
     OutOverlaps.Empty();
+
+    // 이번 프레임에 이동한 Shape를 모두 반영해야 먼저 검사한 쪽과 나중에 검사한 쪽의 결과가 같음
+    FlushDirtyPrimitives();
     
     if (!Component || !Component->IsA<UShapeComponent>())
     {
         return;
     }
 
-    const bool bComponentHasValidBox = Component->AABB.IsValidBox();
-    
-    for (const auto Iter : TObjectRange<UShapeComponent>())
+    const UShapeComponent* Shape = Cast<UShapeComponent>(Component);
+    const FBoundingBox QueryBox = Shape->GetWorldAABB();
+
+    // Broadphase는 World마다 따로 존재하므로 다른 World의 Shape는 후보에 포함되지 않음
+    Broadphase.Query(QueryBox, [&](int32 ProxyId)
     {
-        if (!Iter || Iter->GetWorld() != World || Iter == Component)
+        const UShapeComponent* Other = static_cast<const UShapeComponent*>(Broadphase.GetUserData(ProxyId));
+        if (!Other || Other == Component)
         {
-            continue;            
+            return true;
         }
 
-        bool bCanSkip = true;
-        
-        if (Iter->AABB.IsValidBox() && bComponentHasValidBox)
+        // 다른 Shape의 Fat AABB와만 겹친 경우를 걸러냄
+        if (!FBoundingBox::CheckOverlap(QueryBox, Other->GetWorldAABB()))
         {
-            if (FBoundingBox::CheckOverlap(Component->AABB, Iter->AABB))
-            {
-                bCanSkip = false;
-            }
+            return true;
+        }
+
+        FOverlapResult OverlapResult;
+        if (IsOverlapped(Component, Other, OverlapResult))
+        {
+            OutOverlaps.Add(OverlapResult);
+        }
+        return true;
+    });
+}
+
+void FCollisionManager::RegisterShape(UShapeComponent* Shape)
+{
+    if (!Shape)
+    {
+        return;
+    }
+
+    if (Shape->BroadphaseProxyId != INDEX_NONE)
+    {
+        return;
+    }
+
+    Shape->BroadphaseProxyId = Broadphase.CreateProxy(Shape->GetWorldAABB(), Shape);
+}
+
+void FCollisionManager::UnregisterShape(UShapeComponent* Shape)
+{
+    if (!Shape || Shape->BroadphaseProxyId == INDEX_NONE)
+    {
+        return;
+    }
+
+    Broadphase.DestroyProxy(Shape->BroadphaseProxyId);
+    Shape->BroadphaseProxyId = INDEX_NONE;
+}
+
+void FCollisionManager::UpdateShape(UShapeComponent* Shape)
+{
+    if (!Shape)
+    {
+        return;
+    }
+
+    if (Shape->BroadphaseProxyId == INDEX_NONE)
+    {
+        RegisterShape(Shape);
+        return;
+    }
+
+    Broadphase.MoveProxy(Shape->BroadphaseProxyId, Shape->GetWorldAABB());
+}
+
+void FCollisionManager::RegisterPrimitive(UPrimitiveComponent* Primitive)
+{
+    if (!Primitive)
+    {
+        return;
+    }
+
+    if (!Primitive->IsRayTraceBoundedByAABB())
+    {
+        UnboundedPrimitives.Add(Primitive);
+        return;
+    }
+
+    if (Primitive->SceneProxyId != INDEX_NONE)
+    {
+        return;
+    }
+
+    // GetWorldAABB가 ComponentToWorld를 갱신하므로, 이후의 이동은 모두 MarkPrimitiveDirty로 들어옴
+    Primitive->SceneProxyId = SceneTree.CreateProxy(Primitive->GetWorldAABB(), Primitive);
+}
+
+void FCollisionManager::UnregisterPrimitive(UPrimitiveComponent* Primitive)
+{
+    if (!Primitive)
+    {
+        return;
+    }
+
+    UnboundedPrimitives.Remove(Primitive);
+
+    if (Primitive->SceneDirtyIndex != INDEX_NONE)
+    {
+        UPrimitiveComponent* LastDirty = DirtyPrimitives.Pop();
+        if (LastDirty != Primitive)
+        {
+            DirtyPrimitives[Primitive->SceneDirtyIndex] = LastDirty;
+            LastDirty->SceneDirtyIndex = Primitive->SceneDirtyIndex;
+        }
+        Primitive->SceneDirtyIndex = INDEX_NONE;
+    }
+
+    if (Primitive->SceneProxyId != INDEX_NONE)
+    {
+        SceneTree.DestroyProxy(Primitive->SceneProxyId);
+        Primitive->SceneProxyId = INDEX_NONE;
+    }
+}
+
+void FCollisionManager::MarkPrimitiveDirty(UPrimitiveComponent* Primitive)
+{
+    if (!Primitive || Primitive->SceneDirtyIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    if (Primitive->SceneProxyId == INDEX_NONE)
+    {
+        const UShapeComponent* Shape = Cast<UShapeComponent>(Primitive);
+        if (!Shape || Shape->BroadphaseProxyId == INDEX_NONE)
+        {
+            return;
         }
-        else
+    }
+
+    std::lock_guard Lock(DirtyPrimitivesMutex);
+    Primitive->SceneDirtyIndex = DirtyPrimitives.Add(Primitive);
+}
+
+void FCollisionManager::LineTrace(const FVector& Origin, const FVector& Direction, float MaxDistance, TArray<UPrimitiveComponent*>& OutPrimitives)
+{
+    FlushDirtyPrimitives();
+
+    SceneTree.RayCast(Origin, Direction, MaxDistance, FVector::ZeroVector, [&](int32 ProxyId, float)
+    {
+        OutPrimitives.Add(static_cast<UPrimitiveComponent*>(SceneTree.GetUserData(ProxyId)));
+        return true;
+    });
+
+    for (UPrimitiveComponent* Primitive : UnboundedPrimitives)
+    {
+        OutPrimitives.Add(Primitive);
+    }
+}
+
+void FCollisionManager::SweepBox(const FVector& Start, const FVector& End, const FVector& HalfExtent, TArray<UPrimitiveComponent*>& OutPrimitives)
+{
+    FlushDirtyPrimitives();
+
+    // 상자를 쓸어 가는 검사는 각 노드를 HalfExtent만큼 넓힌 뒤 선분으로 검사하는 것과 같음 (Minkowski 합)
+    SceneTree.RayCast(Start, End - Start, 1.f, HalfExtent, [&](int32 ProxyId, float)
+    {
+        OutPrimitives.Add(static_cast<UPrimitiveComponent*>(SceneTree.GetUserData(ProxyId)));
+        return true;
+    });
+}
+
+void FCollisionManager::FlushDirtyPrimitives()
+{
+    for (UPrimitiveComponent* Primitive : DirtyPrimitives)
+    {
+        const FBoundingBox WorldAABB = Primitive->GetWorldAABB();
+        if (Primitive->SceneProxyId != INDEX_NONE)
         {
-            bCanSkip = false;
+            SceneTree.MoveProxy(Primitive->SceneProxyId, WorldAABB);
         }
 
-        if (!bCanSkip)
+        const UShapeComponent* Shape = Cast<UShapeComponent>(Primitive);
+        if (Shape && Shape->BroadphaseProxyId != INDEX_NONE)
         {
-            FOverlapResult OverlapResult;
-            if (IsOverlapped(Component, Iter, OverlapResult))
-            {
-                OutOverlaps.Add(OverlapResult);
-            }
+            Broadphase.MoveProxy(Shape->BroadphaseProxyId, WorldAABB);
         }
+        Primitive->SceneDirtyIndex = INDEX_NONE;
     }
+    DirtyPrimitives.Empty();
 }
 
 bool FCollisionManager::IsOverlapped(const UPrimitiveComponent* Component, const UPrimitiveComponent* OtherComponent, FOverlapResult& OutResult) const
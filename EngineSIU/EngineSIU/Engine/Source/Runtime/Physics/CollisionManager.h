@@ -1,6 +1,9 @@
 #pragma once
+#include <mutex>
+
 #include "Components/PrimitiveComponent.h"
 #include "Components/ShapeComponent.h"
+#include "AABBTree.h"
 
 struct FOverlapResult;
 
@@ -14,9 +17,65 @@ public:
     FCollisionManager();
     ~FCollisionManager() = default;
 
-    void CheckOverlap(const UWorld* World, const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps) const;
+    /** 대기 중인 이동을 Broadphase에 반영한 뒤, Component와 겹치는 Shape를 모읍니다. */
+    void CheckOverlap(const UWorld* World, const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps);
+
+    /** Shape를 Broadphase에 등록합니다. 이미 등록되어 있으면 무시합니다. */
+    void RegisterShape(UShapeComponent* Shape);
+    void UnregisterShape(UShapeComponent* Shape);
+
+    /**
+     * Shape의 현재 월드 AABB를 Broadphase에 반영합니다. 등록되지 않은 Shape는 등록합니다.
+     * 등록된 Shape의 이동은 MarkPrimitiveDirty로 모였다가 다음 검색 전에 한 번에 반영되므로 따로 호출할 필요가 없습니다.
+     */
+    void UpdateShape(UShapeComponent* Shape);
+
+    int32 GetNumShapes() const { return Broadphase.GetProxyCount(); }
+
+    /**
+     * 픽킹과 Trace에 쓰이는 Scene 트리에 Primitive를 등록합니다. 이미 등록되어 있으면 무시합니다.
+     * IsRayTraceBoundedByAABB가 false인 Primitive는 트리 대신 따로 보관하고 모든 LineTrace 결과에 포함합니다.
+     */
+    void RegisterPrimitive(UPrimitiveComponent* Primitive);
+    void UnregisterPrimitive(UPrimitiveComponent* Primitive);
+
+    /**
+     * 다음 검색 전에 Primitive의 월드 AABB를 다시 계산해서 Scene 트리와, Shape라면 Broadphase에도 반영합니다.
+     * 워커 스레드에서 Tick하는 컴포넌트가 이동할 때도 호출되므로 여러 스레드에서 동시에 호출해도 됩니다.
+     */
+    void MarkPrimitiveDirty(UPrimitiveComponent* Primitive);
+
+    /**
+     * Origin + Direction * t (0 <= t <= MaxDistance)가 월드 AABB를 지나는 Primitive를 모읍니다.
+     * AABB만 검사하므로 실제 교차 여부는 호출한 쪽에서 CheckRayIntersection 등으로 확인해야 합니다.
+     * @param OutPrimitives 순서는 거리와 무관
+     */
+    void LineTrace(const FVector& Origin, const FVector& Direction, float MaxDistance, TArray<UPrimitiveComponent*>& OutPrimitives);
+
+    /**
+     * HalfExtent 크기의 축 정렬 상자를 Start에서 End까지 쓸어 갈 때 월드 AABB에 닿는 Primitive를 모읍니다.
+     * LineTrace와 달리 AABB로 감쌀 수 없는 Primitive는 포함하지 않습니다.
+     */
+    void SweepBox(const FVector& Start, const FVector& End, const FVector& HalfExtent, TArray<UPrimitiveComponent*>& OutPrimitives);
+
+    int32 GetNumScenePrimitives() const { return SceneTree.GetProxyCount() + UnboundedPrimitives.Num(); }
 
 protected:
+    FDynamicAABBTree Broadphase;
+
+    /** World에 등록된 모든 Primitive의 월드 AABB */
+    FDynamicAABBTree SceneTree;
+
+    /** 마지막 검색 이후 Transform이나 AABB가 바뀐 Primitive, Scene 트리와 Broadphase가 함께 씀 */
+    TArray<UPrimitiveComponent*> DirtyPrimitives;
+
+    /** MarkPrimitiveDirty만 워커 스레드에서 호출되므로 추가할 때만 잠금, 검색과 해제는 메인 스레드에서 함 */
+    std::mutex DirtyPrimitivesMutex;
+
+    TSet<UPrimitiveComponent*> UnboundedPrimitives;
+
+    void FlushDirtyPrimitives();
+
     bool IsOverlapped(const UPrimitiveComponent* Component, const UPrimitiveComponent* OtherComponent, FOverlapResult& OutResult) const;
 
     static constexpr SIZE_T NUM_TYPES = static_cast<SIZE_T>(EShapeType::MAX);
@@ -0,0 +1,325 @@
+#include "MeshBVH.h"
+
+#include <algorithm>
+
+namespace
+{
+FORCEINLINE const float* GetPosition(const float* Positions, uint32 Stride, uint32 VertexIndex)
+{
+    return reinterpret_cast<const float*>(reinterpret_cast<const uint8*>(Positions) + static_cast<size_t>(VertexIndex) * Stride);
+}
+
+FORCEINLINE uint32 GetVertexIndex(const uint32* Indices, int32 TriangleIndex, int32 Corner)
+{
+    const int32 Idx = TriangleIndex * 3 + Corner;
+    return Indices ? Indices[Idx] : static_cast<uint32>(Idx);
+}
+
+float GetSurfaceArea(const FVector& Min, const FVector& Max)
+{
+    const FVector Extent = Max - Min;
+    return 2.f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+}
+
+struct FBin
+{
+    FVector Min = FVector(FLT_MAX);
+    FVector Max = FVector(-FLT_MAX);
+    int32 Count = 0;
+};
+
+struct FBuildTask
+{
+    int32 NodeIndex;
+    int32 Depth;
+};
+}
+
+void FMeshBVH::Build(const float* Positions, uint32 Stride, int32 NumVertices, const uint32* Indices, int32 NumIndices)
+{
+    Clear();
+
+    const int32 NumTriangles = Indices ? NumIndices / 3 : NumVertices / 3;
+    if (Positions == nullptr || NumTriangles == 0)
+    {
+        return;
+    }
+
+    // 분할은 삼각형 상자의 중심으로 결정
+    TArray<FVector> TriangleMins;
+    TArray<FVector> TriangleMaxs;
+    TArray<FVector> Centroids;
+    TriangleMins.SetNum(NumTriangles);
+    TriangleMaxs.SetNum(NumTriangles);
+    Centroids.SetNum(NumTriangles);
+    TriangleIds.SetNum(NumTriangles);
+    for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
+    {
+        FVector Min(FLT_MAX);
+        FVector Max(-FLT_MAX);
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const float* Position = GetPosition(Positions, Stride, GetVertexIndex(Indices, TriangleIdx, Corner));
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                Min[Axis] = std::min(Min[Axis], Position[Axis]);
+                Max[Axis] = std::max(Max[Axis], Position[Axis]);
+            }
+        }
+        TriangleMins[TriangleIdx] = Min;
+        TriangleMaxs[TriangleIdx] = Max;
+        Centroids[TriangleIdx] = (Min + Max) * 0.5f;
+        TriangleIds[TriangleIdx] = TriangleIdx;
+    }
+
+    // 리프에 삼각형이 하나 이상이므로 노드는 2N - 1개를 넘지 않음
+    Nodes.Reserve(NumTriangles * 2);
+    Nodes.Emplace();
+    Nodes[0].FirstOrChild = 0;
+    Nodes[0].NumTriangles = NumTriangles;
+
+    TArray<FBuildTask> Tasks;
+    Tasks.Add({ 0, 0 });
+    while (Tasks.Num() > 0)
+    {
+        const FBuildTask Task = Tasks.Pop();
+        const int32 First = Nodes[Task.NodeIndex].FirstOrChild;
+        const int32 Count = Nodes[Task.NodeIndex].NumTriangles;
+        if (Count <= MaxLeafTriangles)
+        {
+            continue;
+        }
+
+        FVector BoundsMin(FLT_MAX);
+        FVector BoundsMax(-FLT_MAX);
+        FVector CentroidMin(FLT_MAX);
+        FVector CentroidMax(-FLT_MAX);
+        for (int32 Idx = First; Idx < First + Count; ++Idx)
+        {
+            const int32 TriangleIdx = TriangleIds[Idx];
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                BoundsMin[Axis] = std::min(BoundsMin[Axis], TriangleMins[TriangleIdx][Axis]);
+                BoundsMax[Axis] = std::max(BoundsMax[Axis], TriangleMaxs[TriangleIdx][Axis]);
+                CentroidMin[Axis] = std::min(CentroidMin[Axis], Centroids[TriangleIdx][Axis]);
+                CentroidMax[Axis] = std::max(CentroidMax[Axis], Centroids[TriangleIdx][Axis]);
+            }
+        }
+        const FVector CentroidExtent = CentroidMax - CentroidMin;
+
+        int32 Mid = First;
+        if (Task.Depth < MaxSAHDepth)
+        {
+            // 축마다 NumBins칸으로 나눠 SAH 비용이 가장 낮은 경계를 찾음
+            int32 BestAxis = -1;
+            int32 BestSplit = 0;
+            float BestCost = FLT_MAX;
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                if (CentroidExtent[Axis] <= 0.f)
+                {
+                    continue;
+                }
+
+                FBin Bins[NumBins];
+                const float BinScale = NumBins / CentroidExtent[Axis];
+                for (int32 Idx = First; Idx < First + Count; ++Idx)
+                {
+                    const int32 TriangleIdx = TriangleIds[Idx];
+                    const int32 BinIdx = std::min(static_cast<int32>((Centroids[TriangleIdx][Axis] - CentroidMin[Axis]) * BinScale), NumBins - 1);
+                    FBin& Bin = Bins[BinIdx];
+                    for (int32 BoxAxis = 0; BoxAxis < 3; ++BoxAxis)
+                    {
+                        Bin.Min[BoxAxis] = std::min(Bin.Min[BoxAxis], TriangleMins[TriangleIdx][BoxAxis]);
+                        Bin.Max[BoxAxis] = std::max(Bin.Max[BoxAxis], TriangleMaxs[TriangleIdx][BoxAxis]);
+                    }
+                    ++Bin.Count;
+                }
+
+                // 오른쪽부터 누적한 비용을 저장한 뒤 왼쪽부터 누적하며 비교
+                float RightCosts[NumBins];
+                FBin Right;
+                for (int32 BinIdx = NumBins - 1; BinIdx > 0; --BinIdx)
+                {
+                    Right.Min = FVector(std::min(Right.Min.X, Bins[BinIdx].Min.X), std::min(Right.Min.Y, Bins[BinIdx].Min.Y), std::min(Right.Min.Z, Bins[BinIdx].Min.Z));
+                    Right.Max = FVector(std::max(Right.Max.X, Bins[BinIdx].Max.X), std::max(Right.Max.Y, Bins[BinIdx].Max.Y), std::max(Right.Max.Z, Bins[BinIdx].Max.Z));
+                    Right.Count += Bins[BinIdx].Count;
+                    RightCosts[BinIdx] = Right.Count > 0 ? GetSurfaceArea(Right.Min, Right.Max) * Right.Count : 0.f;
+                }
+
+                FBin Left;
+                for (int32 Split = 1; Split < NumBins; ++Split)
+                {
+                    const FBin& Bin = Bins[Split - 1];
+                    Left.Min = FVector(std::min(Left.Min.X, Bin.Min.X), std::min(Left.Min.Y, Bin.Min.Y), std::min(Left.Min.Z, Bin.Min.Z));
+                    Left.Max = FVector(std::max(Left.Max.X, Bin.Max.X), std::max(Left.Max.Y, Bin.Max.Y), std::max(Left.Max.Z, Bin.Max.Z));
+                    Left.Count += Bin.Count;
+                    if (Left.Count == 0 || Left.Count == Count)
+                    {
+                        continue;
+                    }
+
+                    const float Cost = GetSurfaceArea(Left.Min, Left.Max) * Left.Count + RightCosts[Split];
+                    if (Cost < BestCost)
+                    {
+                        BestCost = Cost;
+                        BestAxis = Axis;
+                        BestSplit = Split;
+                    }
+                }
+            }
+
+            if (BestAxis >= 0)
+            {
+                // 노드 순회 비용을 삼각형 하나와 같게 보고, 나누는 것이 더 비싸면 작은 노드는 리프로 둠
+                const float ParentArea = GetSurfaceArea(BoundsMin, BoundsMax);
+                if (ParentArea > 0.f && 1.f + BestCost / ParentArea >= static_cast<float>(Count) && Count <= MaxLeafTriangles * 4)
+                {
+                    continue;
+                }
+
+                const float BinScale = NumBins / CentroidExtent[BestAxis];
+                const float SplitMin = CentroidMin[BestAxis];
+                int32* const Begin = TriangleIds.GetData() + First;
+                Mid = static_cast<int32>(std::partition(
+                    Begin, Begin + Count, [&](int32 TriangleIdx)
+                    {
+                        return std::min(static_cast<int32>((Centroids[TriangleIdx][BestAxis] - SplitMin) * BinScale), NumBins - 1) < BestSplit;
+                    }
+                ) - TriangleIds.GetData());
+            }
+        }
+
+        if (Mid == First || Mid == First + Count)
+        {
+            // 중심이 모두 겹쳤거나 깊이 제한에 걸렸으면 가장 긴 축의 중앙값으로 나눔
+            int32 Axis = 0;
+            if (CentroidExtent.Y > CentroidExtent[Axis])
+            {
+                Axis = 1;
+            }
+            if (CentroidExtent.Z > CentroidExtent[Axis])
+            {
+                Axis = 2;
+            }
+
+            int32* const Begin = TriangleIds.GetData() + First;
+            Mid = First + Count / 2;
+            std::nth_element(
+                Begin, TriangleIds.GetData() + Mid, Begin + Count, [&](int32 A, int32 B)
+                {
+                    return Centroids[A][Axis] < Centroids[B][Axis];
+                }
+            );
+        }
+
+        const int32 LeftChild = Nodes.Num();
+        Nodes.Emplace();
+        Nodes.Emplace();
+        Nodes[LeftChild].FirstOrChild = First;
+        Nodes[LeftChild].NumTriangles = Mid - First;
+        Nodes[LeftChild + 1].FirstOrChild = Mid;
+        Nodes[LeftChild + 1].NumTriangles = First + Count - Mid;
+        Nodes[Task.NodeIndex].FirstOrChild = LeftChild;
+        Nodes[Task.NodeIndex].NumTriangles = 0;
+
+        Tasks.Add({ LeftChild, Task.Depth + 1 });
+        Tasks.Add({ LeftChild + 1, Task.Depth + 1 });
+    }
+
+    // 상자는 구조가 정해진 뒤 Refit과 같은 방법으로 계산
+    Refit(Positions, Stride, NumVertices, Indices, NumIndices);
+}
+
+void FMeshBVH::Refit(const float* Positions, uint32 Stride, int32 NumVertices, const uint32* Indices, int32 NumIndices)
+{
+    const int32 NumTriangles = Indices ? NumIndices / 3 : NumVertices / 3;
+    if (Positions == nullptr || Nodes.Num() == 0 || NumTriangles != TriangleIds.Num())
+    {
+        return;
+    }
+
+    for (int32 NodeIdx = Nodes.Num() - 1; NodeIdx >= 0; --NodeIdx)
+    {
+        FNode& Node = Nodes[NodeIdx];
+        if (Node.IsLeaf())
+        {
+            Node.Box = ComputeLeafBox(Node, Positions, Stride, Indices);
+            continue;
+        }
+
+        const FBoundingBox& Left = Nodes[Node.FirstOrChild].Box;
+        const FBoundingBox& Right = Nodes[Node.FirstOrChild + 1].Box;
+        Node.Box = FBoundingBox(
+            FVector(
+                std::min(Left.MinLocation.X, Right.MinLocation.X),
+                std::min(Left.MinLocation.Y, Right.MinLocation.Y),
+                std::min(Left.MinLocation.Z, Right.MinLocation.Z)
+            ),
+            FVector(
+                std::max(Left.MaxLocation.X, Right.MaxLocation.X),
+                std::max(Left.MaxLocation.Y, Right.MaxLocation.Y),
+                std::max(Left.MaxLocation.Z, Right.MaxLocation.Z)
+            )
+        );
+    }
+}
+
+int32 FMeshBVH::GetDepth() const
+{
+    if (Nodes.Num() == 0)
+    {
+        return 0;
+    }
+
+    int32 MaxDepth = 0;
+    TArray<FBuildTask> Stack;
+    Stack.Add({ 0, 1 });
+    while (Stack.Num() > 0)
+    {
+        const FBuildTask Task = Stack.Pop();
+        const FNode& Node = Nodes[Task.NodeIndex];
+        MaxDepth = std::max(MaxDepth, Task.Depth);
+        if (!Node.IsLeaf())
+        {
+            Stack.Add({ Node.FirstOrChild, Task.Depth + 1 });
+            Stack.Add({ Node.FirstOrChild + 1, Task.Depth + 1 });
+        }
+    }
+    return MaxDepth;
+}
+
+void FMeshBVH::Clear()
+{
+    Nodes.Empty();
+    TriangleIds.Empty();
+}
+
+FBoundingBox FMeshBVH::MakePaddedBox(const FVector& Min, const FVector& Max)
+{
+    float Magnitude = 0.f;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Magnitude = std::max(Magnitude, std::max(std::abs(Min[Axis]), std::abs(Max[Axis])));
+    }
+
+    // 좌표를 반올림한 만큼 넓혀서 두께가 0인 상자도 교차 판정에 걸리도록 함
+    const FVector Padding(Magnitude * 1e-6f + SMALL_NUMBER);
+    return FBoundingBox(Min - Padding, Max + Padding);
+}
+
+FBoundingBox FMeshBVH::ComputeLeafBox(const FNode& Node, const float* Positions, uint32 Stride, const uint32* Indices) const
+{
+    FVector Min(FLT_MAX);
+    FVector Max(-FLT_MAX);
+    for (int32 Idx = Node.FirstOrChild; Idx < Node.FirstOrChild + Node.NumTriangles; ++Idx)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const float* Position = GetPosition(Positions, Stride, GetVertexIndex(Indices, TriangleIds[Idx], Corner));
+            Min = FVector(std::min(Min.X, Position[0]), std::min(Min.Y, Position[1]), std::min(Min.Z, Position[2]));
+            Max = FVector(std::max(Max.X, Position[0]), std::max(Max.Y, Position[1]), std::max(Max.Z, Position[2]));
+        }
+    }
+    return MakePaddedBox(Min, Max);
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+#include "Container/String.h"
+
+/**
+ * 메시 삼각형의 BVH (Narrowphase)
+ * Index(위상)는 고정되고 정점만 움직이는 메시를 위한 것으로, 한 번 Build한 뒤 정점이 바뀌면 Refit으로 상자만 다시 계산합니다.
+ * 노드는 TArray에 저장되며 두 자식이 항상 부모 뒤에 연속으로 놓이므로, 뒤에서부터 순회하면 자식이 부모보다 먼저 갱신됩니다.
+ */
+class FMeshBVH
+{
+public:
+    /** 리프 하나에 넣는 최대 삼각형 수 (SAH가 더 싸다고 판단한 경우 제외) */
+    static constexpr int32 MaxLeafTriangles = 4;
+
+    /** SAH 분할 후보를 찾을 때 축마다 나누는 칸 수 */
+    static constexpr int32 NumBins = 12;
+
+    /** 이 깊이부터는 SAH 대신 절반으로 나눠, 탐색 스택이 넘치지 않도록 함 */
+    static constexpr int32 MaxSAHDepth = 64;
+
+    static constexpr int32 MaxStackSize = 128;
+
+    /**
+     * 삼각형마다 상자를 만들고 Binned SAH로 트리를 구성합니다.
+     * @param Positions 첫 정점의 X, 정점마다 Stride Byte 간격으로 X, Y, Z가 연속
+     * @param Indices 삼각형 목록, nullptr이면 정점 3개씩 삼각형 하나
+     */
+    void Build(const float* Positions, uint32 Stride, int32 NumVertices, const uint32* Indices, int32 NumIndices);
+
+    /** 트리 구조는 유지하고 현재 정점 위치로 상자만 다시 계산합니다. Build와 같은 Index를 넘겨야 합니다. */
+    void Refit(const float* Positions, uint32 Stride, int32 NumVertices, const uint32* Indices, int32 NumIndices);
+
+    template <typename VertexType>
+    void Build(const TArray<VertexType>& Vertices, const TArray<uint32>& Indices)
+    {
+        Build(Vertices.Num() > 0 ? &Vertices.GetData()->X : nullptr, sizeof(VertexType), Vertices.Num(), Indices.GetData(), Indices.Num());
+    }
+
+    template <typename VertexType>
+    void Refit(const TArray<VertexType>& Vertices, const TArray<uint32>& Indices)
+    {
+        Refit(Vertices.Num() > 0 ? &Vertices.GetData()->X : nullptr, sizeof(VertexType), Vertices.Num(), Indices.GetData(), Indices.Num());
+    }
+
+    /**
+     * 반직선이 지나는 모든 리프의 삼각형에 대해 Callback을 호출합니다.
+     * 가장 가까운 교차점에서 멈추지 않으므로, 전체 삼각형을 검사한 것과 같은 교차 수를 얻을 수 있습니다.
+     * Callback은 void(int32 TriangleIndex)의 형태이며, TriangleIndex는 Index 버퍼에서의 삼각형 번호입니다.
+     */
+    template <typename CallbackType>
+    void RayCast(const FVector& InRayOrigin, const FVector& InRayDirection, CallbackType&& Callback) const;
+
+    /** 마지막 Build에 사용한 삼각형 수, 메시와 다르면 다시 Build해야 함 */
+    int32 GetNumTriangles() const { return TriangleIds.Num(); }
+    int32 GetNumNodes() const { return Nodes.Num(); }
+    int32 GetDepth() const;
+
+    void Clear();
+
+private:
+    struct FNode
+    {
+        FBoundingBox Box;
+
+        /** 내부 노드는 왼쪽 자식(오른쪽은 바로 다음), 리프는 TriangleIds에서의 시작 위치 */
+        int32 FirstOrChild = 0;
+
+        /** 리프의 삼각형 수, 내부 노드는 0 */
+        int32 NumTriangles = 0;
+
+        bool IsLeaf() const { return NumTriangles > 0; }
+    };
+
+    /**
+     * 반직선과 상자의 교차 여부, 경계에 걸친 삼각형을 놓치지 않도록 구간 끝에 부동소수점 오차만큼 여유를 둡니다.
+     * 방향 성분이 0이면 InvDirection이 무한대가 되고, 원점이 면 위에 있어 생기는 NaN은 비교에서 무시됩니다.
+     */
+    static bool IntersectRayBox(const FBoundingBox& Box, const FVector& Origin, const FVector& InvDirection);
+
+    /** 삼각형 상자를 합치고 Refit 사이의 오차를 흡수하도록 좌표 크기에 비례해서 조금 넓힙니다. */
+    static FBoundingBox MakePaddedBox(const FVector& Min, const FVector& Max);
+
+    FBoundingBox ComputeLeafBox(const FNode& Node, const float* Positions, uint32 Stride, const uint32* Indices) const;
+
+    TArray<FNode> Nodes;
+
+    /** 리프 순서로 정렬된 삼각형 번호 */
+    TArray<int32> TriangleIds;
+};
+
+inline bool FMeshBVH::IntersectRayBox(const FBoundingBox& Box, const FVector& Origin, const FVector& InvDirection)
+{
+    float TMin = 0.f;
+    float TMax = FLT_MAX;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        float T1 = (Box.MinLocation[Axis] - Origin[Axis]) * InvDirection[Axis];
+        float T2 = (Box.MaxLocation[Axis] - Origin[Axis]) * InvDirection[Axis];
+        if (T1 > T2)
+        {
+            std::swap(T1, T2);
+        }
+
+        // NaN은 비교가 항상 거짓이므로 기존 값을 유지
+        TMin = (T1 > TMin) ? T1 : TMin;
+        TMax = (T2 < TMax) ? T2 : TMax;
+    }
+
+    // 나눗셈 세 번의 상대 오차 (Ize 2013, Robust BVH Ray Traversal)
+    return TMin <= TMax * 1.0000004f;
+}
+
+template <typename CallbackType>
+void FMeshBVH::RayCast(const FVector& InRayOrigin, const FVector& InRayDirection, CallbackType&& Callback) const
+{
+    if (Nodes.Num() == 0)
+    {
+        return;
+    }
+
+    const FVector InvDirection(1.f / InRayDirection.X, 1.f / InRayDirection.Y, 1.f / InRayDirection.Z);
+
+    // 재귀 대신 명시적 스택 사용, 깊이는 Build에서 MaxStackSize 아래로 제한됨
+    int32 Stack[MaxStackSize];
+    int32 StackSize = 0;
+    Stack[StackSize++] = 0;
+
+    while (StackSize > 0)
+    {
+        const FNode& Node = Nodes[Stack[--StackSize]];
+        if (!IntersectRayBox(Node.Box, InRayOrigin, InvDirection))
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            for (int32 Idx = Node.FirstOrChild; Idx < Node.FirstOrChild + Node.NumTriangles; ++Idx)
+            {
+                Callback(TriangleIds[Idx]);
+            }
+        }
+        else if (StackSize + 2 <= MaxStackSize)
+        {
+            Stack[StackSize++] = Node.FirstOrChild + 1;
+            Stack[StackSize++] = Node.FirstOrChild;
+        }
+    }
+}
@@ -88,14 +88,14 @@ void FBillboardRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, cons
     BufferManager->UpdateConstantBuffer(TEXT("FObjectConstantBuffer"), ObjectData);
 }
 
-void FBillboardRenderPass::RenderTexturePrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11Buffer* pIndexBuffer, UINT numIndices, ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState) const
+void FBillboardRenderPass::RenderTexturePrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, const FIndexInfo& IndexInfo, ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState) const
 {
     SetupVertexBuffer(pVertexBuffer, numVertices);
 
-    Graphics->DeviceContext->IASetIndexBuffer(pIndexBuffer, DXGI_FORMAT_R16_UINT, 0);
+    Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
     Graphics->DeviceContext->PSSetShaderResources(0, 1, &TextureSRV);
     Graphics->DeviceContext->PSSetSamplers(0, 1, &SamplerState);
-    Graphics->DeviceContext->DrawIndexed(numIndices, 0, 0);
+    Graphics->DeviceContext->DrawIndexed(IndexInfo.NumIndices, 0, 0);
 }
 
 void FBillboardRenderPass::RenderTextPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState) const
@@ -180,8 +180,7 @@ void FBillboardRenderPass::Render(const std::shared_ptr<FEditorViewportClient>&
             RenderTexturePrimitive(
                 VertexInfo.VertexBuffer,
                 VertexInfo.NumVertices,
-                IndexInfo.IndexBuffer,
-                IndexInfo.NumIndices,
+                IndexInfo,
                 SubUVParticle->Texture->TextureSRV,
                 SubUVParticle->Texture->SamplerState
             );
@@ -209,8 +208,7 @@ void FBillboardRenderPass::Render(const std::shared_ptr<FEditorViewportClient>&
             RenderTexturePrimitive(
                 VertexInfo.VertexBuffer,
                 VertexInfo.NumVertices,
-                IndexInfo.IndexBuffer,
-                IndexInfo.NumIndices,
+                IndexInfo,
                 BillboardComp->Texture->TextureSRV,
                 BillboardComp->Texture->SamplerState
             );
@@ -39,7 +39,7 @@ public:
     
     // Primitive 드로우 함수
     void RenderTexturePrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices,
-        ID3D11Buffer* pIndexBuffer, UINT numIndices,
+        const FIndexInfo& IndexInfo,
         ID3D11ShaderResourceView* _TextureSRV, ID3D11SamplerState* _SamplerState) const;
 
     void RenderTextPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices,
@@ -63,6 +63,11 @@ void FDepthPrePass::PrepareRenderState(const std::shared_ptr<FEditorViewportClie
     Graphics->DeviceContext->VSSetShader(VertexShader, nullptr, 0);
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
 
+    MeshVertexShader = VertexShader;
+    MeshInputLayout = InputLayout;
+    InstancedVertexShader = ShaderManager->GetVertexShaderByKey(L"StaticMeshVertexShaderInstanced");
+    InstancedInputLayout = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShaderInstanced");
+
     // 뎁스만 필요하므로, 픽셀 쉐이더는 지정 안함.
     Graphics->DeviceContext->PSSetShader(nullptr, nullptr, 0);
 
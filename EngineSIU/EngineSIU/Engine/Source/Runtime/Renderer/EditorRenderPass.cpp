@@ -271,7 +271,7 @@ void FEditorRenderPass::BindBuffers(const FDebugPrimitiveData& InPrimitiveData)
 {
     UINT offset = 0;
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &InPrimitiveData.VertexInfo.VertexBuffer, &InPrimitiveData.VertexInfo.Stride, &offset);
-    Graphics->DeviceContext->IASetIndexBuffer(InPrimitiveData.IndexInfo.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+    Graphics->DeviceContext->IASetIndexBuffer(InPrimitiveData.IndexInfo.IndexBuffer, InPrimitiveData.IndexInfo.Format, 0);
 }
 
 void FEditorRenderPass::PrepareRenderArr()
@@ -355,13 +355,14 @@ void FEditorRenderPass::LazyLoad()
     BufferManager->CreateVertexBuffer(RenderData->ObjectName, RenderData->Vertices, VertexInfo);
 
     FIndexInfo IndexInfo;
-    BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->Indices, IndexInfo);
+    BufferManager->CreateCompactIndexBuffer(RenderData->ObjectName, RenderData->Indices, RenderData->Vertices.Num(), IndexInfo);
     
     Resources.Primitives.Arrow.VertexInfo.VertexBuffer = VertexInfo.VertexBuffer;
     Resources.Primitives.Arrow.VertexInfo.NumVertices = VertexInfo.NumVertices;
     Resources.Primitives.Arrow.VertexInfo.Stride = sizeof(FStaticMeshVertex); // Directional Light의 Arrow에 해당됨
     Resources.Primitives.Arrow.IndexInfo.IndexBuffer = IndexInfo.IndexBuffer;
     Resources.Primitives.Arrow.IndexInfo.NumIndices = IndexInfo.NumIndices;
+    Resources.Primitives.Arrow.IndexInfo.Format = IndexInfo.Format;
 }
 
 void FEditorRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& Viewport)
@@ -120,7 +120,7 @@ void FLightHeatMapRenderPass::Render(const std::shared_ptr<FEditorViewportClient
     for (const auto& Fog : FogComponents)
     {
         Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexInfo.VertexBuffer, &VertexInfo.Stride, &offset);
-        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R16_UINT, 0);
+        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
         Graphics->DeviceContext->IASetInputLayout(InputLayout);
 
         Graphics->DeviceContext->DrawIndexed(6, 0, 0);
@@ -164,7 +164,7 @@ void FLightHeatMapRenderPass::FinalRender()
     UINT offset = 0;
 
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexInfo.VertexBuffer, &VertexInfo.Stride, &offset);
-    Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R16_UINT, 0);
+    Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
 
     Graphics->DeviceContext->DrawIndexed(6, 0, 0);
@@ -0,0 +1,157 @@
+#include "MeshCullingStage.h"
+
+#include "BaseGizmos/GizmoBaseComponent.h"
+#include "Components/Mesh/SkeletalMeshComponent.h"
+#include "Components/Mesh/StaticMeshComponent.h"
+#include "Engine/Asset/SkeletalMeshAsset.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Casts.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+    /** CPU 스키닝으로 바인드 포즈 밖으로 움직이는 정점을 감안한 AABB 확장 배율 */
+    constexpr float SkinnedBoundsScale = 1.5f;
+
+    template <typename ComponentType>
+    bool ShouldGather(ComponentType* Component, const UWorld* World)
+    {
+        if (Cast<UGizmoBaseComponent>(Component) || Component->GetWorld() != World)
+        {
+            return false;
+        }
+        return Component->GetOwner() && !Component->GetOwner()->IsHidden();
+    }
+}
+
+void FMeshCullingStage::Gather(const UWorld* World)
+{
+    Clear();
+
+    FVector Center, Extent;
+
+    for (UStaticMeshComponent* Component : TObjectRange<UStaticMeshComponent>())
+    {
+        if (!ShouldGather(Component, World) || !Component->GetStaticMesh())
+        {
+            continue;
+        }
+
+        TransformBounds(Component->GetBoundingBox(), Component->GetWorldMatrix(), Center, Extent);
+        StaticMeshes.Add(Component);
+        StaticMeshBounds.Add(Center, Extent);
+    }
+
+    for (USkeletalMeshComponent* Component : TObjectRange<USkeletalMeshComponent>())
+    {
+        if (!ShouldGather(Component, World) || !Component->GetSkeletalMesh() || !Component->GetSkeletalMesh()->GetRenderData())
+        {
+            continue;
+        }
+
+        const FSkeletalMeshRenderData* RenderData = Component->GetSkeletalMesh()->GetRenderData();
+        TransformBounds(FBoundingBox(RenderData->BoundingBoxMin, RenderData->BoundingBoxMax), Component->GetWorldMatrix(), Center, Extent);
+        SkeletalMeshes.Add(Component);
+        SkeletalMeshBounds.Add(Center, Extent * SkinnedBoundsScale);
+    }
+}
+
+void FMeshCullingStage::CullView(const FMatrix& ViewProjection)
+{
+    VisibleStaticMeshes.Empty();
+    VisibleSkeletalMeshes.Empty();
+
+    const FFrustum Frustum(ViewProjection);
+
+    VisibilityScratch.SetNum(StaticMeshes.Num());
+    FrustumCulling::CullBoxes(Frustum, StaticMeshBounds, VisibilityScratch.GetData());
+    for (int32 Index = 0; Index < StaticMeshes.Num(); ++Index)
+    {
+        if (VisibilityScratch[Index])
+        {
+            VisibleStaticMeshes.Add(StaticMeshes[Index]);
+        }
+    }
+
+    VisibilityScratch.SetNum(SkeletalMeshes.Num());
+    FrustumCulling::CullBoxes(Frustum, SkeletalMeshBounds, VisibilityScratch.GetData());
+    for (int32 Index = 0; Index < SkeletalMeshes.Num(); ++Index)
+    {
+        if (VisibilityScratch[Index])
+        {
+            VisibleSkeletalMeshes.Add(SkeletalMeshes[Index]);
+        }
+    }
+}
+
+void FMeshCullingStage::CullStaticMeshes(const FFrustum* Frustums, int32 NumFrustums, TArray<UStaticMeshComponent*>& OutComponents)
+{
+    OutComponents.Empty();
+
+    const int32 NumMeshes = StaticMeshes.Num();
+    VisibilityScratch.SetNum(NumMeshes);
+    VisibilityAccum.Init(0, NumMeshes);
+
+    for (int32 FrustumIndex = 0; FrustumIndex < NumFrustums; ++FrustumIndex)
+    {
+        FrustumCulling::CullBoxes(Frustums[FrustumIndex], StaticMeshBounds, VisibilityScratch.GetData());
+        for (int32 Index = 0; Index < NumMeshes; ++Index)
+        {
+            VisibilityAccum[Index] |= VisibilityScratch[Index];
+        }
+    }
+
+    for (int32 Index = 0; Index < NumMeshes; ++Index)
+    {
+        if (VisibilityAccum[Index])
+        {
+            OutComponents.Add(StaticMeshes[Index]);
+        }
+    }
+}
+
+void FMeshCullingStage::CullStaticMeshes(const FVector& SphereCenter, float SphereRadius, TArray<UStaticMeshComponent*>& OutComponents) const
+{
+    OutComponents.Empty();
+
+    const float RadiusSquared = SphereRadius * SphereRadius;
+    for (int32 Index = 0; Index < StaticMeshes.Num(); ++Index)
+    {
+        // 구의 중심에서 AABB까지의 최단 거리
+        const float DeltaX = FMath::Max(FMath::Abs(SphereCenter.X - StaticMeshBounds.CenterX[Index]) - StaticMeshBounds.ExtentX[Index], 0.0f);
+        const float DeltaY = FMath::Max(FMath::Abs(SphereCenter.Y - StaticMeshBounds.CenterY[Index]) - StaticMeshBounds.ExtentY[Index], 0.0f);
+        const float DeltaZ = FMath::Max(FMath::Abs(SphereCenter.Z - StaticMeshBounds.CenterZ[Index]) - StaticMeshBounds.ExtentZ[Index], 0.0f);
+        if (DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ <= RadiusSquared)
+        {
+            OutComponents.Add(StaticMeshes[Index]);
+        }
+    }
+}
+
+void FMeshCullingStage::Clear()
+{
+    StaticMeshes.Empty();
+    StaticMeshBounds.Empty();
+    SkeletalMeshes.Empty();
+    SkeletalMeshBounds.Empty();
+    VisibleStaticMeshes.Empty();
+    VisibleSkeletalMeshes.Empty();
+}
+
+void FMeshCullingStage::TransformBounds(const FBoundingBox& LocalBox, const FMatrix& WorldMatrix, FVector& OutCenter, FVector& OutExtent)
+{
+    const FVector LocalCenter = (LocalBox.MinLocation + LocalBox.MaxLocation) * 0.5f;
+    const FVector LocalExtent = (LocalBox.MaxLocation - LocalBox.MinLocation) * 0.5f;
+
+    const auto& M = WorldMatrix.M;
+
+    // 행 벡터 규약: World = Local * M
+    OutCenter.X = LocalCenter.X * M[0][0] + LocalCenter.Y * M[1][0] + LocalCenter.Z * M[2][0] + M[3][0];
+    OutCenter.Y = LocalCenter.X * M[0][1] + LocalCenter.Y * M[1][1] + LocalCenter.Z * M[2][1] + M[3][1];
+    OutCenter.Z = LocalCenter.X * M[0][2] + LocalCenter.Y * M[1][2] + LocalCenter.Z * M[2][2] + M[3][2];
+
+    // 회전된 박스를 감싸는 AABB의 반 크기 (Arvo)
+    OutExtent.X = LocalExtent.X * FMath::Abs(M[0][0]) + LocalExtent.Y * FMath::Abs(M[1][0]) + LocalExtent.Z * FMath::Abs(M[2][0]);
+    OutExtent.Y = LocalExtent.X * FMath::Abs(M[0][1]) + LocalExtent.Y * FMath::Abs(M[1][1]) + LocalExtent.Z * FMath::Abs(M[2][1]);
+    OutExtent.Z = LocalExtent.X * FMath::Abs(M[0][2]) + LocalExtent.Y * FMath::Abs(M[1][2]) + LocalExtent.Z * FMath::Abs(M[2][2]);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+#include "Math/Frustum.h"
+
+class UWorld;
+class UStaticMeshComponent;
+class USkeletalMeshComponent;
+
+
+/**
+ * 메시 패스들이 공유하는 절두체 컬링 단계입니다.
+ * 프레임마다 한 번 메시 컴포넌트와 월드 AABB를 수집하고,
+ * 카메라 절두체로 걸러낸 결과를 StaticMesh/DepthPrePass에, 라이트 절두체로 걸러낸 결과를 Shadow 패스에 제공합니다.
+ */
+class FMeshCullingStage
+{
+public:
+    /**
+     * World에서 그릴 수 있는 메시 컴포넌트와 그 월드 AABB를 수집합니다.
+     * @param World 수집할 월드
+     */
+    void Gather(const UWorld* World);
+
+    /** 카메라 절두체로 컬링하여 Visible 목록을 갱신합니다. */
+    void CullView(const FMatrix& ViewProjection);
+
+    /**
+     * 수집된 StaticMesh 중 주어진 절두체들 중 하나라도 겹치는 것을 반환합니다.
+     * @param Frustums 검사할 절두체 배열 (CSM의 Cascade 등)
+     * @param NumFrustums 절두체 개수
+     * @param OutComponents 결과
+     */
+    void CullStaticMeshes(const FFrustum* Frustums, int32 NumFrustums, TArray<UStaticMeshComponent*>& OutComponents);
+
+    /** 수집된 StaticMesh 중 구와 겹치는 것을 반환합니다. (Point Light 그림자용) */
+    void CullStaticMeshes(const FVector& SphereCenter, float SphereRadius, TArray<UStaticMeshComponent*>& OutComponents) const;
+
+    void Clear();
+
+    const TArray<UStaticMeshComponent*>& GetVisibleStaticMeshes() const { return VisibleStaticMeshes; }
+    const TArray<USkeletalMeshComponent*>& GetVisibleSkeletalMeshes() const { return VisibleSkeletalMeshes; }
+
+    int32 GetNumGathered() const { return StaticMeshes.Num() + SkeletalMeshes.Num(); }
+    int32 GetNumVisible() const { return VisibleStaticMeshes.Num() + VisibleSkeletalMeshes.Num(); }
+
+private:
+    /** 로컬 AABB를 월드 공간의 중심/반 크기로 변환합니다. */
+    static void TransformBounds(const FBoundingBox& LocalBox, const FMatrix& WorldMatrix, FVector& OutCenter, FVector& OutExtent);
+
+    TArray<UStaticMeshComponent*> StaticMeshes;
+    FCullingBounds StaticMeshBounds;
+
+    TArray<USkeletalMeshComponent*> SkeletalMeshes;
+    FCullingBounds SkeletalMeshBounds;
+
+    TArray<UStaticMeshComponent*> VisibleStaticMeshes;
+    TArray<USkeletalMeshComponent*> VisibleSkeletalMeshes;
+
+    /** 커널 출력 버퍼, 프레임 간 재사용 */
+    TArray<uint8> VisibilityScratch;
+    TArray<uint8> VisibilityAccum;
+};
@@ -0,0 +1,122 @@
+#include "MeshDrawCommand.h"
+
+#include <cassert>
+
+
+void FMeshDrawCommandList::Reset()
+{
+    Commands.Empty();
+    Objects.Empty();
+    MeshIds.Empty();
+    MaterialIds.Empty();
+}
+
+int32 FMeshDrawCommandList::AddObject(UPrimitiveComponent* Component, bool bIsSelected)
+{
+    const int32 ObjectIndex = Objects.Emplace();
+    Objects[ObjectIndex].Component = Component;
+    Objects[ObjectIndex].bIsSelected = bIsSelected;
+    return ObjectIndex;
+}
+
+FMeshDrawCommand& FMeshDrawCommandList::AddCommand(
+    EMeshDrawPipeline Pipeline, const void* MeshData, const FObjMaterialInfo* Material, int32 ObjectIndex,
+    uint32 StartIndex, uint32 IndexCount, bool bSubMeshSelected
+)
+{
+    assert(ObjectIndex >= 0 && ObjectIndex < Objects.Num());
+
+    FMeshDrawCommand& Command = Commands[Commands.Emplace()];
+    Command.MeshData = MeshData;
+    Command.Material = Material;
+    Command.MeshId = FindOrAddId(MeshIds, MeshData);
+    Command.MaterialId = FindOrAddId(MaterialIds, Material);
+    Command.ObjectIndex = ObjectIndex;
+    Command.StartIndex = StartIndex;
+    Command.IndexCount = IndexCount;
+    Command.Pipeline = Pipeline;
+    Command.bSubMeshSelected = bSubMeshSelected;
+
+    Command.SortKey = (static_cast<uint64>(Pipeline) << PipelineShift)
+        | (static_cast<uint64>(Command.MaterialId) << MaterialIdShift)
+        | (static_cast<uint64>(Command.MeshId) << MeshIdShift);
+
+    return Command;
+}
+
+void FMeshDrawCommandList::Sort()
+{
+    RadixSort(Commands, SortScratch);
+}
+
+void FMeshDrawCommandList::RadixSort(TArray<FMeshDrawCommand>& InOutCommands, TArray<FMeshDrawCommand>& Scratch)
+{
+    const int32 NumCommands = InOutCommands.Num();
+    if (NumCommands < 2)
+    {
+        return;
+    }
+
+    // 모든 키에서 값이 같은 바이트는 순서에 영향을 주지 않으므로 건너뜀
+    uint64 AllOr = 0;
+    uint64 AllAnd = ~0ull;
+    for (const FMeshDrawCommand& Command : InOutCommands)
+    {
+        AllOr |= Command.SortKey;
+        AllAnd &= Command.SortKey;
+    }
+    const uint64 VaryingBits = AllOr ^ AllAnd;
+
+    Scratch.SetNum(NumCommands);
+
+    FMeshDrawCommand* Src = InOutCommands.GetData();
+    FMeshDrawCommand* Dst = Scratch.GetData();
+
+    for (int32 Shift = 0; Shift < 64; Shift += 8)
+    {
+        if (((VaryingBits >> Shift) & 0xFF) == 0)
+        {
+            continue;
+        }
+
+        uint32 Offsets[256] = {};
+        for (int32 Index = 0; Index < NumCommands; ++Index)
+        {
+            ++Offsets[(Src[Index].SortKey >> Shift) & 0xFF];
+        }
+
+        uint32 Sum = 0;
+        for (uint32& Offset : Offsets)
+        {
+            const uint32 Count = Offset;
+            Offset = Sum;
+            Sum += Count;
+        }
+
+        // 앞에서부터 채우므로 같은 바이트끼리는 원래 순서가 유지됨
+        for (int32 Index = 0; Index < NumCommands; ++Index)
+        {
+            Dst[Offsets[(Src[Index].SortKey >> Shift) & 0xFF]++] = Src[Index];
+        }
+
+        std::swap(Src, Dst);
+    }
+
+    if (Src != InOutCommands.GetData())
+    {
+        std::copy(Src, Src + NumCommands, InOutCommands.GetData());
+    }
+}
+
+uint32 FMeshDrawCommandList::FindOrAddId(TMap<const void*, uint32>& IdMap, const void* Key)
+{
+    if (const uint32* Found = IdMap.Find(Key))
+    {
+        return *Found;
+    }
+
+    const uint32 NewId = static_cast<uint32>(IdMap.Num());
+    assert(NewId <= MaxId);
+    IdMap.Add(Key, NewId);
+    return NewId;
+}
@@ -0,0 +1,191 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "HAL/PlatformType.h"
+
+struct FObjMaterialInfo;
+class UPrimitiveComponent;
+
+
+/** 드로우 커맨드가 사용하는 파이프라인 (정점 레이아웃) 종류, SortKey의 최상위 비트에 들어갑니다. */
+enum class EMeshDrawPipeline : uint8
+{
+    StaticMesh,
+    StaticMeshInstanced,
+    SkeletalMesh,
+    SkeletalMeshGPUSkinned,
+};
+
+
+/** 한 프레임 동안 메시 패스가 실제로 GPU에 보낸 호출 수 (stat draw) */
+struct FMeshDrawStats
+{
+    uint32 NumDraws = 0;
+    uint32 NumMaterialBinds = 0;
+    uint32 NumBufferBinds = 0;
+    uint32 NumObjectUpdates = 0;
+
+    /** 인스턴스드 드로우로 그려진 오브젝트 수 */
+    uint32 NumInstances = 0;
+
+    void Reset() { *this = FMeshDrawStats(); }
+};
+
+
+/** 커맨드들이 공유하는 오브젝트 단위 상태 (ObjectConstantBuffer 한 번 갱신 분량) */
+struct FMeshDrawObject
+{
+    UPrimitiveComponent* Component = nullptr;
+    bool bIsSelected = false;
+};
+
+
+/**
+ * 서브메시 하나를 그리기 위한 압축된 레코드입니다.
+ * 리소스는 포인터로만 들고 있고, 실제 바인딩은 Submit의 Visitor가 담당합니다.
+ */
+struct FMeshDrawCommand
+{
+    /** Pipeline | MaterialId | MeshId 순으로 정렬되는 키 */
+    uint64 SortKey = 0;
+
+    /** FStaticMeshRenderData 또는 FSkeletalMeshRenderData */
+    const void* MeshData = nullptr;
+
+    /** 서브메시가 없는 메시는 nullptr, 이전 머티리얼을 그대로 사용 */
+    const FObjMaterialInfo* Material = nullptr;
+
+    uint32 MeshId = 0;
+    uint32 MaterialId = 0;
+    int32 ObjectIndex = 0;
+
+    uint32 StartIndex = 0;
+    uint32 IndexCount = 0;
+
+    /** StaticMeshInstanced 전용, 인스턴스 버퍼 내 범위 */
+    uint32 FirstInstance = 0;
+    uint32 NumInstances = 0;
+
+    EMeshDrawPipeline Pipeline = EMeshDrawPipeline::StaticMesh;
+    bool bSubMeshSelected = false;
+};
+
+
+/**
+ * 메시 패스의 드로우 커맨드 목록입니다.
+ * 컴포넌트를 (Pipeline, Material, Mesh) 키를 가진 커맨드로 펼친 뒤 기수 정렬하고,
+ * 제출할 때는 앞 커맨드와 달라진 상태만 다시 바인딩합니다.
+ */
+class FMeshDrawCommandList
+{
+public:
+    static constexpr int32 PipelineShift = 56;
+    static constexpr int32 MaterialIdShift = 32;
+    static constexpr int32 MeshIdShift = 8;
+    static constexpr uint32 MaxId = (1u << 24) - 1;
+
+    void Reset();
+
+    /**
+     * 오브젝트를 등록하고 커맨드에서 참조할 인덱스를 반환합니다.
+     * @param Component 그릴 컴포넌트
+     * @param bIsSelected 에디터에서 선택된 상태인지
+     * @return Objects 배열 내 인덱스
+     */
+    int32 AddObject(UPrimitiveComponent* Component, bool bIsSelected);
+
+    /**
+     * 서브메시 하나에 대한 커맨드를 추가합니다.
+     * 같은 MeshData/Material에는 프레임 내에서 처음 본 순서대로 같은 Id가 부여됩니다.
+     * @param Pipeline 정점 레이아웃 종류
+     * @param MeshData 버퍼를 공유하는 단위 (RenderData)
+     * @param Material 서브메시 머티리얼, 없으면 nullptr
+     * @param ObjectIndex AddObject의 반환값
+     * @param StartIndex 인덱스 버퍼 시작 위치
+     * @param IndexCount 그릴 인덱스 수
+     * @param bSubMeshSelected 에디터에서 선택된 서브메시인지
+     * @return 추가된 커맨드, 인스턴스 범위 등 키와 무관한 값은 호출자가 채움
+     */
+    FMeshDrawCommand& AddCommand(
+        EMeshDrawPipeline Pipeline, const void* MeshData, const FObjMaterialInfo* Material, int32 ObjectIndex,
+        uint32 StartIndex, uint32 IndexCount, bool bSubMeshSelected
+    );
+
+    /** SortKey 기준 안정 정렬, 키가 같은 커맨드는 추가된 순서를 유지합니다. */
+    void Sort();
+
+    /**
+     * 정렬된 커맨드를 순서대로 제출합니다.
+     * Visitor는 BindPipeline(Pipeline), BindMesh(Command), BindMaterial(MaterialInfo), BindObject(Object), BindSubMesh(bSelected), Draw(Command)를 제공해야 합니다.
+     * @param Visitor 실제 API 호출을 담당하는 객체
+     * @param Stats 바인딩/드로우 횟수를 누적할 카운터
+     */
+    template <typename VisitorType>
+    void Submit(VisitorType& Visitor, FMeshDrawStats& Stats) const;
+
+    const TArray<FMeshDrawCommand>& GetCommands() const { return Commands; }
+    const TArray<FMeshDrawObject>& GetObjects() const { return Objects; }
+
+    int32 Num() const { return Commands.Num(); }
+    bool IsEmpty() const { return Commands.Num() == 0; }
+
+    /**
+     * 64비트 키에 대한 LSD 기수 정렬입니다. 모든 키에서 같은 바이트는 건너뜁니다.
+     * @param InOutCommands 정렬할 커맨드
+     * @param Scratch 같은 크기의 임시 버퍼
+     */
+    static void RadixSort(TArray<FMeshDrawCommand>& InOutCommands, TArray<FMeshDrawCommand>& Scratch);
+
+private:
+    static uint32 FindOrAddId(TMap<const void*, uint32>& IdMap, const void* Key);
+
+    TArray<FMeshDrawCommand> Commands;
+    TArray<FMeshDrawCommand> SortScratch;
+    TArray<FMeshDrawObject> Objects;
+
+    TMap<const void*, uint32> MeshIds;
+    TMap<const void*, uint32> MaterialIds;
+};
+
+
+template <typename VisitorType>
+void FMeshDrawCommandList::Submit(VisitorType& Visitor, FMeshDrawStats& Stats) const
+{
+    const FMeshDrawCommand* Prev = nullptr;
+    for (const FMeshDrawCommand& Command : Commands)
+    {
+        if (!Prev || Prev->Pipeline != Command.Pipeline)
+        {
+            Visitor.BindPipeline(Command.Pipeline);
+        }
+
+        if (!Prev || Prev->MeshId != Command.MeshId)
+        {
+            Visitor.BindMesh(Command);
+            ++Stats.NumBufferBinds;
+        }
+
+        if (Command.Material && (!Prev || Prev->MaterialId != Command.MaterialId))
+        {
+            Visitor.BindMaterial(*Command.Material);
+            ++Stats.NumMaterialBinds;
+        }
+
+        if (!Prev || Prev->ObjectIndex != Command.ObjectIndex)
+        {
+            Visitor.BindObject(Objects[Command.ObjectIndex]);
+            ++Stats.NumObjectUpdates;
+        }
+
+        if (!Prev || Prev->bSubMeshSelected != Command.bSubMeshSelected)
+        {
+            Visitor.BindSubMesh(Command.bSubMeshSelected);
+        }
+
+        Visitor.Draw(Command);
+        ++Stats.NumDraws;
+        Stats.NumInstances += Command.NumInstances;
+
+        Prev = &Command;
+    }
+}
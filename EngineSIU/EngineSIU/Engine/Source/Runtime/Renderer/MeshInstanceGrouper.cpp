@@ -0,0 +1,99 @@
+#include "MeshInstanceGrouper.h"
+
+
+void FMeshInstanceGrouper::Reset()
+{
+    FirstCandidateByMesh.Empty();
+    Candidates.Empty();
+    EntryCandidates.Empty();
+    EntryObjects.Empty();
+    Groups.Empty();
+    InstanceObjects.Empty();
+    SingleObjects.Empty();
+}
+
+void FMeshInstanceGrouper::Add(const void* MeshData, const TArray<UMaterial*>& OverrideMaterials, int32 ObjectIndex)
+{
+    int32 CandidateIndex = INDEX_NONE;
+    int32 LastSameMesh = INDEX_NONE;
+
+    if (const int32* First = FirstCandidateByMesh.Find(MeshData))
+    {
+        for (int32 Index = *First; Index != INDEX_NONE; Index = Candidates[Index].NextWithSameMesh)
+        {
+            const TArray<UMaterial*>& Other = *Candidates[Index].OverrideMaterials;
+            if (&Other == &OverrideMaterials
+                || (Other.Num() == OverrideMaterials.Num() && std::equal(Other.begin(), Other.end(), OverrideMaterials.begin())))
+            {
+                CandidateIndex = Index;
+                break;
+            }
+            LastSameMesh = Index;
+        }
+    }
+
+    if (CandidateIndex == INDEX_NONE)
+    {
+        CandidateIndex = Candidates.Emplace(FCandidate{ MeshData, &OverrideMaterials, INDEX_NONE, 0 });
+        if (LastSameMesh == INDEX_NONE)
+        {
+            FirstCandidateByMesh.Add(MeshData, CandidateIndex);
+        }
+        else
+        {
+            Candidates[LastSameMesh].NextWithSameMesh = CandidateIndex;
+        }
+    }
+
+    ++Candidates[CandidateIndex].Count;
+    EntryCandidates.Add(CandidateIndex);
+    EntryObjects.Add(ObjectIndex);
+}
+
+void FMeshInstanceGrouper::Build(int32 MinInstances)
+{
+    Groups.Empty();
+    InstanceObjects.Empty();
+    SingleObjects.Empty();
+
+    // 후보마다 그룹을 만들지 결정하고 시작 위치를 잡아둠 (Counting Sort)
+    CandidateGroups.SetNum(Candidates.Num());
+    CandidateCursors.SetNum(Candidates.Num());
+
+    int32 NumInstances = 0;
+    for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+    {
+        const FCandidate& Candidate = Candidates[Index];
+        if (Candidate.Count < MinInstances)
+        {
+            CandidateGroups[Index] = INDEX_NONE;
+            continue;
+        }
+
+        FMeshInstanceGroup& Group = Groups[Groups.Emplace()];
+        Group.MeshData = Candidate.MeshData;
+        Group.FirstInstance = NumInstances;
+        Group.NumInstances = Candidate.Count;
+
+        CandidateGroups[Index] = Groups.Num() - 1;
+        CandidateCursors[Index] = NumInstances;
+        NumInstances += Candidate.Count;
+    }
+
+    InstanceObjects.SetNum(NumInstances);
+    for (int32 Entry = 0; Entry < EntryObjects.Num(); ++Entry)
+    {
+        const int32 CandidateIndex = EntryCandidates[Entry];
+        if (CandidateGroups[CandidateIndex] == INDEX_NONE)
+        {
+            SingleObjects.Add(EntryObjects[Entry]);
+            continue;
+        }
+        InstanceObjects[CandidateCursors[CandidateIndex]++] = EntryObjects[Entry];
+    }
+
+    for (FMeshInstanceGroup& Group : Groups)
+    {
+        Group.RepresentativeObject = InstanceObjects[Group.FirstInstance];
+    }
+}
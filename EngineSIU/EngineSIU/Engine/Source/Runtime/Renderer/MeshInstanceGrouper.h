@@ -0,0 +1,78 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "HAL/PlatformType.h"
+
+class UMaterial;
+
+
+/** 한 번의 인스턴스드 드로우로 그릴 오브젝트 묶음 */
+struct FMeshInstanceGroup
+{
+    const void* MeshData = nullptr;
+
+    /** 머티리얼/서브메시 정보를 가져올 대표 오브젝트 */
+    int32 RepresentativeObject = 0;
+
+    /** GetInstanceObjects() 내 시작 위치, 인스턴스 버퍼에서의 오프셋과 같음 */
+    int32 FirstInstance = 0;
+    int32 NumInstances = 0;
+};
+
+
+/**
+ * 같은 메시와 같은 머티리얼 구성을 쓰는 오브젝트들을 인스턴싱 그룹으로 묶습니다.
+ * D3D에 의존하지 않으므로 그룹 수/인스턴스 수를 CPU에서 바로 확인할 수 있습니다.
+ */
+class FMeshInstanceGrouper
+{
+public:
+    void Reset();
+
+    /**
+     * 그룹 후보를 추가합니다.
+     * @param MeshData 버퍼를 공유하는 단위 (RenderData)
+     * @param OverrideMaterials 슬롯별 오버라이드 머티리얼, 포인터가 모두 같아야 같은 그룹, Build까지 유효해야 함
+     * @param ObjectIndex 호출자가 사용하는 오브젝트 인덱스
+     */
+    void Add(const void* MeshData, const TArray<UMaterial*>& OverrideMaterials, int32 ObjectIndex);
+
+    /**
+     * 추가된 오브젝트를 그룹별로 정리합니다. 그룹 내 순서는 추가된 순서를 따릅니다.
+     * @param MinInstances 이보다 적은 그룹은 인스턴싱하지 않고 GetSingleObjects()로 보냄
+     */
+    void Build(int32 MinInstances);
+
+    const TArray<FMeshInstanceGroup>& GetGroups() const { return Groups; }
+
+    /** 그룹 순서대로 나열된 오브젝트 인덱스 */
+    const TArray<int32>& GetInstanceObjects() const { return InstanceObjects; }
+
+    /** 인스턴싱하지 않을 오브젝트 인덱스 */
+    const TArray<int32>& GetSingleObjects() const { return SingleObjects; }
+
+private:
+    struct FCandidate
+    {
+        const void* MeshData;
+        const TArray<UMaterial*>* OverrideMaterials;
+        int32 NextWithSameMesh;
+        int32 Count;
+    };
+
+    /** MeshData -> 해당 메시의 첫 후보 인덱스, 같은 메시의 다른 머티리얼 구성은 NextWithSameMesh로 연결 */
+    TMap<const void*, int32> FirstCandidateByMesh;
+    TArray<FCandidate> Candidates;
+
+    /** Add된 순서대로의 (후보 인덱스, 오브젝트 인덱스) */
+    TArray<int32> EntryCandidates;
+    TArray<int32> EntryObjects;
+
+    TArray<FMeshInstanceGroup> Groups;
+    TArray<int32> InstanceObjects;
+    TArray<int32> SingleObjects;
+
+    /** Build에서 후보별 그룹 시작 위치 계산에 재사용 */
+    TArray<int32> CandidateGroups;
+    TArray<int32> CandidateCursors;
+};
@@ -24,6 +24,7 @@
 
 #include "CompositingPass.h"
 #include "LightHeatMapRenderPass.h"
+#include "MeshCullingStage.h"
 #include "PostProcessCompositingPass.h"
 #include "ShadowManager.h"
 #include "ShadowRenderPass.h"
@@ -34,6 +35,7 @@
 #include "PropertyEditor/ShowFlags.h"
 #include "Stats/Stats.h"
 #include "Stats/GPUTimingManager.h"
+#include "Async/JobSystem.h"
 
 //------------------------------------------------------------------------------
 // 초기화 및 해제 관련 함수
@@ -47,6 +49,7 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
     ShaderManager = new FDXDShaderManager(Graphics->Device);
     ShadowManager = new FShadowManager();
     ShadowRenderPass = new FShadowRenderPass();
+    MeshCullingStage = new FMeshCullingStage();
 
     CreateConstantBuffers();
     CreateCommonShader();
@@ -75,9 +78,12 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
     }
     ShadowRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     ShadowRenderPass->InitializeShadowManager(ShadowManager);
+    ShadowRenderPass->InitializeCullingStage(MeshCullingStage);
     
     StaticMeshRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     StaticMeshRenderPass->InitializeShadowManager(ShadowManager);
+    StaticMeshRenderPass->InitializeCullingStage(MeshCullingStage);
+    StaticMeshRenderPass->InitializeDrawStats(&MeshDrawStats);
     WorldBillboardRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     EditorBillboardRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     GizmoRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
@@ -88,6 +94,8 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
     EditorRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     
     DepthPrePass->Initialize(BufferManager, Graphics, ShaderManager);
+    DepthPrePass->InitializeCullingStage(MeshCullingStage);
+    DepthPrePass->InitializeDrawStats(&MeshDrawStats);
     TileLightCullingPass->Initialize(BufferManager, Graphics, ShaderManager);
     LightHeatMapRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
 
@@ -102,6 +110,7 @@ void FRenderer::Release()
     delete ShaderManager;
     delete ShadowManager;
     delete ShadowRenderPass;
+    delete MeshCullingStage;
 
     delete StaticMeshRenderPass;
     delete WorldBillboardRenderPass;
@@ -169,6 +178,9 @@ void FRenderer::CreateConstantBuffers()
     UINT DiffuseMultiplierSize = sizeof(FDiffuseMultiplier);
     BufferManager->CreateBufferGeneric<FDiffuseMultiplier>("FDiffuseMultiplier", nullptr, DiffuseMultiplierSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
 
+    UINT BonePaletteSize = sizeof(FBonePaletteConstants);
+    BufferManager->CreateBufferGeneric<FBonePaletteConstants>("FBonePaletteConstants", nullptr, BonePaletteSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+
 
     // TODO: 함수로 분리
     ID3D11Buffer* ObjectBuffer = BufferManager->GetConstantBuffer(TEXT("FObjectConstantBuffer"));
@@ -213,6 +225,86 @@ void FRenderer::CreateCommonShader() const
         return;
     }
 #pragma endregion UberShader
+
+#pragma region Instancing
+    // Slot 0은 기존 정점, Slot 1은 FMeshInstanceData
+    D3D11_INPUT_ELEMENT_DESC InstancedStaticMeshLayoutDesc[] = {
+        {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TANGENT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"MATERIAL_INDEX", 0, DXGI_FORMAT_R32_UINT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"INSTANCE_WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+    };
+
+    D3D_SHADER_MACRO DefinesInstancing[] =
+    {
+        { MESH_INSTANCING, "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"StaticMeshVertexShaderInstanced", L"Shaders/StaticMeshVertexShader.hlsl", "mainVS", InstancedStaticMeshLayoutDesc, ARRAYSIZE(InstancedStaticMeshLayoutDesc), DefinesInstancing);
+    if (FAILED(hr))
+    {
+        return;
+    }
+
+    D3D_SHADER_MACRO DefinesGouraudInstancing[] =
+    {
+        { GOURAUD, "1" },
+        { MESH_INSTANCING, "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"GOURAUD_StaticMeshVertexShaderInstanced", L"Shaders/StaticMeshVertexShader.hlsl", "mainVS", InstancedStaticMeshLayoutDesc, ARRAYSIZE(InstancedStaticMeshLayoutDesc), DefinesGouraudInstancing);
+    if (FAILED(hr))
+    {
+        return;
+    }
+#pragma endregion Instancing
+
+#pragma region GPUSkinning
+    // Slot 0은 바인드 포즈 정점, Slot 1은 FSkeletalMeshBoneWeight
+    D3D11_INPUT_ELEMENT_DESC SkinnedMeshLayoutDesc[] = {
+        {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TANGENT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"MATERIAL_INDEX", 0, DXGI_FORMAT_R32_UINT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"BONE_INDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT, 1, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"BONE_WEIGHTS", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+    };
+
+    D3D_SHADER_MACRO DefinesSkinning[] =
+    {
+        { GPU_SKINNING, "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"StaticMeshVertexShaderSkinned", L"Shaders/StaticMeshVertexShader.hlsl", "mainVS", SkinnedMeshLayoutDesc, ARRAYSIZE(SkinnedMeshLayoutDesc), DefinesSkinning);
+    if (FAILED(hr))
+    {
+        return;
+    }
+
+    D3D_SHADER_MACRO DefinesGouraudSkinning[] =
+    {
+        { GOURAUD, "1" },
+        { GPU_SKINNING, "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"GOURAUD_StaticMeshVertexShaderSkinned", L"Shaders/StaticMeshVertexShader.hlsl", "mainVS", SkinnedMeshLayoutDesc, ARRAYSIZE(SkinnedMeshLayoutDesc), DefinesGouraudSkinning);
+    if (FAILED(hr))
+    {
+        return;
+    }
+#pragma endregion GPUSkinning
 }
 
 void FRenderer::PrepareRender(FViewportResource* ViewportResource) const
@@ -228,16 +320,23 @@ void FRenderer::PrepareRender(FViewportResource* ViewportResource) const
 
 void FRenderer::PrepareRenderPass() const
 {
+    // 컴포넌트를 모으기만 하는 패스는 서로 겹치지 않는 배열을 채우므로 워커 스레드에서 실행
+    TArray<FJobHandle> CollectJobs;
+    for (IRenderPass* Pass : std::initializer_list<IRenderPass*>{
+        WorldBillboardRenderPass, EditorBillboardRenderPass, UpdateLightBufferPass, FogRenderPass, EditorRenderPass })
+    {
+        CollectJobs.Add(FJobSystem::Submit([Pass] { Pass->PrepareRenderArr(); }));
+    }
+
     StaticMeshRenderPass->PrepareRenderArr();
     ShadowRenderPass->PrepareRenderArr();
     GizmoRenderPass->PrepareRenderArr();
-    WorldBillboardRenderPass->PrepareRenderArr();
-    EditorBillboardRenderPass->PrepareRenderArr();
-    UpdateLightBufferPass->PrepareRenderArr();
-    FogRenderPass->PrepareRenderArr();
-    EditorRenderPass->PrepareRenderArr();
-    TileLightCullingPass->PrepareRenderArr();
     DepthPrePass->PrepareRenderArr();
+
+    // 라이트 버퍼 생성에 DeviceContext를 사용하므로 메인 스레드에서 실행
+    TileLightCullingPass->PrepareRenderArr();
+
+    FJobSystem::WaitAll(CollectJobs);
 }
 
 void FRenderer::ClearRenderArr() const
@@ -252,6 +351,7 @@ void FRenderer::ClearRenderArr() const
     EditorRenderPass->ClearRenderArr();
     DepthPrePass->ClearRenderArr();
     TileLightCullingPass->ClearRenderArr();
+    MeshCullingStage->Clear();
 }
 
 void FRenderer::UpdateCommonBuffer(const std::shared_ptr<FEditorViewportClient>& Viewport) const
@@ -276,6 +376,13 @@ void FRenderer::BeginRender(const std::shared_ptr<FEditorViewportClient>& Viewpo
     }
 
     UpdateCommonBuffer(Viewport);
+
+    // 모든 메시 패스가 PrepareRenderArr에서 사용할 가시성 결과를 먼저 계산
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(MeshCulling_CPU)
+        MeshCullingStage->Gather(GEngine->ActiveWorld);
+        MeshCullingStage->CullView(Viewport->GetViewMatrix() * Viewport->GetProjectionMatrix());
+    }
     
     PrepareRender(ViewportResource);
 }
@@ -13,6 +13,7 @@
 
 #include "D3D11RHI/GraphicDevice.h"
 #include "D3D11RHI/DXDBufferManager.h"
+#include "MeshDrawCommand.h"
 
 
 class FLightHeatMapRenderPass;
@@ -44,6 +45,7 @@ class FEditorRenderPass;
 class FDepthPrePass;
 class FTileLightCullingPass;
 class FGPUTimingManager;
+class FMeshCullingStage;
 
 class FRenderer
 {
@@ -93,6 +95,12 @@ public:
     FDXDShaderManager* ShaderManager = nullptr;
     class FShadowManager* ShadowManager = nullptr;
     FGPUTimingManager* GPUTimingManager = nullptr;
+
+    /** 메시 패스들이 공유하는 절두체 컬링 결과 */
+    FMeshCullingStage* MeshCullingStage = nullptr;
+
+    /** 메시 패스들의 드로우/바인딩 횟수, 매 프레임 시작 시 초기화 (stat draw) */
+    FMeshDrawStats MeshDrawStats;
     
     class FShadowRenderPass* ShadowRenderPass;
 
@@ -1,6 +1,7 @@
 #include "ShadowRenderPass.h"
 
 #include "ShadowManager.h"
+#include "MeshCullingStage.h"
 #include "BaseGizmos/GizmoBaseComponent.h"
 #include "Components/Light/LightComponent.h"
 #include "Components/Light/PointLightComponent.h"
@@ -45,6 +46,11 @@ void FShadowRenderPass::InitializeShadowManager(class FShadowManager* InShadowMa
     ShadowManager = InShadowManager;
 }
 
+void FShadowRenderPass::InitializeCullingStage(FMeshCullingStage* InCullingStage)
+{
+    CullingStage = InCullingStage;
+}
+
 
 //한번만 실행하면 되는 것
 void FShadowRenderPass::PrepareRenderState()
@@ -88,16 +94,7 @@ void FShadowRenderPass::PrepareCSMRenderState()
 
 void FShadowRenderPass::PrepareRenderArr()
 {
-    for (const auto iter : TObjectRange<UStaticMeshComponent>())
-    {
-        if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            if (iter->GetOwner() && !iter->GetOwner()->IsHidden())
-            {
-                StaticMeshComponents.Add(iter);
-            }
-        }
-    }
+    // 그림자 캐스터는 카메라가 아니라 라이트 기준으로 걸러야 하므로, Render에서 라이트마다 CullingStage에 질의함
 }
 
 void FShadowRenderPass::UpdateIsShadowConstant(int32 isShadow) const
@@ -134,10 +131,15 @@ void FShadowRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& Vie
             PrepareCSMRenderState();
             FCascadeConstantBuffer CascadeData = {};
             uint32 NumCascades = ShadowManager->GetNumCasCades();
+            TArray<FFrustum> CascadeFrustums;
+            CascadeFrustums.Reserve(NumCascades);
             for (uint32 i = 0; i < NumCascades; i++)
             {
                 CascadeData.ViewProj[i] = ShadowManager->GetCascadeViewProjMatrix(i);
+                // Shadow Rasterizer는 Depth Clip을 끄므로(Pancaking) Near/Far 평면으로는 컬링하지 않음
+                CascadeFrustums.Add(FFrustum(CascadeData.ViewProj[i], false));
             }
+            CullingStage->CullStaticMeshes(CascadeFrustums.GetData(), CascadeFrustums.Num(), StaticMeshComponents);
 
             ShadowManager->BeginDirectionalShadowCascadePass(0);
             //RenderAllStaticMeshes(Viewport);
@@ -160,6 +162,9 @@ void FShadowRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& Vie
 
         BufferManager->UpdateConstantBuffer(TEXT("FShadowConstantBuffer"), ShadowData);
 
+        const FFrustum SpotFrustum(ShadowData.ShadowViewProj, false);
+        CullingStage->CullStaticMeshes(&SpotFrustum, 1, StaticMeshComponents);
+
         ShadowManager->BeginSpotShadowPass(i);
         RenderAllStaticMeshes(Viewport);
            
@@ -171,6 +176,9 @@ void FShadowRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& Vie
     for (int i = 0 ; i < PointLights.Num(); i++)
     {
         
+        // 감쇠 반경 밖의 캐스터는 빛이 닿는 영역에 그림자를 드리울 수 없음
+        CullingStage->CullStaticMeshes(PointLights[i]->GetWorldLocation(), PointLights[i]->GetRadius(), StaticMeshComponents);
+
         ShadowManager->BeginPointShadowPass(i);
         RenderAllStaticMeshesForPointLight(Viewport, PointLights[i]);
            
@@ -192,7 +200,7 @@ void FShadowRenderPass::SetLightData(const TArray<class UPointLightComponent*>&
     SpotLights = InSpotLights;
 }
 
-void FShadowRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int32 SelectedSubMeshIndex)
+void FShadowRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int32 SelectedSubMeshIndex)
 {
     UINT Stride = sizeof(FStaticMeshVertex);
     UINT Offset = 0;
@@ -203,10 +211,10 @@ void FShadowRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexInfo.VertexBuffer, &Stride, &Offset);
 
     FIndexInfo IndexInfo;
-    BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->Indices, IndexInfo);
+    BufferManager->CreateCompactIndexBuffer(RenderData->ObjectName, RenderData->Indices, RenderData->Vertices.Num(), IndexInfo);
     if (IndexInfo.IndexBuffer)
     {
-        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
     }
 
     if (RenderData->MaterialSubsets.Num() == 0)
@@ -19,6 +19,7 @@ class FDXDBufferManager;
 class FDXDShaderManager;
 class FGraphicsDevice;
 class ULightComponentBase;
+class FMeshCullingStage;
 
 class FShadowRenderPass : public IRenderPass
 {
@@ -34,6 +35,7 @@ public:
     
     void Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager) override;
     void InitializeShadowManager(class FShadowManager* InShadowManager);
+    void InitializeCullingStage(FMeshCullingStage* InCullingStage);
     void PrepareRenderState();
     void PrepareCSMRenderState();
     virtual void PrepareRenderArr() override;
@@ -42,7 +44,7 @@ public:
     virtual void Render(const std::shared_ptr<FEditorViewportClient>& Viewport) override;    
     virtual void ClearRenderArr() override;
 
-    void RenderPrimitive(FStaticMeshRenderData* render_data, const TArray<FStaticMaterial*> array, TArray<UMaterial*> materials, int32 SelectedSubMeshIndex);
+    void RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int32 SelectedSubMeshIndex);
     virtual void RenderAllStaticMeshes(const std::shared_ptr<FEditorViewportClient>& Viewport);
     void RenderAllStaticMeshesForCSM(const std::shared_ptr<FEditorViewportClient>& Viewport,
                                      FCascadeConstantBuffer FCasCadeData);
@@ -55,7 +57,7 @@ public:
 
 private:
 
-    
+    /** 현재 라이트의 절두체(또는 반경)로 걸러진 그림자 캐스터 */
     TArray<class UStaticMeshComponent*> StaticMeshComponents;
     TArray<UPointLightComponent*> PointLights;
     TArray<USpotLightComponent*> SpotLights;
@@ -64,6 +66,7 @@ private:
     FGraphicsDevice* Graphics;
     FDXDShaderManager* ShaderManager;
     FShadowManager* ShadowManager;
+    FMeshCullingStage* CullingStage = nullptr;
 
     ID3D11InputLayout* StaticMeshIL;
     ID3D11VertexShader* DepthOnlyVS;
@@ -8,10 +8,12 @@
 #include "RendererHelpers.h"
 #include "ShadowManager.h"
 #include "ShadowRenderPass.h"
+#include "MeshCullingStage.h"
+#include "MeshDrawCommand.h"
+#include "MeshInstanceGrouper.h"
 #include "UnrealClient.h"
 #include "Math/JungleMath.h"
 
-#include "UObject/UObjectIterator.h"
 #include "UObject/Casts.h"
 
 #include "D3D11RHI/DXDBufferManager.h"
@@ -20,7 +22,6 @@
 
 #include "Components/Mesh/StaticMeshComponent.h"
 
-#include "BaseGizmos/GizmoBaseComponent.h"
 #include "Engine/EditorEngine.h"
 
 #include "PropertyEditor/ShowFlags.h"
@@ -30,6 +31,7 @@
 #include "Contents/Actors/Fish.h"
 #include "Components/Mesh/SkeletalMeshComponent.h"
 #include "Engine/Asset/SkeletalMeshAsset.h"
+#include "Engine/SkeletalMeshSkinning.h"
 
 
 FStaticMeshRenderPass::FStaticMeshRenderPass()
@@ -42,6 +44,12 @@ FStaticMeshRenderPass::FStaticMeshRenderPass()
 FStaticMeshRenderPass::~FStaticMeshRenderPass()
 {
     ReleaseShader();
+
+    if (InstanceBuffer)
+    {
+        InstanceBuffer->Release();
+        InstanceBuffer = nullptr;
+    }
 }
 
 void FStaticMeshRenderPass::CreateShader()
@@ -182,6 +190,18 @@ void FStaticMeshRenderPass::ChangeViewMode(EViewModeIndex ViewMode)
         break;
     }
 
+    // 커맨드 파이프라인이 바뀔 때 다시 바인딩하기 위해 보관
+    MeshVertexShader = VertexShader;
+    MeshInputLayout = InputLayout;
+
+    const wchar_t* InstancedShaderKey = (ViewMode == EViewModeIndex::VMI_Lit_Gouraud) ? L"GOURAUD_StaticMeshVertexShaderInstanced" : L"StaticMeshVertexShaderInstanced";
+    InstancedVertexShader = ShaderManager->GetVertexShaderByKey(InstancedShaderKey);
+    InstancedInputLayout = ShaderManager->GetInputLayoutByKey(InstancedShaderKey);
+
+    const wchar_t* SkinnedShaderKey = (ViewMode == EViewModeIndex::VMI_Lit_Gouraud) ? L"GOURAUD_StaticMeshVertexShaderSkinned" : L"StaticMeshVertexShaderSkinned";
+    SkinnedVertexShader = ShaderManager->GetVertexShaderByKey(SkinnedShaderKey);
+    SkinnedInputLayout = ShaderManager->GetInputLayoutByKey(SkinnedShaderKey);
+
     // Rasterizer
     Graphics->ChangeRasterizer(ViewMode);
 
@@ -206,29 +226,21 @@ void FStaticMeshRenderPass::InitializeShadowManager(class FShadowManager* InShad
     ShadowManager = InShadowManager;
 }
 
-void FStaticMeshRenderPass::PrepareRenderArr()
+void FStaticMeshRenderPass::InitializeCullingStage(FMeshCullingStage* InCullingStage)
 {
-    for (const auto iter : TObjectRange<UStaticMeshComponent>())
-    {
-        if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            if (iter->GetOwner() && !iter->GetOwner()->IsHidden())
-            {
-                StaticMeshComponents.Add(iter);
-            }
-        }
-    }
+    CullingStage = InCullingStage;
+}
 
-    for (const auto iter : TObjectRange<USkeletalMeshComponent>())
-    {
-        if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            if (iter->GetOwner() && !iter->GetOwner()->IsHidden())
-            {
-                SkeletalMeshComponents.Add(iter);
-            }
-        }
-    }
+void FStaticMeshRenderPass::InitializeDrawStats(FMeshDrawStats* InDrawStats)
+{
+    DrawStats = InDrawStats;
+}
+
+void FStaticMeshRenderPass::PrepareRenderArr()
+{
+    // 카메라 절두체 밖의 메시는 CullingStage에서 이미 걸러짐
+    StaticMeshComponents = CullingStage->GetVisibleStaticMeshes();
+    SkeletalMeshComponents = CullingStage->GetVisibleSkeletalMeshes();
 }
 
 void FStaticMeshRenderPass::PrepareRenderState(const std::shared_ptr<FEditorViewportClient>& Viewport) 
@@ -283,7 +295,7 @@ void FStaticMeshRenderPass::UpdateLitUnlitConstant(int32 isLit) const
     BufferManager->UpdateConstantBuffer(TEXT("FLitUnlitConstants"), Data);
 }
 
-void FStaticMeshRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const
+void FStaticMeshRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int SelectedSubMeshIndex) const
 {
     UINT Stride = sizeof(FStaticMeshVertex);
     UINT Offset = 0;
@@ -294,10 +306,10 @@ void FStaticMeshRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, T
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexInfo.VertexBuffer, &Stride, &Offset);
 
     FIndexInfo IndexInfo;
-    BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->Indices, IndexInfo);
+    BufferManager->CreateCompactIndexBuffer(RenderData->ObjectName, RenderData->Indices, RenderData->Vertices.Num(), IndexInfo);
     if (IndexInfo.IndexBuffer)
     {
-        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
     }
 
     if (RenderData->MaterialSubsets.Num() == 0)
@@ -329,7 +341,7 @@ void FStaticMeshRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, T
     }
 }
 
-void FStaticMeshRenderPass::RenderPrimitive(FSkeletalMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const
+void FStaticMeshRenderPass::RenderPrimitive(FSkeletalMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int SelectedSubMeshIndex) const
 {
     UINT Stride = sizeof(FSkeletalMeshVertex);
     UINT Offset = 0;
@@ -344,7 +356,7 @@ void FStaticMeshRenderPass::RenderPrimitive(FSkeletalMeshRenderData* RenderData,
     BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->Indices, IndexInfo);
     if (IndexInfo.IndexBuffer)
     {
-        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
     }
 
     if (RenderData->MaterialSubsets.Num() == 0)
@@ -384,51 +396,107 @@ void FStaticMeshRenderPass::RenderPrimitive(ID3D11Buffer* pBuffer, UINT numVerti
     Graphics->DeviceContext->Draw(numVertices, 0);
 }
 
-void FStaticMeshRenderPass::RenderPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11Buffer* pIndexBuffer, UINT numIndices) const
+void FStaticMeshRenderPass::RenderPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, const FIndexInfo& IndexInfo, UINT numIndices) const
 {
     UINT Stride = sizeof(FStaticMeshVertex);
     UINT Offset = 0;
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &pVertexBuffer, &Stride, &Offset);
-    Graphics->DeviceContext->IASetIndexBuffer(pIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+    Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
     Graphics->DeviceContext->DrawIndexed(numIndices, 0, 0);
 }
 
-void FStaticMeshRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FEditorViewportClient>& Viewport)
+/** FMeshDrawCommandList::Submit에서 실제 D3D 호출을 담당합니다. */
+struct FStaticMeshRenderPass::FDrawVisitor
 {
-    for (UStaticMeshComponent* Comp : StaticMeshComponents)
+    FStaticMeshRenderPass& Pass;
+
+    void BindPipeline(EMeshDrawPipeline Pipeline) const
     {
-        if (!Comp || !Comp->GetStaticMesh())
+        if (Pipeline == EMeshDrawPipeline::StaticMeshInstanced)
         {
-            continue;
+            UINT Stride = sizeof(FMeshInstanceData);
+            UINT Offset = 0;
+            Pass.Graphics->DeviceContext->IASetVertexBuffers(1, 1, &Pass.InstanceBuffer, &Stride, &Offset);
+            Pass.Graphics->DeviceContext->VSSetShader(Pass.InstancedVertexShader, nullptr, 0);
+            Pass.Graphics->DeviceContext->IASetInputLayout(Pass.InstancedInputLayout);
         }
-
-        FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
-        if (RenderData == nullptr)
+        else if (Pipeline == EMeshDrawPipeline::SkeletalMeshGPUSkinned)
         {
-            continue;
+            Pass.BufferManager->BindConstantBuffer(TEXT("FBonePaletteConstants"), 7, EShaderStage::Vertex);
+            Pass.Graphics->DeviceContext->VSSetShader(Pass.SkinnedVertexShader, nullptr, 0);
+            Pass.Graphics->DeviceContext->IASetInputLayout(Pass.SkinnedInputLayout);
+        }
+        else
+        {
+            Pass.Graphics->DeviceContext->VSSetShader(Pass.MeshVertexShader, nullptr, 0);
+            Pass.Graphics->DeviceContext->IASetInputLayout(Pass.MeshInputLayout);
         }
+    }
 
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+    void BindMesh(const FMeshDrawCommand& Command) const
+    {
+        FDXDBufferManager* BufferManager = Pass.BufferManager;
+        UINT Offset = 0;
+        FVertexInfo VertexInfo;
+        FIndexInfo IndexInfo;
 
-        USceneComponent* SelectedComponent = Engine->GetSelectedComponent();
-        AActor* SelectedActor = Engine->GetSelectedActor();
+        if (Command.Pipeline == EMeshDrawPipeline::SkeletalMesh)
+        {
+            const FSkeletalMeshRenderData* RenderData = static_cast<const FSkeletalMeshRenderData*>(Command.MeshData);
+            UINT Stride = sizeof(FSkeletalMeshVertex);
 
-        USceneComponent* TargetComponent = nullptr;
+            // 같은 RenderData를 쓰는 컴포넌트들은 정점이 같으므로 메시당 한 번만 갱신
+            BufferManager->CreateDynamicVertexBuffer(RenderData->ObjectName, RenderData->Vertices, VertexInfo);
+            BufferManager->UpdateDynamicVertexBuffer(RenderData->ObjectName, RenderData->Vertices);
+            BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->Indices, IndexInfo);
 
-        if (SelectedComponent != nullptr)
+            Pass.Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexInfo.VertexBuffer, &Stride, &Offset);
+        }
+        else if (Command.Pipeline == EMeshDrawPipeline::SkeletalMeshGPUSkinned)
         {
-            TargetComponent = SelectedComponent;
+            const FSkeletalMeshRenderData* RenderData = static_cast<const FSkeletalMeshRenderData*>(Command.MeshData);
+            UINT Stride = sizeof(FSkeletalMeshVertex);
+            UINT WeightStride = sizeof(FSkeletalMeshBoneWeight);
+
+            // 바인드 포즈와 가중치는 변하지 않으므로 정적 버퍼, 포즈는 팔레트로만 전달
+            FVertexInfo WeightInfo;
+            BufferManager->CreateVertexBuffer(RenderData->ObjectName + L"_BindPose", RenderData->BindPoseVertices, VertexInfo);
+            BufferManager->CreateVertexBuffer(RenderData->ObjectName + L"_BoneWeights", RenderData->BoneWeights, WeightInfo);
+            BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->Indices, IndexInfo);
+
+            FBonePaletteConstants PaletteData = {};
+            std::copy(RenderData->BonePalette.begin(), RenderData->BonePalette.end(), PaletteData.BonePalette);
+            BufferManager->UpdateConstantBuffer(TEXT("FBonePaletteConstants"), PaletteData);
+
+            Pass.Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexInfo.VertexBuffer, &Stride, &Offset);
+            Pass.Graphics->DeviceContext->IASetVertexBuffers(1, 1, &WeightInfo.VertexBuffer, &WeightStride, &Offset);
         }
-        else if (SelectedActor != nullptr)
+        else
         {
-            TargetComponent = SelectedActor->GetRootComponent();
+            const FStaticMeshRenderData* RenderData = static_cast<const FStaticMeshRenderData*>(Command.MeshData);
+            UINT Stride = sizeof(FStaticMeshVertex);
+
+            BufferManager->CreateVertexBuffer(RenderData->ObjectName, RenderData->Vertices, VertexInfo);
+            BufferManager->CreateCompactIndexBuffer(RenderData->ObjectName, RenderData->Indices, RenderData->Vertices.Num(), IndexInfo);
+
+            Pass.Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexInfo.VertexBuffer, &Stride, &Offset);
         }
 
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-        FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
-        const bool bIsSelected = (Engine && TargetComponent == Comp);
+        if (IndexInfo.IndexBuffer)
+        {
+            Pass.Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
+        }
+    }
 
-        UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
+    void BindMaterial(const FObjMaterialInfo& MaterialInfo) const
+    {
+        MaterialUtils::UpdateMaterial(Pass.BufferManager, Pass.Graphics, MaterialInfo);
+    }
+
+    void BindObject(const FMeshDrawObject& Object) const
+    {
+        const UPrimitiveComponent* Comp = Object.Component;
+        Pass.UpdateObjectConstant(Comp->GetWorldMatrix(), Comp->EncodeUUID() / 255.0f, Object.bIsSelected);
 
 #pragma region W08
         FDiffuseMultiplier DM = {};
@@ -441,20 +509,191 @@ void FStaticMeshRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FEditorV
             }
         }
         DM.DiffuseOverrideColor = FVector(0.55f, 0.45f, 0.067f);
-        BufferManager->UpdateConstantBuffer(TEXT("FDiffuseMultiplier"), DM);
+        Pass.BufferManager->UpdateConstantBuffer(TEXT("FDiffuseMultiplier"), DM);
 #pragma endregion W08
+    }
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+    void BindSubMesh(bool bSelected) const
+    {
+        Pass.BufferManager->UpdateConstantBuffer(TEXT("FSubMeshConstants"), FSubMeshConstants(bSelected));
+    }
+
+    void Draw(const FMeshDrawCommand& Command) const
+    {
+        if (Command.NumInstances > 0)
+        {
+            Pass.Graphics->DeviceContext->DrawIndexedInstanced(Command.IndexCount, Command.NumInstances, Command.StartIndex, 0, Command.FirstInstance);
+        }
+        else
+        {
+            Pass.Graphics->DeviceContext->DrawIndexed(Command.IndexCount, Command.StartIndex, 0);
+        }
+    }
+};
 
-        if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
+namespace
+{
+    USceneComponent* GetSelectionTarget()
+    {
+        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+        if (!Engine)
+        {
+            return nullptr;
+        }
+
+        if (USceneComponent* SelectedComponent = Engine->GetSelectedComponent())
+        {
+            return SelectedComponent;
+        }
+        if (AActor* SelectedActor = Engine->GetSelectedActor())
         {
-            FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Comp->GetBoundingBox(), Comp->GetWorldLocation(), WorldMatrix);
+            return SelectedActor->GetRootComponent();
+        }
+        return nullptr;
+    }
+
+    /** 선택 하이라이트와 W08 물고기 색상은 오브젝트 상수 버퍼로만 전달되므로 인스턴싱에서 제외 */
+    bool CanInstance(const UStaticMeshComponent* Comp, bool bIsSelected)
+    {
+        return !bIsSelected && Comp->GetselectedSubMeshIndex() < 0 && !Cast<AFish>(Comp->GetOwner());
+    }
+
+    /**
+     * 컴포넌트의 서브메시마다 커맨드를 추가합니다.
+     * NumInstances가 0보다 크면 Comp는 그룹의 대표이고, 인스턴스 버퍼의 [FirstInstance, FirstInstance + NumInstances) 범위를 그립니다.
+     */
+    template <typename RenderDataType>
+    void AddMeshDrawCommands(
+        FMeshDrawCommandList& DrawCommands, EMeshDrawPipeline Pipeline, UMeshComponent* Comp, const RenderDataType* RenderData,
+        const TArray<FStaticMaterial*>& Materials, bool bIsSelected, int32 SelectedSubMeshIndex,
+        uint32 FirstInstance = 0, uint32 NumInstances = 0
+    )
+    {
+        const int32 ObjectIndex = DrawCommands.AddObject(Comp, bIsSelected);
+
+        if (RenderData->MaterialSubsets.Num() == 0)
+        {
+            FMeshDrawCommand& Command = DrawCommands.AddCommand(Pipeline, RenderData, nullptr, ObjectIndex, 0, RenderData->Indices.Num(), false);
+            Command.FirstInstance = FirstInstance;
+            Command.NumInstances = NumInstances;
+            return;
+        }
+
+        const TArray<UMaterial*>& OverrideMaterials = Comp->GetOverrideMaterials();
+        for (int32 SubMeshIndex = 0; SubMeshIndex < RenderData->MaterialSubsets.Num(); ++SubMeshIndex)
+        {
+            const FMaterialSubset& Subset = RenderData->MaterialSubsets[SubMeshIndex];
+            const uint32 MaterialIndex = Subset.MaterialIndex;
+
+            UMaterial* Material = OverrideMaterials[MaterialIndex] != nullptr ? OverrideMaterials[MaterialIndex] : Materials[MaterialIndex]->Material;
+            FMeshDrawCommand& Command = DrawCommands.AddCommand(
+                Pipeline, RenderData, &Material->GetMaterialInfo(), ObjectIndex,
+                Subset.IndexStart, Subset.IndexCount, SubMeshIndex == SelectedSubMeshIndex
+            );
+            Command.FirstInstance = FirstInstance;
+            Command.NumInstances = NumInstances;
         }
     }
 }
 
+void FStaticMeshRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FEditorViewportClient>& Viewport)
+{
+    const USceneComponent* TargetComponent = GetSelectionTarget();
+    const bool bShowAABB = Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB);
+
+    DrawCommands.Reset();
+    InstanceGrouper.Reset();
+    InstanceCandidates.Empty();
+
+    for (UStaticMeshComponent* Comp : StaticMeshComponents)
+    {
+        if (!Comp || !Comp->GetStaticMesh())
+        {
+            continue;
+        }
+
+        FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
+        if (RenderData == nullptr)
+        {
+            continue;
+        }
+
+        const bool bIsSelected = TargetComponent == Comp;
+        if (CanInstance(Comp, bIsSelected))
+        {
+            InstanceGrouper.Add(RenderData, Comp->GetOverrideMaterials(), InstanceCandidates.Add(Comp));
+        }
+        else
+        {
+            AddMeshDrawCommands(
+                DrawCommands, EMeshDrawPipeline::StaticMesh, Comp, RenderData,
+                Comp->GetStaticMesh()->GetMaterials(), bIsSelected, Comp->GetselectedSubMeshIndex()
+            );
+        }
+
+        if (bShowAABB)
+        {
+            FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Comp->GetBoundingBox(), Comp->GetWorldLocation(), Comp->GetWorldMatrix());
+        }
+    }
+
+    InstanceGrouper.Build(MinInstancesPerBatch);
+
+    // 인스턴스 버퍼를 올릴 수 없으면 그룹도 개별 드로우로 처리
+    const bool bInstancingAvailable = UpdateInstanceBuffer();
+
+    for (const FMeshInstanceGroup& Group : InstanceGrouper.GetGroups())
+    {
+        if (!bInstancingAvailable)
+        {
+            break;
+        }
+
+        UStaticMeshComponent* Representative = InstanceCandidates[Group.RepresentativeObject];
+        AddMeshDrawCommands(
+            DrawCommands, EMeshDrawPipeline::StaticMeshInstanced, Representative, static_cast<const FStaticMeshRenderData*>(Group.MeshData),
+            Representative->GetStaticMesh()->GetMaterials(), false, INDEX_NONE, Group.FirstInstance, Group.NumInstances
+        );
+    }
+
+    auto AddSingle = [this](int32 CandidateIndex)
+    {
+        UStaticMeshComponent* Comp = InstanceCandidates[CandidateIndex];
+        AddMeshDrawCommands(
+            DrawCommands, EMeshDrawPipeline::StaticMesh, Comp, Comp->GetStaticMesh()->GetRenderData(),
+            Comp->GetStaticMesh()->GetMaterials(), false, INDEX_NONE
+        );
+    };
+
+    for (const int32 CandidateIndex : InstanceGrouper.GetSingleObjects())
+    {
+        AddSingle(CandidateIndex);
+    }
+    if (!bInstancingAvailable)
+    {
+        for (const int32 CandidateIndex : InstanceGrouper.GetInstanceObjects())
+        {
+            AddSingle(CandidateIndex);
+        }
+    }
+
+    SubmitDrawCommands();
+
+    if (bInstancingAvailable && !InstanceGrouper.GetGroups().IsEmpty())
+    {
+        ID3D11Buffer* NullBuffer = nullptr;
+        UINT Zero = 0;
+        Graphics->DeviceContext->IASetVertexBuffers(1, 1, &NullBuffer, &Zero, &Zero);
+    }
+}
+
 void FStaticMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FEditorViewportClient>& Viewport)
 {
+    const USceneComponent* TargetComponent = GetSelectionTarget();
+    const bool bShowAABB = Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB);
+    bool bUsedGPUSkinning = false;
+
+    DrawCommands.Reset();
     for (USkeletalMeshComponent* Comp : SkeletalMeshComponents)
     {
         if (!Comp || !Comp->GetSkeletalMesh())
@@ -468,35 +707,102 @@ void FStaticMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FEdito
             continue;
         }
 
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+        const bool bGPUSkinning = FSkeletalMeshSkinning::bUseGPUSkinning
+            && RenderData->SkeletonBones.Num() <= MAX_SKINNING_BONES
+            && RenderData->BoneWeights.Num() == RenderData->BindPoseVertices.Num();
 
-        USceneComponent* SelectedComponent = Engine->GetSelectedComponent();
-        AActor* SelectedActor = Engine->GetSelectedActor();
+        if (bGPUSkinning)
+        {
+            FSkeletalMeshSkinning::BuildPalette(RenderData->SkeletonBones, RenderData->BonePalette);
+            bUsedGPUSkinning = true;
+        }
+        else if (RenderData->bPoseDirty)
+        {
+            FSkeletalMeshSkinning::UpdateSkinnedVertices(*RenderData);
+        }
 
-        USceneComponent* TargetComponent = nullptr;
+        AddMeshDrawCommands(
+            DrawCommands, bGPUSkinning ? EMeshDrawPipeline::SkeletalMeshGPUSkinned : EMeshDrawPipeline::SkeletalMesh, Comp, RenderData,
+            Comp->GetSkeletalMesh()->GetMaterials(), TargetComponent == Comp, Comp->GetselectedSubMeshIndex()
+        );
 
-        if (SelectedComponent != nullptr)
+        if (bShowAABB)
         {
-            TargetComponent = SelectedComponent;
+            FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Comp->GetBoundingBox(), Comp->GetWorldLocation(), Comp->GetWorldMatrix());
         }
-        else if (SelectedActor != nullptr)
+    }
+
+    SubmitDrawCommands();
+
+    if (bUsedGPUSkinning)
+    {
+        ID3D11Buffer* NullBuffer = nullptr;
+        UINT Zero = 0;
+        Graphics->DeviceContext->IASetVertexBuffers(1, 1, &NullBuffer, &Zero, &Zero);
+    }
+}
+
+void FStaticMeshRenderPass::SubmitDrawCommands()
+{
+    DrawCommands.Sort();
+
+    FMeshDrawStats LocalStats;
+    FDrawVisitor Visitor = { *this };
+    DrawCommands.Submit(Visitor, DrawStats ? *DrawStats : LocalStats);
+}
+
+bool FStaticMeshRenderPass::UpdateInstanceBuffer()
+{
+    const TArray<int32>& InstanceObjects = InstanceGrouper.GetInstanceObjects();
+    if (InstanceObjects.IsEmpty())
+    {
+        return true;
+    }
+
+    InstanceData.SetNum(InstanceObjects.Num());
+    for (int32 Index = 0; Index < InstanceObjects.Num(); ++Index)
+    {
+        const FMatrix WorldMatrix = InstanceCandidates[InstanceObjects[Index]]->GetWorldMatrix();
+        InstanceData[Index].WorldMatrix = WorldMatrix;
+        InstanceData[Index].InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    }
+
+    const uint32 NumInstances = static_cast<uint32>(InstanceData.Num());
+    if (NumInstances > InstanceBufferCapacity)
+    {
+        if (InstanceBuffer)
         {
-            TargetComponent = SelectedActor->GetRootComponent();
+            InstanceBuffer->Release();
+            InstanceBuffer = nullptr;
         }
 
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-        FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
-        const bool bIsSelected = (Engine && TargetComponent == Comp);
-
-        UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
+        // 매 프레임 재생성하지 않도록 여유 있게 키움
+        InstanceBufferCapacity = FMath::Max(NumInstances, InstanceBufferCapacity * 2);
 
-        RenderPrimitive(RenderData, Comp->GetSkeletalMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        D3D11_BUFFER_DESC Desc = {};
+        Desc.ByteWidth = sizeof(FMeshInstanceData) * InstanceBufferCapacity;
+        Desc.Usage = D3D11_USAGE_DYNAMIC;
+        Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
-        if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
+        const HRESULT hr = Graphics->Device->CreateBuffer(&Desc, nullptr, &InstanceBuffer);
+        if (FAILED(hr))
         {
-            FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Comp->GetBoundingBox(), Comp->GetWorldLocation(), WorldMatrix);
+            UE_LOG(ELogLevel::Error, TEXT("Failed to create mesh instance buffer"));
+            InstanceBufferCapacity = 0;
+            return false;
         }
     }
+
+    D3D11_MAPPED_SUBRESOURCE Mapped;
+    if (FAILED(Graphics->DeviceContext->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+    {
+        return false;
+    }
+    memcpy(Mapped.pData, InstanceData.GetData(), sizeof(FMeshInstanceData) * NumInstances);
+    Graphics->DeviceContext->Unmap(InstanceBuffer, 0);
+
+    return true;
 }
 
 void FStaticMeshRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& Viewport)
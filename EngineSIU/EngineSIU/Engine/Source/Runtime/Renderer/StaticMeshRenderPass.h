@@ -5,6 +5,8 @@
 
 #include "Define.h"
 #include "Components/Light/PointLightComponent.h"
+#include "MeshDrawCommand.h"
+#include "MeshInstanceGrouper.h"
 
 struct FStaticMeshRenderData;
 struct FSkeletalMeshRenderData;
@@ -17,6 +19,7 @@ class UStaticMeshComponent;
 class USkeletalMeshComponent;
 struct FStaticMaterial;
 class FShadowRenderPass;
+class FMeshCullingStage;
 
 class FStaticMeshRenderPass : public IRenderPass
 {
@@ -28,6 +31,11 @@ public:
     virtual void Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager) override;
     
     void InitializeShadowManager(class FShadowManager* InShadowManager);
+
+    void InitializeCullingStage(FMeshCullingStage* InCullingStage);
+
+    /** 드로우/바인딩 횟수를 누적할 프레임 카운터를 지정합니다. */
+    void InitializeDrawStats(FMeshDrawStats* InDrawStats);
     
     virtual void PrepareRenderArr() override;
 
@@ -45,11 +53,11 @@ public:
   
     void UpdateLitUnlitConstant(int32 isLit) const;
 
-    void RenderPrimitive(FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const;
-    void RenderPrimitive(FSkeletalMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const;
+    void RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int SelectedSubMeshIndex) const;
+    void RenderPrimitive(FSkeletalMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int SelectedSubMeshIndex) const;
     void RenderPrimitive(ID3D11Buffer* pBuffer, UINT numVertices) const;
 
-    void RenderPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11Buffer* pIndexBuffer, UINT numIndices) const;
+    void RenderPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, const FIndexInfo& IndexInfo, UINT numIndices) const;
 
     // Shader 관련 함수 (생성/해제 등)
     void CreateShader();
@@ -58,7 +66,19 @@ public:
     void ChangeViewMode(EViewModeIndex ViewMode);
     
 protected:
+    struct FDrawVisitor;
+
+    /** 이보다 적은 수의 같은 메시는 인스턴싱하지 않음 */
+    static constexpr int32 MinInstancesPerBatch = 2;
 
+    /** DrawCommands를 정렬한 뒤 달라진 상태만 바인딩하며 제출합니다. */
+    void SubmitDrawCommands();
+
+    /**
+     * InstanceGrouper의 그룹 순서대로 월드/역전치 행렬을 인스턴스 버퍼에 올립니다.
+     * @return 인스턴스 버퍼를 사용할 수 있으면 true
+     */
+    bool UpdateInstanceBuffer();
 
     TArray<UStaticMeshComponent*> StaticMeshComponents;
     TArray<USkeletalMeshComponent*> SkeletalMeshComponents;
@@ -77,4 +97,28 @@ protected:
     FDXDShaderManager* ShaderManager;
     
     FShadowManager* ShadowManager;
+
+    FMeshCullingStage* CullingStage = nullptr;
+
+    /** 프레임마다 다시 채워지는 드로우 커맨드, 메모리는 재사용 */
+    FMeshDrawCommandList DrawCommands;
+
+    FMeshDrawStats* DrawStats = nullptr;
+
+    /** 같은 UStaticMesh와 머티리얼 구성을 쓰는 컴포넌트 묶음 */
+    FMeshInstanceGrouper InstanceGrouper;
+    TArray<UStaticMeshComponent*> InstanceCandidates;
+    TArray<FMeshInstanceData> InstanceData;
+
+    /** Slot 1에 바인딩되는 FMeshInstanceData 정점 버퍼, 부족할 때만 다시 만듦 */
+    ID3D11Buffer* InstanceBuffer = nullptr;
+    uint32 InstanceBufferCapacity = 0;
+
+    /** PrepareRenderState에서 정해지는 파이프라인별 정점 셰이더 */
+    ID3D11VertexShader* MeshVertexShader = nullptr;
+    ID3D11InputLayout* MeshInputLayout = nullptr;
+    ID3D11VertexShader* InstancedVertexShader = nullptr;
+    ID3D11InputLayout* InstancedInputLayout = nullptr;
+    ID3D11VertexShader* SkinnedVertexShader = nullptr;
+    ID3D11InputLayout* SkinnedInputLayout = nullptr;
 };
@@ -2,13 +2,12 @@
 #include "StaticMeshRenderPassBase.h"
 
 #include "Engine/Engine.h"
-#include "UObject/UObjectIterator.h"
 #include "Components/Mesh/StaticMeshComponent.h"
-#include "BaseGizmos/GizmoBaseComponent.h"
 #include "Engine/EditorEngine.h"
 #include "UnrealEd/EditorViewportClient.h"
 #include "UObject/Casts.h"
 #include "Editor/PropertyEditor/ShowFlags.h"
+#include "MeshCullingStage.h"
 
 FStaticMeshRenderPassBase::FStaticMeshRenderPassBase()
     : BufferManager(nullptr)
@@ -31,16 +30,14 @@ void FStaticMeshRenderPassBase::Initialize(FDXDBufferManager* InBufferManager, F
     CreateResource();
 }
 
+void FStaticMeshRenderPassBase::InitializeCullingStage(FMeshCullingStage* InCullingStage)
+{
+    CullingStage = InCullingStage;
+}
+
 void FStaticMeshRenderPassBase::PrepareRenderArr()
 {
-    for (const auto iter : TObjectRange<UStaticMeshComponent>())
-    {
-        if (iter->IsA<UGizmoBaseComponent>() || iter->GetWorld() != GEngine->ActiveWorld)
-        {
-            continue;
-        }
-        StaticMeshComponents.Add(iter);
-    }
+    StaticMeshComponents = CullingStage->GetVisibleStaticMeshes();
 }
 
 void FStaticMeshRenderPassBase::Render(const std::shared_ptr<FEditorViewportClient>& Viewport)
@@ -94,7 +91,7 @@ void FStaticMeshRenderPassBase::RenderAllStaticMeshes(const std::shared_ptr<FEdi
     }
 }
 
-void FStaticMeshRenderPassBase::RenderPrimitive(FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int32 SelectedSubMeshIndex) const
+void FStaticMeshRenderPassBase::RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int32 SelectedSubMeshIndex) const
 {
     UINT Stride = sizeof(FStaticMeshVertex);
     UINT Offset = 0;
@@ -105,10 +102,10 @@ void FStaticMeshRenderPassBase::RenderPrimitive(FStaticMeshRenderData* RenderDat
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexInfo.VertexBuffer, &Stride, &Offset);
 
     FIndexInfo IndexInfo;
-    BufferManager->CreateIndexBuffer(RenderData->ObjectName, RenderData->Indices, IndexInfo);
+    BufferManager->CreateCompactIndexBuffer(RenderData->ObjectName, RenderData->Indices, RenderData->Vertices.Num(), IndexInfo);
     if (IndexInfo.IndexBuffer)
     {
-        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
     }
 
     if (RenderData->MaterialSubsets.Num() == 0)
@@ -148,12 +145,12 @@ void FStaticMeshRenderPassBase::RenderPrimitive(ID3D11Buffer* Buffer, UINT Verti
     Graphics->DeviceContext->Draw(VerticesNum, 0);
 }
 
-void FStaticMeshRenderPassBase::RenderPrimitive(ID3D11Buffer* VertexBuffer, ID3D11Buffer* IndexBuffer, UINT IndicesNum) const
+void FStaticMeshRenderPassBase::RenderPrimitive(ID3D11Buffer* VertexBuffer, const FIndexInfo& IndexInfo, UINT IndicesNum) const
 {
     UINT Stride = sizeof(FStaticMeshVertex);
     UINT Offset = 0;
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
-    Graphics->DeviceContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+    Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
     Graphics->DeviceContext->DrawIndexed(IndicesNum, 0, 0);
 }
 
@@ -5,11 +5,13 @@
 
 class UStaticMeshComponent;
 class UMaterial;
+class FMeshCullingStage;
 
 struct FMatrix;
 struct FVector4;
 struct FStaticMaterial;
 struct FStaticMeshRenderData;
+struct FIndexInfo;
 struct ID3D11Buffer;
 
 class FStaticMeshRenderPassBase : public IRenderPass
@@ -20,6 +22,8 @@ public:
 
     virtual void Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager) override;
 
+    void InitializeCullingStage(FMeshCullingStage* InCullingStage);
+
     virtual void PrepareRenderArr() override;
 
     virtual void Render(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
@@ -39,11 +43,11 @@ protected:
 
     void RenderAllStaticMeshes(const std::shared_ptr<FEditorViewportClient>& Viewport);
 
-    void RenderPrimitive(FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int32 SelectedSubMeshIndex) const;
+    void RenderPrimitive(FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int32 SelectedSubMeshIndex) const;
 
     void RenderPrimitive(ID3D11Buffer* Buffer, UINT VerticesNum) const;
 
-    void RenderPrimitive(ID3D11Buffer* VertexBuffer, ID3D11Buffer* IndexBuffer, UINT IndicesNum) const;
+    void RenderPrimitive(ID3D11Buffer* VertexBuffer, const FIndexInfo& IndexInfo, UINT IndicesNum) const;
 
     void UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const;
 
@@ -51,6 +55,8 @@ protected:
     FGraphicsDevice* Graphics;
     FDXDShaderManager* ShaderManager;
 
+    FMeshCullingStage* CullingStage = nullptr;
+
     TArray<UStaticMeshComponent*> StaticMeshComponents;
     ID3D11ShaderResourceView* SpotShadowArraySRV = nullptr;
 };
@@ -90,30 +90,30 @@ void FDXDBufferManager::BindConstantBuffer(const FString& Key, UINT StartSlot, E
 
 FVertexInfo FDXDBufferManager::GetVertexBuffer(const FString& InName) const
 {
-    if (VertexBufferPool.Contains(InName))
-        return VertexBufferPool[InName];
+    if (const FVertexInfo* VertexInfo = VertexBufferPool.Find(InName))
+        return *VertexInfo;
     return FVertexInfo();
 }
 
 FIndexInfo FDXDBufferManager::GetIndexBuffer(const FString& InName) const
 {
-    if (IndexBufferPool.Contains(InName))
-        return IndexBufferPool[InName];
+    if (const FIndexInfo* IndexInfo = IndexBufferPool.Find(InName))
+        return *IndexInfo;
     return FIndexInfo();
 }
 
 FVertexInfo FDXDBufferManager::GetTextVertexBuffer(const FWString& InName) const
 {
-    if (TextAtlasVertexBufferPool.Contains(InName))
-        return TextAtlasVertexBufferPool[InName];
+    if (const FVertexInfo* VertexInfo = TextAtlasVertexBufferPool.Find(InName))
+        return *VertexInfo;
 
     return FVertexInfo();
 }
 
 FIndexInfo FDXDBufferManager::GetTextIndexBuffer(const FWString& InName) const
 {
-    if (TextAtlasIndexBufferPool.Contains(InName))
-        return TextAtlasIndexBufferPool[InName];
+    if (const FIndexInfo* IndexInfo = TextAtlasIndexBufferPool.Find(InName))
+        return *IndexInfo;
 
     return FIndexInfo();
 }
@@ -121,12 +121,28 @@ FIndexInfo FDXDBufferManager::GetTextIndexBuffer(const FWString& InName) const
 
 ID3D11Buffer* FDXDBufferManager::GetConstantBuffer(const FString& InName) const
 {
-    if (ConstantBufferPool.Contains(InName))
-        return ConstantBufferPool[InName];
+    if (ID3D11Buffer* const* Buffer = ConstantBufferPool.Find(InName))
+        return *Buffer;
 
     return nullptr;
 }
 
+HRESULT FDXDBufferManager::CreateCompactIndexBuffer(const FWString& KeyName, const TArray<uint32>& Indices, uint32 NumVertices, FIndexInfo& OutIndexInfo)
+{
+    if (NumVertices >= 65536 || TextAtlasIndexBufferPool.Contains(KeyName))
+    {
+        return CreateIndexBuffer(KeyName, Indices, OutIndexInfo);
+    }
+
+    TArray<uint16> ShortIndices;
+    ShortIndices.SetNum(Indices.Num());
+    for (int32 i = 0; i < Indices.Num(); ++i)
+    {
+        ShortIndices[i] = static_cast<uint16>(Indices[i]);
+    }
+    return CreateIndexBuffer(KeyName, ShortIndices, OutIndexInfo);
+}
+
 void FDXDBufferManager::CreateQuadBuffer()
 {
     TArray<QuadVertex> Vertices =
@@ -166,9 +182,9 @@ void FDXDBufferManager::GetTextBuffer(const FWString& Text, FVertexInfo& OutVert
 HRESULT FDXDBufferManager::CreateUnicodeTextBuffer(const FWString& Text, FBufferInfo& OutBufferInfo,
     float BitmapWidth, float BitmapHeight, float ColCount, float RowCount)
 {
-    if (TextAtlasBufferPool.Contains(Text))
+    if (const FBufferInfo* BufferInfo = TextAtlasBufferPool.Find(Text))
     {
-        OutBufferInfo = TextAtlasBufferPool[Text];
+        OutBufferInfo = *BufferInfo;
         return S_OK;
     }
 
@@ -43,6 +43,12 @@ public:
     template<typename T>
     HRESULT CreateIndexBuffer(const FWString& KeyName, const TArray<T>& indices, FIndexInfo& OutIndexInfo, D3D11_USAGE Usage = D3D11_USAGE_DEFAULT, UINT CpuAccessFlags = 0);
 
+    /**
+     * 정점이 65536개 미만이면 16비트 Index 버퍼로 만듭니다. 사용할 포맷은 OutIndexInfo.Format에 기록됩니다.
+     * @param NumVertices Index가 가리키는 정점 버퍼의 정점 수
+     */
+    HRESULT CreateCompactIndexBuffer(const FWString& KeyName, const TArray<uint32>& Indices, uint32 NumVertices, FIndexInfo& OutIndexInfo);
+
     template<typename T>
     HRESULT CreateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo);
 
@@ -112,9 +118,9 @@ template<typename T>
 HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo,
     D3D11_USAGE usage, UINT cpuAccessFlags)
 {
-    if (!KeyName.IsEmpty() && VertexBufferPool.Contains(KeyName))
+    if (const FVertexInfo* VertexInfo = KeyName.IsEmpty() ? nullptr : VertexBufferPool.Find(KeyName))
     {
-        OutVertexInfo = VertexBufferPool[KeyName];
+        OutVertexInfo = *VertexInfo;
         return S_OK;
     }
     uint32_t Stride = sizeof(T);
@@ -142,15 +148,15 @@ HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FString& KeyName, co
 template<typename T>
 HRESULT FDXDBufferManager::CreateIndexBuffer(const FString& KeyName, const TArray<T>& indices, FIndexInfo& OutIndexInfo, D3D11_USAGE Usage, UINT CpuAccessFlags)
 {
-    if (!KeyName.IsEmpty() && IndexBufferPool.Contains(KeyName))
+    if (const FIndexInfo* IndexInfo = KeyName.IsEmpty() ? nullptr : IndexBufferPool.Find(KeyName))
     {
-        OutIndexInfo = IndexBufferPool[KeyName];
+        OutIndexInfo = *IndexInfo;
         return S_OK;
     }
 
     D3D11_BUFFER_DESC indexBufferDesc = {};
     indexBufferDesc.Usage = Usage;
-    indexBufferDesc.ByteWidth = indices.Num() * sizeof(uint32);
+    indexBufferDesc.ByteWidth = indices.Num() * sizeof(T);
     indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
     indexBufferDesc.CPUAccessFlags = CpuAccessFlags;
 
@@ -164,7 +170,8 @@ HRESULT FDXDBufferManager::CreateIndexBuffer(const FString& KeyName, const TArra
 
     OutIndexInfo.NumIndices = static_cast<uint32>(indices.Num());
     OutIndexInfo.IndexBuffer = NewBuffer;
-    IndexBufferPool.Add(KeyName, FIndexInfo(static_cast<uint32>(indices.Num()), NewBuffer));
+    OutIndexInfo.Format = sizeof(T) == sizeof(uint16) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+    IndexBufferPool.Add(KeyName, OutIndexInfo);
 
 
     return S_OK;
@@ -182,9 +189,9 @@ template<typename T>
 HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FWString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo,
     D3D11_USAGE usage, UINT cpuAccessFlags)
 {
-    if (!KeyName.empty() && TextAtlasVertexBufferPool.Contains(KeyName))
+    if (const FVertexInfo* VertexInfo = KeyName.empty() ? nullptr : TextAtlasVertexBufferPool.Find(KeyName))
     {
-        OutVertexInfo = TextAtlasVertexBufferPool[KeyName];
+        OutVertexInfo = *VertexInfo;
         return S_OK;
     }
     uint32_t Stride = sizeof(T);
@@ -214,15 +221,15 @@ HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FWString& KeyName, c
 template<typename T>
 HRESULT FDXDBufferManager::CreateIndexBuffer(const FWString& KeyName, const TArray<T>& indices, FIndexInfo& OutIndexInfo, D3D11_USAGE Usage, UINT CpuAccessFlags)
 {
-    if (!KeyName.empty() && TextAtlasIndexBufferPool.Contains(KeyName))
+    if (const FIndexInfo* IndexInfo = KeyName.empty() ? nullptr : TextAtlasIndexBufferPool.Find(KeyName))
     {
-        OutIndexInfo = TextAtlasIndexBufferPool[KeyName];
+        OutIndexInfo = *IndexInfo;
         return S_OK;
     }
 
     D3D11_BUFFER_DESC indexBufferDesc = {};
     indexBufferDesc.Usage = Usage;
-    indexBufferDesc.ByteWidth = indices.Num() * sizeof(uint32);
+    indexBufferDesc.ByteWidth = indices.Num() * sizeof(T);
     indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
     indexBufferDesc.CPUAccessFlags = CpuAccessFlags;
 
@@ -236,7 +243,8 @@ HRESULT FDXDBufferManager::CreateIndexBuffer(const FWString& KeyName, const TArr
 
     OutIndexInfo.NumIndices = static_cast<uint32>(indices.Num());
     OutIndexInfo.IndexBuffer = NewBuffer;
-    TextAtlasIndexBufferPool.Add(KeyName, FIndexInfo(static_cast<uint32>(indices.Num()), NewBuffer));
+    OutIndexInfo.Format = sizeof(T) == sizeof(uint16) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+    TextAtlasIndexBufferPool.Add(KeyName, OutIndexInfo);
 
     return S_OK;
 }
@@ -332,12 +340,13 @@ void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const TArray<T>
 template<typename T>
 void FDXDBufferManager::UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices) const
 {
-    if (!VertexBufferPool.Contains(KeyName))
+    const FVertexInfo* VertexInfo = VertexBufferPool.Find(KeyName);
+    if (!VertexInfo)
     {
         UE_LOG(ELogLevel::Error, TEXT("UpdateDynamicVertexBuffer 호출: 키 %s에 해당하는 버텍스 버퍼가 없습니다."), *KeyName);
         return;
     }
-    FVertexInfo vbInfo = VertexBufferPool[KeyName];
+    const FVertexInfo vbInfo = *VertexInfo;
 
     D3D11_MAPPED_SUBRESOURCE mapped;
     HRESULT hr = DXDeviceContext->Map(vbInfo.VertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
@@ -17,6 +17,12 @@ FDXDShaderManager::FDXDShaderManager(ID3D11Device* Device)
 
 FDXDShaderManager::~FDXDShaderManager()
 {
+    for (const auto& [FilePath, WatchHandle] : ShaderFileWatches)
+    {
+        FFileWatcher::Unwatch(WatchHandle);
+    }
+    ShaderFileWatches.Empty();
+
     ReleaseAllShader();
 }
 
@@ -139,15 +145,23 @@ void FDXDShaderManager::RegisterShaderForReload(std::wstring Key, std::wstring F
     }
     
     BuildDependency(Info); // 해당 셰이더 파일이 포함하는 셰이더(헤더) 파일을 모두 찾아 graph, date 기록
+    WatchShaderFile(FilePath);
 }
 
 // 모든 리로드 대상 Shader에 대해 업데이트 시도
 void FDXDShaderManager::ReloadAllShaders()  
 {  
+   // 파일 감시가 알려준 변경이 없으면 파일 시스템에 접근하지 않음
+   if (OutdatedShaderKeys.IsEmpty()) { return; }
+
+   TSet<std::wstring> OutdatedKeys = std::move(OutdatedShaderKeys);
+   OutdatedShaderKeys.Empty();
+
    auto Copied = RegisteredShaders;
    bool bAnyUpdated = false;
    for (const auto& Shader : Copied)
    {  
+       if (!OutdatedKeys.Contains(Shader.Key)) { continue; }
        if (!IsOutdatedWithDependency(Shader)) { continue; } // 갱신 필요없으면 skip
 
        const D3D_SHADER_MACRO* definesPtr = Shader.Defines.empty() ? nullptr : Shader.Defines.data();
@@ -175,6 +189,41 @@ void FDXDShaderManager::ReloadAllShaders()
    if (bAnyUpdated) { UpdateDependencyTimestamps(); }
 }
 
+void FDXDShaderManager::WatchShaderFile(const std::wstring& FilePath)
+{
+    if (ShaderFileWatches.Contains(FilePath)) { return; }
+
+    const FFileWatchHandle WatchHandle = FFileWatcher::Watch(FilePath, [this, FilePath](const std::filesystem::path&)
+    {
+        MarkShadersUsingFileOutdated(FilePath);
+    });
+    ShaderFileWatches.Add(FilePath, WatchHandle);
+}
+
+void FDXDShaderManager::MarkShadersUsingFileOutdated(const std::wstring& FilePath)
+{
+    // 메인 셰이더 파일
+    for (const FShaderReloadInfo& Info : RegisteredShaders)
+    {
+        if (Info.FilePath == FilePath)
+        {
+            OutdatedShaderKeys.Add(Info.Key);
+        }
+    }
+
+    // include 파일, 의존성 그래프의 Key는 Shaders/ 기준 경로
+    for (const auto& [IncludeFile, ShaderKeys] : ShaderDependencyGraph)
+    {
+        if (L"Shaders/" + IncludeFile == FilePath)
+        {
+            for (const std::wstring& Key : ShaderKeys)
+            {
+                OutdatedShaderKeys.Add(Key);
+            }
+        }
+    }
+}
+
 
 
 #ifdef Multi_Shader_Include
@@ -208,6 +257,7 @@ void FDXDShaderManager::BuildDependency(const FShaderReloadInfo& Info)
                 {
                     auto currentTime = std::filesystem::last_write_time(fullPath);
                     ShaderTimeStamps.Add(includeFile, currentTime);
+                    WatchShaderFile(fullPath);
 
                     // 중첩 include 탐색 재귀 호출
                     FShaderReloadInfo DummyInfo;
@@ -332,6 +382,7 @@ void FDXDShaderManager::BuildDependency(const FShaderReloadInfo& Info)
                 {
                     auto currentTime = std::filesystem::last_write_time(L"Shaders/"+includeFile);
                     ShaderTimeStamps.Add(includeFile, currentTime);
+                    WatchShaderFile(L"Shaders/" + includeFile);
                 }
             }
         }
@@ -7,6 +7,7 @@
 #include "Container/Map.h"
 #include "Container/Array.h"
 #include "Container/Set.h"
+#include "WindowsFileWatcher.h"
 #include <vector>
 
 //#define Multi_Shader_Include // 중첩 헤더 파일 지원 플래그 (주석 해제시 재귀적으로 include 검사/갱신)
@@ -49,6 +50,10 @@ public:
     void BuildDependency(const FShaderReloadInfo& Info);
     bool IsOutdatedWithDependency(const FShaderReloadInfo& Info);
     void UpdateDependencyTimestamps();
+
+    // File Watch 관련 함수, 파일이 바뀐 프레임에만 해당 셰이더의 타임스탬프를 검사
+    void WatchShaderFile(const std::wstring& FilePath);
+    void MarkShadersUsingFileOutdated(const std::wstring& FilePath);
 private:
     ID3D11Device* DXDDevice;
 
@@ -80,5 +85,9 @@ private:
     TMap<std::wstring, std::filesystem::file_time_type> ShaderTimeStamps;
     TMap<std::wstring, TSet<std::wstring>> ShaderDependencyGraph;
     std::vector<FShaderReloadInfo> RegisteredShaders;
+
+    /** 파일 감시에서 변경을 알려준 셰이더 Key, ReloadAllShaders는 이 셰이더만 검사 */
+    TSet<std::wstring> OutdatedShaderKeys;
+    TMap<std::wstring, FFileWatchHandle> ShaderFileWatches;
 };
 
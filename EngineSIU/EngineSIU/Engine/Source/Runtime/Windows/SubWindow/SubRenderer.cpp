@@ -154,7 +154,7 @@ void FSubRenderer::RenderMesh(FSubCamera& Camera)
 
     if (IndexInfo.IndexBuffer)
     {
-        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, IndexInfo.Format, 0);
     }
 
     if (RenderData->MaterialSubsets.Num() == 0)
@@ -0,0 +1,540 @@
+﻿#include "WindowsFileWatcher.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cwctype>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <Windows.h>
+
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/Set.h"
+#include "UserInterface/Console.h"
+#include "WindowsPlatformTime.h"
+
+
+namespace
+{
+struct FWatchedDirectory
+{
+    /** 정규화한 디렉터리 경로, 끝에 구분자 포함 */
+    std::wstring Path;
+
+    HANDLE Handle = INVALID_HANDLE_VALUE;
+    OVERLAPPED Overlapped = {};
+    bool bReadPending = false;
+
+    /** 알림 대신 수정 시각 비교로 감시 중 */
+    bool bPolling = false;
+
+    /** 감시하는 파일이 없어 읽기를 취소함, 취소 완료를 받은 감시 스레드가 해제 */
+    bool bClosing = false;
+
+    /** ReadDirectoryChangesW가 채우는 FILE_NOTIFY_INFORMATION 목록, DWORD 정렬이 필요함 */
+    alignas(DWORD) uint8 Buffer[16 * 1024];
+};
+
+struct FSubscription
+{
+    std::wstring Path;
+    FWindowsFileWatcher::FCallback Callback;
+};
+
+/** 아래 상태는 모두 Mutex로 보호, 단 읽기가 걸린 동안 디렉터리의 Buffer는 커널이, 완료 뒤에는 감시 스레드가 사용 */
+std::mutex Mutex;
+TArray<std::unique_ptr<FWatchedDirectory>> Directories;
+TMap<FFileWatchHandle, FSubscription> Subscriptions;
+FFileWatchHandle NextHandle = 1;
+
+/** 감시 중인 파일 경로마다 등록된 콜백 수, 감시 스레드는 여기 있는 파일의 변경만 대기열에 넣음 */
+TMap<std::wstring, int32> WatchedFileRefs;
+
+/** 수정 시각 비교로 감시하는 파일의 마지막 수정 시각 */
+TMap<std::wstring, std::filesystem::file_time_type> PolledFiles;
+
+/** 다음 ProcessEvents에서 전달할 파일, 같은 파일의 변경은 하나로 합쳐짐 */
+TSet<std::wstring> PendingChanges;
+
+/** PendingChanges가 비어 있지 않음, 변경이 없는 프레임은 이것만 읽고 끝남 */
+std::atomic<bool> bHasPendingChanges = false;
+
+std::atomic<uint64> NumDrains = 0;
+
+/** 감시 스레드가 마지막으로 변경을 대기열에 넣은 시각 (bench filewatch에서 지연 시간 측정용) */
+std::atomic<uint64> LastChangeCycles = 0;
+
+std::atomic<int32> NumPollingDirectories = 0;
+
+HANDLE CompletionPort = nullptr;
+std::thread WatcherThread;
+std::atomic<bool> bStopWatcher = false;
+
+/** 절대 경로로 바꾸고 구분자와 대소문자를 통일합니다. Windows 경로는 대소문자를 구분하지 않음 */
+std::wstring NormalizePath(const std::filesystem::path& Path)
+{
+    std::error_code ErrorCode;
+    std::filesystem::path Absolute = std::filesystem::absolute(Path, ErrorCode);
+    if (ErrorCode)
+    {
+        Absolute = Path;
+    }
+
+    std::wstring Result = Absolute.lexically_normal().make_preferred().wstring();
+    std::transform(Result.begin(), Result.end(), Result.begin(), [](wchar_t Char) { return static_cast<wchar_t>(std::towlower(Char)); });
+    return Result;
+}
+
+bool IsInDirectory(const std::wstring& FilePath, const std::wstring& DirectoryPath)
+{
+    return FilePath.starts_with(DirectoryPath) && FilePath.find(L'\\', DirectoryPath.size()) == std::wstring::npos;
+}
+
+std::filesystem::file_time_type ReadWriteTime(const std::wstring& FilePath)
+{
+    std::error_code ErrorCode;
+    const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(FilePath, ErrorCode);
+    return ErrorCode ? std::filesystem::file_time_type::min() : WriteTime;
+}
+
+bool IssueRead(FWatchedDirectory& Directory)
+{
+    Directory.Overlapped = {};
+
+    // 저장할 때 임시 파일을 만들고 이름을 바꾸는 편집기도 있으므로 이름 변경도 받음
+    constexpr DWORD NotifyFilter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+    Directory.bReadPending = ReadDirectoryChangesW(
+        Directory.Handle, Directory.Buffer, sizeof(Directory.Buffer), FALSE, NotifyFilter, nullptr, &Directory.Overlapped, nullptr
+    ) != FALSE;
+    return Directory.bReadPending;
+}
+
+/** Mutex를 잡은 상태에서 호출 */
+void PushChangesLocked(const TArray<std::wstring>& ChangedFiles)
+{
+    bool bAnyWatched = false;
+    for (const std::wstring& FilePath : ChangedFiles)
+    {
+        if (WatchedFileRefs.Contains(FilePath))
+        {
+            PendingChanges.Add(FilePath);
+            bAnyWatched = true;
+        }
+    }
+
+    if (bAnyWatched)
+    {
+        LastChangeCycles.store(FPlatformTime::Cycles64());
+        bHasPendingChanges.store(true, std::memory_order_release);
+    }
+}
+
+/** Mutex를 잡은 상태에서 호출 */
+void RemoveDirectoryLocked(const FWatchedDirectory* Directory)
+{
+    const int32 Index = Directories.IndexOfByPredicate([Directory](const std::unique_ptr<FWatchedDirectory>& Existing) { return Existing.get() == Directory; });
+    if (Index != INDEX_NONE)
+    {
+        Directories.RemoveAt(Index);
+    }
+}
+
+/** Mutex를 잡은 상태에서 호출, 알림을 받을 수 없는 디렉터리를 수정 시각 비교로 바꿈 */
+void SwitchToPollingLocked(FWatchedDirectory& Directory)
+{
+    if (Directory.bPolling)
+    {
+        return;
+    }
+
+    if (Directory.Handle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(Directory.Handle);
+        Directory.Handle = INVALID_HANDLE_VALUE;
+    }
+
+    Directory.bPolling = true;
+    NumPollingDirectories.fetch_add(1);
+
+    for (const auto& [FilePath, NumRefs] : WatchedFileRefs)
+    {
+        if (IsInDirectory(FilePath, Directory.Path))
+        {
+            PolledFiles.Add(FilePath, ReadWriteTime(FilePath));
+        }
+    }
+}
+
+void HandleCompletion(FWatchedDirectory& Directory, bool bSucceeded, DWORD NumBytes)
+{
+    // 버퍼는 다음 읽기에 다시 쓰이므로 먼저 경로를 꺼내 둠
+    TArray<std::wstring> ChangedFiles;
+    if (bSucceeded && NumBytes > 0)
+    {
+        const uint8* Cursor = Directory.Buffer;
+        while (true)
+        {
+            const FILE_NOTIFY_INFORMATION* Info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(Cursor);
+            if (Info->Action != FILE_ACTION_REMOVED && Info->Action != FILE_ACTION_RENAMED_OLD_NAME)
+            {
+                std::wstring FileName(Info->FileName, Info->FileNameLength / sizeof(WCHAR));
+                std::transform(FileName.begin(), FileName.end(), FileName.begin(), [](wchar_t Char) { return static_cast<wchar_t>(std::towlower(Char)); });
+                ChangedFiles.Add(Directory.Path + FileName);
+            }
+
+            if (Info->NextEntryOffset == 0)
+            {
+                break;
+            }
+            Cursor += Info->NextEntryOffset;
+        }
+    }
+
+    // Unwatch의 취소와 엇갈리지 않도록 다시 읽기를 거는 것도 잠금 안에서
+    std::lock_guard Lock(Mutex);
+    Directory.bReadPending = false;
+    if (Directory.bClosing)
+    {
+        CloseHandle(Directory.Handle);
+        RemoveDirectoryLocked(&Directory);
+        return;
+    }
+
+    const bool bReissued = bSucceeded && IssueRead(Directory);
+
+    // 버퍼가 넘쳤거나(NumBytes == 0) 감시가 끊기면 어떤 파일이 바뀌었는지 모르므로 디렉터리의 감시 파일을 모두 변경으로 처리
+    if (!bReissued || NumBytes == 0)
+    {
+        if (!bReissued)
+        {
+            SwitchToPollingLocked(Directory);
+        }
+        for (const auto& [FilePath, NumRefs] : WatchedFileRefs)
+        {
+            if (IsInDirectory(FilePath, Directory.Path))
+            {
+                ChangedFiles.Add(FilePath);
+            }
+        }
+    }
+
+    PushChangesLocked(ChangedFiles);
+}
+
+void PollFiles()
+{
+    // 파일 시스템 접근은 잠금 밖에서
+    TArray<std::wstring> FilePaths;
+    {
+        std::lock_guard Lock(Mutex);
+        FilePaths.Reserve(PolledFiles.Num());
+        for (const auto& [FilePath, WriteTime] : PolledFiles)
+        {
+            FilePaths.Add(FilePath);
+        }
+    }
+
+    TArray<std::filesystem::file_time_type> WriteTimes;
+    WriteTimes.Reserve(FilePaths.Num());
+    for (const std::wstring& FilePath : FilePaths)
+    {
+        WriteTimes.Add(ReadWriteTime(FilePath));
+    }
+
+    std::lock_guard Lock(Mutex);
+    TArray<std::wstring> ChangedFiles;
+    for (int32 Index = 0; Index < FilePaths.Num(); ++Index)
+    {
+        std::filesystem::file_time_type* StoredTime = PolledFiles.Find(FilePaths[Index]);
+        if (StoredTime && *StoredTime != WriteTimes[Index])
+        {
+            *StoredTime = WriteTimes[Index];
+            ChangedFiles.Add(FilePaths[Index]);
+        }
+    }
+    PushChangesLocked(ChangedFiles);
+}
+
+void WatcherMain()
+{
+    ULONGLONG LastPollTime = GetTickCount64();
+    while (!bStopWatcher.load())
+    {
+        const DWORD Timeout = NumPollingDirectories.load() > 0 ? FWindowsFileWatcher::PollingIntervalMs : INFINITE;
+
+        DWORD NumBytes = 0;
+        ULONG_PTR Key = 0;
+        OVERLAPPED* Overlapped = nullptr;
+        const BOOL bSucceeded = GetQueuedCompletionStatus(CompletionPort, &NumBytes, &Key, &Overlapped, Timeout);
+        if (bStopWatcher.load())
+        {
+            break;
+        }
+
+        // Overlapped가 없으면 시간 초과이거나 Watch/Shutdown이 깨운 것
+        if (Overlapped)
+        {
+            HandleCompletion(*reinterpret_cast<FWatchedDirectory*>(Key), bSucceeded != FALSE, NumBytes);
+        }
+
+        // 알림이 계속 와서 시간 초과가 나지 않더라도 주기는 지킴
+        const ULONGLONG Now = GetTickCount64();
+        if (NumPollingDirectories.load() > 0 && Now - LastPollTime >= FWindowsFileWatcher::PollingIntervalMs)
+        {
+            LastPollTime = Now;
+            PollFiles();
+        }
+    }
+}
+}
+
+void FWindowsFileWatcher::Initialize()
+{
+    if (CompletionPort)
+    {
+        return;
+    }
+
+    CompletionPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+    if (!CompletionPort)
+    {
+        UE_LOG(ELogLevel::Error, "Failed to create the file watcher completion port");
+        return;
+    }
+
+    bStopWatcher.store(false);
+    WatcherThread = std::thread(WatcherMain);
+}
+
+void FWindowsFileWatcher::Shutdown()
+{
+    if (!CompletionPort)
+    {
+        return;
+    }
+
+    bStopWatcher.store(true);
+    PostQueuedCompletionStatus(CompletionPort, 0, 0, nullptr);
+    WatcherThread.join();
+
+    std::lock_guard Lock(Mutex);
+    for (const std::unique_ptr<FWatchedDirectory>& Directory : Directories)
+    {
+        if (Directory->Handle == INVALID_HANDLE_VALUE)
+        {
+            continue;
+        }
+
+        // 취소가 끝나기 전에 Overlapped와 Buffer를 해제하면 커널이 해제된 메모리에 쓸 수 있으므로 기다림
+        if (Directory->bReadPending)
+        {
+            CancelIoEx(Directory->Handle, &Directory->Overlapped);
+            DWORD NumBytes = 0;
+            GetOverlappedResult(Directory->Handle, &Directory->Overlapped, &NumBytes, TRUE);
+        }
+        CloseHandle(Directory->Handle);
+    }
+
+    CloseHandle(CompletionPort);
+    CompletionPort = nullptr;
+
+    Directories.Empty();
+    Subscriptions.Empty();
+    WatchedFileRefs.Empty();
+    PolledFiles.Empty();
+    PendingChanges.Empty();
+    bHasPendingChanges.store(false);
+    NumPollingDirectories.store(0);
+}
+
+FFileWatchHandle FWindowsFileWatcher::Watch(const std::filesystem::path& FilePath, FCallback Callback, bool bForcePolling)
+{
+    Initialize();
+    if (!CompletionPort)
+    {
+        return 0;
+    }
+
+    const std::wstring NormalizedPath = NormalizePath(FilePath);
+    const std::filesystem::path DirectoryPath = std::filesystem::path(NormalizedPath).parent_path();
+
+    std::error_code ErrorCode;
+    if (!std::filesystem::is_directory(DirectoryPath, ErrorCode))
+    {
+        UE_LOG(ELogLevel::Warning, "Cannot watch %ls: directory does not exist", NormalizedPath.c_str());
+        return 0;
+    }
+
+    std::wstring DirectoryKey = DirectoryPath.wstring();
+    if (!DirectoryKey.ends_with(L'\\'))
+    {
+        DirectoryKey += L'\\';
+    }
+
+    std::lock_guard Lock(Mutex);
+
+    FWatchedDirectory* Directory = nullptr;
+    for (const std::unique_ptr<FWatchedDirectory>& Existing : Directories)
+    {
+        if (Existing->Path == DirectoryKey && !Existing->bClosing)
+        {
+            Directory = Existing.get();
+            break;
+        }
+    }
+
+    if (!Directory)
+    {
+        const int32 Index = Directories.Add(std::make_unique<FWatchedDirectory>());
+        Directory = Directories[Index].get();
+        Directory->Path = DirectoryKey;
+
+        // 읽기를 여기서 바로 걸어야 Watch가 돌아온 뒤의 변경을 놓치지 않음, 완료는 감시 스레드가 받음
+        bool bOpened = false;
+        if (!bForcePolling)
+        {
+            Directory->Handle = CreateFileW(
+                DirectoryKey.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr
+            );
+            bOpened = Directory->Handle != INVALID_HANDLE_VALUE
+                && CreateIoCompletionPort(Directory->Handle, CompletionPort, reinterpret_cast<ULONG_PTR>(Directory), 0)
+                && IssueRead(*Directory);
+        }
+
+        if (!bOpened)
+        {
+            if (!bForcePolling)
+            {
+                UE_LOG(ELogLevel::Warning, "Directory change notifications unavailable for %ls, polling every %u ms", DirectoryKey.c_str(), PollingIntervalMs);
+            }
+            SwitchToPollingLocked(*Directory);
+
+            // 무한 대기 중인 감시 스레드가 주기적으로 깨어나도록 함
+            PostQueuedCompletionStatus(CompletionPort, 0, 0, nullptr);
+        }
+    }
+
+    const FFileWatchHandle Handle = NextHandle++;
+    Subscriptions.Emplace(Handle, FSubscription{ NormalizedPath, std::move(Callback) });
+
+    int32& NumRefs = WatchedFileRefs.FindOrAdd(NormalizedPath);
+    if (NumRefs++ == 0 && Directory->bPolling)
+    {
+        PolledFiles.Add(NormalizedPath, ReadWriteTime(NormalizedPath));
+    }
+
+    return Handle;
+}
+
+void FWindowsFileWatcher::Unwatch(FFileWatchHandle Handle)
+{
+    if (Handle == 0)
+    {
+        return;
+    }
+
+    std::lock_guard Lock(Mutex);
+    const FSubscription* Subscription = Subscriptions.Find(Handle);
+    if (!Subscription)
+    {
+        return;
+    }
+
+    const std::wstring FilePath = Subscription->Path;
+    Subscriptions.Remove(Handle);
+
+    int32* NumRefs = WatchedFileRefs.Find(FilePath);
+    if (!NumRefs || --(*NumRefs) > 0)
+    {
+        return;
+    }
+    WatchedFileRefs.Remove(FilePath);
+    PolledFiles.Remove(FilePath);
+
+    // 디렉터리에 감시하는 파일이 남지 않았으면 감시를 닫아, 디렉터리를 지우거나 옮길 수 있게 함
+    const std::wstring DirectoryPath = FilePath.substr(0, FilePath.find_last_of(L'\\') + 1);
+    for (const auto& [WatchedPath, WatchedRefs] : WatchedFileRefs)
+    {
+        if (IsInDirectory(WatchedPath, DirectoryPath))
+        {
+            return;
+        }
+    }
+
+    for (const std::unique_ptr<FWatchedDirectory>& Directory : Directories)
+    {
+        if (Directory->Path != DirectoryPath || Directory->bClosing)
+        {
+            continue;
+        }
+
+        if (Directory->bPolling)
+        {
+            NumPollingDirectories.fetch_sub(1);
+            RemoveDirectoryLocked(Directory.get());
+        }
+        else
+        {
+            // 완료 통지를 받은 감시 스레드가 핸들을 닫고 해제함
+            Directory->bClosing = true;
+            CancelIoEx(Directory->Handle, &Directory->Overlapped);
+        }
+        return;
+    }
+}
+
+int32 FWindowsFileWatcher::ProcessEvents()
+{
+    if (!bHasPendingChanges.load(std::memory_order_acquire))
+    {
+        return 0;
+    }
+
+    TArray<FFileWatchHandle> Handles;
+    {
+        std::lock_guard Lock(Mutex);
+        bHasPendingChanges.store(false, std::memory_order_relaxed);
+
+        for (const auto& [Handle, Subscription] : Subscriptions)
+        {
+            if (PendingChanges.Contains(Subscription.Path))
+            {
+                Handles.Add(Handle);
+            }
+        }
+        PendingChanges.Empty();
+    }
+    NumDrains.fetch_add(1);
+
+    // 콜백 안에서 Watch/Unwatch를 호출할 수 있도록 잠금 밖에서 호출하고, 그 사이 해제된 콜백은 건너뜀
+    int32 NumCalled = 0;
+    for (const FFileWatchHandle Handle : Handles)
+    {
+        FSubscription Subscription;
+        {
+            std::lock_guard Lock(Mutex);
+            const FSubscription* Found = Subscriptions.Find(Handle);
+            if (!Found)
+            {
+                continue;
+            }
+            Subscription = *Found;
+        }
+
+        Subscription.Callback(Subscription.Path);
+        ++NumCalled;
+    }
+    return NumCalled;
+}
+
+uint64 FWindowsFileWatcher::GetNumDrains()
+{
+    return NumDrains.load();
+}
+
+uint64 FWindowsFileWatcher::GetLastChangeCycles()
+{
+    return LastChangeCycles.load();
+}
@@ -0,0 +1,64 @@
+﻿#pragma once
+#include <filesystem>
+#include <functional>
+
+#include "HAL/PlatformType.h"
+
+
+/** Watch가 돌려주는 감시 핸들, 0은 유효하지 않음 */
+using FFileWatchHandle = uint32;
+
+/**
+ * 엔진 전체가 함께 쓰는 파일 변경 감시 서비스입니다.
+ * 감시할 파일의 디렉터리마다 ReadDirectoryChangesW를 걸어 두고, 감시 스레드가 변경된 파일을 대기열에 모읍니다.
+ * 디렉터리를 열 수 없거나 알림을 받을 수 없으면 감시 스레드에서 수정 시각을 주기적으로 비교하는 방식으로 바뀝니다.
+ * 대기열은 ProcessEvents에서 프레임마다 한 번 비우며, 변경이 없는 프레임은 원자 변수 하나만 읽고 끝납니다.
+ *
+ * @note 콜백은 ProcessEvents를 호출한 스레드(메인 스레드)에서 호출됩니다.
+ * @note 디렉터리 감시는 그 디렉터리에서 감시하는 파일이 남아 있는 동안 유지되고, 마지막 파일을 Unwatch하면 닫힙니다.
+ */
+class FWindowsFileWatcher
+{
+public:
+    using FCallback = std::function<void(const std::filesystem::path&)>;
+
+    /** 알림을 쓸 수 없는 디렉터리에서 수정 시각을 비교하는 간격 */
+    static constexpr uint32 PollingIntervalMs = 100;
+
+    /** 감시 스레드를 시작합니다. 초기화 전에 Watch를 호출하면 그때 초기화됩니다. */
+    static void Initialize();
+
+    /** 감시 스레드를 멈추고 디렉터리 감시를 모두 닫습니다. 아직 전달되지 않은 변경은 버립니다. */
+    static void Shutdown();
+
+    /**
+     * 파일의 변경(수정, 생성, 이름 변경으로 덮어쓰기)을 감시합니다.
+     * @param FilePath 감시할 파일, 아직 없어도 디렉터리가 있으면 감시 가능
+     * @param Callback 변경된 프레임의 ProcessEvents에서 한 번 호출됨
+     * @param bForcePolling 알림 대신 수정 시각 비교로 감시 (디렉터리를 처음 감시할 때만 적용)
+     * @return 감시 핸들, 디렉터리가 없으면 0
+     */
+    static FFileWatchHandle Watch(const std::filesystem::path& FilePath, FCallback Callback, bool bForcePolling = false);
+
+    /**
+     * 감시 핸들의 콜백 등록을 해제합니다.
+     * 디렉터리에서 감시하는 마지막 파일이었다면 디렉터리 감시도 닫아, 디렉터리를 지우거나 옮길 수 있게 합니다.
+     * 알림 방식의 감시는 감시 스레드가 취소 완료를 받은 뒤 핸들을 닫습니다.
+     * @param Handle Watch가 돌려준 핸들, 0이나 이미 해제된 핸들은 무시
+     */
+    static void Unwatch(FFileWatchHandle Handle);
+
+    /**
+     * 지난 호출 이후 변경된 파일의 콜백을 호출합니다. 같은 파일이 여러 번 바뀌어도 한 번만 호출됩니다.
+     * @return 호출한 콜백 수
+     */
+    static int32 ProcessEvents();
+
+    /** ProcessEvents가 대기열을 실제로 비운 횟수 (변경이 없던 호출은 세지 않음) */
+    static uint64 GetNumDrains();
+
+    /** 감시 스레드가 마지막으로 변경을 대기열에 넣은 시각 (FPlatformTime::Cycles64) */
+    static uint64 GetLastChangeCycles();
+};
+
+typedef FWindowsFileWatcher FFileWatcher;
@@ -0,0 +1,70 @@
+﻿#include "WindowsMappedFile.h"
+#include <Windows.h>
+
+
+FWindowsMappedFile::~FWindowsMappedFile()
+{
+    Close();
+}
+
+bool FWindowsMappedFile::Open(const std::filesystem::path& FilePath)
+{
+    Close();
+
+    HANDLE File = CreateFileW(
+        FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+    );
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER FileSize;
+    if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart == 0)
+    {
+        CloseHandle(File);
+        return false;
+    }
+
+    HANDLE Mapping = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (Mapping == nullptr)
+    {
+        CloseHandle(File);
+        return false;
+    }
+
+    const void* View = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+    if (View == nullptr)
+    {
+        CloseHandle(Mapping);
+        CloseHandle(File);
+        return false;
+    }
+
+    FileHandle = File;
+    MappingHandle = Mapping;
+    Data = static_cast<const uint8*>(View);
+    Size = FileSize.QuadPart;
+    return true;
+}
+
+void FWindowsMappedFile::Close()
+{
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+        Data = nullptr;
+    }
+    if (MappingHandle)
+    {
+        CloseHandle(MappingHandle);
+        MappingHandle = nullptr;
+    }
+    if (FileHandle)
+    {
+        CloseHandle(FileHandle);
+        FileHandle = nullptr;
+    }
+    Size = 0;
+}
@@ -0,0 +1,42 @@
+﻿#pragma once
+#include <filesystem>
+
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 파일 전체를 읽기 전용으로 메모리에 매핑합니다.
+ * 파일을 버퍼로 복사하지 않고 OS의 페이지 캐시를 그대로 읽으므로, 큰 파일을 한 번 훑어 파싱할 때 사용합니다.
+ *
+ * @note 매핑된 메모리는 Close되거나 소멸될 때까지만 유효합니다.
+ */
+class FWindowsMappedFile
+{
+public:
+    FWindowsMappedFile() = default;
+    ~FWindowsMappedFile();
+
+    FWindowsMappedFile(const FWindowsMappedFile&) = delete;
+    FWindowsMappedFile& operator=(const FWindowsMappedFile&) = delete;
+
+    /**
+     * 파일을 매핑합니다. 이미 열려 있으면 먼저 닫습니다.
+     * @return 성공 여부, 빈 파일은 매핑할 수 없으므로 실패
+     */
+    bool Open(const std::filesystem::path& FilePath);
+    void Close();
+
+    bool IsOpen() const { return Data != nullptr; }
+
+    const uint8* GetData() const { return Data; }
+    int64 GetSize() const { return Size; }
+
+private:
+    void* FileHandle = nullptr;
+    void* MappingHandle = nullptr;
+
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+};
+
+typedef FWindowsMappedFile FMappedFile;
@@ -1,6 +1,6 @@
 #include "LuaScriptComponent.h"
-#include "LuaBindingHelpers.h"
 #include "LuaScriptFileUtils.h"
+#include "LuaScriptManager.h"
 #include "World/World.h"
 #include "Engine/EditorEngine.h"
 #include "Runtime/Engine/Classes/GameFramework/Actor.h"
@@ -8,10 +8,13 @@
 
 ULuaScriptComponent::ULuaScriptComponent()
 {
+    // 스크립트는 World마다 하나인 Lua VM을 함께 쓰고, VM은 스레드에 안전하지 않으므로 메인 스레드에서 Tick
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 ULuaScriptComponent::~ULuaScriptComponent()
 {
+    FFileWatcher::Unwatch(ScriptWatchHandle);
 }
 
 void ULuaScriptComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -43,16 +46,29 @@ void ULuaScriptComponent::BeginPlay()
 
     InitializeLuaState();
 
+    if (ScriptWatchHandle == 0 && !ScriptPath.IsEmpty())
+    {
+        ScriptWatchHandle = FFileWatcher::Watch(ScriptPath.ToWideString(), [this](const std::filesystem::path&)
+        {
+            bReloadPending = true;
+        });
+    }
+
     DelegateHandles.Empty();
     
-    CallLuaFunction("BeginPlay");
+    CallLuaFunction(LuaBeginPlay);
 }
 
 void ULuaScriptComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 { 
     Super::EndPlay(EndPlayReason);
 
-    CallLuaFunction("EndPlay");
+    CallLuaFunction(LuaEndPlay);
+    ResetLuaState();
+
+    FFileWatcher::Unwatch(ScriptWatchHandle);
+    ScriptWatchHandle = 0;
+    bReloadPending = false;
 }
 
 UObject* ULuaScriptComponent::Duplicate(UObject* InOuter)
@@ -110,103 +126,62 @@ void ULuaScriptComponent::InitializeLuaState()
         }
     }*/
 
-    LuaState.open_libraries();
-    BindEngineAPI();
+    ResetLuaState();
 
-    try {
-        LuaState.script_file((*ScriptPath));
-        bScriptValid = true;
-        const std::wstring FilePath = ScriptPath.ToWideString();
-        LastWriteTime = std::filesystem::last_write_time(FilePath);
-    }
-    catch (const sol::error& err) {
-        UE_LOG(ELogLevel::Error, TEXT("Lua Initialization error: %s"), err.what());
+    FLuaScriptManager* LuaScriptManager = GetOwner()->GetWorld()->GetLuaScriptManager();
+    ScriptEnv = LuaScriptManager->CreateScriptEnvironment(ScriptPath, GetOwner());
+    bScriptValid = ScriptEnv.valid();
+    if (!bScriptValid)
+    {
+        return;
     }
 
-    CallLuaFunction("InitializeLua");
-}
-
-void ULuaScriptComponent::BindEngineAPI()
-{
-    // [1] 바인딩 전 글로벌 키 스냅샷
-    TArray<FString> Before = LuaDebugHelper::CaptureGlobalNames(LuaState);
-
-    LuaBindingHelpers::BindPrint(LuaState);    // 0) Print 바인딩
-    LuaBindingHelpers::BindFVector(LuaState);   // 2) FVector 바인딩
-    LuaBindingHelpers::BindFRotator(LuaState);
-    LuaBindingHelpers::BindController(LuaState);
-    
-    auto ActorType = LuaState.new_usertype<AActor>("Actor",
-        sol::constructors<>(),
-        "Location", sol::property(
-            &AActor::GetActorLocation,
-            &AActor::SetActorLocation
-        ),
-        "Rotator", sol::property(
-            &AActor::GetActorRotation,
-            &AActor::SetActorRotation
-        ),
-        "Forward", &AActor::GetActorForwardVector
-    );
-    
-    // 프로퍼티 바인딩
-    LuaState["actor"] = GetOwner();
+    // 스크립트가 전역 테이블에 같은 이름을 두더라도 이 Actor의 환경에 정의된 함수만 사용
+    LuaBeginPlay = ScriptEnv.raw_get<sol::protected_function>("BeginPlay");
+    LuaTick = ScriptEnv.raw_get<sol::protected_function>("Tick");
+    LuaEndPlay = ScriptEnv.raw_get<sol::protected_function>("EndPlay");
 
-    // [2] 바인딩 후, 새로 추가된 글로벌 키만 자동 로그
-    LuaDebugHelper::LogNewBindings(LuaState, Before);
+    CallLuaFunction("InitializeLua");
 }
 
-bool ULuaScriptComponent::CheckFileModified()
+void ULuaScriptComponent::ResetLuaState()
 {
-    if (ScriptPath.IsEmpty()) return false;
-
-    try {
-        std::wstring FilePath = ScriptPath.ToWideString();
-        const auto CurrentTime = std::filesystem::last_write_time(FilePath);
-
-        if (CurrentTime > LastWriteTime) {
-            LastWriteTime = CurrentTime;
-            return true;
-        }
-    }
-    catch (const std::exception& e) {
-        UE_LOG(ELogLevel::Error, TEXT("Failed to check lua script file"));
-    }
-    return false;
+    LuaBeginPlay = sol::protected_function();
+    LuaTick = sol::protected_function();
+    LuaEndPlay = sol::protected_function();
+    ScriptEnv = sol::environment();
+    bScriptValid = false;
 }
 
 void ULuaScriptComponent::ReloadScript()
 {
     sol::table PersistentData;
-    if (bScriptValid && LuaState["PersistentData"].valid()) {
-        PersistentData = LuaState["PersistentData"];
+    if (bScriptValid) {
+        PersistentData = ScriptEnv.raw_get<sol::table>("PersistentData");
     }
 
-    LuaState = sol::state();
     InitializeLuaState();
 
-    if (PersistentData.valid()) {
-        LuaState["PersistentData"] = PersistentData;
+    if (bScriptValid && PersistentData.valid()) {
+        ScriptEnv["PersistentData"] = PersistentData;
     }
 
     CallLuaFunction("OnHotReload");
-    CallLuaFunction("BeginPlay");
+    CallLuaFunction(LuaBeginPlay);
 }
 
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
 
-    CallLuaFunction("Tick", DeltaTime);
-
-    if (CheckFileModified()) {
-        try {
-            ReloadScript();
-            UE_LOG(ELogLevel::Display, TEXT("Lua script reloaded"));
-        }
-        catch (const sol::error& e) {
-            UE_LOG(ELogLevel::Error, TEXT("Failed to reload lua script"));
-        }
+    // 파일 감시가 변경을 알려준 경우에만 리로드하므로, 변경이 없는 프레임에는 파일 시스템에 접근하지 않음
+    if (bReloadPending)
+    {
+        bReloadPending = false;
+        ReloadScript();
+        UE_LOG(ELogLevel::Display, TEXT("Lua script reloaded"));
     }
+
+    CallLuaFunction(LuaTick, DeltaTime);
 }
 
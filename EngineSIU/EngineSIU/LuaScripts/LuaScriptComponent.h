@@ -2,7 +2,7 @@
 #include "Runtime/CoreUObject/UObject/ObjectMacros.h"
 #include "Components/ActorComponent.h"
 #include <sol/sol.hpp>
-#include <filesystem>
+#include "WindowsFileWatcher.h"
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnLocationTenUp, const FVector);
 
@@ -28,8 +28,11 @@ public:
     virtual UObject* Duplicate(UObject* InOuter) override;
     virtual void InitializeComponent() override;
 
-    // Lua 함수 호출 메서드
+    // Lua 함수 호출 메서드, 스크립트 환경에서 이름으로 찾아 호출
     template<typename... Arguments> void CallLuaFunction(const FString& FunctionName, Arguments... args);
+
+    // 미리 찾아 둔 Lua 함수 호출, 오류는 로그로 출력
+    template<typename... Arguments> void CallLuaFunction(const sol::protected_function& Function, Arguments... args);
     
     FString GetScriptPath() const { return ScriptPath; }
     void SetScriptPath(const FString& InScriptPath);
@@ -45,30 +48,55 @@ public:
     FOnLocationTenUp FOnLocationTenUp;
     
 private:
-    // Lua 환경 초기화
+    // World의 Lua VM에 이 Actor의 스크립트 환경을 만들고, 자주 부르는 함수를 찾아 둠
     void InitializeLuaState();
 
-    // Lua-Engine 바인딩
-    void BindEngineAPI();
+    // 스크립트 환경과 함수 참조 해제
+    void ResetLuaState();
 
     FString ScriptPath;
     FString DisplayName;
 
     TArray<FDelegateHandle> DelegateHandles;
     
-    sol::state LuaState;
+    /** World의 Lua VM 안에서 이 Actor만 쓰는 전역 테이블 */
+    sol::environment ScriptEnv;
+
+    /** 매 호출마다 문자열로 찾지 않도록 BeginPlay에서 한 번 찾아 둠, 스크립트에 없으면 유효하지 않음 */
+    sol::protected_function LuaBeginPlay;
+    sol::protected_function LuaTick;
+    sol::protected_function LuaEndPlay;
+
     bool bScriptValid = false;
 
-    std::filesystem::file_time_type LastWriteTime;
-    bool CheckFileModified();
+    /** 스크립트 파일 감시, 파일이 바뀌면 bReloadPending을 켜고 다음 Tick에서 리로드 */
+    FFileWatchHandle ScriptWatchHandle = 0;
+    bool bReloadPending = false;
+
     void ReloadScript();
 };
 
 template <typename ... Arguments>
 void ULuaScriptComponent::CallLuaFunction(const FString& FunctionName, Arguments... args)
 {
-    if (bScriptValid && LuaState[*FunctionName].valid())
+    if (bScriptValid)
+    {
+        CallLuaFunction(ScriptEnv.raw_get<sol::protected_function>(*FunctionName), args...);
+    }
+}
+
+template <typename ... Arguments>
+void ULuaScriptComponent::CallLuaFunction(const sol::protected_function& Function, Arguments... args)
+{
+    if (!bScriptValid || !Function.valid())
+    {
+        return;
+    }
+
+    const sol::protected_function_result Result = Function(args...);
+    if (!Result.valid())
     {
-        LuaState[*FunctionName](args...);
+        const sol::error Error = Result;
+        UE_LOG(ELogLevel::Error, TEXT("Lua runtime error: %s"), Error.what());
     }
 }
@@ -0,0 +1,124 @@
+#include "LuaScriptManager.h"
+
+#include "LuaBindingHelpers.h"
+#include "GameFramework/Actor.h"
+
+FLuaScriptManager::FLuaScriptManager()
+{
+    LuaState.open_libraries();
+
+    // 바인딩 전 글로벌 키 스냅샷을 찍고, 바인딩 후 새로 추가된 글로벌 키만 로그
+    TArray<FString> Before = LuaDebugHelper::CaptureGlobalNames(LuaState);
+    BindEngineAPI(LuaState);
+    LuaDebugHelper::LogNewBindings(LuaState, Before);
+}
+
+FLuaScriptManager::~FLuaScriptManager()
+{
+    for (const auto& [ScriptPath, Compiled] : CompiledScripts)
+    {
+        FFileWatcher::Unwatch(Compiled.WatchHandle);
+    }
+}
+
+sol::environment FLuaScriptManager::CreateScriptEnvironment(const FString& ScriptPath, AActor* Actor)
+{
+    const sol::bytecode* Code = FindOrCompileScript(ScriptPath);
+    if (!Code)
+    {
+        return sol::environment();
+    }
+
+    // '@'로 시작하는 Chunk 이름은 오류 메시지에 파일 경로로 표시됨
+    return RunInNewEnvironment(*Code, "@" + std::string(*ScriptPath), Actor);
+}
+
+int32 FLuaScriptManager::GetMemoryUsageKB() const
+{
+    return lua_gc(LuaState.lua_state(), LUA_GCCOUNT, 0);
+}
+
+void FLuaScriptManager::BindEngineAPI(sol::state& Lua)
+{
+    LuaBindingHelpers::BindPrint(Lua);    // 0) Print 바인딩
+    LuaBindingHelpers::BindFVector(Lua);   // 2) FVector 바인딩
+    LuaBindingHelpers::BindFRotator(Lua);
+    LuaBindingHelpers::BindController(Lua);
+
+    Lua.new_usertype<AActor>("Actor",
+        sol::constructors<>(),
+        "Location", sol::property(
+            &AActor::GetActorLocation,
+            &AActor::SetActorLocation
+        ),
+        "Rotator", sol::property(
+            &AActor::GetActorRotation,
+            &AActor::SetActorRotation
+        ),
+        "Forward", &AActor::GetActorForwardVector
+    );
+}
+
+const sol::bytecode* FLuaScriptManager::FindOrCompileScript(const FString& ScriptPath)
+{
+    if (const FCompiledScript* Cached = CompiledScripts.Find(ScriptPath))
+    {
+        if (!Cached->bOutdated)
+        {
+            return &Cached->Code;
+        }
+    }
+
+    sol::load_result Chunk = LuaState.load_file(std::string(*ScriptPath));
+    if (!Chunk.valid())
+    {
+        const sol::error Error = Chunk;
+        UE_LOG(ELogLevel::Error, TEXT("Lua compile error: %s"), Error.what());
+        return nullptr;
+    }
+
+    // 디버그 정보(_ENV 같은 Upvalue 이름 포함)를 남겨야 set_environment가 동작함
+    const sol::protected_function Function = Chunk;
+    FCompiledScript& Compiled = CompiledScripts.FindOrAdd(ScriptPath);
+    Compiled.Code = Function.dump();
+    Compiled.bOutdated = false;
+    if (Compiled.WatchHandle == 0)
+    {
+        Compiled.WatchHandle = FFileWatcher::Watch(ScriptPath.ToWideString(), [this, ScriptPath](const std::filesystem::path&)
+        {
+            if (FCompiledScript* Outdated = CompiledScripts.Find(ScriptPath))
+            {
+                Outdated->bOutdated = true;
+            }
+        });
+    }
+    return &Compiled.Code;
+}
+
+sol::environment FLuaScriptManager::RunInNewEnvironment(const sol::bytecode& Code, const std::string& ChunkName, AActor* Actor)
+{
+    // 같은 바이트코드라도 load할 때마다 별도의 함수가 만들어지므로, 환경을 바꿔도 다른 Actor에 영향이 없음
+    sol::load_result Chunk = LuaState.load(Code.as_string_view(), ChunkName, sol::load_mode::binary);
+    if (!Chunk.valid())
+    {
+        const sol::error Error = Chunk;
+        UE_LOG(ELogLevel::Error, TEXT("Lua load error: %s"), Error.what());
+        return sol::environment();
+    }
+
+    sol::environment Environment(LuaState, sol::create, LuaState.globals());
+    Environment["actor"] = Actor;
+
+    sol::protected_function Function = Chunk;
+    sol::set_environment(Environment, Function);
+
+    const sol::protected_function_result Result = Function();
+    if (!Result.valid())
+    {
+        const sol::error Error = Result;
+        UE_LOG(ELogLevel::Error, TEXT("Lua Initialization error: %s"), Error.what());
+        return sol::environment();
+    }
+
+    return Environment;
+}
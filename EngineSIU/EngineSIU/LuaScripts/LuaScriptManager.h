@@ -0,0 +1,59 @@
+#pragma once
+#include <sol/sol.hpp>
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "WindowsFileWatcher.h"
+
+class AActor;
+
+/**
+ * World마다 하나씩 두는 Lua VM
+ * 바인딩은 전역 테이블에 한 번만 등록하고, 스크립트는 Actor마다 따로 만든 환경 테이블에서 실행합니다.
+ * 환경은 전역 테이블을 __index로 보므로 바인딩은 함께 쓰고, 스크립트가 정의한 변수와 함수는 그 Actor의 환경에만 남습니다.
+ * VM은 스레드에 안전하지 않으므로 메인 스레드에서만 사용해야 합니다.
+ */
+class FLuaScriptManager
+{
+public:
+    FLuaScriptManager();
+    ~FLuaScriptManager();
+
+    FLuaScriptManager(const FLuaScriptManager&) = delete;
+    FLuaScriptManager& operator=(const FLuaScriptManager&) = delete;
+
+    /**
+     * 스크립트 파일을 Actor 전용 환경에서 실행합니다.
+     * 같은 파일은 한 번만 컴파일하고, 파일이 바뀌기 전까지는 캐시한 바이트코드를 불러옵니다.
+     * @param Actor 스크립트에서 actor로 접근할 Actor
+     * @return 스크립트를 실행한 환경, 실패하면 유효하지 않은 환경
+     */
+    sol::environment CreateScriptEnvironment(const FString& ScriptPath, AActor* Actor);
+
+    sol::state& GetState() { return LuaState; }
+
+    /** Lua 힙 사용량 (KB) */
+    int32 GetMemoryUsageKB() const;
+
+    /** 엔진 타입과 함수를 Lua 전역 테이블에 바인딩합니다. */
+    static void BindEngineAPI(sol::state& Lua);
+
+private:
+    struct FCompiledScript
+    {
+        sol::bytecode Code;
+
+        /** 파일이 바뀌면 bOutdated를 켜서 다음 요청에서 다시 컴파일 */
+        FFileWatchHandle WatchHandle = 0;
+        bool bOutdated = false;
+    };
+
+    /** 캐시한 바이트코드를 반환하고, 없거나 파일이 바뀌었으면 다시 컴파일합니다. 실패하면 nullptr */
+    const sol::bytecode* FindOrCompileScript(const FString& ScriptPath);
+
+    /** 바이트코드를 새 함수로 불러와 새 환경에서 실행합니다. */
+    sol::environment RunInNewEnvironment(const sol::bytecode& Code, const std::string& ChunkName, AActor* Actor);
+
+    sol::state LuaState;
+
+    TMap<FString, FCompiledScript> CompiledScripts;
+};
@@ -14,22 +14,87 @@ cbuffer MaterialConstants : register(b1)
 #include "Light.hlsl"
 #endif
 
+#ifdef MESH_INSTANCING
+// Slot 1, D3D11_INPUT_PER_INSTANCE_DATA
+struct VS_INPUT_Instance
+{
+    float4 World0 : INSTANCE_WORLD0;
+    float4 World1 : INSTANCE_WORLD1;
+    float4 World2 : INSTANCE_WORLD2;
+    float4 World3 : INSTANCE_WORLD3;
+    float4 InverseTransposedWorld0 : INSTANCE_NORMAL0;
+    float4 InverseTransposedWorld1 : INSTANCE_NORMAL1;
+    float4 InverseTransposedWorld2 : INSTANCE_NORMAL2;
+    float4 InverseTransposedWorld3 : INSTANCE_NORMAL3;
+};
+#endif
+
+#ifdef GPU_SKINNING
+#define MAX_SKINNING_BONES 128
+
+// Slot 1, 정점별 본 영향 (FSkeletalMeshBoneWeight)
+struct VS_INPUT_Skin
+{
+    uint4 BoneIndices : BONE_INDICES;
+    float4 BoneWeights : BONE_WEIGHTS;
+};
 
+cbuffer BonePaletteConstants : register(b7)
+{
+    row_major matrix BonePalette[MAX_SKINNING_BONES];
+};
+#endif
+
+
+#ifdef MESH_INSTANCING
+PS_INPUT_StaticMesh mainVS(VS_INPUT_StaticMesh Input, VS_INPUT_Instance Instance)
+#elif defined(GPU_SKINNING)
+PS_INPUT_StaticMesh mainVS(VS_INPUT_StaticMesh Input, VS_INPUT_Skin Skin)
+#else
 PS_INPUT_StaticMesh mainVS(VS_INPUT_StaticMesh Input)
+#endif
 {
     PS_INPUT_StaticMesh Output;
 
+#ifdef GPU_SKINNING
+    // 영향이 없는 정점은 가중치 합이 0이므로 바인드 포즈를 그대로 사용
+    float WeightSum = dot(Skin.BoneWeights, float4(1, 1, 1, 1));
+    if (WeightSum > 0.0)
+    {
+        float4x4 SkinMatrix = BonePalette[Skin.BoneIndices.x] * Skin.BoneWeights.x
+            + BonePalette[Skin.BoneIndices.y] * Skin.BoneWeights.y
+            + BonePalette[Skin.BoneIndices.z] * Skin.BoneWeights.z
+            + BonePalette[Skin.BoneIndices.w] * Skin.BoneWeights.w;
+
+        Input.Position = mul(float4(Input.Position, 1.0), SkinMatrix).xyz;
+        Input.Normal = normalize(mul(Input.Normal, (float3x3)SkinMatrix));
+        Input.Tangent.xyz = mul(Input.Tangent.xyz, (float3x3)SkinMatrix);
+    }
+#endif
+
+#ifdef MESH_INSTANCING
+    // 행 단위로 들어오므로 생성자 인자 순서가 곧 행
+    float4x4 World = float4x4(Instance.World0, Instance.World1, Instance.World2, Instance.World3);
+    float4x4 NormalMatrix = float4x4(
+        Instance.InverseTransposedWorld0, Instance.InverseTransposedWorld1,
+        Instance.InverseTransposedWorld2, Instance.InverseTransposedWorld3
+    );
+#else
+    float4x4 World = WorldMatrix;
+    float4x4 NormalMatrix = InverseTransposedWorld;
+#endif
+
     Output.Position = float4(Input.Position, 1.0);
-    Output.Position = mul(Output.Position, WorldMatrix);
+    Output.Position = mul(Output.Position, World);
     Output.WorldPosition = Output.Position.xyz;
     
     Output.Position = mul(Output.Position, ViewMatrix);
     Output.Position = mul(Output.Position, ProjectionMatrix);
     
-    Output.WorldNormal = mul(Input.Normal, (float3x3)InverseTransposedWorld);
+    Output.WorldNormal = mul(Input.Normal, (float3x3)NormalMatrix);
 
     // Begin Tangent
-    float3 WorldTangent = mul(Input.Tangent.xyz, (float3x3)WorldMatrix);
+    float3 WorldTangent = mul(Input.Tangent.xyz, (float3x3)World);
     WorldTangent = normalize(WorldTangent);
     WorldTangent = normalize(WorldTangent - Output.WorldNormal * dot(Output.WorldNormal, WorldTangent));
 